@@ -0,0 +1,455 @@
+/**
+ *  @brief      Native unit tests for SimSIMD, comparing the dispatched kernels against the serial ones.
+ *  @file       test.c
+ *  @date       October 15, 2026
+ */
+#include <assert.h> // `assert`
+#include <math.h>   // `fabs`
+#include <stdio.h>  // `printf`
+#include <stdlib.h> // `malloc`, `rand`
+#include <string.h> // `memcmp`, `memset`
+
+#include <simsimd/simsimd.h>
+
+/// Dimensions of the tested vectors, mostly odd, to exercise the tail handling of the kernels.
+static simsimd_size_t const test_dimensions[] = {1, 3, 7, 15, 16, 17, 31, 63, 97, 130};
+
+/// Numbers of rows in the tested batches, to exercise the kernels comparing several rows at a time.
+static simsimd_size_t const test_counts[] = {1, 2, 3, 4, 5, 7, 9, 33};
+
+/// Number of bytes in every scalar of the given type, or in every word of the binary vectors.
+static simsimd_size_t datatype_bytes(simsimd_datatype_t datatype) {
+    switch (datatype) {
+    case simsimd_datatype_f64_k: return sizeof(simsimd_f64_t);
+    case simsimd_datatype_f32_k: return sizeof(simsimd_f32_t);
+    case simsimd_datatype_f16_k: return sizeof(simsimd_f16_t);
+    case simsimd_datatype_bf16_k: return sizeof(simsimd_bf16_t);
+    default: return 1;
+    }
+}
+
+/// Fills a buffer of the given type with random values in [-1, 1] for floats, or random bits otherwise.
+static void fill_random(simsimd_datatype_t datatype, void* data, simsimd_size_t count) {
+    for (simsimd_size_t i = 0; i != count; ++i) {
+        simsimd_f32_t value = (simsimd_f32_t)rand() / (simsimd_f32_t)RAND_MAX * 2 - 1;
+        switch (datatype) {
+        case simsimd_datatype_f64_k: ((simsimd_f64_t*)data)[i] = value; break;
+        case simsimd_datatype_f32_k: ((simsimd_f32_t*)data)[i] = value; break;
+        default: ((unsigned char*)data)[i] = (unsigned char)rand(); break;
+        }
+    }
+}
+
+/// Fills a buffer of the given type with a random discrete probability distribution without zero entries.
+static void fill_distribution(simsimd_datatype_t datatype, void* data, simsimd_size_t count) {
+    simsimd_f64_t sum = 0;
+    for (simsimd_size_t i = 0; i != count; ++i) {
+        simsimd_f64_t value = (simsimd_f64_t)(rand() % 1000 + 1);
+        sum += value;
+        switch (datatype) {
+        case simsimd_datatype_f64_k: ((simsimd_f64_t*)data)[i] = value; break;
+        case simsimd_datatype_f32_k: ((simsimd_f32_t*)data)[i] = (simsimd_f32_t)value; break;
+        default: assert(0);
+        }
+    }
+    for (simsimd_size_t i = 0; i != count; ++i)
+        switch (datatype) {
+        case simsimd_datatype_f64_k: ((simsimd_f64_t*)data)[i] /= sum; break;
+        case simsimd_datatype_f32_k: ((simsimd_f32_t*)data)[i] /= (simsimd_f32_t)sum; break;
+        default: assert(0);
+        }
+}
+
+/// Checks, that two distances match up to the given tolerance, relative to the larger of one and `expected`.
+static void assert_close(simsimd_f32_t actual, simsimd_f32_t expected, simsimd_f32_t tolerance) {
+    simsimd_f64_t scale = fabs(expected) > 1 ? fabs(expected) : 1;
+    if (fabs((simsimd_f64_t)actual - expected) > tolerance * scale) {
+        printf("- expected %f, got %f\n", expected, actual);
+        assert(0);
+    }
+}
+
+/**
+ *  @brief  Compares every dispatched one-to-many batch kernel against the serial single-pair kernel,
+ *          over odd dimensions and row counts, that are not multiples of the rows compared at a time,
+ *          with padded strides, so that the rows don't follow each other.
+ */
+static void test_batch_kernels(void) {
+    static simsimd_metric_kind_t const kinds[] = {simsimd_metric_ip_k, simsimd_metric_cos_k, simsimd_metric_l2sq_k,
+                                                  simsimd_metric_hamming_k};
+    static simsimd_datatype_t const datatypes[] = {simsimd_datatype_f32_k, simsimd_datatype_b8_k};
+    simsimd_capability_t const capabilities = simsimd_capabilities();
+    simsimd_size_t const max_count = test_counts[sizeof(test_counts) / sizeof(test_counts[0]) - 1];
+    simsimd_size_t const max_dimensions = test_dimensions[sizeof(test_dimensions) / sizeof(test_dimensions[0]) - 1];
+    simsimd_f64_t* a = (simsimd_f64_t*)malloc(max_dimensions * sizeof(simsimd_f64_t));
+    simsimd_f64_t* b = (simsimd_f64_t*)malloc(max_count * (max_dimensions + 1) * sizeof(simsimd_f64_t));
+    simsimd_f32_t* results = (simsimd_f32_t*)malloc(max_count * sizeof(simsimd_f32_t));
+    assert(a && b && results);
+
+    for (simsimd_size_t k = 0; k != sizeof(kinds) / sizeof(kinds[0]); ++k)
+        for (simsimd_size_t d = 0; d != sizeof(datatypes) / sizeof(datatypes[0]); ++d) {
+            simsimd_batch_punned_t batch;
+            simsimd_metric_punned_t serial;
+            simsimd_capability_t batch_capability, serial_capability;
+            simsimd_find_batch_punned(kinds[k], datatypes[d], capabilities, simsimd_cap_any_k, &batch,
+                                      &batch_capability);
+            if (!batch)
+                continue;
+            simsimd_find_metric_punned(kinds[k], datatypes[d], simsimd_cap_serial_k, simsimd_cap_any_k, &serial,
+                                       &serial_capability);
+            assert(serial);
+
+            for (simsimd_size_t i = 0; i != sizeof(test_dimensions) / sizeof(test_dimensions[0]); ++i)
+                for (simsimd_size_t j = 0; j != sizeof(test_counts) / sizeof(test_counts[0]); ++j) {
+                    simsimd_size_t const dimensions = test_dimensions[i], count = test_counts[j];
+                    simsimd_size_t const stride = (dimensions + 1) * datatype_bytes(datatypes[d]);
+                    fill_random(datatypes[d], a, dimensions);
+                    for (simsimd_size_t row = 0; row != count; ++row)
+                        fill_random(datatypes[d], (char*)b + row * stride, dimensions);
+                    batch(a, b, count, stride, dimensions, results);
+                    for (simsimd_size_t row = 0; row != count; ++row)
+                        assert_close(results[row], serial(a, (char*)b + row * stride, dimensions, dimensions), 1e-3f);
+                }
+            printf("- batch of kind '%c' and datatype %d matches the serial kernel\n", (char)kinds[k],
+                   (int)datatypes[d]);
+        }
+    free(a), free(b), free(results);
+}
+
+/**
+ *  @brief  Compares every dispatched one-to-many batch kernel with early termination against the serial
+ *          single-pair kernel, like `test_batch_kernels`. The rows within the bound must get exact distances,
+ *          and the other ones any distance beyond it.
+ */
+static void test_bounded_batch_kernels(void) {
+    simsimd_capability_t const capabilities = simsimd_capabilities();
+    simsimd_size_t const max_count = test_counts[sizeof(test_counts) / sizeof(test_counts[0]) - 1];
+    simsimd_size_t const max_dimensions = test_dimensions[sizeof(test_dimensions) / sizeof(test_dimensions[0]) - 1];
+    simsimd_b8_t* a = (simsimd_b8_t*)malloc(max_dimensions);
+    simsimd_b8_t* b = (simsimd_b8_t*)malloc(max_count * (max_dimensions + 1));
+    simsimd_f32_t* results = (simsimd_f32_t*)malloc(max_count * sizeof(simsimd_f32_t));
+    assert(a && b && results);
+
+    simsimd_bounded_batch_punned_t bounded;
+    simsimd_metric_punned_t serial;
+    simsimd_capability_t bounded_capability, serial_capability;
+    simsimd_find_bounded_batch_punned(simsimd_metric_hamming_k, simsimd_datatype_b8_k, capabilities,
+                                      simsimd_cap_any_k, &bounded, &bounded_capability);
+    simsimd_find_metric_punned(simsimd_metric_hamming_k, simsimd_datatype_b8_k, simsimd_cap_serial_k,
+                               simsimd_cap_any_k, &serial, &serial_capability);
+    assert(bounded && serial);
+
+    for (simsimd_size_t i = 0; i != sizeof(test_dimensions) / sizeof(test_dimensions[0]); ++i)
+        for (simsimd_size_t j = 0; j != sizeof(test_counts) / sizeof(test_counts[0]); ++j) {
+            simsimd_size_t const dimensions = test_dimensions[i], count = test_counts[j], stride = dimensions + 1;
+            simsimd_f32_t const max_distance = (simsimd_f32_t)(dimensions * 4); // Half of the bits
+            fill_random(simsimd_datatype_b8_k, a, dimensions);
+            for (simsimd_size_t row = 0; row != count; ++row)
+                fill_random(simsimd_datatype_b8_k, b + row * stride, dimensions);
+            bounded(a, b, count, stride, dimensions, max_distance, results);
+            for (simsimd_size_t row = 0; row != count; ++row) {
+                simsimd_f32_t expected = serial(a, b + row * stride, dimensions, dimensions);
+                assert(expected <= max_distance ? results[row] == expected : results[row] > max_distance);
+            }
+        }
+    printf("- bounded Hamming batch matches the serial kernel\n");
+    free(a), free(b), free(results);
+}
+
+/**
+ *  @brief  Compares the metric kernels, that the dispatch picks for the given capability, against the serial
+ *          ones, over the tested dimensions. Skips the capabilities, that this machine lacks, and the kinds,
+ *          that have no dedicated kernel for that capability.
+ */
+static void test_metric_kernels(simsimd_capability_t capability, simsimd_datatype_t datatype,
+                                simsimd_metric_kind_t const* kinds, simsimd_size_t kinds_count,
+                                simsimd_f32_t tolerance) {
+    simsimd_size_t const max_dimensions = test_dimensions[sizeof(test_dimensions) / sizeof(test_dimensions[0]) - 1];
+    simsimd_f64_t* a = (simsimd_f64_t*)malloc(max_dimensions * sizeof(simsimd_f64_t));
+    simsimd_f64_t* b = (simsimd_f64_t*)malloc(max_dimensions * sizeof(simsimd_f64_t));
+    assert(a && b);
+    if ((simsimd_capabilities() & capability) != capability)
+        kinds_count = 0;
+
+    for (simsimd_size_t k = 0; k != kinds_count; ++k) {
+        simsimd_metric_punned_t metric, serial;
+        simsimd_capability_t metric_capability, serial_capability;
+        simsimd_find_metric_punned(kinds[k], datatype, (simsimd_capability_t)(capability | simsimd_cap_serial_k),
+                                   simsimd_cap_any_k, &metric, &metric_capability);
+        if (metric_capability != capability)
+            continue;
+        simsimd_find_metric_punned(kinds[k], datatype, simsimd_cap_serial_k, simsimd_cap_any_k, &serial,
+                                   &serial_capability);
+        assert(serial);
+
+        int const is_probability = kinds[k] == simsimd_metric_kl_k || kinds[k] == simsimd_metric_js_k;
+        for (simsimd_size_t i = 0; i != sizeof(test_dimensions) / sizeof(test_dimensions[0]); ++i) {
+            simsimd_size_t const dimensions = test_dimensions[i];
+            if (is_probability)
+                fill_distribution(datatype, a, dimensions), fill_distribution(datatype, b, dimensions);
+            else
+                fill_random(datatype, a, dimensions), fill_random(datatype, b, dimensions);
+            assert_close(metric(a, b, dimensions, dimensions), serial(a, b, dimensions, dimensions), tolerance);
+        }
+        printf("- kernel of kind '%c' and datatype %d for capability %#x matches the serial one\n", (char)kinds[k],
+               (int)datatype, (unsigned)capability);
+    }
+    free(a), free(b);
+}
+
+/**
+ *  @brief  Compares the AVX2 `f32` kernels for the spatial and probability metrics against the serial ones.
+ */
+static void test_avx2_f32_kernels(void) {
+    static simsimd_metric_kind_t const kinds[] = {simsimd_metric_ip_k, simsimd_metric_cos_k, simsimd_metric_l2sq_k,
+                                                  simsimd_metric_kl_k, simsimd_metric_js_k};
+    test_metric_kernels(simsimd_cap_x86_avx2_k, simsimd_datatype_f32_k, kinds, sizeof(kinds) / sizeof(kinds[0]),
+                        1e-3f);
+}
+
+/**
+ *  @brief  Compares the `i8` kernels against the serial ones, separately for the SVE `svdot`, the NEON `sdot`,
+ *          and the plain NEON fallback paths, as well as the x86 ones, whichever this machine supports.
+ */
+static void test_i8_kernels(void) {
+    static simsimd_metric_kind_t const kinds[] = {simsimd_metric_ip_k, simsimd_metric_cos_k, simsimd_metric_l2sq_k};
+    static simsimd_capability_t const capabilities[] = {simsimd_cap_arm_sve_k, simsimd_cap_arm_dotprod_k,
+                                                        simsimd_cap_arm_neon_k, simsimd_cap_x86_avx512vnni_k,
+                                                        simsimd_cap_x86_avx2_k};
+    for (simsimd_size_t i = 0; i != sizeof(capabilities) / sizeof(capabilities[0]); ++i)
+        test_metric_kernels(capabilities[i], simsimd_datatype_i8_k, kinds, sizeof(kinds) / sizeof(kinds[0]), 1e-3f);
+}
+
+#if SIMSIMD_COS_PRECISION == SIMSIMD_COS_PRECISION_FAST
+static simsimd_f32_t const test_cos_tolerance = 2e-3f;
+static simsimd_f32_t const test_rsqrt_tolerance = 2e-3f;
+#elif SIMSIMD_COS_PRECISION == SIMSIMD_COS_PRECISION_NEWTON
+static simsimd_f32_t const test_cos_tolerance = 1e-5f;
+static simsimd_f32_t const test_rsqrt_tolerance = 1e-5f;
+#else
+static simsimd_f32_t const test_cos_tolerance = 1e-5f;
+static simsimd_f32_t const test_rsqrt_tolerance = 1e-6f;
+#endif
+
+/**
+ *  @brief  Compares the reciprocal square roots and the dispatched cosine kernels against an `f64` reference,
+ *          with the tolerance of the `SIMSIMD_COS_PRECISION` mode, that this unit is compiled with.
+ */
+static void test_cos_precision(void) {
+    for (simsimd_f32_t number = 1e-3f; number < 1e6f; number *= 1.37f)
+        assert_close(simsimd_approximate_inverse_square_root(number) * (simsimd_f32_t)sqrt(number), 1,
+                     test_rsqrt_tolerance);
+
+    static simsimd_datatype_t const datatypes[] = {simsimd_datatype_f64_k, simsimd_datatype_f32_k};
+    simsimd_size_t const max_dimensions = test_dimensions[sizeof(test_dimensions) / sizeof(test_dimensions[0]) - 1];
+    simsimd_f64_t* a = (simsimd_f64_t*)malloc(max_dimensions * sizeof(simsimd_f64_t));
+    simsimd_f64_t* b = (simsimd_f64_t*)malloc(max_dimensions * sizeof(simsimd_f64_t));
+    assert(a && b);
+    for (simsimd_size_t d = 0; d != sizeof(datatypes) / sizeof(datatypes[0]); ++d) {
+        simsimd_metric_punned_t metric;
+        simsimd_capability_t metric_capability;
+        simsimd_find_metric_punned(simsimd_metric_cos_k, datatypes[d], simsimd_capabilities(), simsimd_cap_any_k,
+                                   &metric, &metric_capability);
+        assert(metric);
+        for (simsimd_size_t i = 0; i != sizeof(test_dimensions) / sizeof(test_dimensions[0]); ++i) {
+            simsimd_size_t const dimensions = test_dimensions[i];
+            fill_random(datatypes[d], a, dimensions), fill_random(datatypes[d], b, dimensions);
+            simsimd_f64_t ab = 0, a2 = 0, b2 = 0;
+            for (simsimd_size_t j = 0; j != dimensions; ++j) {
+                simsimd_f64_t ai = datatypes[d] == simsimd_datatype_f64_k ? a[j] : ((simsimd_f32_t*)a)[j];
+                simsimd_f64_t bi = datatypes[d] == simsimd_datatype_f64_k ? b[j] : ((simsimd_f32_t*)b)[j];
+                ab += ai * bi, a2 += ai * ai, b2 += bi * bi;
+            }
+            assert_close(metric(a, b, dimensions, dimensions), (simsimd_f32_t)(1 - ab / sqrt(a2 * b2)),
+                         test_cos_tolerance);
+        }
+        printf("- cosine kernel of datatype %d for capability %#x matches the reference with precision mode %d\n",
+               (int)datatypes[d], (unsigned)metric_capability, (int)SIMSIMD_COS_PRECISION);
+    }
+    free(a), free(b);
+}
+
+/**
+ *  @brief  Compares the cosine distances derived from the cached inverse norms and the inner product kernels
+ *          against the dispatched cosine kernels, including zero vectors.
+ */
+static void test_cos_normalized(void) {
+    static simsimd_datatype_t const datatypes[] = {simsimd_datatype_f64_k, simsimd_datatype_f32_k};
+    simsimd_size_t const count = 9;
+    simsimd_size_t const max_dimensions = test_dimensions[sizeof(test_dimensions) / sizeof(test_dimensions[0]) - 1];
+    simsimd_f64_t* rows = (simsimd_f64_t*)malloc(count * max_dimensions * sizeof(simsimd_f64_t));
+    simsimd_f32_t inverse_norms[9], results[9 * 9];
+    assert(rows);
+
+    for (simsimd_size_t d = 0; d != sizeof(datatypes) / sizeof(datatypes[0]); ++d) {
+        simsimd_metric_punned_t ip, cos;
+        simsimd_batch_punned_t ip_batch;
+        simsimd_capability_t capability;
+        simsimd_find_metric_punned(simsimd_metric_ip_k, datatypes[d], simsimd_capabilities(), simsimd_cap_any_k, &ip,
+                                   &capability);
+        simsimd_find_metric_punned(simsimd_metric_cos_k, datatypes[d], simsimd_capabilities(), simsimd_cap_any_k,
+                                   &cos, &capability);
+        simsimd_find_batch_punned(simsimd_metric_ip_k, datatypes[d], simsimd_capabilities(), simsimd_cap_any_k,
+                                  &ip_batch, &capability);
+        for (simsimd_size_t i = 0; i != sizeof(test_dimensions) / sizeof(test_dimensions[0]); ++i) {
+            simsimd_size_t const dimensions = test_dimensions[i];
+            simsimd_size_t const stride = dimensions * datatype_bytes(datatypes[d]);
+            fill_random(datatypes[d], rows, dimensions * (count - 1));
+            memset((char*)rows + (count - 1) * stride, 0, stride);
+            assert(simsimd_inverse_norms(datatypes[d], rows, count, stride, dimensions, inverse_norms) == 0);
+            assert(inverse_norms[count - 1] == 0);
+            simsimd_many_to_many_normalized(ip, ip_batch, rows, inverse_norms, count, stride, rows, inverse_norms,
+                                            count, stride, dimensions, results, count * sizeof(simsimd_f32_t));
+            for (simsimd_size_t a = 0; a + 1 != count; ++a)
+                for (simsimd_size_t b = 0; b + 1 != count; ++b)
+                    assert_close(results[a * count + b],
+                                 cos((char*)rows + a * stride, (char*)rows + b * stride, dimensions, dimensions),
+                                 1e-3f);
+            for (simsimd_size_t a = 0; a != count; ++a)
+                assert(results[a * count + count - 1] == 1 && results[(count - 1) * count + a] == 1);
+        }
+        printf("- cosine with cached norms of datatype %d matches the dispatched kernel\n", (int)datatypes[d]);
+    }
+    free(rows);
+}
+
+/**
+ *  @brief  Fills a dispatch table for the serial capability alone, and checks, that it points to the serial
+ *          kernels, while the shared table points to the same kernels as the dispatch with all capabilities.
+ */
+static void test_dispatch_table(void) {
+    static simsimd_dispatch_table_t serial_table;
+    simsimd_dispatch_table_init(&serial_table, simsimd_cap_serial_k);
+    int const ip = simsimd_metric_kind_index(simsimd_metric_ip_k);
+    int const l2sq = simsimd_metric_kind_index(simsimd_metric_l2sq_k);
+    assert(serial_table.metrics[ip][simsimd_datatype_f32_k] == (simsimd_metric_punned_t)&simsimd_serial_f32_ip);
+    assert(serial_table.metrics[l2sq][simsimd_datatype_f32_k] == (simsimd_metric_punned_t)&simsimd_serial_f32_l2sq);
+    assert(serial_table.metric_capabilities[ip][simsimd_datatype_f32_k] == simsimd_cap_serial_k);
+    assert(serial_table.batches[ip][simsimd_datatype_f32_k] == NULL);
+
+    simsimd_metric_punned_t best;
+    simsimd_capability_t best_capability;
+    simsimd_find_metric_punned(simsimd_metric_ip_k, simsimd_datatype_f32_k, simsimd_capabilities(), simsimd_cap_any_k,
+                               &best, &best_capability);
+    assert(simsimd_dispatch_metric(simsimd_metric_ip_k, simsimd_datatype_f32_k) == best);
+    assert(simsimd_dispatch_table()->metric_capabilities[ip][simsimd_datatype_f32_k] == best_capability);
+    printf("- dispatch table for the serial capability points to the serial kernels\n");
+}
+
+/**
+ *  @brief  Restricts the shared dispatch table to the serial kernels, and then excludes the best capability,
+ *          checking that the dispatched pointers follow every restriction, and are restored afterwards.
+ */
+static void test_dispatch_restrict(void) {
+    simsimd_metric_punned_t best = simsimd_dispatch_metric(simsimd_metric_ip_k, simsimd_datatype_f32_k);
+    simsimd_capability_t best_capability = simsimd_dispatch_capability(simsimd_metric_ip_k, simsimd_datatype_f32_k);
+
+    assert(simsimd_dispatch_restrict(simsimd_cap_serial_k) == simsimd_cap_serial_k);
+    assert(simsimd_dispatch_metric(simsimd_metric_ip_k, simsimd_datatype_f32_k) ==
+           (simsimd_metric_punned_t)&simsimd_serial_f32_ip);
+    assert(simsimd_dispatch_capability(simsimd_metric_ip_k, simsimd_datatype_f32_k) == simsimd_cap_serial_k);
+
+    if (best_capability != simsimd_cap_serial_k) {
+        simsimd_dispatch_restrict((simsimd_capability_t)(simsimd_cap_any_k & ~best_capability));
+        assert(simsimd_dispatch_metric(simsimd_metric_ip_k, simsimd_datatype_f32_k) != best);
+        assert(simsimd_dispatch_capability(simsimd_metric_ip_k, simsimd_datatype_f32_k) != best_capability);
+    }
+
+    simsimd_dispatch_restrict(simsimd_cap_any_k);
+    assert(simsimd_dispatch_metric(simsimd_metric_ip_k, simsimd_datatype_f32_k) == best);
+    printf("- dispatch table restricted from %s follows every restriction\n", simsimd_capability_name(best_capability));
+}
+
+#if SIMSIMD_DISPATCH_COUNTERS
+
+/**
+ *  @brief  Checks, that the kernel counters accumulate the calls, vectors, and bytes of one (metric, datatype)
+ *          pair, leave the other pairs intact, and are cleared on reset.
+ */
+static void test_dispatch_counters(void) {
+    simsimd_dispatch_counters(simsimd_metric_l2sq_k, simsimd_datatype_f32_k, 1);
+    simsimd_dispatch_count(simsimd_metric_l2sq_k, simsimd_datatype_f32_k, 1, 2 * 97 * 4);
+    simsimd_dispatch_count(simsimd_metric_l2sq_k, simsimd_datatype_f32_k, 200, 201 * 97 * 4);
+
+    simsimd_kernel_counters_t counters = simsimd_dispatch_counters(simsimd_metric_l2sq_k, simsimd_datatype_f32_k, 1);
+    assert(counters.calls == 2 && counters.vectors == 201 && counters.bytes == 203 * 97 * 4);
+    assert(simsimd_dispatch_counters(simsimd_metric_ip_k, simsimd_datatype_f32_k, 0).calls == 0);
+    assert(simsimd_dispatch_counters(simsimd_metric_l2sq_k, simsimd_datatype_f32_k, 0).calls == 0);
+    printf("- kernel counters accumulate the calls, vectors, and bytes\n");
+}
+
+#endif // SIMSIMD_DISPATCH_COUNTERS
+
+#if SIMSIMD_THREAD_POOL
+
+/// Context of the nested thread pool test, counting the inner tasks from all the outer ones.
+typedef struct test_nested_context_t {
+    simsimd_thread_pool_t* pool;
+    simsimd_size_t inner_count;
+    simsimd_size_t finished;
+} test_nested_context_t;
+
+static void test_nested_inner_task(void* context, simsimd_size_t index) {
+    (void)index;
+    __atomic_fetch_add(&((test_nested_context_t*)context)->finished, 1, __ATOMIC_RELAXED);
+}
+
+static void test_nested_outer_task(void* context, simsimd_size_t index) {
+    test_nested_context_t* nested = (test_nested_context_t*)context;
+    (void)index;
+    simsimd_thread_pool_run(nested->pool, 0, nested->inner_count, &test_nested_inner_task, context);
+}
+
+/**
+ *  @brief  Runs executions on the thread pool from within its own tasks, that would wait for themselves
+ *          to finish, unless they run inline, and compares the parallel all-pairs distances with serial ones.
+ */
+static void test_thread_pool(void) {
+    simsimd_thread_pool_t pool;
+    assert(simsimd_thread_pool_init(&pool, 4) == 0);
+
+    test_nested_context_t nested = {&pool, 100, 0};
+    simsimd_thread_pool_execute(&pool, 16, &test_nested_outer_task, &nested);
+    assert(nested.finished == 16 * 100);
+    printf("- nested thread pool executions run inline\n");
+
+    simsimd_size_t const count = 67, dimensions = 97, stride = dimensions * sizeof(simsimd_f32_t);
+    simsimd_f32_t* rows = (simsimd_f32_t*)malloc(count * stride);
+    simsimd_f32_t* serial = (simsimd_f32_t*)malloc(count * count * sizeof(simsimd_f32_t));
+    simsimd_f32_t* parallel = (simsimd_f32_t*)malloc(count * count * sizeof(simsimd_f32_t));
+    assert(rows && serial && parallel);
+    fill_random(simsimd_datatype_f32_k, rows, count * dimensions);
+    simsimd_metric_punned_t metric = simsimd_dispatch_metric(simsimd_metric_l2sq_k, simsimd_datatype_f32_k);
+    simsimd_batch_punned_t batch = simsimd_dispatch_batch(simsimd_metric_l2sq_k, simsimd_datatype_f32_k);
+    simsimd_many_to_many_parallel(NULL, NULL, metric, batch, rows, count, stride, rows, count, stride, dimensions,
+                                  serial, count * sizeof(simsimd_f32_t));
+    simsimd_many_to_many_parallel(&simsimd_thread_pool_execute, &pool, metric, batch, rows, count, stride, rows,
+                                  count, stride, dimensions, parallel, count * sizeof(simsimd_f32_t));
+    assert(memcmp(serial, parallel, count * count * sizeof(simsimd_f32_t)) == 0);
+    printf("- parallel all-pairs distances match the serial ones\n");
+
+    free(rows), free(serial), free(parallel);
+    simsimd_thread_pool_free(&pool);
+}
+
+#endif // SIMSIMD_THREAD_POOL
+
+int main(void) {
+    printf("Running tests...\n");
+    test_batch_kernels();
+    test_bounded_batch_kernels();
+    test_avx2_f32_kernels();
+    test_i8_kernels();
+    test_cos_precision();
+    test_cos_normalized();
+    test_dispatch_table();
+    test_dispatch_restrict();
+#if SIMSIMD_DISPATCH_COUNTERS
+    test_dispatch_counters();
+#endif
+#if SIMSIMD_THREAD_POOL
+    test_thread_pool();
+#endif
+    printf("All tests passed.\n");
+    return 0;
+}
@@ -1,36 +1,76 @@
-#include <cmath>  // `std::sqrt`
-#include <thread> // `std::thread`
+#include <cmath>       // `std::sqrt`
+#include <cstdlib>     // `std::strtoull`
+#include <cstring>     // `std::strncmp`
+#include <mutex>       // `std::mutex`
+#include <string>      // `std::to_string`
+#include <thread>      // `std::thread`
+#include <type_traits> // `std::is_same_v`
+#include <vector>      // `std::vector`
 
 #include <benchmark/benchmark.h>
 
 #define SIMSIMD_RSQRT(x) (1 / sqrtf(x))
-#define SIMSIMD_LOG(x) (logf(x))
 #include <simsimd/simsimd.h>
 
 namespace bm = benchmark;
 
+/// Dimensions of the vectors in the pairwise benchmarks, covering common embedding sizes,
+/// as well as odd ones, that exercise the tail handling of the kernels.
+static std::size_t const pair_dimensions[] = {97, 128, 384, 768, 1535, 1536, 4096};
+
+/// Dimensions of the rows in the one-to-many and all-pairs benchmarks over large datasets.
+static std::size_t const dataset_dimensions[] = {128, 384, 768, 1536, 4096};
+
+/// Size of every dataset in bytes, that should exceed the last-level cache, to make the scans memory-bound.
+/// Can be overridden with the `--dataset_mb=` command-line argument.
+static std::size_t dataset_bytes = 1024ull * 1024ull * 1024ull;
+
+/// Number of query vectors, that are compared against every row of the dataset in the all-pairs benchmarks.
+static std::size_t const cdist_queries = 64;
+
+/// Number of rows, that the dataset benchmarks pass to the kernels at once, to keep the results in cache.
+static std::size_t const dataset_chunk = 4096;
+
+/// Brain-float vectors are stored as raw bits in integers, so they have to be filled through a conversion.
+/// Without a native `f16` type both half-precision types are `unsigned short`, and can't be told apart.
+template <typename scalar_at>
+constexpr bool is_bf16_v = std::is_same_v<scalar_at, simsimd_bf16_t> && SIMSIMD_NATIVE_F16;
+
+/// Truncates a single-precision number to the upper half of its bits, that form the brain-float.
+inline simsimd_bf16_t compress_bf16(float value) {
+    simsimd_f32i32_t conv;
+    conv.f = value;
+    return (simsimd_bf16_t)(conv.i >> 16);
+}
+
 template <typename return_at, typename... args_at>
 constexpr std::size_t number_of_arguments(return_at (*f)(args_at...)) {
     return sizeof...(args_at);
 }
 
-template <typename scalar_at, std::size_t dimensions_ak> struct vectors_pair_gt {
-    scalar_at a[dimensions_ak]{};
-    scalar_at b[dimensions_ak]{};
+template <typename scalar_at> struct vectors_pair_gt {
+    std::vector<scalar_at> a;
+    std::vector<scalar_at> b;
 
-    std::size_t dimensions() const noexcept { return dimensions_ak; }
-    std::size_t size_bytes() const noexcept { return dimensions_ak * sizeof(scalar_at); }
+    explicit vectors_pair_gt(std::size_t dimensions) : a(dimensions), b(dimensions) {}
+
+    std::size_t dimensions() const noexcept { return a.size(); }
+    std::size_t size_bytes() const noexcept { return a.size() * sizeof(scalar_at); }
 
     void set(scalar_at v) noexcept {
-        for (std::size_t i = 0; i != dimensions_ak; ++i)
+        for (std::size_t i = 0; i != a.size(); ++i)
             a[i] = b[i] = v;
     }
 
     void randomize() noexcept {
 
         double a2_sum = 0, b2_sum = 0;
-        for (std::size_t i = 0; i != dimensions_ak; ++i) {
-            if constexpr (std::is_integral_v<scalar_at>)
+        for (std::size_t i = 0; i != a.size(); ++i) {
+            if constexpr (is_bf16_v<scalar_at>) {
+                float ai = float(rand()) / float(RAND_MAX), bi = float(rand()) / float(RAND_MAX);
+                a2_sum += ai * ai, b2_sum += bi * bi;
+                a[i] = compress_bf16(ai), b[i] = compress_bf16(bi);
+            } else if constexpr (std::is_integral_v<scalar_at>)
                 a[i] = static_cast<scalar_at>(rand()), b[i] = static_cast<scalar_at>(rand());
             else {
                 double ai = double(rand()) / double(RAND_MAX), bi = double(rand()) / double(RAND_MAX);
@@ -40,27 +80,33 @@ template <typename scalar_at, std::size_t dimensions_ak> struct vectors_pair_gt
         }
 
         // Normalize the vectors:
-        if constexpr (!std::is_integral_v<scalar_at>) {
+        if constexpr (is_bf16_v<scalar_at>) {
+            a2_sum = std::sqrt(a2_sum);
+            b2_sum = std::sqrt(b2_sum);
+            for (std::size_t i = 0; i != a.size(); ++i)
+                a[i] = compress_bf16(float(SIMSIMD_UNCOMPRESS_BF16(a[i]) / a2_sum)),
+                b[i] = compress_bf16(float(SIMSIMD_UNCOMPRESS_BF16(b[i]) / b2_sum));
+        } else if constexpr (!std::is_integral_v<scalar_at>) {
             a2_sum = std::sqrt(a2_sum);
             b2_sum = std::sqrt(b2_sum);
-            for (std::size_t i = 0; i != dimensions_ak; ++i)
+            for (std::size_t i = 0; i != a.size(); ++i)
                 a[i] = static_cast<scalar_at>(a[i] / a2_sum), b[i] = static_cast<scalar_at>(b[i] / b2_sum);
         }
     }
 };
 
-template <typename pair_at, typename metric_at = void>
-static void measure(bm::State& state, metric_at metric, metric_at baseline) {
+template <typename scalar_at, typename metric_at = void>
+static void measure(bm::State& state, metric_at metric, metric_at baseline, std::size_t dimensions) {
 
-    pair_at pair;
+    vectors_pair_gt<scalar_at> pair(dimensions);
     pair.randomize();
     // pair.set(1);
 
-    double c_baseline = baseline(pair.a, pair.b, pair.dimensions());
+    double c_baseline = baseline(pair.a.data(), pair.b.data(), pair.dimensions());
     double c = 0;
     std::size_t iterations = 0;
     for (auto _ : state)
-        bm::DoNotOptimize((c = metric(pair.a, pair.b, pair.dimensions()))), iterations++;
+        bm::DoNotOptimize((c = metric(pair.a.data(), pair.b.data(), pair.dimensions()))), iterations++;
 
     state.counters["bytes"] = bm::Counter(iterations * pair.size_bytes() * 2, bm::Counter::kIsRate);
     state.counters["pairs"] = bm::Counter(iterations, bm::Counter::kIsRate);
@@ -73,21 +119,227 @@ static void measure(bm::State& state, metric_at metric, metric_at baseline) {
 
 template <typename scalar_at, typename metric_at = void>
 void register_(std::string name, metric_at* distance_func, metric_at* baseline_func) {
+    for (std::size_t dimensions : pair_dimensions) {
+        std::string name_dims = name + "_" + std::to_string(dimensions) + "d";
+        bm::RegisterBenchmark(name_dims.c_str(), measure<scalar_at, metric_at*>, distance_func, baseline_func,
+                              dimensions);
+    }
+}
 
-    using pair_dims_t = vectors_pair_gt<scalar_at, 1536>;
-    using pair_bytes_t = vectors_pair_gt<scalar_at, 1536 / sizeof(scalar_at)>;
+/// Registers a fixed-dimension kernel, that is only valid for one size, to compare with the generic ones.
+template <typename scalar_at, typename metric_at = void>
+void register_fixed_(std::string name, metric_at* distance_func, metric_at* baseline_func, std::size_t dimensions) {
+    std::string name_dims = name + "_fixed_" + std::to_string(dimensions) + "d";
+    bm::RegisterBenchmark(name_dims.c_str(), measure<scalar_at, metric_at*>, distance_func, baseline_func,
+                          dimensions);
+}
 
-    std::size_t seconds = 10;
-    std::size_t threads = 1; // std::thread::hardware_concurrency(); // 1;
-    std::string name_dims = name + "_" + std::to_string(pair_dims_t{}.dimensions()) + "d";
-    std::string name_bytes = name + "_" + std::to_string(pair_bytes_t{}.size_bytes()) + "b";
+/// Number of bytes in every scalar of the given type, or in every word of the binary vectors.
+static std::size_t datatype_bytes(simsimd_datatype_t datatype) {
+    switch (datatype) {
+    case simsimd_datatype_f64_k: return sizeof(simsimd_f64_t);
+    case simsimd_datatype_f32_k: return sizeof(simsimd_f32_t);
+    case simsimd_datatype_f16_k: return sizeof(simsimd_f16_t);
+    case simsimd_datatype_bf16_k: return sizeof(simsimd_bf16_t);
+    default: return 1;
+    }
+}
 
-    bm::RegisterBenchmark(name_dims.c_str(), measure<pair_dims_t, metric_at*>, distance_func, baseline_func)
-        ->MinTime(seconds)
-        ->Threads(threads);
-    bm::RegisterBenchmark(name_bytes.c_str(), measure<pair_bytes_t, metric_at*>, distance_func, baseline_func)
-        ->MinTime(seconds)
-        ->Threads(threads);
+/**
+ *  @brief  Returns the dataset of `dataset_bytes` random scalars of the given type, generating it on first use.
+ *          Only one dataset is kept in memory at a time, so benchmarks are registered grouped by the datatype.
+ *          Floating-point values are positive, so that the same data suits the probability metrics.
+ */
+static char const* dataset(simsimd_datatype_t datatype) {
+    static std::mutex mutex;
+    static std::vector<char> data;
+    static simsimd_datatype_t data_type = simsimd_datatype_unknown_k;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (data_type == datatype)
+        return data.data();
+
+    data.clear();
+    data.shrink_to_fit();
+    data.resize(dataset_bytes);
+    std::size_t const count = dataset_bytes / datatype_bytes(datatype);
+    unsigned long long state = 0x9E3779B97F4A7C15ull;
+    for (std::size_t i = 0; i != count; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        unsigned const bits = (unsigned)(state >> 32);
+        float const value = (float)(bits >> 8) / (float)(1u << 24) + 1e-6f;
+        switch (datatype) {
+        case simsimd_datatype_f64_k: ((simsimd_f64_t*)data.data())[i] = value; break;
+        case simsimd_datatype_f32_k: ((simsimd_f32_t*)data.data())[i] = value; break;
+        case simsimd_datatype_f16_k: ((simsimd_f16_t*)data.data())[i] = SIMSIMD_COMPRESS_F16(value); break;
+        case simsimd_datatype_bf16_k: ((simsimd_bf16_t*)data.data())[i] = compress_bf16(value); break;
+        default: data[i] = (char)bits; break;
+        }
+    }
+    data_type = datatype;
+    return data.data();
+}
+
+/**
+ *  @brief  Compares the distances of the last chunk, that a dataset benchmark computed, against the serial kernel,
+ *          reporting the largest deviation with the same `abs_delta` and `relative_error` counters as `measure`.
+ */
+static void measure_dataset_errors(bm::State& state, simsimd_metric_kind_t kind, simsimd_datatype_t datatype,
+                                   char const* queries, std::size_t queries_count, char const* rows,
+                                   std::size_t rows_count, std::size_t row_bytes, std::size_t dimensions,
+                                   simsimd_f32_t const* results, std::size_t results_stride) {
+
+    simsimd_metric_punned_t serial = nullptr;
+    simsimd_capability_t serial_capability = simsimd_cap_serial_k;
+    simsimd_find_metric_punned(kind, datatype, simsimd_cap_serial_k, simsimd_cap_any_k, &serial, &serial_capability);
+    if (!serial)
+        return;
+
+    double delta = 0, error = 0;
+    for (std::size_t i = 0; i != queries_count; ++i)
+        for (std::size_t j = 0; j != rows_count; ++j) {
+            double c_baseline = serial(queries + i * row_bytes, rows + j * row_bytes, dimensions, dimensions);
+            double c_delta = std::abs(results[i * results_stride + j] - c_baseline);
+            if (c_delta <= 0.0001 || c_delta <= delta)
+                continue;
+            delta = c_delta;
+            error = c_baseline != 0 ? c_delta / std::abs(c_baseline) : 0;
+        }
+    state.counters["abs_delta"] = delta;
+    state.counters["relative_error"] = error;
+}
+
+/**
+ *  @brief  Measures the throughput of scanning a dataset larger than the last-level cache with one query,
+ *          using the best available batch kernel. Every thread scans its own slice of the rows.
+ */
+static void measure_one_to_many(bm::State& state, simsimd_metric_kind_t kind, simsimd_datatype_t datatype,
+                                std::size_t dimensions) {
+
+    simsimd_metric_punned_t metric = simsimd_dispatch_metric(kind, datatype);
+    simsimd_batch_punned_t batch = simsimd_dispatch_batch(kind, datatype);
+    std::size_t const row_bytes = dimensions * datatype_bytes(datatype);
+    std::size_t const slice = dataset_bytes / row_bytes / state.threads();
+    char const* rows = dataset(datatype) + state.thread_index() * slice * row_bytes;
+    std::vector<char> query(rows, rows + row_bytes);
+    std::vector<simsimd_f32_t> results(dataset_chunk);
+
+    std::size_t iterations = 0;
+    for (auto _ : state) {
+        for (std::size_t start = 0; start < slice; start += dataset_chunk) {
+            std::size_t const length = slice - start < dataset_chunk ? slice - start : dataset_chunk;
+            simsimd_one_to_many(metric, batch, query.data(), rows + start * row_bytes, length, row_bytes, dimensions,
+                                results.data());
+        }
+        bm::DoNotOptimize(results.data());
+        iterations++;
+    }
+
+    state.counters["bytes"] = bm::Counter(iterations * slice * row_bytes, bm::Counter::kIsRate);
+    state.counters["pairs"] = bm::Counter(iterations * slice, bm::Counter::kIsRate);
+    if (slice) {
+        std::size_t const last = (slice - 1) / dataset_chunk * dataset_chunk;
+        measure_dataset_errors(state, kind, datatype, query.data(), 1, rows + last * row_bytes, slice - last,
+                               row_bytes, dimensions, results.data(), 0);
+    }
+}
+
+/**
+ *  @brief  Measures the throughput of all-pairs distances between `cdist_queries` cached vectors and a dataset
+ *          larger than the last-level cache, using the tiled `simsimd_many_to_many`, or the matrix kernel, where
+ *          one is available. Every thread processes its own slice of the rows, like the `*_parallel` helpers.
+ */
+static void measure_cdist(bm::State& state, simsimd_metric_kind_t kind, simsimd_datatype_t datatype,
+                          std::size_t dimensions) {
+
+    simsimd_metric_punned_t metric = simsimd_dispatch_metric(kind, datatype);
+    simsimd_batch_punned_t batch = simsimd_dispatch_batch(kind, datatype);
+    simsimd_matrix_punned_t matrix = simsimd_dispatch_matrix(kind, datatype);
+    std::size_t const row_bytes = dimensions * datatype_bytes(datatype);
+    std::size_t const slice = dataset_bytes / row_bytes / state.threads();
+    char const* rows = dataset(datatype) + state.thread_index() * slice * row_bytes;
+    std::vector<char> queries(rows, rows + cdist_queries * row_bytes);
+    std::vector<simsimd_f32_t> results(cdist_queries * dataset_chunk);
+
+    std::size_t iterations = 0;
+    for (auto _ : state) {
+        for (std::size_t start = 0; start < slice; start += dataset_chunk) {
+            std::size_t const length = slice - start < dataset_chunk ? slice - start : dataset_chunk;
+            if (matrix)
+                matrix(queries.data(), cdist_queries, row_bytes, rows + start * row_bytes, length, row_bytes,
+                       dimensions, results.data(), dataset_chunk * sizeof(simsimd_f32_t));
+            else
+                simsimd_many_to_many(metric, batch, queries.data(), cdist_queries, row_bytes,
+                                     rows + start * row_bytes, length, row_bytes, dimensions, results.data(),
+                                     dataset_chunk * sizeof(simsimd_f32_t));
+        }
+        bm::DoNotOptimize(results.data());
+        iterations++;
+    }
+
+    state.counters["bytes"] = bm::Counter(iterations * slice * row_bytes, bm::Counter::kIsRate);
+    state.counters["pairs"] = bm::Counter(iterations * slice * cdist_queries, bm::Counter::kIsRate);
+    if (slice) {
+        std::size_t const last = (slice - 1) / dataset_chunk * dataset_chunk;
+        measure_dataset_errors(state, kind, datatype, queries.data(), cdist_queries, rows + last * row_bytes,
+                               slice - last, row_bytes, dimensions, results.data(), dataset_chunk);
+    }
+}
+
+/**
+ *  @brief  Registers the one-to-many and all-pairs benchmarks over large datasets for every metric and datatype
+ *          combination with a kernel, scaling the number of threads in powers of two up to the number of cores.
+ */
+void register_datasets() {
+    struct dataset_metric_t {
+        char const* name;
+        simsimd_metric_kind_t kind;
+        simsimd_datatype_t datatype;
+    };
+    static dataset_metric_t const metrics[] = {
+        {"f64_ip", simsimd_metric_ip_k, simsimd_datatype_f64_k},
+        {"f64_cos", simsimd_metric_cos_k, simsimd_datatype_f64_k},
+        {"f64_l2sq", simsimd_metric_l2sq_k, simsimd_datatype_f64_k},
+        {"f64_kl", simsimd_metric_kl_k, simsimd_datatype_f64_k},
+        {"f64_js", simsimd_metric_js_k, simsimd_datatype_f64_k},
+        {"f32_ip", simsimd_metric_ip_k, simsimd_datatype_f32_k},
+        {"f32_cos", simsimd_metric_cos_k, simsimd_datatype_f32_k},
+        {"f32_l2sq", simsimd_metric_l2sq_k, simsimd_datatype_f32_k},
+        {"f32_kl", simsimd_metric_kl_k, simsimd_datatype_f32_k},
+        {"f32_js", simsimd_metric_js_k, simsimd_datatype_f32_k},
+        {"f16_ip", simsimd_metric_ip_k, simsimd_datatype_f16_k},
+        {"f16_cos", simsimd_metric_cos_k, simsimd_datatype_f16_k},
+        {"f16_l2sq", simsimd_metric_l2sq_k, simsimd_datatype_f16_k},
+        {"f16_kl", simsimd_metric_kl_k, simsimd_datatype_f16_k},
+        {"f16_js", simsimd_metric_js_k, simsimd_datatype_f16_k},
+        {"bf16_ip", simsimd_metric_ip_k, simsimd_datatype_bf16_k},
+        {"bf16_cos", simsimd_metric_cos_k, simsimd_datatype_bf16_k},
+        {"bf16_l2sq", simsimd_metric_l2sq_k, simsimd_datatype_bf16_k},
+        {"i8_cos", simsimd_metric_cos_k, simsimd_datatype_i8_k},
+        {"i8_l2sq", simsimd_metric_l2sq_k, simsimd_datatype_i8_k},
+        {"u8_cos", simsimd_metric_cos_k, simsimd_datatype_u8_k},
+        {"u8_l2sq", simsimd_metric_l2sq_k, simsimd_datatype_u8_k},
+        {"i4x2_cos", simsimd_metric_cos_k, simsimd_datatype_i4x2_k},
+        {"i4x2_l2sq", simsimd_metric_l2sq_k, simsimd_datatype_i4x2_k},
+        {"b8_hamming", simsimd_metric_hamming_k, simsimd_datatype_b8_k},
+        {"b8_jaccard", simsimd_metric_jaccard_k, simsimd_datatype_b8_k},
+    };
+
+    int const max_threads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+    for (dataset_metric_t const& metric : metrics) {
+        if (!simsimd_dispatch_metric(metric.kind, metric.datatype))
+            continue;
+        for (std::size_t dimensions : dataset_dimensions) {
+            std::string name = std::string(metric.name) + "_" + std::to_string(dimensions) + "d";
+            bm::RegisterBenchmark(("one_to_many_" + name).c_str(), measure_one_to_many, metric.kind, metric.datatype,
+                                  dimensions)
+                ->ThreadRange(1, max_threads)
+                ->UseRealTime();
+            bm::RegisterBenchmark(("cdist_" + name).c_str(), measure_cdist, metric.kind, metric.datatype, dimensions)
+                ->ThreadRange(1, max_threads)
+                ->UseRealTime();
+        }
+    }
 }
 
 int main(int argc, char** argv) {
@@ -114,6 +366,15 @@ int main(int argc, char** argv) {
     compiled_with_avx512vnni = true;
 #endif
 
+    // Consume our own arguments, before Google Benchmark rejects them
+    int kept_arguments = 1;
+    for (int i = 1; i < argc; ++i)
+        if (std::strncmp(argv[i], "--dataset_mb=", 13) == 0)
+            dataset_bytes = std::strtoull(argv[i] + 13, NULL, 10) * 1024ull * 1024ull;
+        else
+            argv[kept_arguments++] = argv[i];
+    argc = kept_arguments;
+
     // Log supported functionality
     char const* flags[2] = {"false", "true"};
     std::printf("Benchmarking Similarity Measures\n");
@@ -123,6 +384,7 @@ int main(int argc, char** argv) {
     std::printf("- x86 AVX2 support enabled: %s\n", flags[compiled_with_avx2]);
     std::printf("- x86 AVX512VPOPCNTDQ support enabled: %s\n", flags[compiled_with_avx512vpopcntdq]);
     std::printf("- x86 AVX512VNNI support enabled: %s\n", flags[compiled_with_avx512vnni]);
+    std::printf("- Dataset size for memory-bound benchmarks: %zu MB\n", dataset_bytes / 1024 / 1024);
     std::printf("\n");
 
     // Run the benchmarks
@@ -130,6 +392,10 @@ int main(int argc, char** argv) {
     if (bm::ReportUnrecognizedArguments(argc, argv))
         return 1;
 
+    // Annotate the JSON reports, so that the results from different machines can be told apart
+    bm::AddCustomContext("simsimd_capabilities", std::to_string(simsimd_capabilities()));
+    bm::AddCustomContext("simsimd_dataset_bytes", std::to_string(dataset_bytes));
+
 #if SIMSIMD_TARGET_ARM_NEON
     register_<simsimd_f16_t>("neon_f16_ip", simsimd_neon_f16_ip, simsimd_accurate_f16_ip);
     register_<simsimd_f16_t>("neon_f16_cos", simsimd_neon_f16_cos, simsimd_accurate_f16_cos);
@@ -137,24 +403,60 @@ int main(int argc, char** argv) {
     register_<simsimd_f16_t>("neon_f16_kl", simsimd_neon_f16_kl, simsimd_accurate_f16_kl);
     register_<simsimd_f16_t>("neon_f16_js", simsimd_neon_f16_js, simsimd_accurate_f16_js);
 
+    register_<simsimd_bf16_t>("neon_bf16_ip", simsimd_neon_bf16_ip, simsimd_accurate_bf16_ip);
+    register_<simsimd_bf16_t>("neon_bf16_cos", simsimd_neon_bf16_cos, simsimd_accurate_bf16_cos);
+    register_<simsimd_bf16_t>("neon_bf16_l2sq", simsimd_neon_bf16_l2sq, simsimd_accurate_bf16_l2sq);
+
     register_<simsimd_f32_t>("neon_f32_ip", simsimd_neon_f32_ip, simsimd_accurate_f32_ip);
     register_<simsimd_f32_t>("neon_f32_cos", simsimd_neon_f32_cos, simsimd_accurate_f32_cos);
     register_<simsimd_f32_t>("neon_f32_l2sq", simsimd_neon_f32_l2sq, simsimd_accurate_f32_l2sq);
     register_<simsimd_f32_t>("neon_f32_kl", simsimd_neon_f32_kl, simsimd_accurate_f32_kl);
     register_<simsimd_f32_t>("neon_f32_js", simsimd_neon_f32_js, simsimd_accurate_f32_js);
 
+    register_<simsimd_f64_t>("neon_f64_ip", simsimd_neon_f64_ip, simsimd_serial_f64_ip);
+    register_<simsimd_f64_t>("neon_f64_cos", simsimd_neon_f64_cos, simsimd_serial_f64_cos);
+    register_<simsimd_f64_t>("neon_f64_l2sq", simsimd_neon_f64_l2sq, simsimd_serial_f64_l2sq);
+    register_<simsimd_f64_t>("neon_f64_kl", simsimd_neon_f64_kl, simsimd_serial_f64_kl);
+    register_<simsimd_f64_t>("neon_f64_js", simsimd_neon_f64_js, simsimd_serial_f64_js);
+
     register_<simsimd_i8_t>("neon_i8_cos", simsimd_neon_i8_cos, simsimd_accurate_i8_cos);
     register_<simsimd_i8_t>("neon_i8_l2sq", simsimd_neon_i8_l2sq, simsimd_accurate_i8_l2sq);
+    register_<simsimd_i8_t>("dotprod_i8_cos", simsimd_dotprod_i8_cos, simsimd_accurate_i8_cos);
+    register_<simsimd_i8_t>("dotprod_i8_l2sq", simsimd_dotprod_i8_l2sq, simsimd_accurate_i8_l2sq);
+    register_<simsimd_u8_t>("dotprod_u8_cos", simsimd_dotprod_u8_cos, simsimd_accurate_u8_cos);
+    register_<simsimd_u8_t>("dotprod_u8_l2sq", simsimd_dotprod_u8_l2sq, simsimd_accurate_u8_l2sq);
+    register_<simsimd_i4x2_t>("dotprod_i4x2_cos", simsimd_dotprod_i4x2_cos, simsimd_serial_i4x2_cos);
+    register_<simsimd_i4x2_t>("dotprod_i4x2_l2sq", simsimd_dotprod_i4x2_l2sq, simsimd_serial_i4x2_l2sq);
+
+    register_<simsimd_b8_t>("neon_b8_hamming", simsimd_neon_b8_hamming, simsimd_serial_b8_hamming);
+    register_<simsimd_b8_t>("neon_b8_jaccard", simsimd_neon_b8_jaccard, simsimd_serial_b8_jaccard);
 #endif
 
 #if SIMSIMD_TARGET_ARM_SVE
     register_<simsimd_f16_t>("sve_f16_ip", simsimd_sve_f16_ip, simsimd_accurate_f16_ip);
     register_<simsimd_f16_t>("sve_f16_cos", simsimd_sve_f16_cos, simsimd_accurate_f16_cos);
     register_<simsimd_f16_t>("sve_f16_l2sq", simsimd_sve_f16_l2sq, simsimd_accurate_f16_l2sq);
+    register_<simsimd_f16_t>("sve_f16_kl", simsimd_sve_f16_kl, simsimd_accurate_f16_kl);
+    register_<simsimd_f16_t>("sve_f16_js", simsimd_sve_f16_js, simsimd_accurate_f16_js);
+
+    register_<simsimd_bf16_t>("sve_bf16_ip", simsimd_sve_bf16_ip, simsimd_accurate_bf16_ip);
+    register_<simsimd_bf16_t>("sve_bf16_cos", simsimd_sve_bf16_cos, simsimd_accurate_bf16_cos);
+    register_<simsimd_bf16_t>("sve_bf16_l2sq", simsimd_sve_bf16_l2sq, simsimd_accurate_bf16_l2sq);
 
     register_<simsimd_f32_t>("sve_f32_ip", simsimd_sve_f32_ip, simsimd_accurate_f32_ip);
     register_<simsimd_f32_t>("sve_f32_cos", simsimd_sve_f32_cos, simsimd_accurate_f32_cos);
     register_<simsimd_f32_t>("sve_f32_l2sq", simsimd_sve_f32_l2sq, simsimd_accurate_f32_l2sq);
+    register_<simsimd_f32_t>("sve_f32_kl", simsimd_sve_f32_kl, simsimd_accurate_f32_kl);
+    register_<simsimd_f32_t>("sve_f32_js", simsimd_sve_f32_js, simsimd_accurate_f32_js);
+
+    register_<simsimd_f64_t>("sve_f64_ip", simsimd_sve_f64_ip, simsimd_serial_f64_ip);
+    register_<simsimd_f64_t>("sve_f64_cos", simsimd_sve_f64_cos, simsimd_serial_f64_cos);
+    register_<simsimd_f64_t>("sve_f64_l2sq", simsimd_sve_f64_l2sq, simsimd_serial_f64_l2sq);
+    register_<simsimd_f64_t>("sve_f64_kl", simsimd_sve_f64_kl, simsimd_serial_f64_kl);
+    register_<simsimd_f64_t>("sve_f64_js", simsimd_sve_f64_js, simsimd_serial_f64_js);
+
+    register_<simsimd_i8_t>("sve_i8_cos", simsimd_sve_i8_cos, simsimd_accurate_i8_cos);
+    register_<simsimd_i8_t>("sve_i8_l2sq", simsimd_sve_i8_l2sq, simsimd_accurate_i8_l2sq);
 #endif
 
 #if SIMSIMD_TARGET_X86_AVX2
@@ -164,8 +466,45 @@ int main(int argc, char** argv) {
     register_<simsimd_f16_t>("avx2_f16_kl", simsimd_avx2_f16_kl, simsimd_accurate_f16_kl);
     register_<simsimd_f16_t>("avx2_f16_js", simsimd_avx2_f16_js, simsimd_accurate_f16_js);
 
+    register_<simsimd_bf16_t>("avx2_bf16_ip", simsimd_avx2_bf16_ip, simsimd_accurate_bf16_ip);
+    register_<simsimd_bf16_t>("avx2_bf16_cos", simsimd_avx2_bf16_cos, simsimd_accurate_bf16_cos);
+    register_<simsimd_bf16_t>("avx2_bf16_l2sq", simsimd_avx2_bf16_l2sq, simsimd_accurate_bf16_l2sq);
+
+    register_<simsimd_f32_t>("avx2_f32_ip", simsimd_avx2_f32_ip, simsimd_accurate_f32_ip);
+    register_<simsimd_f32_t>("avx2_f32_cos", simsimd_avx2_f32_cos, simsimd_accurate_f32_cos);
+    register_<simsimd_f32_t>("avx2_f32_l2sq", simsimd_avx2_f32_l2sq, simsimd_accurate_f32_l2sq);
+    register_<simsimd_f32_t>("avx2_f32_kl", simsimd_avx2_f32_kl, simsimd_accurate_f32_kl);
+    register_<simsimd_f32_t>("avx2_f32_js", simsimd_avx2_f32_js, simsimd_accurate_f32_js);
+
+    register_<simsimd_f64_t>("avx2_f64_ip", simsimd_avx2_f64_ip, simsimd_serial_f64_ip);
+    register_<simsimd_f64_t>("avx2_f64_cos", simsimd_avx2_f64_cos, simsimd_serial_f64_cos);
+    register_<simsimd_f64_t>("avx2_f64_l2sq", simsimd_avx2_f64_l2sq, simsimd_serial_f64_l2sq);
+    register_<simsimd_f64_t>("avx2_f64_kl", simsimd_avx2_f64_kl, simsimd_serial_f64_kl);
+    register_<simsimd_f64_t>("avx2_f64_js", simsimd_avx2_f64_js, simsimd_serial_f64_js);
+
     register_<simsimd_i8_t>("avx2_i8_cos", simsimd_avx2_i8_cos, simsimd_accurate_i8_cos);
     register_<simsimd_i8_t>("avx2_i8_l2sq", simsimd_avx2_i8_l2sq, simsimd_accurate_i8_l2sq);
+    register_<simsimd_u8_t>("avx2_u8_cos", simsimd_avx2_u8_cos, simsimd_accurate_u8_cos);
+    register_<simsimd_u8_t>("avx2_u8_l2sq", simsimd_avx2_u8_l2sq, simsimd_accurate_u8_l2sq);
+    register_<simsimd_i4x2_t>("avx2_i4x2_cos", simsimd_avx2_i4x2_cos, simsimd_serial_i4x2_cos);
+    register_<simsimd_i4x2_t>("avx2_i4x2_l2sq", simsimd_avx2_i4x2_l2sq, simsimd_serial_i4x2_l2sq);
+
+    register_<simsimd_b8_t>("avx2_b8_hamming", simsimd_avx2_b8_hamming, simsimd_serial_b8_hamming);
+    register_<simsimd_b8_t>("avx2_b8_jaccard", simsimd_avx2_b8_jaccard, simsimd_serial_b8_jaccard);
+
+    register_fixed_<simsimd_f16_t>("avx2_f16_ip", simsimd_avx2_f16_ip_768, simsimd_accurate_f16_ip, 768);
+    register_fixed_<simsimd_f16_t>("avx2_f16_ip", simsimd_avx2_f16_ip_1536, simsimd_accurate_f16_ip, 1536);
+    register_fixed_<simsimd_f16_t>("avx2_f16_cos", simsimd_avx2_f16_cos_768, simsimd_accurate_f16_cos, 768);
+    register_fixed_<simsimd_f16_t>("avx2_f16_cos", simsimd_avx2_f16_cos_1536, simsimd_accurate_f16_cos, 1536);
+    register_fixed_<simsimd_f16_t>("avx2_f16_l2sq", simsimd_avx2_f16_l2sq_768, simsimd_accurate_f16_l2sq, 768);
+    register_fixed_<simsimd_f16_t>("avx2_f16_l2sq", simsimd_avx2_f16_l2sq_1536, simsimd_accurate_f16_l2sq, 1536);
+
+    register_fixed_<simsimd_f32_t>("avx2_f32_ip", simsimd_avx2_f32_ip_768, simsimd_accurate_f32_ip, 768);
+    register_fixed_<simsimd_f32_t>("avx2_f32_ip", simsimd_avx2_f32_ip_1536, simsimd_accurate_f32_ip, 1536);
+    register_fixed_<simsimd_f32_t>("avx2_f32_cos", simsimd_avx2_f32_cos_768, simsimd_accurate_f32_cos, 768);
+    register_fixed_<simsimd_f32_t>("avx2_f32_cos", simsimd_avx2_f32_cos_1536, simsimd_accurate_f32_cos, 1536);
+    register_fixed_<simsimd_f32_t>("avx2_f32_l2sq", simsimd_avx2_f32_l2sq_768, simsimd_accurate_f32_l2sq, 768);
+    register_fixed_<simsimd_f32_t>("avx2_f32_l2sq", simsimd_avx2_f32_l2sq_1536, simsimd_accurate_f32_l2sq, 1536);
 #endif
 
 #if SIMSIMD_TARGET_X86_AVX512
@@ -175,14 +514,42 @@ int main(int argc, char** argv) {
     register_<simsimd_f16_t>("avx512_f16_kl", simsimd_avx512_f16_kl, simsimd_accurate_f16_kl);
     register_<simsimd_f16_t>("avx512_f16_js", simsimd_avx512_f16_js, simsimd_accurate_f16_js);
 
+    register_<simsimd_bf16_t>("avx512_bf16_ip", simsimd_avx512_bf16_ip, simsimd_accurate_bf16_ip);
+    register_<simsimd_bf16_t>("avx512_bf16_cos", simsimd_avx512_bf16_cos, simsimd_accurate_bf16_cos);
+    register_<simsimd_bf16_t>("avx512_bf16_l2sq", simsimd_avx512_bf16_l2sq, simsimd_accurate_bf16_l2sq);
+
     register_<simsimd_i8_t>("avx512_i8_cos", simsimd_avx512_i8_cos, simsimd_accurate_i8_cos);
     register_<simsimd_i8_t>("avx512_i8_l2sq", simsimd_avx512_i8_l2sq, simsimd_accurate_i8_l2sq);
+    register_<simsimd_u8_t>("avx512_u8_cos", simsimd_avx512_u8_cos, simsimd_accurate_u8_cos);
+    register_<simsimd_u8_t>("avx512_u8_l2sq", simsimd_avx512_u8_l2sq, simsimd_accurate_u8_l2sq);
+    register_<simsimd_i4x2_t>("avx512_i4x2_cos", simsimd_avx512_i4x2_cos, simsimd_serial_i4x2_cos);
+    register_<simsimd_i4x2_t>("avx512_i4x2_l2sq", simsimd_avx512_i4x2_l2sq, simsimd_serial_i4x2_l2sq);
 
     register_<simsimd_f32_t>("avx512_f32_ip", simsimd_avx512_f32_ip, simsimd_accurate_f32_ip);
     register_<simsimd_f32_t>("avx512_f32_cos", simsimd_avx512_f32_cos, simsimd_accurate_f32_cos);
     register_<simsimd_f32_t>("avx512_f32_l2sq", simsimd_avx512_f32_l2sq, simsimd_accurate_f32_l2sq);
     register_<simsimd_f32_t>("avx512_f32_kl", simsimd_avx512_f32_kl, simsimd_accurate_f32_kl);
     register_<simsimd_f32_t>("avx512_f32_js", simsimd_avx512_f32_js, simsimd_accurate_f32_js);
+
+    register_<simsimd_f64_t>("avx512_f64_ip", simsimd_avx512_f64_ip, simsimd_serial_f64_ip);
+    register_<simsimd_f64_t>("avx512_f64_cos", simsimd_avx512_f64_cos, simsimd_serial_f64_cos);
+    register_<simsimd_f64_t>("avx512_f64_l2sq", simsimd_avx512_f64_l2sq, simsimd_serial_f64_l2sq);
+    register_<simsimd_f64_t>("avx512_f64_kl", simsimd_avx512_f64_kl, simsimd_serial_f64_kl);
+    register_<simsimd_f64_t>("avx512_f64_js", simsimd_avx512_f64_js, simsimd_serial_f64_js);
+
+    register_fixed_<simsimd_f16_t>("avx512_f16_ip", simsimd_avx512_f16_ip_768, simsimd_accurate_f16_ip, 768);
+    register_fixed_<simsimd_f16_t>("avx512_f16_ip", simsimd_avx512_f16_ip_1536, simsimd_accurate_f16_ip, 1536);
+    register_fixed_<simsimd_f16_t>("avx512_f16_cos", simsimd_avx512_f16_cos_768, simsimd_accurate_f16_cos, 768);
+    register_fixed_<simsimd_f16_t>("avx512_f16_cos", simsimd_avx512_f16_cos_1536, simsimd_accurate_f16_cos, 1536);
+    register_fixed_<simsimd_f16_t>("avx512_f16_l2sq", simsimd_avx512_f16_l2sq_768, simsimd_accurate_f16_l2sq, 768);
+    register_fixed_<simsimd_f16_t>("avx512_f16_l2sq", simsimd_avx512_f16_l2sq_1536, simsimd_accurate_f16_l2sq, 1536);
+
+    register_fixed_<simsimd_f32_t>("avx512_f32_ip", simsimd_avx512_f32_ip_768, simsimd_accurate_f32_ip, 768);
+    register_fixed_<simsimd_f32_t>("avx512_f32_ip", simsimd_avx512_f32_ip_1536, simsimd_accurate_f32_ip, 1536);
+    register_fixed_<simsimd_f32_t>("avx512_f32_cos", simsimd_avx512_f32_cos_768, simsimd_accurate_f32_cos, 768);
+    register_fixed_<simsimd_f32_t>("avx512_f32_cos", simsimd_avx512_f32_cos_1536, simsimd_accurate_f32_cos, 1536);
+    register_fixed_<simsimd_f32_t>("avx512_f32_l2sq", simsimd_avx512_f32_l2sq_768, simsimd_accurate_f32_l2sq, 768);
+    register_fixed_<simsimd_f32_t>("avx512_f32_l2sq", simsimd_avx512_f32_l2sq_1536, simsimd_accurate_f32_l2sq, 1536);
 #endif
 
     register_<simsimd_f16_t>("serial_f16_ip", simsimd_serial_f16_ip, simsimd_accurate_f16_ip);
@@ -191,6 +558,10 @@ int main(int argc, char** argv) {
     register_<simsimd_f16_t>("serial_f16_kl", simsimd_serial_f16_kl, simsimd_accurate_f16_kl);
     register_<simsimd_f16_t>("serial_f16_js", simsimd_serial_f16_js, simsimd_accurate_f16_js);
 
+    register_<simsimd_bf16_t>("serial_bf16_ip", simsimd_serial_bf16_ip, simsimd_accurate_bf16_ip);
+    register_<simsimd_bf16_t>("serial_bf16_cos", simsimd_serial_bf16_cos, simsimd_accurate_bf16_cos);
+    register_<simsimd_bf16_t>("serial_bf16_l2sq", simsimd_serial_bf16_l2sq, simsimd_accurate_bf16_l2sq);
+
     register_<simsimd_f32_t>("serial_f32_ip", simsimd_serial_f32_ip, simsimd_accurate_f32_ip);
     register_<simsimd_f32_t>("serial_f32_cos", simsimd_serial_f32_cos, simsimd_accurate_f32_cos);
     register_<simsimd_f32_t>("serial_f32_l2sq", simsimd_serial_f32_l2sq, simsimd_accurate_f32_l2sq);
@@ -199,6 +570,15 @@ int main(int argc, char** argv) {
 
     register_<simsimd_i8_t>("serial_i8_cos", simsimd_serial_i8_cos, simsimd_accurate_i8_cos);
     register_<simsimd_i8_t>("serial_i8_l2sq", simsimd_serial_i8_l2sq, simsimd_accurate_i8_l2sq);
+    register_<simsimd_u8_t>("serial_u8_cos", simsimd_serial_u8_cos, simsimd_accurate_u8_cos);
+    register_<simsimd_u8_t>("serial_u8_l2sq", simsimd_serial_u8_l2sq, simsimd_accurate_u8_l2sq);
+    register_<simsimd_i4x2_t>("serial_i4x2_cos", simsimd_serial_i4x2_cos, simsimd_serial_i4x2_cos);
+    register_<simsimd_i4x2_t>("serial_i4x2_l2sq", simsimd_serial_i4x2_l2sq, simsimd_serial_i4x2_l2sq);
+
+    register_<simsimd_b8_t>("serial_b8_hamming", simsimd_serial_b8_hamming, simsimd_serial_b8_hamming);
+    register_<simsimd_b8_t>("serial_b8_jaccard", simsimd_serial_b8_jaccard, simsimd_serial_b8_jaccard);
+
+    register_datasets();
 
     bm::RunSpecifiedBenchmarks();
     bm::Shutdown();
@@ -37,4 +37,22 @@ func BenchmarkCosineSimilaritySIMD(b *testing.B) {
     for i := 0; i < b.N; i++ {
         CosineF32(first, second)
     }
-}
\ No newline at end of file
+}
+func BenchmarkOneToManySIMD(b *testing.B) {
+	query, matrix := generateRandomVector(1536), generateRandomVector(1536*1000)
+	results := make([]float32, 1000)
+	for i := 0; i < b.N; i++ {
+		OneToManyF32(Cosine, query, matrix, results)
+	}
+}
+
+func BenchmarkOneToRowsSIMD(b *testing.B) {
+	query, rows := generateRandomVector(1536), make([][]float32, 1000)
+	for i := range rows {
+		rows[i] = generateRandomVector(1536)
+	}
+	results := make([]float32, 1000)
+	for i := 0; i < b.N; i++ {
+		OneToRowsF32(Cosine, query, rows, results)
+	}
+}
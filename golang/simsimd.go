@@ -1,47 +1,425 @@
 package simsimd
 
 /*
-#cgo CFLAGS: -O3
-#cgo LDFLAGS: -O3 -L.
-#include "../simsimd/simsimd.h"
+#cgo CFLAGS: -O3 -I${SRCDIR}/../include
+#cgo LDFLAGS: -O3 -lm
+#cgo linux,amd64 CFLAGS: -DSIMSIMD_TARGET_X86_AVX2=1 -DSIMSIMD_TARGET_X86_AVX512=1
+#cgo linux,arm64 CFLAGS: -DSIMSIMD_TARGET_ARM_NEON=1 -DSIMSIMD_TARGET_ARM_SVE=1
+#cgo darwin,amd64 CFLAGS: -DSIMSIMD_TARGET_X86_AVX2=1
+#cgo darwin,arm64 CFLAGS: -DSIMSIMD_TARGET_ARM_NEON=1
+
+#define SIMSIMD_RSQRT simsimd_approximate_inverse_square_root
+#include "simsimd/simsimd.h"
 #include <stdlib.h>
+#include <string.h>
 
-inline static simsimd_f32_t cosine_i8(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t d) { return simsimd_metric_punned(simsimd_metric_cosine_k, simsimd_datatype_i8_k, simsimd_cap_any_k)(a, b, d, d); }
-inline static simsimd_f32_t cosine_f32(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t d) { return simsimd_neon_f32_cos(a, b, d); }
-inline static simsimd_f32_t inner_i8(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t d) { return simsimd_metric_punned(simsimd_metric_inner_k, simsimd_datatype_i8_k, simsimd_cap_any_k)(a, b, d, d); }
-inline static simsimd_f32_t inner_f32(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t d) { return simsimd_metric_punned(simsimd_metric_inner_k, simsimd_datatype_f32_k, simsimd_cap_any_k)(a, b, d, d); }
-inline static simsimd_f32_t sqeuclidean_i8(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t d) { return simsimd_metric_punned(simsimd_metric_sqeuclidean_k, simsimd_datatype_i8_k, simsimd_cap_any_k)(a, b, d, d); }
-inline static simsimd_f32_t sqeuclidean_f32(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t d) { return simsimd_metric_punned(simsimd_metric_sqeuclidean_k, simsimd_datatype_f32_k, simsimd_cap_any_k)(a, b, d, d); }
+// Go can't call C function pointers directly, so we forward the pre-resolved pointers through these helpers
+static simsimd_f32_t simsimd_go_metric(simsimd_metric_punned_t metric, void const* a, void const* b, simsimd_size_t d) {
+    return metric(a, b, d, d);
+}
+static void simsimd_go_find(simsimd_metric_kind_t kind, simsimd_datatype_t datatype, simsimd_capability_t capabilities,
+                            simsimd_metric_punned_t* metric, simsimd_batch_punned_t* batch,
+                            simsimd_capability_t* capability) {
+    simsimd_capability_t batch_capability = simsimd_cap_serial_k;
+    simsimd_find_metric_punned(kind, datatype, capabilities, simsimd_cap_any_k, metric, capability);
+    simsimd_find_batch_punned(kind, datatype, capabilities, simsimd_cap_any_k, batch, &batch_capability);
+}
+static simsimd_capability_t simsimd_go_capability(char const* name) {
+    for (int bit = 0; bit != 32; ++bit) {
+        char const* candidate = simsimd_capability_name((simsimd_capability_t)(1u << bit));
+        if (candidate && strcmp(candidate, name) == 0)
+            return (simsimd_capability_t)(1u << bit);
+    }
+    return (simsimd_capability_t)0;
+}
 */
 import "C"
+import (
+	"errors"
+	"unsafe"
+)
+
+// Metric enumerates the supported distance functions, for the batch APIs.
+type Metric int
+
+const (
+	Cosine Metric = iota
+	Inner
+	SqEuclidean
+	KullbackLeibler
+	JensenShannon
+	Hamming
+	Jaccard
+	metricsCount
+)
+
+var metricKinds = [metricsCount]C.simsimd_metric_kind_t{
+	C.simsimd_metric_cos_k,
+	C.simsimd_metric_ip_k,
+	C.simsimd_metric_l2sq_k,
+	C.simsimd_metric_kl_k,
+	C.simsimd_metric_js_k,
+	C.simsimd_metric_hamming_k,
+	C.simsimd_metric_jaccard_k,
+}
+
+const (
+	datatypeF64 = iota
+	datatypeF32
+	datatypeF16
+	datatypeI8
+	datatypeB8
+	datatypesCount
+)
+
+var datatypeNames = [datatypesCount]string{"f64", "f32", "f16", "i8", "b8"}
+
+var datatypes = [datatypesCount]C.simsimd_datatype_t{
+	C.simsimd_datatype_f64_k,
+	C.simsimd_datatype_f32_k,
+	C.simsimd_datatype_f16_k,
+	C.simsimd_datatype_i8_k,
+	C.simsimd_datatype_b8_k,
+}
+
+type kernels struct {
+	metric     C.simsimd_metric_punned_t
+	batch      C.simsimd_batch_punned_t
+	capability C.simsimd_capability_t
+}
+
+// Resolved just once, when the package is loaded, so that every call is a single indirect jump.
+var dispatch [metricsCount][datatypesCount]kernels
+
+// The capabilities, that the kernels in the dispatch table may rely on.
+var enabled C.simsimd_capability_t
+
+func init() {
+	enabled = C.simsimd_capabilities()
+	resolve()
+}
+
+func resolve() {
+	for metric := range dispatch {
+		for datatype := range dispatch[metric] {
+			resolved := &dispatch[metric][datatype]
+			C.simsimd_go_find(metricKinds[metric], datatypes[datatype], enabled, &resolved.metric, &resolved.batch,
+				&resolved.capability)
+		}
+	}
+}
+
+func parseCapability(name string) (C.simsimd_capability_t, error) {
+	cName := C.CString(name)
+	defer C.free(unsafe.Pointer(cName))
+	capability := C.simsimd_go_capability(cName)
+	if capability == 0 {
+		return 0, errors.New("simsimd: unknown capability " + name)
+	}
+	return capability, nil
+}
+
+// Kernel names the hardware capability, like "x86_avx512" or "serial", of the kernel, that the functions
+// of the given metric use for the given scalar type: "f64", "f32", "f16", "i8", or "b8".
+// Returns an empty string for unsupported combinations.
+func Kernel(metric Metric, datatype string) string {
+	for i, name := range datatypeNames {
+		if name == datatype && metric >= 0 && metric < metricsCount && dispatch[metric][i].metric != nil {
+			return C.GoString(C.simsimd_capability_name(dispatch[metric][i].capability))
+		}
+	}
+	return ""
+}
+
+// DisableCapability forbids the kernels relying on the named hardware capability, to compare the backends.
+// It isn't safe to call concurrently with the distance functions.
+func DisableCapability(name string) error {
+	capability, err := parseCapability(name)
+	if err != nil {
+		return err
+	}
+	if capability == C.simsimd_cap_serial_k {
+		return errors.New("simsimd: the serial kernels can't be disabled")
+	}
+	enabled &^= capability
+	resolve()
+	return nil
+}
+
+// EnableCapability allows the kernels relying on the named hardware capability again.
+// It isn't safe to call concurrently with the distance functions.
+func EnableCapability(name string) error {
+	capability, err := parseCapability(name)
+	if err != nil {
+		return err
+	}
+	if C.simsimd_capabilities()&capability == 0 {
+		return errors.New("simsimd: the capability isn't supported by this machine: " + name)
+	}
+	enabled |= capability
+	resolve()
+	return nil
+}
+
+func lookup(metric Metric, datatype int) *kernels {
+	if metric < 0 || metric >= metricsCount || dispatch[metric][datatype].metric == nil {
+		panic("simsimd: unsupported metric and datatype combination")
+	}
+	return &dispatch[metric][datatype]
+}
+
+func distance[T any](k *kernels, a, b []T) float32 {
+	if len(a) != len(b) {
+		panic("simsimd: vectors must have the same length")
+	}
+	if len(a) == 0 {
+		panic("simsimd: vectors can't be empty")
+	}
+	return float32(C.simsimd_go_metric(k.metric, unsafe.Pointer(&a[0]), unsafe.Pointer(&b[0]), C.simsimd_size_t(len(a))))
+}
 
+func oneToMany[T any](k *kernels, query, matrix []T, results []float32) {
+	dimensions := len(query)
+	if dimensions == 0 || len(matrix)%dimensions != 0 {
+		panic("simsimd: the matrix length must be a multiple of the query length")
+	}
+	count := len(matrix) / dimensions
+	if len(results) < count {
+		panic("simsimd: the results slice is too short")
+	}
+	if count == 0 {
+		return
+	}
+	stride := uintptr(dimensions) * unsafe.Sizeof(query[0])
+	C.simsimd_one_to_many(k.metric, k.batch, unsafe.Pointer(&query[0]), unsafe.Pointer(&matrix[0]),
+		C.simsimd_size_t(count), C.simsimd_size_t(stride), C.simsimd_size_t(dimensions), (*C.simsimd_f32_t)(&results[0]))
+}
+
+func manyToMany[T any](k *kernels, a, b []T, dimensions int, results []float32) {
+	if dimensions <= 0 || len(a)%dimensions != 0 || len(b)%dimensions != 0 {
+		panic("simsimd: the matrix lengths must be multiples of the number of dimensions")
+	}
+	aCount, bCount := len(a)/dimensions, len(b)/dimensions
+	if len(results) < aCount*bCount {
+		panic("simsimd: the results slice is too short")
+	}
+	if aCount == 0 || bCount == 0 {
+		return
+	}
+	stride := uintptr(dimensions) * unsafe.Sizeof(a[0])
+	C.simsimd_many_to_many(k.metric, k.batch,
+		unsafe.Pointer(&a[0]), C.simsimd_size_t(aCount), C.simsimd_size_t(stride),
+		unsafe.Pointer(&b[0]), C.simsimd_size_t(bCount), C.simsimd_size_t(stride),
+		C.simsimd_size_t(dimensions), (*C.simsimd_f32_t)(&results[0]), C.simsimd_size_t(uintptr(bCount)*4))
+}
 
-// CosineI8 computes the cosine similarity between two i8 vectors using the most suitable SIMD instruction set available.
+// oneToRows compares the query against separately allocated rows. If they happen to be laid out
+// back-to-back, like when sliced from a single flat array, a single batch call is made. Otherwise the
+// rows are copied into one C-allocated buffer first, to still pay for just one cgo transition.
+func oneToRows[T any](k *kernels, query []T, rows [][]T, results []float32) {
+	if len(results) < len(rows) {
+		panic("simsimd: the results slice is too short")
+	}
+	if len(rows) == 0 {
+		return
+	}
+	dimensions := len(query)
+	if dimensions == 0 {
+		panic("simsimd: vectors can't be empty")
+	}
+	contiguous := true
+	scalar := unsafe.Sizeof(query[0])
+	for i := range rows {
+		if len(rows[i]) != dimensions {
+			panic("simsimd: vectors must have the same length")
+		}
+		if i > 0 && uintptr(unsafe.Pointer(&rows[i][0])) != uintptr(unsafe.Pointer(&rows[i-1][0]))+uintptr(dimensions)*scalar {
+			contiguous = false
+		}
+	}
+	if contiguous {
+		flat := unsafe.Slice(&rows[0][0], len(rows)*dimensions)
+		oneToMany(k, query, flat, results)
+		return
+	}
+	// Go pointers to Go memory, like the addresses of the rows, can't be passed to C without pinning them
+	buffer := C.malloc(C.size_t(uintptr(len(rows)*dimensions) * scalar))
+	if buffer == nil {
+		panic("simsimd: failed to allocate memory")
+	}
+	defer C.free(buffer)
+	flat := unsafe.Slice((*T)(buffer), len(rows)*dimensions)
+	for i := range rows {
+		copy(flat[i*dimensions:(i+1)*dimensions], rows[i])
+	}
+	oneToMany(k, query, flat, results)
+}
+
+// CosineI8 computes the cosine distance between two i8 vectors using the most suitable SIMD instruction set available.
 func CosineI8(a, b []int8) float32 {
-	return float32(C.cosine_i8((*C.simsimd_i8_t)(&a[0]), (*C.simsimd_i8_t)(&b[0]), C.simsimd_size_t(len(a))))
+	return distance(&dispatch[Cosine][datatypeI8], a, b)
+}
+
+// CosineF16 computes the cosine distance between two f16 vectors, stored as IEEE 754 half-precision bits.
+func CosineF16(a, b []uint16) float32 {
+	return distance(&dispatch[Cosine][datatypeF16], a, b)
 }
 
-// CosineF32 computes the cosine similarity between two i8 vectors using the most suitable SIMD instruction set available.
+// CosineF32 computes the cosine distance between two f32 vectors using the most suitable SIMD instruction set available.
 func CosineF32(a, b []float32) float32 {
-	return float32(C.cosine_f32((*C.simsimd_f32_t)(&a[0]), (*C.simsimd_f32_t)(&b[0]), C.simsimd_size_t(len(a))))
+	return distance(&dispatch[Cosine][datatypeF32], a, b)
+}
+
+// CosineF64 computes the cosine distance between two f64 vectors using the most suitable SIMD instruction set available.
+func CosineF64(a, b []float64) float32 {
+	return distance(&dispatch[Cosine][datatypeF64], a, b)
 }
 
-// InnerI8 computes the inner-product similarity between two i8 vectors using the most suitable SIMD instruction set available.
+// InnerI8 computes the inner-product distance between two i8 vectors using the most suitable SIMD instruction set available.
 func InnerI8(a, b []int8) float32 {
-	return float32(C.inner_i8((*C.simsimd_i8_t)(&a[0]), (*C.simsimd_i8_t)(&b[0]), C.simsimd_size_t(len(a))))
+	return distance(&dispatch[Inner][datatypeI8], a, b)
 }
 
-// InnerF32 computes the inner-product similarity between two i8 vectors using the most suitable SIMD instruction set available.
+// InnerF16 computes the inner-product distance between two f16 vectors, stored as IEEE 754 half-precision bits.
+func InnerF16(a, b []uint16) float32 {
+	return distance(&dispatch[Inner][datatypeF16], a, b)
+}
+
+// InnerF32 computes the inner-product distance between two f32 vectors using the most suitable SIMD instruction set available.
 func InnerF32(a, b []float32) float32 {
-	return float32(C.inner_f32((*C.simsimd_f32_t)(&a[0]), (*C.simsimd_f32_t)(&b[0]), C.simsimd_size_t(len(a))))
+	return distance(&dispatch[Inner][datatypeF32], a, b)
 }
 
-// SqEuclideanI8 computes the squared euclidean similarity between two i8 vectors using the most suitable SIMD instruction set available.
+// InnerF64 computes the inner-product distance between two f64 vectors using the most suitable SIMD instruction set available.
+func InnerF64(a, b []float64) float32 {
+	return distance(&dispatch[Inner][datatypeF64], a, b)
+}
+
+// SqEuclideanI8 computes the squared Euclidean distance between two i8 vectors using the most suitable SIMD instruction set available.
 func SqEuclideanI8(a, b []int8) float32 {
-	return float32(C.sqeuclidean_i8((*C.simsimd_i8_t)(&a[0]), (*C.simsimd_i8_t)(&b[0]), C.simsimd_size_t(len(a))))
+	return distance(&dispatch[SqEuclidean][datatypeI8], a, b)
 }
 
-// SqEuclideanF32 computes the squared euclidean similarity between two i8 vectors using the most suitable SIMD instruction set available.
+// SqEuclideanF16 computes the squared Euclidean distance between two f16 vectors, stored as IEEE 754 half-precision bits.
+func SqEuclideanF16(a, b []uint16) float32 {
+	return distance(&dispatch[SqEuclidean][datatypeF16], a, b)
+}
+
+// SqEuclideanF32 computes the squared Euclidean distance between two f32 vectors using the most suitable SIMD instruction set available.
 func SqEuclideanF32(a, b []float32) float32 {
-	return float32(C.sqeuclidean_f32((*C.simsimd_f32_t)(&a[0]), (*C.simsimd_f32_t)(&b[0]), C.simsimd_size_t(len(a))))
+	return distance(&dispatch[SqEuclidean][datatypeF32], a, b)
+}
+
+// SqEuclideanF64 computes the squared Euclidean distance between two f64 vectors using the most suitable SIMD instruction set available.
+func SqEuclideanF64(a, b []float64) float32 {
+	return distance(&dispatch[SqEuclidean][datatypeF64], a, b)
+}
+
+// KullbackLeiblerF16 computes the Kullback-Leibler divergence between two f16 probability distributions.
+func KullbackLeiblerF16(a, b []uint16) float32 {
+	return distance(&dispatch[KullbackLeibler][datatypeF16], a, b)
+}
+
+// KullbackLeiblerF32 computes the Kullback-Leibler divergence between two f32 probability distributions.
+func KullbackLeiblerF32(a, b []float32) float32 {
+	return distance(&dispatch[KullbackLeibler][datatypeF32], a, b)
+}
+
+// KullbackLeiblerF64 computes the Kullback-Leibler divergence between two f64 probability distributions.
+func KullbackLeiblerF64(a, b []float64) float32 {
+	return distance(&dispatch[KullbackLeibler][datatypeF64], a, b)
+}
+
+// JensenShannonF16 computes the Jensen-Shannon divergence between two f16 probability distributions.
+func JensenShannonF16(a, b []uint16) float32 {
+	return distance(&dispatch[JensenShannon][datatypeF16], a, b)
+}
+
+// JensenShannonF32 computes the Jensen-Shannon divergence between two f32 probability distributions.
+func JensenShannonF32(a, b []float32) float32 {
+	return distance(&dispatch[JensenShannon][datatypeF32], a, b)
+}
+
+// JensenShannonF64 computes the Jensen-Shannon divergence between two f64 probability distributions.
+func JensenShannonF64(a, b []float64) float32 {
+	return distance(&dispatch[JensenShannon][datatypeF64], a, b)
+}
+
+// HammingB8 computes the bitwise Hamming distance between two binary vectors, packed 8 bits per byte.
+func HammingB8(a, b []uint8) float32 {
+	return distance(&dispatch[Hamming][datatypeB8], a, b)
+}
+
+// JaccardB8 computes the bitwise Jaccard distance between two binary vectors, packed 8 bits per byte.
+func JaccardB8(a, b []uint8) float32 {
+	return distance(&dispatch[Jaccard][datatypeB8], a, b)
+}
+
+// OneToManyF32 computes the distances between the query and every row of a flat row-major matrix,
+// writing them into the results, crossing into C just once for the whole batch.
+func OneToManyF32(metric Metric, query, matrix []float32, results []float32) {
+	oneToMany(lookup(metric, datatypeF32), query, matrix, results)
+}
+
+// OneToManyF64 computes the distances between the query and every row of a flat row-major matrix.
+func OneToManyF64(metric Metric, query, matrix []float64, results []float32) {
+	oneToMany(lookup(metric, datatypeF64), query, matrix, results)
+}
+
+// OneToManyF16 computes the distances between the query and every row of a flat row-major matrix of f16 bits.
+func OneToManyF16(metric Metric, query, matrix []uint16, results []float32) {
+	oneToMany(lookup(metric, datatypeF16), query, matrix, results)
+}
+
+// OneToManyI8 computes the distances between the query and every row of a flat row-major matrix.
+func OneToManyI8(metric Metric, query, matrix []int8, results []float32) {
+	oneToMany(lookup(metric, datatypeI8), query, matrix, results)
+}
+
+// OneToManyB8 computes the distances between the query and every row of a flat matrix of packed bits.
+func OneToManyB8(metric Metric, query, matrix []uint8, results []float32) {
+	oneToMany(lookup(metric, datatypeB8), query, matrix, results)
+}
+
+// OneToRowsF32 computes the distances between the query and every row. Rows sliced back-to-back from
+// a single flat array are processed by the batch kernels, others are compared one by one in a single cgo call.
+func OneToRowsF32(metric Metric, query []float32, rows [][]float32, results []float32) {
+	oneToRows(lookup(metric, datatypeF32), query, rows, results)
+}
+
+// OneToRowsF64 computes the distances between the query and every row, like OneToRowsF32.
+func OneToRowsF64(metric Metric, query []float64, rows [][]float64, results []float32) {
+	oneToRows(lookup(metric, datatypeF64), query, rows, results)
+}
+
+// OneToRowsI8 computes the distances between the query and every row, like OneToRowsF32.
+func OneToRowsI8(metric Metric, query []int8, rows [][]int8, results []float32) {
+	oneToRows(lookup(metric, datatypeI8), query, rows, results)
+}
+
+// ManyToManyF32 computes all pairwise distances between the rows of two flat row-major matrices,
+// writing a row of results for every row of the first matrix.
+func ManyToManyF32(metric Metric, a, b []float32, dimensions int, results []float32) {
+	manyToMany(lookup(metric, datatypeF32), a, b, dimensions, results)
+}
+
+// ManyToManyF64 computes all pairwise distances between the rows of two flat row-major matrices.
+func ManyToManyF64(metric Metric, a, b []float64, dimensions int, results []float32) {
+	manyToMany(lookup(metric, datatypeF64), a, b, dimensions, results)
+}
+
+// ManyToManyF16 computes all pairwise distances between the rows of two flat row-major matrices of f16 bits.
+func ManyToManyF16(metric Metric, a, b []uint16, dimensions int, results []float32) {
+	manyToMany(lookup(metric, datatypeF16), a, b, dimensions, results)
+}
+
+// ManyToManyI8 computes all pairwise distances between the rows of two flat row-major matrices.
+func ManyToManyI8(metric Metric, a, b []int8, dimensions int, results []float32) {
+	manyToMany(lookup(metric, datatypeI8), a, b, dimensions, results)
+}
+
+// ManyToManyB8 computes all pairwise distances between the rows of two flat matrices of packed bits,
+// where the dimensions are counted in bytes.
+func ManyToManyB8(metric Metric, a, b []uint8, dimensions int, results []float32) {
+	manyToMany(lookup(metric, datatypeB8), a, b, dimensions, results)
 }
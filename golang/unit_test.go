@@ -38,3 +38,114 @@ func TestVectorLengthMismatch(t *testing.T) {
 	b := []int8{0}
 	_ = CosineI8(a, b) // This should panic
 }
+
+func TestAllMetrics(t *testing.T) {
+	a64, b64 := []float64{0.2, 0.3, 0.5}, []float64{0.5, 0.3, 0.2}
+	a32, b32 := []float32{0.2, 0.3, 0.5}, []float32{0.5, 0.3, 0.2}
+	a16, b16 := []uint16{0x3266, 0x34cd, 0x3800}, []uint16{0x3800, 0x34cd, 0x3266} // 0.2, 0.3, 0.5
+	checks := []struct {
+		name     string
+		result   float32
+		expected float32
+	}{
+		{"SqEuclideanF64", SqEuclideanF64(a64, b64), 0.18},
+		{"SqEuclideanF32", SqEuclideanF32(a32, b32), 0.18},
+		{"SqEuclideanF16", SqEuclideanF16(a16, b16), 0.18},
+		{"InnerF64", InnerF64(a64, b64), 0.71},
+		{"InnerF32", InnerF32(a32, b32), 0.71},
+		{"InnerF16", InnerF16(a16, b16), 0.71},
+		{"CosineF64", CosineF64(a64, b64), 1 - 0.29/0.38},
+		{"CosineF16", CosineF16(a16, b16), 1 - 0.29/0.38},
+		{"KullbackLeiblerF32", KullbackLeiblerF32(a32, a32), 0},
+		{"KullbackLeiblerF64", KullbackLeiblerF64(a64, a64), 0},
+		{"JensenShannonF32", JensenShannonF32(a32, a32), 0},
+		{"JensenShannonF16", JensenShannonF16(a16, a16), 0},
+		{"HammingB8", HammingB8([]uint8{0xFF, 0x0F}, []uint8{0x0F, 0x0F}), 4},
+		{"JaccardB8", JaccardB8([]uint8{0xFF, 0x00}, []uint8{0x0F, 0x00}), 0.5},
+	}
+	for _, check := range checks {
+		if math.Abs(float64(check.result-check.expected)) > 1e-2 {
+			t.Errorf("%s: expected %v, got %v", check.name, check.expected, check.result)
+		}
+	}
+}
+
+func TestBatches(t *testing.T) {
+	const dimensions, count = 7, 13
+	matrix := make([]float32, dimensions*count)
+	rows := make([][]float32, count)
+	for i := range matrix {
+		matrix[i] = float32(i%5) + 1
+	}
+	for i := range rows {
+		rows[i] = matrix[i*dimensions : (i+1)*dimensions]
+	}
+	query := rows[3]
+
+	results := make([]float32, count)
+	OneToManyF32(SqEuclidean, query, matrix, results)
+	for i := range rows {
+		if expected := SqEuclideanF32(query, rows[i]); math.Abs(float64(results[i]-expected)) > 1e-3 {
+			t.Errorf("OneToManyF32: expected %v, got %v for row %d", expected, results[i], i)
+		}
+	}
+
+	// Mixing contiguous and separately allocated rows
+	rows[5] = append([]float32(nil), rows[5]...)
+	OneToRowsF32(Cosine, query, rows, results)
+	for i := range rows {
+		if expected := CosineF32(query, rows[i]); math.Abs(float64(results[i]-expected)) > 1e-3 {
+			t.Errorf("OneToRowsF32: expected %v, got %v for row %d", expected, results[i], i)
+		}
+	}
+
+	// Every row separately allocated, all compared in a single cgo call
+	for i := range rows {
+		rows[i] = append([]float32(nil), rows[i]...)
+	}
+	OneToRowsF32(SqEuclidean, query, rows, results)
+	for i := range rows {
+		if expected := SqEuclideanF32(query, rows[i]); math.Abs(float64(results[i]-expected)) > 1e-3 {
+			t.Errorf("OneToRowsF32: expected %v, got %v for separately allocated row %d", expected, results[i], i)
+		}
+	}
+
+	pairwise := make([]float32, count*count)
+	ManyToManyF32(Inner, matrix, matrix, dimensions, pairwise)
+	for i := range rows {
+		for j := range rows {
+			if expected := InnerF32(rows[i], rows[j]); math.Abs(float64(pairwise[i*count+j]-expected)) > 1e-3 {
+				t.Errorf("ManyToManyF32: expected %v, got %v for rows %d and %d", expected, pairwise[i*count+j], i, j)
+			}
+		}
+	}
+}
+
+func TestKernelCapabilities(t *testing.T) {
+	best := Kernel(Cosine, "f32")
+	if best == "" || Kernel(KullbackLeibler, "b8") != "" {
+		t.Fatalf("Unexpected kernels: %q for cosine, %q for binary divergence", best, Kernel(KullbackLeibler, "b8"))
+	}
+	a, b := []float32{1, 2, 3}, []float32{4, 5, 6}
+	expected := CosineF32(a, b)
+	if best != "serial" {
+		if err := DisableCapability(best); err != nil {
+			t.Fatal(err)
+		}
+		if Kernel(Cosine, "f32") == best {
+			t.Errorf("The %q kernel is still used after disabling it", best)
+		}
+		if math.Abs(float64(CosineF32(a, b)-expected)) > 1e-3 {
+			t.Errorf("Expected %v, got %v", expected, CosineF32(a, b))
+		}
+		if err := EnableCapability(best); err != nil {
+			t.Fatal(err)
+		}
+	}
+	if Kernel(Cosine, "f32") != best {
+		t.Errorf("Expected the %q kernel after enabling it again, got %q", best, Kernel(Cosine, "f32"))
+	}
+	if DisableCapability("serial") == nil || DisableCapability("x86_avx1024") == nil {
+		t.Errorf("Expected errors for the serial and unknown capabilities")
+	}
+}
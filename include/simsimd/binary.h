@@ -12,7 +12,7 @@
  *
  *  For hardware architectures:
  *  - Arm (NEON, SVE)
- *  - x86 (AVX512)
+ *  - x86 (AVX2, AVX512)
  *
  *  x86 intrinsics: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/
  *  Arm intrinsics: https://developer.arm.com/architectures/instruction-sets/intrinsics/
@@ -54,14 +54,70 @@ inline static simsimd_f32_t simsimd_serial_b8_jaccard( //
     return (union_ != 0) ? 1 - (simsimd_f32_t)intersection / (simsimd_f32_t)union_ : 0;
 }
 
+/**
+ *  @brief  Number of bytes after which the bounded batch kernels check, if all the rows they are
+ *          processing at once are already further from the query than the `max_distance`.
+ */
+#define SIMSIMD_B8_BOUNDED_CHECK_BYTES 256
+
+/**
+ *  @brief  Computes the Hamming distances from one query to `count` rows, abandoning the rows as soon
+ *          as they are known to be further than `max_distance`. Such rows get a partial distance, that
+ *          is still guaranteed to exceed the threshold, so the callers may filter them out.
+ */
+inline static void simsimd_serial_b8_hamming_bounded(                                               //
+    simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t count, simsimd_size_t stride, //
+    simsimd_size_t n_words, simsimd_f32_t max_distance, simsimd_f32_t* results) {
+    for (simsimd_size_t j = 0; j != count; ++j) {
+        simsimd_b8_t const* b_j = (simsimd_b8_t const*)((char const*)b + j * stride);
+        simsimd_i32_t differences = 0;
+        for (simsimd_size_t i = 0; i != n_words; ++i) {
+            differences += simsimd_popcount_b8(a[i] ^ b_j[i]);
+            if ((i + 1) % SIMSIMD_B8_BOUNDED_CHECK_BYTES == 0 && (simsimd_f32_t)differences > max_distance)
+                break;
+        }
+        results[j] = (simsimd_f32_t)differences;
+    }
+}
+
+inline static void simsimd_serial_b8_hamming_batch(                                                 //
+    simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t count, simsimd_size_t stride, //
+    simsimd_size_t n_words, simsimd_f32_t* results) {
+    simsimd_serial_b8_hamming_bounded(a, b, count, stride, n_words, (simsimd_f32_t)(n_words * 8), results);
+}
+
 #if SIMSIMD_TARGET_ARM
 #if SIMSIMD_TARGET_ARM_NEON
 
+/*
+ *  @file   arm_neon_b8.h
+ *  @brief  Arm NEON implementation of the binary similarity metrics for 8-bit words.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: Hamming distance, Jaccard distance.
+ *  - Uses two independent accumulators, to hide the latency of the `vcntq_u8` instructions.
+ *  - Accumulates per-byte counts in `u8` for up to 31 iterations, before widening them with `vpadalq`.
+ *  - Requires compiler capabilities: +simd.
+ */
+
 __attribute__((target("+simd"))) //
 inline static simsimd_f32_t
 simsimd_neon_b8_hamming(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t n_words) {
-    simsimd_i32_t differences = 0;
+    uint32x4_t differences_vec = vdupq_n_u32(0);
     simsimd_size_t i = 0;
+    // Each `vcntq_u8` lane is at most 8, so a `u8` lane can absorb 31 of them without overflowing
+    while (i + 32 <= n_words) {
+        uint8x16_t first_vec = vdupq_n_u8(0), second_vec = vdupq_n_u8(0);
+        for (simsimd_size_t cycle = 0; cycle != 31 && i + 32 <= n_words; ++cycle, i += 32) {
+            uint8x16_t a_first = vld1q_u8(a + i), a_second = vld1q_u8(a + i + 16);
+            uint8x16_t b_first = vld1q_u8(b + i), b_second = vld1q_u8(b + i + 16);
+            first_vec = vaddq_u8(first_vec, vcntq_u8(veorq_u8(a_first, b_first)));
+            second_vec = vaddq_u8(second_vec, vcntq_u8(veorq_u8(a_second, b_second)));
+        }
+        uint16x8_t block_vec = vaddq_u16(vpaddlq_u8(first_vec), vpaddlq_u8(second_vec));
+        differences_vec = vpadalq_u16(differences_vec, block_vec);
+    }
+    simsimd_i32_t differences = (simsimd_i32_t)vaddvq_u32(differences_vec);
     for (; i + 16 <= n_words; i += 16) {
         uint8x16_t a_first = vld1q_u8(a + i);
         uint8x16_t b_first = vld1q_u8(b + i);
@@ -76,8 +132,25 @@ simsimd_neon_b8_hamming(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_si
 __attribute__((target("+simd"))) //
 inline static simsimd_f32_t
 simsimd_neon_b8_jaccard(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t n_words) {
-    simsimd_i32_t intersection = 0, union_ = 0;
+    uint32x4_t intersection_vec = vdupq_n_u32(0), union_vec = vdupq_n_u32(0);
     simsimd_size_t i = 0;
+    while (i + 32 <= n_words) {
+        uint8x16_t intersection_first = vdupq_n_u8(0), intersection_second = vdupq_n_u8(0);
+        uint8x16_t union_first = vdupq_n_u8(0), union_second = vdupq_n_u8(0);
+        for (simsimd_size_t cycle = 0; cycle != 31 && i + 32 <= n_words; ++cycle, i += 32) {
+            uint8x16_t a_first = vld1q_u8(a + i), a_second = vld1q_u8(a + i + 16);
+            uint8x16_t b_first = vld1q_u8(b + i), b_second = vld1q_u8(b + i + 16);
+            intersection_first = vaddq_u8(intersection_first, vcntq_u8(vandq_u8(a_first, b_first)));
+            intersection_second = vaddq_u8(intersection_second, vcntq_u8(vandq_u8(a_second, b_second)));
+            union_first = vaddq_u8(union_first, vcntq_u8(vorrq_u8(a_first, b_first)));
+            union_second = vaddq_u8(union_second, vcntq_u8(vorrq_u8(a_second, b_second)));
+        }
+        intersection_vec = vpadalq_u16(intersection_vec,
+                                       vaddq_u16(vpaddlq_u8(intersection_first), vpaddlq_u8(intersection_second)));
+        union_vec = vpadalq_u16(union_vec, vaddq_u16(vpaddlq_u8(union_first), vpaddlq_u8(union_second)));
+    }
+    simsimd_i32_t intersection = (simsimd_i32_t)vaddvq_u32(intersection_vec),
+                  union_ = (simsimd_i32_t)vaddvq_u32(union_vec);
     for (; i + 16 <= n_words; i += 16) {
         uint8x16_t a_first = vld1q_u8(a + i);
         uint8x16_t b_first = vld1q_u8(b + i);
@@ -90,6 +163,78 @@ simsimd_neon_b8_jaccard(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_si
     return (union_ != 0) ? 1 - (simsimd_f32_t)intersection / (simsimd_f32_t)union_ : 0;
 }
 
+/*
+ *  @file   arm_neon_b8_batch.h
+ *  @brief  Arm NEON implementation of one-to-many Hamming distances for 8-bit words.
+ *  @author Ash Vardanian
+ *
+ *  - Compares the query against 4 rows at a time, loading every query chunk into a register just once.
+ *  - Accumulates per-byte counts in `u8` between the early termination checks, widening them just then.
+ *  - Requires compiler capabilities: +simd.
+ */
+
+__attribute__((target("+simd"))) //
+inline static void
+simsimd_neon_b8_hamming_bounded(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t count,
+                                simsimd_size_t stride, simsimd_size_t n_words, simsimd_f32_t max_distance,
+                                simsimd_f32_t* results) {
+    simsimd_size_t const n_vectors = n_words / 16 * 16;
+    simsimd_size_t j = 0;
+    for (; j + 4 <= count; j += 4) {
+        simsimd_b8_t const* b_0 = (simsimd_b8_t const*)((char const*)b + (j + 0) * stride);
+        simsimd_b8_t const* b_1 = (simsimd_b8_t const*)((char const*)b + (j + 1) * stride);
+        simsimd_b8_t const* b_2 = (simsimd_b8_t const*)((char const*)b + (j + 2) * stride);
+        simsimd_b8_t const* b_3 = (simsimd_b8_t const*)((char const*)b + (j + 3) * stride);
+        uint32x4_t d_0_vec = vdupq_n_u32(0), d_1_vec = vdupq_n_u32(0);
+        uint32x4_t d_2_vec = vdupq_n_u32(0), d_3_vec = vdupq_n_u32(0);
+        simsimd_size_t i = 0;
+        simsimd_i32_t d_0, d_1, d_2, d_3;
+        while (i < n_vectors) {
+            // At most 16 chunks of 8 bits each are accumulated in every `u8` lane
+            uint8x16_t partial_0 = vdupq_n_u8(0), partial_1 = vdupq_n_u8(0);
+            uint8x16_t partial_2 = vdupq_n_u8(0), partial_3 = vdupq_n_u8(0);
+            simsimd_size_t block_end = i + SIMSIMD_B8_BOUNDED_CHECK_BYTES;
+            if (block_end > n_vectors)
+                block_end = n_vectors;
+            for (; i != block_end; i += 16) {
+                uint8x16_t a_vec = vld1q_u8(a + i);
+                partial_0 = vaddq_u8(partial_0, vcntq_u8(veorq_u8(a_vec, vld1q_u8(b_0 + i))));
+                partial_1 = vaddq_u8(partial_1, vcntq_u8(veorq_u8(a_vec, vld1q_u8(b_1 + i))));
+                partial_2 = vaddq_u8(partial_2, vcntq_u8(veorq_u8(a_vec, vld1q_u8(b_2 + i))));
+                partial_3 = vaddq_u8(partial_3, vcntq_u8(veorq_u8(a_vec, vld1q_u8(b_3 + i))));
+            }
+            d_0_vec = vpadalq_u16(d_0_vec, vpaddlq_u8(partial_0));
+            d_1_vec = vpadalq_u16(d_1_vec, vpaddlq_u8(partial_1));
+            d_2_vec = vpadalq_u16(d_2_vec, vpaddlq_u8(partial_2));
+            d_3_vec = vpadalq_u16(d_3_vec, vpaddlq_u8(partial_3));
+            // Check if all of the rows are already too far away
+            if (i != n_vectors && (simsimd_f32_t)vaddvq_u32(d_0_vec) > max_distance &&
+                (simsimd_f32_t)vaddvq_u32(d_1_vec) > max_distance &&
+                (simsimd_f32_t)vaddvq_u32(d_2_vec) > max_distance && (simsimd_f32_t)vaddvq_u32(d_3_vec) > max_distance)
+                break;
+        }
+        d_0 = (simsimd_i32_t)vaddvq_u32(d_0_vec), d_1 = (simsimd_i32_t)vaddvq_u32(d_1_vec);
+        d_2 = (simsimd_i32_t)vaddvq_u32(d_2_vec), d_3 = (simsimd_i32_t)vaddvq_u32(d_3_vec);
+        if (i == n_vectors)
+            for (; i != n_words; ++i)
+                d_0 += simsimd_popcount_b8(a[i] ^ b_0[i]), d_1 += simsimd_popcount_b8(a[i] ^ b_1[i]),
+                    d_2 += simsimd_popcount_b8(a[i] ^ b_2[i]), d_3 += simsimd_popcount_b8(a[i] ^ b_3[i]);
+        results[j + 0] = (simsimd_f32_t)d_0;
+        results[j + 1] = (simsimd_f32_t)d_1;
+        results[j + 2] = (simsimd_f32_t)d_2;
+        results[j + 3] = (simsimd_f32_t)d_3;
+    }
+    for (; j < count; ++j)
+        results[j] = simsimd_neon_b8_hamming(a, (simsimd_b8_t const*)((char const*)b + j * stride), n_words);
+}
+
+__attribute__((target("+simd"))) //
+inline static void
+simsimd_neon_b8_hamming_batch(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t count,
+                              simsimd_size_t stride, simsimd_size_t n_words, simsimd_f32_t* results) {
+    simsimd_neon_b8_hamming_bounded(a, b, count, stride, n_words, (simsimd_f32_t)(n_words * 8), results);
+}
+
 #endif // SIMSIMD_TARGET_ARM_NEON
 
 #if SIMSIMD_TARGET_ARM_SVE
@@ -131,6 +276,242 @@ simsimd_sve_b8_jaccard(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_siz
 
 #if SIMSIMD_TARGET_X86
 
+#if SIMSIMD_TARGET_X86_AVX2
+
+/*
+ *  @file   x86_avx2_b8.h
+ *  @brief  x86 AVX2 implementation of the binary similarity metrics for 8-bit words.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: Hamming distance, Jaccard distance.
+ *  - Uses `_mm256_shuffle_epi8` as a 4-bit lookup table to count bits in every byte.
+ *  - Uses Harley-Seal carry-save adders to popcount only one of every 16 input vectors.
+ *  - Uses `_mm256_sad_epu8` to horizontally add byte counts into 64-bit lanes.
+ *  - Requires compiler capabilities: avx2.
+ *
+ *  http://0x80.pl/articles/avx512-harley-seal-popcount.html
+ */
+
+__attribute__((target("avx2"))) //
+inline static __m256i
+simsimd_avx2_popcount_b8x32(__m256i x) {
+    __m256i const lookup_vec = _mm256_setr_epi8(                       //
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    __m256i const nibble_mask_vec = _mm256_set1_epi8(0x0F);
+    __m256i low_vec = _mm256_shuffle_epi8(lookup_vec, _mm256_and_si256(x, nibble_mask_vec));
+    __m256i high_vec = _mm256_shuffle_epi8(lookup_vec, _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble_mask_vec));
+    // Sum up the byte counts into four 64-bit words
+    return _mm256_sad_epu8(_mm256_add_epi8(low_vec, high_vec), _mm256_setzero_si256());
+}
+
+/// @brief  Carry-save adder: `high` receives the carries, `low` the sums of the three inputs.
+#define SIMSIMD_AVX2_CSA(high, low, a, b, c)                                                                           \
+    {                                                                                                                  \
+        __m256i u_ = _mm256_xor_si256(a, b);                                                                           \
+        high = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(u_, c));                                       \
+        low = _mm256_xor_si256(u_, c);                                                                                 \
+    }
+
+/// @brief  Harley-Seal popcount over 16 vectors, produced by the `load_and_combine` expression. It updates the
+///         `ones`, `twos`, `fours`, `eights` states and accumulates the popcount of `sixteens` into `total`.
+#define SIMSIMD_AVX2_HARLEY_SEAL(total, ones, twos, fours, eights, load_and_combine)                                  \
+    {                                                                                                                  \
+        __m256i twos_a_, twos_b_, fours_a_, fours_b_, eights_a_, eights_b_, sixteens_;                                 \
+        SIMSIMD_AVX2_CSA(twos_a_, ones, ones, load_and_combine(0), load_and_combine(1));                               \
+        SIMSIMD_AVX2_CSA(twos_b_, ones, ones, load_and_combine(2), load_and_combine(3));                               \
+        SIMSIMD_AVX2_CSA(fours_a_, twos, twos, twos_a_, twos_b_);                                                      \
+        SIMSIMD_AVX2_CSA(twos_a_, ones, ones, load_and_combine(4), load_and_combine(5));                               \
+        SIMSIMD_AVX2_CSA(twos_b_, ones, ones, load_and_combine(6), load_and_combine(7));                               \
+        SIMSIMD_AVX2_CSA(fours_b_, twos, twos, twos_a_, twos_b_);                                                      \
+        SIMSIMD_AVX2_CSA(eights_a_, fours, fours, fours_a_, fours_b_);                                                 \
+        SIMSIMD_AVX2_CSA(twos_a_, ones, ones, load_and_combine(8), load_and_combine(9));                               \
+        SIMSIMD_AVX2_CSA(twos_b_, ones, ones, load_and_combine(10), load_and_combine(11));                             \
+        SIMSIMD_AVX2_CSA(fours_a_, twos, twos, twos_a_, twos_b_);                                                      \
+        SIMSIMD_AVX2_CSA(twos_a_, ones, ones, load_and_combine(12), load_and_combine(13));                             \
+        SIMSIMD_AVX2_CSA(twos_b_, ones, ones, load_and_combine(14), load_and_combine(15));                             \
+        SIMSIMD_AVX2_CSA(fours_b_, twos, twos, twos_a_, twos_b_);                                                      \
+        SIMSIMD_AVX2_CSA(eights_b_, fours, fours, fours_a_, fours_b_);                                                 \
+        SIMSIMD_AVX2_CSA(sixteens_, eights, eights, eights_a_, eights_b_);                                             \
+        total = _mm256_add_epi64(total, simsimd_avx2_popcount_b8x32(sixteens_));                                       \
+    }
+
+/// @brief  Weighs the partial Harley-Seal states and reduces them into a single scalar.
+__attribute__((target("avx2"))) //
+inline static simsimd_size_t
+simsimd_avx2_harley_seal_reduce(__m256i total, __m256i ones, __m256i twos, __m256i fours, __m256i eights) {
+    total = _mm256_slli_epi64(total, 4);
+    total = _mm256_add_epi64(total, _mm256_slli_epi64(simsimd_avx2_popcount_b8x32(eights), 3));
+    total = _mm256_add_epi64(total, _mm256_slli_epi64(simsimd_avx2_popcount_b8x32(fours), 2));
+    total = _mm256_add_epi64(total, _mm256_slli_epi64(simsimd_avx2_popcount_b8x32(twos), 1));
+    total = _mm256_add_epi64(total, simsimd_avx2_popcount_b8x32(ones));
+    __m128i sum_vec = _mm_add_epi64(_mm256_castsi256_si128(total), _mm256_extracti128_si256(total, 1));
+    return (simsimd_size_t)(_mm_cvtsi128_si64(sum_vec) + _mm_extract_epi64(sum_vec, 1));
+}
+
+__attribute__((target("avx2"))) //
+inline static simsimd_f32_t
+simsimd_avx2_b8_hamming(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t n_words) {
+    __m256i total_vec = _mm256_setzero_si256();
+    __m256i ones_vec = _mm256_setzero_si256(), twos_vec = _mm256_setzero_si256();
+    __m256i fours_vec = _mm256_setzero_si256(), eights_vec = _mm256_setzero_si256();
+
+    simsimd_size_t i = 0;
+#define simsimd_avx2_b8_xor_(k)                                                                                        \
+    _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(a + i) + (k)),                                                \
+                     _mm256_loadu_si256((__m256i const*)(b + i) + (k)))
+    for (; i + 512 <= n_words; i += 512)
+        SIMSIMD_AVX2_HARLEY_SEAL(total_vec, ones_vec, twos_vec, fours_vec, eights_vec, simsimd_avx2_b8_xor_);
+#undef simsimd_avx2_b8_xor_
+
+    // Count the remaining full vectors directly, without the carry-save adders
+    __m256i leftover_vec = _mm256_setzero_si256();
+    for (; i + 32 <= n_words; i += 32) {
+        __m256i a_vec = _mm256_loadu_si256((__m256i const*)(a + i));
+        __m256i b_vec = _mm256_loadu_si256((__m256i const*)(b + i));
+        leftover_vec = _mm256_add_epi64(leftover_vec, simsimd_avx2_popcount_b8x32(_mm256_xor_si256(a_vec, b_vec)));
+    }
+    simsimd_size_t differences = simsimd_avx2_harley_seal_reduce(total_vec, ones_vec, twos_vec, fours_vec, eights_vec);
+    __m128i leftover_sum =
+        _mm_add_epi64(_mm256_castsi256_si128(leftover_vec), _mm256_extracti128_si256(leftover_vec, 1));
+    differences += (simsimd_size_t)(_mm_cvtsi128_si64(leftover_sum) + _mm_extract_epi64(leftover_sum, 1));
+
+    // Take care of the tail:
+    for (; i != n_words; ++i)
+        differences += simsimd_popcount_b8(a[i] ^ b[i]);
+    return (simsimd_f32_t)differences;
+}
+
+__attribute__((target("avx2"))) //
+inline static simsimd_f32_t
+simsimd_avx2_b8_jaccard(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t n_words) {
+    __m256i intersection_total_vec = _mm256_setzero_si256(), union_total_vec = _mm256_setzero_si256();
+    __m256i intersection_ones_vec = _mm256_setzero_si256(), intersection_twos_vec = _mm256_setzero_si256();
+    __m256i intersection_fours_vec = _mm256_setzero_si256(), intersection_eights_vec = _mm256_setzero_si256();
+    __m256i union_ones_vec = _mm256_setzero_si256(), union_twos_vec = _mm256_setzero_si256();
+    __m256i union_fours_vec = _mm256_setzero_si256(), union_eights_vec = _mm256_setzero_si256();
+
+    simsimd_size_t i = 0;
+#define simsimd_avx2_b8_and_(k)                                                                                        \
+    _mm256_and_si256(_mm256_loadu_si256((__m256i const*)(a + i) + (k)),                                                \
+                     _mm256_loadu_si256((__m256i const*)(b + i) + (k)))
+#define simsimd_avx2_b8_or_(k)                                                                                         \
+    _mm256_or_si256(_mm256_loadu_si256((__m256i const*)(a + i) + (k)),                                                 \
+                    _mm256_loadu_si256((__m256i const*)(b + i) + (k)))
+    for (; i + 512 <= n_words; i += 512) {
+        SIMSIMD_AVX2_HARLEY_SEAL(intersection_total_vec, intersection_ones_vec, intersection_twos_vec,
+                                 intersection_fours_vec, intersection_eights_vec, simsimd_avx2_b8_and_);
+        SIMSIMD_AVX2_HARLEY_SEAL(union_total_vec, union_ones_vec, union_twos_vec, union_fours_vec, union_eights_vec,
+                                 simsimd_avx2_b8_or_);
+    }
+#undef simsimd_avx2_b8_and_
+#undef simsimd_avx2_b8_or_
+
+    __m256i intersection_leftover_vec = _mm256_setzero_si256(), union_leftover_vec = _mm256_setzero_si256();
+    for (; i + 32 <= n_words; i += 32) {
+        __m256i a_vec = _mm256_loadu_si256((__m256i const*)(a + i));
+        __m256i b_vec = _mm256_loadu_si256((__m256i const*)(b + i));
+        intersection_leftover_vec =
+            _mm256_add_epi64(intersection_leftover_vec, simsimd_avx2_popcount_b8x32(_mm256_and_si256(a_vec, b_vec)));
+        union_leftover_vec =
+            _mm256_add_epi64(union_leftover_vec, simsimd_avx2_popcount_b8x32(_mm256_or_si256(a_vec, b_vec)));
+    }
+    simsimd_size_t intersection = simsimd_avx2_harley_seal_reduce( //
+        intersection_total_vec, intersection_ones_vec, intersection_twos_vec, intersection_fours_vec,
+        intersection_eights_vec);
+    simsimd_size_t union_ = simsimd_avx2_harley_seal_reduce( //
+        union_total_vec, union_ones_vec, union_twos_vec, union_fours_vec, union_eights_vec);
+    __m128i intersection_sum = _mm_add_epi64(_mm256_castsi256_si128(intersection_leftover_vec),
+                                             _mm256_extracti128_si256(intersection_leftover_vec, 1));
+    __m128i union_sum =
+        _mm_add_epi64(_mm256_castsi256_si128(union_leftover_vec), _mm256_extracti128_si256(union_leftover_vec, 1));
+    intersection += (simsimd_size_t)(_mm_cvtsi128_si64(intersection_sum) + _mm_extract_epi64(intersection_sum, 1));
+    union_ += (simsimd_size_t)(_mm_cvtsi128_si64(union_sum) + _mm_extract_epi64(union_sum, 1));
+
+    // Take care of the tail:
+    for (; i != n_words; ++i)
+        intersection += simsimd_popcount_b8(a[i] & b[i]), union_ += simsimd_popcount_b8(a[i] | b[i]);
+    return (union_ != 0) ? 1 - (simsimd_f32_t)intersection / (simsimd_f32_t)union_ : 0;
+}
+
+/*
+ *  @file   x86_avx2_b8_batch.h
+ *  @brief  x86 AVX2 implementation of one-to-many Hamming distances for 8-bit words.
+ *  @author Ash Vardanian
+ *
+ *  - Compares the query against 4 rows at a time, loading every query chunk into a register just once.
+ *  - Uses `_mm256_shuffle_epi8` to count bits, and reduces the 64-bit lanes only for early termination checks.
+ *  - Requires compiler capabilities: avx2.
+ */
+
+__attribute__((target("avx2"))) //
+inline static simsimd_size_t
+simsimd_avx2_reduce_u64x4(__m256i x) {
+    __m128i sum_vec = _mm_add_epi64(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+    return (simsimd_size_t)(_mm_cvtsi128_si64(sum_vec) + _mm_extract_epi64(sum_vec, 1));
+}
+
+__attribute__((target("avx2"))) //
+inline static void
+simsimd_avx2_b8_hamming_bounded(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t count,
+                                simsimd_size_t stride, simsimd_size_t n_words, simsimd_f32_t max_distance,
+                                simsimd_f32_t* results) {
+    simsimd_size_t const n_vectors = n_words / 32 * 32;
+    simsimd_size_t j = 0;
+    for (; j + 4 <= count; j += 4) {
+        simsimd_b8_t const* b_0 = (simsimd_b8_t const*)((char const*)b + (j + 0) * stride);
+        simsimd_b8_t const* b_1 = (simsimd_b8_t const*)((char const*)b + (j + 1) * stride);
+        simsimd_b8_t const* b_2 = (simsimd_b8_t const*)((char const*)b + (j + 2) * stride);
+        simsimd_b8_t const* b_3 = (simsimd_b8_t const*)((char const*)b + (j + 3) * stride);
+        __m256i d_0_vec = _mm256_setzero_si256(), d_1_vec = _mm256_setzero_si256();
+        __m256i d_2_vec = _mm256_setzero_si256(), d_3_vec = _mm256_setzero_si256();
+        simsimd_size_t i = 0;
+        for (; i != n_vectors; i += 32) {
+            __m256i a_vec = _mm256_loadu_si256((__m256i const*)(a + i));
+            __m256i b_0_vec = _mm256_loadu_si256((__m256i const*)(b_0 + i));
+            __m256i b_1_vec = _mm256_loadu_si256((__m256i const*)(b_1 + i));
+            __m256i b_2_vec = _mm256_loadu_si256((__m256i const*)(b_2 + i));
+            __m256i b_3_vec = _mm256_loadu_si256((__m256i const*)(b_3 + i));
+            d_0_vec = _mm256_add_epi64(d_0_vec, simsimd_avx2_popcount_b8x32(_mm256_xor_si256(a_vec, b_0_vec)));
+            d_1_vec = _mm256_add_epi64(d_1_vec, simsimd_avx2_popcount_b8x32(_mm256_xor_si256(a_vec, b_1_vec)));
+            d_2_vec = _mm256_add_epi64(d_2_vec, simsimd_avx2_popcount_b8x32(_mm256_xor_si256(a_vec, b_2_vec)));
+            d_3_vec = _mm256_add_epi64(d_3_vec, simsimd_avx2_popcount_b8x32(_mm256_xor_si256(a_vec, b_3_vec)));
+            // Check if all of the rows are already too far away
+            if ((i + 32) % SIMSIMD_B8_BOUNDED_CHECK_BYTES == 0 && i + 32 != n_vectors &&
+                (simsimd_f32_t)simsimd_avx2_reduce_u64x4(d_0_vec) > max_distance &&
+                (simsimd_f32_t)simsimd_avx2_reduce_u64x4(d_1_vec) > max_distance &&
+                (simsimd_f32_t)simsimd_avx2_reduce_u64x4(d_2_vec) > max_distance &&
+                (simsimd_f32_t)simsimd_avx2_reduce_u64x4(d_3_vec) > max_distance) {
+                i += 32;
+                break;
+            }
+        }
+        simsimd_size_t d_0 = simsimd_avx2_reduce_u64x4(d_0_vec), d_1 = simsimd_avx2_reduce_u64x4(d_1_vec);
+        simsimd_size_t d_2 = simsimd_avx2_reduce_u64x4(d_2_vec), d_3 = simsimd_avx2_reduce_u64x4(d_3_vec);
+        if (i == n_vectors)
+            for (; i != n_words; ++i)
+                d_0 += simsimd_popcount_b8(a[i] ^ b_0[i]), d_1 += simsimd_popcount_b8(a[i] ^ b_1[i]),
+                    d_2 += simsimd_popcount_b8(a[i] ^ b_2[i]), d_3 += simsimd_popcount_b8(a[i] ^ b_3[i]);
+        results[j + 0] = (simsimd_f32_t)d_0;
+        results[j + 1] = (simsimd_f32_t)d_1;
+        results[j + 2] = (simsimd_f32_t)d_2;
+        results[j + 3] = (simsimd_f32_t)d_3;
+    }
+    for (; j < count; ++j)
+        results[j] = simsimd_avx2_b8_hamming(a, (simsimd_b8_t const*)((char const*)b + j * stride), n_words);
+}
+
+__attribute__((target("avx2"))) //
+inline static void
+simsimd_avx2_b8_hamming_batch(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t count,
+                              simsimd_size_t stride, simsimd_size_t n_words, simsimd_f32_t* results) {
+    simsimd_avx2_b8_hamming_bounded(a, b, count, stride, n_words, (simsimd_f32_t)(n_words * 8), results);
+}
+
+#undef SIMSIMD_AVX2_CSA
+#undef SIMSIMD_AVX2_HARLEY_SEAL
+
+#endif // SIMSIMD_TARGET_X86_AVX2
+
 #if SIMSIMD_TARGET_X86_AVX512
 
 __attribute__((target("avx512vpopcntdq,avx512vl,avx512bw,avx512f,bmi2"))) //
@@ -188,6 +569,92 @@ simsimd_avx512_b8_jaccard_cycle:
     return (union_ != 0) ? 1 - (simsimd_f32_t)intersection / (simsimd_f32_t)union_ : 0;
 }
 
+/*
+ *  @file   x86_avx512_b8_batch.h
+ *  @brief  x86 AVX-512 implementation of one-to-many Hamming distances for 8-bit words.
+ *  @author Ash Vardanian
+ *
+ *  - Compares the query against 4 rows at a time, loading every query chunk into a register just once.
+ *  - Keeps codes of up to 64 bytes, like 512-bit hashes, in a single register for the whole scan.
+ *  - Uses masked loads for every chunk, the mask is only different from all-ones in the last one.
+ *  - Requires compiler capabilities: avx512vpopcntdq, avx512vl, avx512bw, avx512f, bmi2.
+ */
+
+__attribute__((target("avx512vpopcntdq,avx512vl,avx512bw,avx512f,bmi2"))) //
+inline static void
+simsimd_avx512_b8_hamming_bounded(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t count,
+                                  simsimd_size_t stride, simsimd_size_t n_words, simsimd_f32_t max_distance,
+                                  simsimd_f32_t* results) {
+    __mmask64 const tail_mask = (__mmask64)_bzhi_u64(0xFFFFFFFFFFFFFFFF, n_words % 64);
+    simsimd_size_t j = 0;
+
+    // Short codes are compared in a single step, so there is nothing to terminate early
+    if (n_words <= 64) {
+        __mmask64 const mask = (__mmask64)_bzhi_u64(0xFFFFFFFFFFFFFFFF, n_words);
+        __m512i const a_vec = _mm512_maskz_loadu_epi8(mask, a);
+        for (; j + 4 <= count; j += 4) {
+            __m512i b_0_vec = _mm512_maskz_loadu_epi8(mask, (char const*)b + (j + 0) * stride);
+            __m512i b_1_vec = _mm512_maskz_loadu_epi8(mask, (char const*)b + (j + 1) * stride);
+            __m512i b_2_vec = _mm512_maskz_loadu_epi8(mask, (char const*)b + (j + 2) * stride);
+            __m512i b_3_vec = _mm512_maskz_loadu_epi8(mask, (char const*)b + (j + 3) * stride);
+            __m512i d_0_vec = _mm512_popcnt_epi64(_mm512_xor_si512(a_vec, b_0_vec));
+            __m512i d_1_vec = _mm512_popcnt_epi64(_mm512_xor_si512(a_vec, b_1_vec));
+            __m512i d_2_vec = _mm512_popcnt_epi64(_mm512_xor_si512(a_vec, b_2_vec));
+            __m512i d_3_vec = _mm512_popcnt_epi64(_mm512_xor_si512(a_vec, b_3_vec));
+            results[j + 0] = (simsimd_f32_t)_mm512_reduce_add_epi64(d_0_vec);
+            results[j + 1] = (simsimd_f32_t)_mm512_reduce_add_epi64(d_1_vec);
+            results[j + 2] = (simsimd_f32_t)_mm512_reduce_add_epi64(d_2_vec);
+            results[j + 3] = (simsimd_f32_t)_mm512_reduce_add_epi64(d_3_vec);
+        }
+        for (; j < count; ++j) {
+            __m512i b_vec = _mm512_maskz_loadu_epi8(mask, (char const*)b + j * stride);
+            results[j] = (simsimd_f32_t)_mm512_reduce_add_epi64(_mm512_popcnt_epi64(_mm512_xor_si512(a_vec, b_vec)));
+        }
+        return;
+    }
+
+    for (; j + 4 <= count; j += 4) {
+        simsimd_b8_t const* b_0 = (simsimd_b8_t const*)((char const*)b + (j + 0) * stride);
+        simsimd_b8_t const* b_1 = (simsimd_b8_t const*)((char const*)b + (j + 1) * stride);
+        simsimd_b8_t const* b_2 = (simsimd_b8_t const*)((char const*)b + (j + 2) * stride);
+        simsimd_b8_t const* b_3 = (simsimd_b8_t const*)((char const*)b + (j + 3) * stride);
+        __m512i d_0_vec = _mm512_setzero_si512(), d_1_vec = _mm512_setzero_si512();
+        __m512i d_2_vec = _mm512_setzero_si512(), d_3_vec = _mm512_setzero_si512();
+        for (simsimd_size_t i = 0; i < n_words; i += 64) {
+            __mmask64 mask = i + 64 <= n_words ? (__mmask64)0xFFFFFFFFFFFFFFFF : tail_mask;
+            __m512i a_vec = _mm512_maskz_loadu_epi8(mask, a + i);
+            __m512i x_0_vec = _mm512_xor_si512(a_vec, _mm512_maskz_loadu_epi8(mask, b_0 + i));
+            __m512i x_1_vec = _mm512_xor_si512(a_vec, _mm512_maskz_loadu_epi8(mask, b_1 + i));
+            __m512i x_2_vec = _mm512_xor_si512(a_vec, _mm512_maskz_loadu_epi8(mask, b_2 + i));
+            __m512i x_3_vec = _mm512_xor_si512(a_vec, _mm512_maskz_loadu_epi8(mask, b_3 + i));
+            d_0_vec = _mm512_add_epi64(d_0_vec, _mm512_popcnt_epi64(x_0_vec));
+            d_1_vec = _mm512_add_epi64(d_1_vec, _mm512_popcnt_epi64(x_1_vec));
+            d_2_vec = _mm512_add_epi64(d_2_vec, _mm512_popcnt_epi64(x_2_vec));
+            d_3_vec = _mm512_add_epi64(d_3_vec, _mm512_popcnt_epi64(x_3_vec));
+            // Check if all of the rows are already too far away
+            if ((i + 64) % SIMSIMD_B8_BOUNDED_CHECK_BYTES == 0 && i + 64 < n_words &&
+                (simsimd_f32_t)_mm512_reduce_add_epi64(d_0_vec) > max_distance &&
+                (simsimd_f32_t)_mm512_reduce_add_epi64(d_1_vec) > max_distance &&
+                (simsimd_f32_t)_mm512_reduce_add_epi64(d_2_vec) > max_distance &&
+                (simsimd_f32_t)_mm512_reduce_add_epi64(d_3_vec) > max_distance)
+                break;
+        }
+        results[j + 0] = (simsimd_f32_t)_mm512_reduce_add_epi64(d_0_vec);
+        results[j + 1] = (simsimd_f32_t)_mm512_reduce_add_epi64(d_1_vec);
+        results[j + 2] = (simsimd_f32_t)_mm512_reduce_add_epi64(d_2_vec);
+        results[j + 3] = (simsimd_f32_t)_mm512_reduce_add_epi64(d_3_vec);
+    }
+    for (; j < count; ++j)
+        results[j] = simsimd_avx512_b8_hamming(a, (simsimd_b8_t const*)((char const*)b + j * stride), n_words);
+}
+
+__attribute__((target("avx512vpopcntdq,avx512vl,avx512bw,avx512f,bmi2"))) //
+inline static void
+simsimd_avx512_b8_hamming_batch(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t count,
+                                simsimd_size_t stride, simsimd_size_t n_words, simsimd_f32_t* results) {
+    simsimd_avx512_b8_hamming_bounded(a, b, count, stride, n_words, (simsimd_f32_t)(n_words * 8), results);
+}
+
 #endif // SIMSIMD_TARGET_X86_AVX512
 #endif // SIMSIMD_TARGET_X86
 
@@ -0,0 +1,394 @@
+/**
+ *  @brief      SIMD-accelerated Conversions and Quantization of Vectors.
+ *  @author     Ash Vardanian
+ *  @date       October 14, 2026
+ *
+ *  Contains:
+ *  - Downcasting `f32` vectors into `f16` and `bf16`, rounding to the nearest even
+ *  - Symmetric quantization of `f32` vectors into `i8`, dividing by a scale and saturating to [-127, 127]
+ *  - Binarization of `f32` vectors into `b8` bitsets, setting the bits of the positive scalars
+ *  - Maximum absolute value of `f32` vectors, to derive the per-vector scales for quantization, ignoring NaNs
+ *
+ *  All the conversions share the `simsimd_convert_punned_t` signature, where the `scale` is only used
+ *  for `i8` outputs, so that `x[i] ~ y[i] * scale`, like in the `_scaled` mixed-precision kernels.
+ *  The bitsets are packed from the most significant bit, like `numpy.packbits`, and the last byte
+ *  is padded with zeros.
+ *
+ *  For hardware architectures:
+ *  - Arm (NEON)
+ *  - x86 (AVX2, AVX512)
+ *
+ *  x86 intrinsics: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/
+ *  Arm intrinsics: https://developer.arm.com/architectures/instruction-sets/intrinsics/
+ */
+
+#pragma once
+#include "types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  @brief  Rounds a `f32` to the nearest `i8` in [-127, 127], breaking the ties to even, just like
+ *          the default rounding mode of the SIMD conversions, so all backends produce the same codes.
+ */
+inline static simsimd_i8_t simsimd_f32_round_i8(simsimd_f32_t x) {
+    x = x >= -127 ? x : -127; // Also replaces NaNs
+    x = x <= 127 ? x : 127;
+    simsimd_i32_t i = (simsimd_i32_t)x;
+    simsimd_f32_t fraction = x - (simsimd_f32_t)i;
+    i += (fraction > 0.5f) - (fraction < -0.5f);
+    i += ((fraction == 0.5f) - (fraction == -0.5f)) * (i & 1);
+    return (simsimd_i8_t)i;
+}
+
+/**
+ *  @brief  Reverses the order of bits in every byte of a word, to pack the bitsets from the most
+ *          significant bit, when the SIMD comparisons produce masks from the least significant one.
+ */
+inline static simsimd_size_t simsimd_reverse_bits_in_bytes(simsimd_size_t x) {
+    x = ((x & 0xF0F0F0F0F0F0F0F0ull) >> 4) | ((x & 0x0F0F0F0F0F0F0F0Full) << 4);
+    x = ((x & 0xCCCCCCCCCCCCCCCCull) >> 2) | ((x & 0x3333333333333333ull) << 2);
+    x = ((x & 0xAAAAAAAAAAAAAAAAull) >> 1) | ((x & 0x5555555555555555ull) << 1);
+    return x;
+}
+
+inline static void simsimd_serial_f32_to_f16(simsimd_f32_t const* x, simsimd_size_t n, simsimd_f32_t scale,
+                                             void* y) {
+    simsimd_f16_t* y_f16 = (simsimd_f16_t*)y;
+    (void)scale;
+    for (simsimd_size_t i = 0; i != n; ++i)
+        y_f16[i] = SIMSIMD_COMPRESS_F16(x[i]);
+}
+
+inline static void simsimd_serial_f32_to_bf16(simsimd_f32_t const* x, simsimd_size_t n, simsimd_f32_t scale,
+                                              void* y) {
+    simsimd_bf16_t* y_bf16 = (simsimd_bf16_t*)y;
+    (void)scale;
+    for (simsimd_size_t i = 0; i != n; ++i)
+        y_bf16[i] = SIMSIMD_COMPRESS_BF16(x[i]);
+}
+
+inline static void simsimd_serial_f32_to_i8(simsimd_f32_t const* x, simsimd_size_t n, simsimd_f32_t scale,
+                                            void* y) {
+    simsimd_i8_t* y_i8 = (simsimd_i8_t*)y;
+    simsimd_f32_t inverse_scale = scale != 0 ? 1 / scale : 0;
+    for (simsimd_size_t i = 0; i != n; ++i)
+        y_i8[i] = simsimd_f32_round_i8(x[i] * inverse_scale);
+}
+
+inline static void simsimd_serial_f32_to_b8(simsimd_f32_t const* x, simsimd_size_t n, simsimd_f32_t scale,
+                                            void* y) {
+    simsimd_b8_t* y_b8 = (simsimd_b8_t*)y;
+    (void)scale;
+    for (simsimd_size_t i = 0; i < n; i += 8) {
+        simsimd_b8_t word = 0;
+        for (simsimd_size_t bit = 0; bit != 8 && i + bit != n; ++bit)
+            word |= (simsimd_b8_t)((x[i + bit] > 0) << (7 - bit));
+        y_b8[i / 8] = word;
+    }
+}
+
+inline static simsimd_f32_t simsimd_serial_f32_absmax(simsimd_f32_t const* x, simsimd_size_t n) {
+    simsimd_f32_t max = 0;
+    for (simsimd_size_t i = 0; i != n; ++i) {
+        simsimd_f32_t magnitude = x[i] < 0 ? -x[i] : x[i];
+        max = magnitude > max ? magnitude : max;
+    }
+    return max;
+}
+
+#if SIMSIMD_TARGET_ARM
+#if SIMSIMD_TARGET_ARM_NEON
+
+/*
+ *  @file   arm_neon_convert.h
+ *  @brief  Arm NEON implementation of the conversions from `f32` vectors.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: `f16`, `bf16`, `i8` and `b8` conversions, maximum absolute value.
+ *  - Uses `vcvt_f16_f32` for `f16`, and integer rounding of the upper half of the bits for `bf16`.
+ *  - Uses `vcvtnq_s32_f32` and saturating narrowing `vqmovn` for `i8`.
+ *  - Weighs the comparison masks by powers of two and adds them with `vaddv_u8` for `b8`.
+ *  - Requires compiler capabilities: +simd+fp16.
+ */
+
+__attribute__((target("+simd+fp16"))) //
+inline static void
+simsimd_neon_f32_to_f16(simsimd_f32_t const* x, simsimd_size_t n, simsimd_f32_t scale, void* y) {
+    simsimd_f16_t* y_f16 = (simsimd_f16_t*)y;
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        vst1_f16((float16_t*)y_f16 + i, vcvt_f16_f32(vld1q_f32(x + i)));
+    simsimd_serial_f32_to_f16(x + i, n - i, scale, y_f16 + i);
+}
+
+__attribute__((target("+simd"))) //
+inline static void
+simsimd_neon_f32_to_bf16(simsimd_f32_t const* x, simsimd_size_t n, simsimd_f32_t scale, void* y) {
+    simsimd_bf16_t* y_bf16 = (simsimd_bf16_t*)y;
+    uint32x4_t const magnitude_mask = vdupq_n_u32(0x7FFFFFFFu), infinity = vdupq_n_u32(0x7F800000u);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        uint32x4_t bits = vreinterpretq_u32_f32(vld1q_f32(x + i));
+        uint32x4_t is_nan = vcgtq_u32(vandq_u32(bits, magnitude_mask), infinity);
+        uint32x4_t odd = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+        uint32x4_t rounded = vaddq_u32(bits, vaddq_u32(vdupq_n_u32(0x7FFFu), odd));
+        uint32x4_t quiet = vorrq_u32(bits, vdupq_n_u32(0x00400000u));
+        vst1_u16(y_bf16 + i, vshrn_n_u32(vbslq_u32(is_nan, quiet, rounded), 16));
+    }
+    simsimd_serial_f32_to_bf16(x + i, n - i, scale, y_bf16 + i);
+}
+
+__attribute__((target("+simd"))) //
+inline static void
+simsimd_neon_f32_to_i8(simsimd_f32_t const* x, simsimd_size_t n, simsimd_f32_t scale, void* y) {
+    simsimd_i8_t* y_i8 = (simsimd_i8_t*)y;
+    float32x4_t const inverse_scale = vdupq_n_f32(scale != 0 ? 1 / scale : 0);
+    float32x4_t const upper = vdupq_n_f32(127), lower = vdupq_n_f32(-127);
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        float32x4_t low = vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(x + i), inverse_scale), lower), upper);
+        float32x4_t high = vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(x + i + 4), inverse_scale), lower), upper);
+        int16x8_t words = vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(low)), vqmovn_s32(vcvtnq_s32_f32(high)));
+        vst1_s8(y_i8 + i, vqmovn_s16(words));
+    }
+    simsimd_serial_f32_to_i8(x + i, n - i, scale, y_i8 + i);
+}
+
+__attribute__((target("+simd"))) //
+inline static void
+simsimd_neon_f32_to_b8(simsimd_f32_t const* x, simsimd_size_t n, simsimd_f32_t scale, void* y) {
+    simsimd_b8_t* y_b8 = (simsimd_b8_t*)y;
+    static simsimd_b8_t const weights[8] = {128, 64, 32, 16, 8, 4, 2, 1};
+    uint8x8_t const weights_vec = vld1_u8(weights);
+    float32x4_t const zeros = vdupq_n_f32(0);
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint16x8_t positive = vcombine_u16(vmovn_u32(vcgtq_f32(vld1q_f32(x + i), zeros)),
+                                           vmovn_u32(vcgtq_f32(vld1q_f32(x + i + 4), zeros)));
+        y_b8[i / 8] = vaddv_u8(vand_u8(vmovn_u16(positive), weights_vec));
+    }
+    simsimd_serial_f32_to_b8(x + i, n - i, scale, y_b8 + i / 8);
+}
+
+__attribute__((target("+simd"))) //
+inline static simsimd_f32_t
+simsimd_neon_f32_absmax(simsimd_f32_t const* x, simsimd_size_t n) {
+    float32x4_t max_vec = vdupq_n_f32(0);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        max_vec = vmaxnmq_f32(max_vec, vabsq_f32(vld1q_f32(x + i)));
+    simsimd_f32_t max = vmaxvq_f32(max_vec);
+    simsimd_f32_t tail = simsimd_serial_f32_absmax(x + i, n - i);
+    return tail > max ? tail : max;
+}
+
+#endif // SIMSIMD_TARGET_ARM_NEON
+#endif // SIMSIMD_TARGET_ARM
+
+#if SIMSIMD_TARGET_X86
+#if SIMSIMD_TARGET_X86_AVX2
+
+/*
+ *  @file   x86_avx2_convert.h
+ *  @brief  x86 AVX2 implementation of the conversions from `f32` vectors.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: `f16`, `bf16`, `i8` and `b8` conversions, maximum absolute value.
+ *  - Uses F16C `_mm256_cvtps_ph` for `f16`, and integer rounding of the upper half of the bits for `bf16`.
+ *  - Uses `_mm256_cvtps_epi32` and saturating packs for `i8`, fixing the order of 128-bit lanes afterwards.
+ *  - Uses `_mm256_movemask_ps` for `b8`, reversing the bits of every byte.
+ *  - Requires compiler capabilities: avx2, f16c, fma.
+ */
+
+__attribute__((target("avx2,f16c,fma"))) //
+inline static void
+simsimd_avx2_f32_to_f16(simsimd_f32_t const* x, simsimd_size_t n, simsimd_f32_t scale, void* y) {
+    simsimd_f16_t* y_f16 = (simsimd_f16_t*)y;
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm_storeu_si128((__m128i*)(y_f16 + i),
+                         _mm256_cvtps_ph(_mm256_loadu_ps(x + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    simsimd_serial_f32_to_f16(x + i, n - i, scale, y_f16 + i);
+}
+
+__attribute__((target("avx2,f16c,fma"))) //
+inline static __m256i
+simsimd_avx2_f32_round_bf16(__m256i bits) {
+    __m256i is_nan = _mm256_cmpgt_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x7FFFFFFF)),
+                                        _mm256_set1_epi32(0x7F800000));
+    __m256i odd = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+    __m256i rounded = _mm256_add_epi32(bits, _mm256_add_epi32(_mm256_set1_epi32(0x7FFF), odd));
+    __m256i quiet = _mm256_or_si256(bits, _mm256_set1_epi32(0x00400000));
+    return _mm256_srli_epi32(_mm256_blendv_epi8(rounded, quiet, is_nan), 16);
+}
+
+__attribute__((target("avx2,f16c,fma"))) //
+inline static void
+simsimd_avx2_f32_to_bf16(simsimd_f32_t const* x, simsimd_size_t n, simsimd_f32_t scale, void* y) {
+    simsimd_bf16_t* y_bf16 = (simsimd_bf16_t*)y;
+    simsimd_size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i low = simsimd_avx2_f32_round_bf16(_mm256_castps_si256(_mm256_loadu_ps(x + i)));
+        __m256i high = simsimd_avx2_f32_round_bf16(_mm256_castps_si256(_mm256_loadu_ps(x + i + 8)));
+        __m256i words = _mm256_permute4x64_epi64(_mm256_packus_epi32(low, high), 0xD8);
+        _mm256_storeu_si256((__m256i*)(y_bf16 + i), words);
+    }
+    simsimd_serial_f32_to_bf16(x + i, n - i, scale, y_bf16 + i);
+}
+
+__attribute__((target("avx2,f16c,fma"))) //
+inline static void
+simsimd_avx2_f32_to_i8(simsimd_f32_t const* x, simsimd_size_t n, simsimd_f32_t scale, void* y) {
+    simsimd_i8_t* y_i8 = (simsimd_i8_t*)y;
+    __m256 const inverse_scale = _mm256_set1_ps(scale != 0 ? 1 / scale : 0);
+    __m256 const upper = _mm256_set1_ps(127), lower = _mm256_set1_ps(-127);
+    __m256i const order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    simsimd_size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i quarters[4];
+        for (int k = 0; k != 4; ++k) {
+            __m256 scaled = _mm256_mul_ps(_mm256_loadu_ps(x + i + k * 8), inverse_scale);
+            quarters[k] = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(scaled, lower), upper));
+        }
+        __m256i words = _mm256_packs_epi16(_mm256_packs_epi32(quarters[0], quarters[1]),
+                                           _mm256_packs_epi32(quarters[2], quarters[3]));
+        _mm256_storeu_si256((__m256i*)(y_i8 + i), _mm256_permutevar8x32_epi32(words, order));
+    }
+    simsimd_serial_f32_to_i8(x + i, n - i, scale, y_i8 + i);
+}
+
+__attribute__((target("avx2,f16c,fma"))) //
+inline static void
+simsimd_avx2_f32_to_b8(simsimd_f32_t const* x, simsimd_size_t n, simsimd_f32_t scale, void* y) {
+    simsimd_b8_t* y_b8 = (simsimd_b8_t*)y;
+    __m256 const zeros = _mm256_setzero_ps();
+    simsimd_size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        simsimd_size_t bits = 0;
+        for (int k = 0; k != 4; ++k)
+            bits |= (simsimd_size_t)_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(x + i + k * 8), zeros,
+                                                                     _CMP_GT_OQ))
+                    << (k * 8);
+        bits = simsimd_reverse_bits_in_bytes(bits);
+        for (int k = 0; k != 4; ++k)
+            y_b8[i / 8 + k] = (simsimd_b8_t)(bits >> (k * 8));
+    }
+    simsimd_serial_f32_to_b8(x + i, n - i, scale, y_b8 + i / 8);
+}
+
+__attribute__((target("avx2,f16c,fma"))) //
+inline static simsimd_f32_t
+simsimd_avx2_f32_absmax(simsimd_f32_t const* x, simsimd_size_t n) {
+    __m256 const magnitude_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    __m256 max_vec = _mm256_setzero_ps();
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        max_vec = _mm256_max_ps(_mm256_and_ps(_mm256_loadu_ps(x + i), magnitude_mask), max_vec);
+    __m128 max_half = _mm_max_ps(_mm256_castps256_ps128(max_vec), _mm256_extractf128_ps(max_vec, 1));
+    max_half = _mm_max_ps(max_half, _mm_movehl_ps(max_half, max_half));
+    max_half = _mm_max_ss(max_half, _mm_shuffle_ps(max_half, max_half, 1));
+    simsimd_f32_t max = _mm_cvtss_f32(max_half);
+    simsimd_f32_t tail = simsimd_serial_f32_absmax(x + i, n - i);
+    return tail > max ? tail : max;
+}
+
+#endif // SIMSIMD_TARGET_X86_AVX2
+
+#if SIMSIMD_TARGET_X86_AVX512
+
+/*
+ *  @file   x86_avx512_convert.h
+ *  @brief  x86 AVX-512 implementation of the conversions from `f32` vectors.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: `f16`, `bf16`, `i8` and `b8` conversions, maximum absolute value.
+ *  - Uses `_mm512_cvtps_ph` for `f16`, which AVX-512 FP16 doesn't make any faster, and integer rounding of the
+ *    upper half of the bits for `bf16`, which matches the serial code even for subnormals, unlike `vcvtneps2bf16`.
+ *  - Uses `_mm512_cvtps_epi32` and the truncating `_mm512_cvtepi32_epi8` for `i8`, after clamping.
+ *  - Uses `_mm512_cmp_ps_mask` for `b8`, reversing the bits of every byte.
+ *  - Handles the tails of all the conversions, except for `b8`, with masked loads and stores.
+ *  - Requires compiler capabilities: avx512f, avx512vl, avx512bw, bmi2.
+ */
+
+__attribute__((target("avx512f,avx512vl,avx512bw,bmi2"))) //
+inline static void
+simsimd_avx512_f32_to_f16(simsimd_f32_t const* x, simsimd_size_t n, simsimd_f32_t scale, void* y) {
+    simsimd_f16_t* y_f16 = (simsimd_f16_t*)y;
+    (void)scale;
+    for (simsimd_size_t i = 0; i < n; i += 16) {
+        __mmask16 mask = (__mmask16)_bzhi_u32(0xFFFF, n - i < 16 ? (unsigned int)(n - i) : 16);
+        __m512 floats = _mm512_maskz_loadu_ps(mask, x + i);
+        __m256i words = _mm512_cvtps_ph(floats, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm256_mask_storeu_epi16(y_f16 + i, mask, words);
+    }
+}
+
+__attribute__((target("avx512f,avx512vl,avx512bw,bmi2"))) //
+inline static void
+simsimd_avx512_f32_to_bf16(simsimd_f32_t const* x, simsimd_size_t n, simsimd_f32_t scale, void* y) {
+    simsimd_bf16_t* y_bf16 = (simsimd_bf16_t*)y;
+    (void)scale;
+    for (simsimd_size_t i = 0; i < n; i += 16) {
+        __mmask16 mask = (__mmask16)_bzhi_u32(0xFFFF, n - i < 16 ? (unsigned int)(n - i) : 16);
+        __m512i bits = _mm512_castps_si512(_mm512_maskz_loadu_ps(mask, x + i));
+        __mmask16 is_nan = _mm512_cmpgt_epu32_mask(_mm512_and_si512(bits, _mm512_set1_epi32(0x7FFFFFFF)),
+                                                   _mm512_set1_epi32(0x7F800000));
+        __m512i odd = _mm512_and_si512(_mm512_srli_epi32(bits, 16), _mm512_set1_epi32(1));
+        __m512i rounded = _mm512_add_epi32(bits, _mm512_add_epi32(_mm512_set1_epi32(0x7FFF), odd));
+        rounded = _mm512_mask_or_epi32(rounded, is_nan, bits, _mm512_set1_epi32(0x00400000));
+        _mm256_mask_storeu_epi16(y_bf16 + i, mask, _mm512_cvtepi32_epi16(_mm512_srli_epi32(rounded, 16)));
+    }
+}
+
+__attribute__((target("avx512f,avx512vl,avx512bw,bmi2"))) //
+inline static void
+simsimd_avx512_f32_to_i8(simsimd_f32_t const* x, simsimd_size_t n, simsimd_f32_t scale, void* y) {
+    simsimd_i8_t* y_i8 = (simsimd_i8_t*)y;
+    __m512 const inverse_scale = _mm512_set1_ps(scale != 0 ? 1 / scale : 0);
+    __m512 const upper = _mm512_set1_ps(127), lower = _mm512_set1_ps(-127);
+    for (simsimd_size_t i = 0; i < n; i += 16) {
+        __mmask16 mask = (__mmask16)_bzhi_u32(0xFFFF, n - i < 16 ? (unsigned int)(n - i) : 16);
+        __m512 scaled = _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, x + i), inverse_scale);
+        __m512i words = _mm512_cvtps_epi32(_mm512_min_ps(_mm512_max_ps(scaled, lower), upper));
+        _mm_mask_storeu_epi8(y_i8 + i, mask, _mm512_cvtepi32_epi8(words));
+    }
+}
+
+__attribute__((target("avx512f,avx512vl,avx512bw,bmi2"))) //
+inline static void
+simsimd_avx512_f32_to_b8(simsimd_f32_t const* x, simsimd_size_t n, simsimd_f32_t scale, void* y) {
+    simsimd_b8_t* y_b8 = (simsimd_b8_t*)y;
+    __m512 const zeros = _mm512_setzero_ps();
+    simsimd_size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        simsimd_size_t bits = 0;
+        for (int k = 0; k != 4; ++k)
+            bits |= (simsimd_size_t)_mm512_cmp_ps_mask(_mm512_loadu_ps(x + i + k * 16), zeros, _CMP_GT_OQ)
+                    << (k * 16);
+        bits = simsimd_reverse_bits_in_bytes(bits);
+        for (int k = 0; k != 8; ++k)
+            y_b8[i / 8 + k] = (simsimd_b8_t)(bits >> (k * 8));
+    }
+    simsimd_serial_f32_to_b8(x + i, n - i, scale, y_b8 + i / 8);
+}
+
+__attribute__((target("avx512f,avx512vl,avx512bw,bmi2"))) //
+inline static simsimd_f32_t
+simsimd_avx512_f32_absmax(simsimd_f32_t const* x, simsimd_size_t n) {
+    __m512 max_vec = _mm512_setzero_ps();
+    for (simsimd_size_t i = 0; i < n; i += 16) {
+        __mmask16 mask = (__mmask16)_bzhi_u32(0xFFFF, n - i < 16 ? (unsigned int)(n - i) : 16);
+        max_vec = _mm512_max_ps(_mm512_abs_ps(_mm512_maskz_loadu_ps(mask, x + i)), max_vec);
+    }
+    return _mm512_reduce_max_ps(max_vec);
+}
+
+#endif // SIMSIMD_TARGET_X86_AVX512
+#endif // SIMSIMD_TARGET_X86
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,361 @@
+/**
+ *  @brief      SIMD-accelerated Asymmetric Distances to Product-Quantized Vectors.
+ *  @author     Ash Vardanian
+ *  @date       October 14, 2026
+ *
+ *  Contains:
+ *  - Asymmetric Distance Computation (ADC) for 8-bit codes, with a `f32` lookup table
+ *  - Fast-scan ADC for blocks of 4-bit codes, with a quantized `u8` lookup table
+ *
+ *  A vector is split into `m` sub-vectors, and every sub-vector is replaced with the index of the closest
+ *  centroid in the codebook of that subspace. For every query, the distances from each sub-vector of the query
+ *  to all the centroids of the matching subspace are computed once, into a lookup table (LUT) of `m` rows.
+ *  The distance to any code is then just the sum of `m` entries of that table, one from every row.
+ *
+ *  For datatypes:
+ *  - 8-bit codes, with 256 centroids per subspace and `f32` tables of `m * 256` entries
+ *  - 4-bit codes, with 16 centroids per subspace, packed in pairs into bytes and interleaved in blocks
+ *    of `SIMSIMD_PQ4_BLOCK` codes, with `u8` tables of `m * 16` entries
+ *
+ *  For hardware architectures:
+ *  - Arm (NEON)
+ *  - x86 (AVX2, AVX512)
+ *
+ *  x86 intrinsics: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/
+ *  Arm intrinsics: https://developer.arm.com/architectures/instruction-sets/intrinsics/
+ */
+
+#pragma once
+#include "types.h"
+
+/**
+ *  @brief  Number of 4-bit codes, interleaved together by `simsimd_pq4_pack` and scored at once by the
+ *          fast-scan kernels. Every block stores the `k`-th byte of all of its codes contiguously.
+ */
+#define SIMSIMD_PQ4_BLOCK 32
+
+/**
+ *  @brief  Number of byte columns, the 4-bit kernels accumulate in `u16` before flushing into `u32`.
+ *          Every column adds up to 2 * 255 to a lane, so 128 columns can't overflow 65535.
+ */
+#define SIMSIMD_PQ4_FLUSH_BYTES 128
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+inline static simsimd_f32_t simsimd_serial_pq8_adc( //
+    simsimd_f32_t const* lut, simsimd_b8_t const* codes, simsimd_size_t m) {
+    simsimd_f32_t d = 0;
+    for (simsimd_size_t i = 0; i != m; ++i)
+        d += lut[i * 256 + codes[i]];
+    return d;
+}
+
+/**
+ *  @brief  Quantizes a `f32` lookup table of `m` rows with 16 entries into the `u8` table, consumed by the
+ *          4-bit fast-scan kernels. The minimum of every row is subtracted, and all rows share the same
+ *          step, so that the distance to any code is `bias + scale * sum`, with a rounding error of at
+ *          most `m * scale / 2`. For odd `m` a zero row is appended to `lut_u8`, which must have room for
+ *          `(m + 1) / 2 * 32` entries.
+ */
+inline static void simsimd_pq4_quantize_lut(                                                //
+    simsimd_f32_t const* lut, simsimd_size_t m, simsimd_b8_t* lut_u8, simsimd_f32_t* scale, //
+    simsimd_f32_t* bias) {
+    simsimd_f32_t sum_of_mins = 0, max_range = 0;
+    for (simsimd_size_t i = 0; i != m; ++i) {
+        simsimd_f32_t min = lut[i * 16], max = lut[i * 16];
+        for (simsimd_size_t j = 1; j != 16; ++j)
+            min = lut[i * 16 + j] < min ? lut[i * 16 + j] : min, max = lut[i * 16 + j] > max ? lut[i * 16 + j] : max;
+        sum_of_mins += min;
+        max_range = max - min > max_range ? max - min : max_range;
+    }
+    simsimd_f32_t step = max_range > 0 ? max_range / 255 : 1;
+    for (simsimd_size_t i = 0; i != m; ++i) {
+        simsimd_f32_t min = lut[i * 16];
+        for (simsimd_size_t j = 1; j != 16; ++j)
+            min = lut[i * 16 + j] < min ? lut[i * 16 + j] : min;
+        for (simsimd_size_t j = 0; j != 16; ++j) {
+            simsimd_f32_t level = (lut[i * 16 + j] - min) / step + 0.5f;
+            lut_u8[i * 16 + j] = (simsimd_b8_t)(level > 255 ? 255 : level);
+        }
+    }
+    for (simsimd_size_t j = 0; j != 16 * (m & 1); ++j)
+        lut_u8[m * 16 + j] = 0;
+    *scale = step;
+    *bias = sum_of_mins;
+}
+
+/**
+ *  @brief  Interleaves `count` rows of 4-bit codes into blocks of `SIMSIMD_PQ4_BLOCK` codes for the fast-scan
+ *          kernels. Every row has `n_bytes` bytes, with the even subspace in the low nibble and the odd one
+ *          in the high nibble. The `packed` output must have room for `ceil(count / 32) * 32 * n_bytes`
+ *          bytes, and the rows missing in the last block are zero-filled.
+ */
+inline static void simsimd_pq4_pack(                                                                //
+    simsimd_b8_t const* codes, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n_bytes, //
+    simsimd_b8_t* packed) {
+    simsimd_size_t blocks = (count + SIMSIMD_PQ4_BLOCK - 1) / SIMSIMD_PQ4_BLOCK;
+    for (simsimd_size_t block = 0; block != blocks; ++block) {
+        simsimd_b8_t* block_start = packed + block * SIMSIMD_PQ4_BLOCK * n_bytes;
+        for (simsimd_size_t r = 0; r != SIMSIMD_PQ4_BLOCK; ++r) {
+            simsimd_size_t row = block * SIMSIMD_PQ4_BLOCK + r;
+            simsimd_b8_t const* row_start = codes + row * stride;
+            for (simsimd_size_t k = 0; k != n_bytes; ++k)
+                block_start[k * SIMSIMD_PQ4_BLOCK + r] = row < count ? row_start[k] : 0;
+        }
+    }
+}
+
+/**
+ *  @brief  Scores `count` interleaved 4-bit codes against a quantized lookup table, exporting the
+ *          dequantized `bias + scale * sum` distances.
+ */
+inline static void simsimd_serial_pq4_scan(                                                            //
+    simsimd_b8_t const* lut, simsimd_b8_t const* packed, simsimd_size_t count, simsimd_size_t n_bytes, //
+    simsimd_f32_t scale, simsimd_f32_t bias, simsimd_f32_t* results) {
+    for (simsimd_size_t block = 0; block * SIMSIMD_PQ4_BLOCK < count; ++block) {
+        simsimd_b8_t const* block_start = packed + block * SIMSIMD_PQ4_BLOCK * n_bytes;
+        simsimd_size_t rows = count - block * SIMSIMD_PQ4_BLOCK;
+        rows = rows < SIMSIMD_PQ4_BLOCK ? rows : SIMSIMD_PQ4_BLOCK;
+        for (simsimd_size_t r = 0; r != rows; ++r) {
+            simsimd_i32_t sum = 0;
+            for (simsimd_size_t k = 0; k != n_bytes; ++k) {
+                simsimd_b8_t code = block_start[k * SIMSIMD_PQ4_BLOCK + r];
+                sum += lut[k * 32 + (code & 0x0F)] + lut[k * 32 + 16 + (code >> 4)];
+            }
+            results[block * SIMSIMD_PQ4_BLOCK + r] = bias + scale * (simsimd_f32_t)sum;
+        }
+    }
+}
+
+/**
+ *  @brief  Exports the distances of one block of 4-bit codes, accumulated as `u32` integers.
+ */
+inline static void simsimd_pq4_export_block(simsimd_i32_t const* sums, simsimd_size_t rows, simsimd_f32_t scale,
+                                            simsimd_f32_t bias, simsimd_f32_t* results) {
+    for (simsimd_size_t r = 0; r != rows; ++r)
+        results[r] = bias + scale * (simsimd_f32_t)sums[r];
+}
+
+#if SIMSIMD_TARGET_ARM
+#if SIMSIMD_TARGET_ARM_NEON
+
+/*
+ *  @file   arm_neon_pq.h
+ *  @brief  Arm NEON implementation of the fast-scan kernels for 4-bit product-quantized codes.
+ *  @author Ash Vardanian
+ *
+ *  - Looks up 16 entries of a table row for 16 codes at once with `vqtbl1q_u8`.
+ *  - Widens the `u8` partial sums into `u16` with `vaddw_u8`, flushing them into `u32` periodically.
+ *  - The 8-bit codes have no gather instructions to benefit from, and use the serial kernel.
+ *  - Requires compiler capabilities: +simd.
+ */
+
+__attribute__((target("+simd"))) //
+inline static void
+simsimd_neon_pq4_scan(simsimd_b8_t const* lut, simsimd_b8_t const* packed, simsimd_size_t count,
+                      simsimd_size_t n_bytes, simsimd_f32_t scale, simsimd_f32_t bias, simsimd_f32_t* results) {
+    uint8x16_t const nibble_vec = vdupq_n_u8(0x0F);
+    for (simsimd_size_t block = 0; block * SIMSIMD_PQ4_BLOCK < count; ++block) {
+        simsimd_b8_t const* block_start = packed + block * SIMSIMD_PQ4_BLOCK * n_bytes;
+        uint32x4_t sums_vecs[8];
+        for (int v = 0; v != 8; ++v)
+            sums_vecs[v] = vdupq_n_u32(0);
+
+        for (simsimd_size_t k = 0; k < n_bytes;) {
+            simsimd_size_t k_end = k + SIMSIMD_PQ4_FLUSH_BYTES < n_bytes ? k + SIMSIMD_PQ4_FLUSH_BYTES : n_bytes;
+            uint16x8_t acc_vecs[4] = {vdupq_n_u16(0), vdupq_n_u16(0), vdupq_n_u16(0), vdupq_n_u16(0)};
+            for (; k != k_end; ++k) {
+                uint8x16_t lut_low_vec = vld1q_u8(lut + k * 32);
+                uint8x16_t lut_high_vec = vld1q_u8(lut + k * 32 + 16);
+                for (int half = 0; half != 2; ++half) {
+                    uint8x16_t codes_vec = vld1q_u8(block_start + k * SIMSIMD_PQ4_BLOCK + half * 16);
+                    uint8x16_t low_vec = vqtbl1q_u8(lut_low_vec, vandq_u8(codes_vec, nibble_vec));
+                    uint8x16_t high_vec = vqtbl1q_u8(lut_high_vec, vshrq_n_u8(codes_vec, 4));
+                    acc_vecs[half * 2] = vaddw_u8(acc_vecs[half * 2], vget_low_u8(low_vec));
+                    acc_vecs[half * 2] = vaddw_u8(acc_vecs[half * 2], vget_low_u8(high_vec));
+                    acc_vecs[half * 2 + 1] = vaddw_high_u8(acc_vecs[half * 2 + 1], low_vec);
+                    acc_vecs[half * 2 + 1] = vaddw_high_u8(acc_vecs[half * 2 + 1], high_vec);
+                }
+            }
+            for (int v = 0; v != 4; ++v) {
+                sums_vecs[v * 2] = vaddw_u16(sums_vecs[v * 2], vget_low_u16(acc_vecs[v]));
+                sums_vecs[v * 2 + 1] = vaddw_high_u16(sums_vecs[v * 2 + 1], acc_vecs[v]);
+            }
+        }
+
+        simsimd_i32_t sums[SIMSIMD_PQ4_BLOCK];
+        for (int v = 0; v != 8; ++v)
+            vst1q_s32(sums + v * 4, vreinterpretq_s32_u32(sums_vecs[v]));
+        simsimd_size_t rows = count - block * SIMSIMD_PQ4_BLOCK;
+        rows = rows < SIMSIMD_PQ4_BLOCK ? rows : SIMSIMD_PQ4_BLOCK;
+        simsimd_pq4_export_block(sums, rows, scale, bias, results + block * SIMSIMD_PQ4_BLOCK);
+    }
+}
+
+#endif // SIMSIMD_TARGET_ARM_NEON
+#endif // SIMSIMD_TARGET_ARM
+
+#if SIMSIMD_TARGET_X86
+#if SIMSIMD_TARGET_X86_AVX2
+
+/*
+ *  @file   x86_avx2_pq.h
+ *  @brief  x86 AVX2 implementation of the product-quantization kernels.
+ *  @author Ash Vardanian
+ *
+ *  - The 8-bit kernel fetches 8 table entries at once with `_mm256_i32gather_ps`.
+ *  - The 4-bit kernel looks up 32 codes of a block at once with `_mm256_shuffle_epi8`, using the same
+ *    table row in both 128-bit lanes, and accumulates even and odd codes in separate `u16` lanes.
+ *  - Requires compiler capabilities: avx2.
+ */
+
+__attribute__((target("avx2"))) //
+inline static simsimd_f32_t
+simsimd_avx2_pq8_adc(simsimd_f32_t const* lut, simsimd_b8_t const* codes, simsimd_size_t m) {
+    __m256i offsets_vec = _mm256_setr_epi32(0, 256, 512, 768, 1024, 1280, 1536, 1792);
+    __m256i const step_vec = _mm256_set1_epi32(8 * 256);
+    __m256 d_vec = _mm256_setzero_ps();
+    simsimd_size_t i = 0;
+    for (; i + 8 <= m; i += 8) {
+        __m256i codes_vec = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i const*)(codes + i)));
+        __m256i indices_vec = _mm256_add_epi32(codes_vec, offsets_vec);
+        d_vec = _mm256_add_ps(d_vec, _mm256_i32gather_ps(lut, indices_vec, 4));
+        offsets_vec = _mm256_add_epi32(offsets_vec, step_vec);
+    }
+
+    __m128 d_low_vec = _mm_add_ps(_mm256_castps256_ps128(d_vec), _mm256_extractf128_ps(d_vec, 1));
+    d_low_vec = _mm_hadd_ps(d_low_vec, d_low_vec);
+    d_low_vec = _mm_hadd_ps(d_low_vec, d_low_vec);
+    simsimd_f32_t d = _mm_cvtss_f32(d_low_vec);
+    for (; i != m; ++i)
+        d += lut[i * 256 + codes[i]];
+    return d;
+}
+
+__attribute__((target("avx2"))) //
+inline static void
+simsimd_avx2_pq4_scan(simsimd_b8_t const* lut, simsimd_b8_t const* packed, simsimd_size_t count,
+                      simsimd_size_t n_bytes, simsimd_f32_t scale, simsimd_f32_t bias, simsimd_f32_t* results) {
+    __m256i const nibble_vec = _mm256_set1_epi8(0x0F);
+    __m256i const low_byte_vec = _mm256_set1_epi16(0x00FF);
+    for (simsimd_size_t block = 0; block * SIMSIMD_PQ4_BLOCK < count; ++block) {
+        simsimd_b8_t const* block_start = packed + block * SIMSIMD_PQ4_BLOCK * n_bytes;
+        simsimd_i32_t sums[SIMSIMD_PQ4_BLOCK] = {0};
+
+        for (simsimd_size_t k = 0; k < n_bytes;) {
+            simsimd_size_t k_end = k + SIMSIMD_PQ4_FLUSH_BYTES < n_bytes ? k + SIMSIMD_PQ4_FLUSH_BYTES : n_bytes;
+            __m256i even_vec = _mm256_setzero_si256(), odd_vec = _mm256_setzero_si256();
+            for (; k != k_end; ++k) {
+                __m128i const* lut_row = (__m128i const*)(lut + k * 32);
+                __m256i lut_low_vec = _mm256_broadcastsi128_si256(_mm_loadu_si128(lut_row));
+                __m256i lut_high_vec = _mm256_broadcastsi128_si256(_mm_loadu_si128(lut_row + 1));
+                __m256i codes_vec = _mm256_loadu_si256((__m256i const*)(block_start + k * SIMSIMD_PQ4_BLOCK));
+                __m256i low_vec = _mm256_shuffle_epi8(lut_low_vec, _mm256_and_si256(codes_vec, nibble_vec));
+                __m256i high_vec = _mm256_shuffle_epi8( //
+                    lut_high_vec, _mm256_and_si256(_mm256_srli_epi16(codes_vec, 4), nibble_vec));
+                even_vec = _mm256_add_epi16(even_vec, _mm256_and_si256(low_vec, low_byte_vec));
+                even_vec = _mm256_add_epi16(even_vec, _mm256_and_si256(high_vec, low_byte_vec));
+                odd_vec = _mm256_add_epi16(odd_vec, _mm256_srli_epi16(low_vec, 8));
+                odd_vec = _mm256_add_epi16(odd_vec, _mm256_srli_epi16(high_vec, 8));
+            }
+            unsigned short even[16], odd[16];
+            _mm256_storeu_si256((__m256i*)even, even_vec);
+            _mm256_storeu_si256((__m256i*)odd, odd_vec);
+            for (int t = 0; t != 16; ++t)
+                sums[t * 2] += even[t], sums[t * 2 + 1] += odd[t];
+        }
+
+        simsimd_size_t rows = count - block * SIMSIMD_PQ4_BLOCK;
+        rows = rows < SIMSIMD_PQ4_BLOCK ? rows : SIMSIMD_PQ4_BLOCK;
+        simsimd_pq4_export_block(sums, rows, scale, bias, results + block * SIMSIMD_PQ4_BLOCK);
+    }
+}
+
+#endif // SIMSIMD_TARGET_X86_AVX2
+
+#if SIMSIMD_TARGET_X86_AVX512
+
+/*
+ *  @file   x86_avx512_pq.h
+ *  @brief  x86 AVX-512 implementation of the product-quantization kernels.
+ *  @author Ash Vardanian
+ *
+ *  - The 8-bit kernel fetches 16 table entries at once with masked `_mm512_mask_i32gather_ps`, avoiding tails.
+ *  - The 4-bit kernel processes two byte columns of a block at once, reshuffling four consecutive table rows
+ *    into the 128-bit lanes, so that the first two lanes look up the first column and the last two - the
+ *    second one. The columns are folded together before the periodic flush.
+ *  - Requires compiler capabilities: avx512f, avx512vl, avx512bw, bmi2.
+ */
+
+__attribute__((target("avx512f,avx512vl,avx512bw,bmi2"))) //
+inline static simsimd_f32_t
+simsimd_avx512_pq8_adc(simsimd_f32_t const* lut, simsimd_b8_t const* codes, simsimd_size_t m) {
+    __m512i offsets_vec = _mm512_mullo_epi32(
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32(256));
+    __m512i const step_vec = _mm512_set1_epi32(16 * 256);
+    __m512 d_vec = _mm512_setzero_ps();
+    for (simsimd_size_t i = 0; i < m; i += 16) {
+        __mmask16 mask = i + 16 <= m ? 0xFFFF : (__mmask16)_bzhi_u32(0xFFFF, (unsigned)(m - i));
+        __m512i codes_vec = _mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(mask, codes + i));
+        __m512i indices_vec = _mm512_add_epi32(codes_vec, offsets_vec);
+        d_vec = _mm512_add_ps(d_vec, _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask, indices_vec, lut, 4));
+        offsets_vec = _mm512_add_epi32(offsets_vec, step_vec);
+    }
+    return _mm512_reduce_add_ps(d_vec);
+}
+
+__attribute__((target("avx512f,avx512vl,avx512bw,bmi2"))) //
+inline static void
+simsimd_avx512_pq4_scan(simsimd_b8_t const* lut, simsimd_b8_t const* packed, simsimd_size_t count,
+                        simsimd_size_t n_bytes, simsimd_f32_t scale, simsimd_f32_t bias, simsimd_f32_t* results) {
+    __m512i const nibble_vec = _mm512_set1_epi8(0x0F);
+    __m512i const low_byte_vec = _mm512_set1_epi16(0x00FF);
+    for (simsimd_size_t block = 0; block * SIMSIMD_PQ4_BLOCK < count; ++block) {
+        simsimd_b8_t const* block_start = packed + block * SIMSIMD_PQ4_BLOCK * n_bytes;
+        simsimd_i32_t sums[SIMSIMD_PQ4_BLOCK] = {0};
+
+        for (simsimd_size_t k = 0; k < n_bytes;) {
+            simsimd_size_t k_end = k + SIMSIMD_PQ4_FLUSH_BYTES < n_bytes ? k + SIMSIMD_PQ4_FLUSH_BYTES : n_bytes;
+            __m512i even_vec = _mm512_setzero_si512(), odd_vec = _mm512_setzero_si512();
+            for (; k < k_end; k += 2) {
+                // With an odd number of columns, the last step loads just one column and two table rows,
+                // leaving zeros in the upper half, that look up zeros from the zeroed table rows.
+                __mmask64 mask = k + 2 <= k_end ? 0xFFFFFFFFFFFFFFFFull : 0x00000000FFFFFFFFull;
+                __m512i lut_vec = _mm512_maskz_loadu_epi8(mask, lut + k * 32);
+                __m512i lut_low_vec = _mm512_shuffle_i32x4(lut_vec, lut_vec, _MM_SHUFFLE(2, 2, 0, 0));
+                __m512i lut_high_vec = _mm512_shuffle_i32x4(lut_vec, lut_vec, _MM_SHUFFLE(3, 3, 1, 1));
+                __m512i codes_vec = _mm512_maskz_loadu_epi8(mask, block_start + k * SIMSIMD_PQ4_BLOCK);
+                __m512i low_vec = _mm512_shuffle_epi8(lut_low_vec, _mm512_and_si512(codes_vec, nibble_vec));
+                __m512i high_vec = _mm512_shuffle_epi8( //
+                    lut_high_vec, _mm512_and_si512(_mm512_srli_epi16(codes_vec, 4), nibble_vec));
+                even_vec = _mm512_add_epi16(even_vec, _mm512_and_si512(low_vec, low_byte_vec));
+                even_vec = _mm512_add_epi16(even_vec, _mm512_and_si512(high_vec, low_byte_vec));
+                odd_vec = _mm512_add_epi16(odd_vec, _mm512_srli_epi16(low_vec, 8));
+                odd_vec = _mm512_add_epi16(odd_vec, _mm512_srli_epi16(high_vec, 8));
+            }
+            // Each half accumulated at most `SIMSIMD_PQ4_FLUSH_BYTES / 2` columns, so the sum still fits.
+            __m256i even_folded_vec =
+                _mm256_add_epi16(_mm512_castsi512_si256(even_vec), _mm512_extracti64x4_epi64(even_vec, 1));
+            __m256i odd_folded_vec =
+                _mm256_add_epi16(_mm512_castsi512_si256(odd_vec), _mm512_extracti64x4_epi64(odd_vec, 1));
+            unsigned short even[16], odd[16];
+            _mm256_storeu_si256((__m256i*)even, even_folded_vec);
+            _mm256_storeu_si256((__m256i*)odd, odd_folded_vec);
+            for (int t = 0; t != 16; ++t)
+                sums[t * 2] += even[t], sums[t * 2 + 1] += odd[t];
+        }
+
+        simsimd_size_t rows = count - block * SIMSIMD_PQ4_BLOCK;
+        rows = rows < SIMSIMD_PQ4_BLOCK ? rows : SIMSIMD_PQ4_BLOCK;
+        simsimd_pq4_export_block(sums, rows, scale, bias, results + block * SIMSIMD_PQ4_BLOCK);
+    }
+}
+
+#endif // SIMSIMD_TARGET_X86_AVX512
+#endif // SIMSIMD_TARGET_X86
+
+#ifdef __cplusplus
+}
+#endif
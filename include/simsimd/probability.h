@@ -6,8 +6,10 @@
  *  Contains:
  *  - Kullback-Leibler divergence
  *  - Jensen–Shannon divergence
+ *  - Mixture, cross-entropy, and entropy terms, to reuse the logarithms across many pairs of distributions
  *
  *  For datatypes:
+ *  - 64-bit floating point numbers
  *  - 32-bit floating point numbers
  *  - 16-bit floating point numbers
  *
@@ -15,26 +17,54 @@
  *  - Arm (NEON, SVE)
  *  - x86 (AVX2, AVX512)
  *
+ *  All backends share one `log2` approximation. The argument is split into `2^e * (1 + t)` with integer
+ *  arithmetic, so that `1 + t` lands between `sqrt(0.5)` and `sqrt(2)`, and `log2(1 + t) / t` is evaluated
+ *  with the Horner scheme over the same coefficients. Centering the mantissa around one keeps the relative
+ *  error bounded for ratios close to one, which dominate the sums for similar distributions.
+ *  The degree of the polynomial is controlled by `SIMSIMD_LOG_PRECISION`, and the smoothing term by
+ *  `SIMSIMD_PROBABILITY_EPSILON`. Half-precision inputs are upcast to `f32` before taking the logarithm.
+ *
  *  x86 intrinsics: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/
  *  Arm intrinsics: https://developer.arm.com/architectures/instruction-sets/intrinsics/
  */
 
 #pragma once
+#include <math.h> // `log2` for the accurate kernels
+
 #include "types.h"
 
-#define SIMSIMD_MAKE_KL(name, input_type, accumulator_type, converter, epsilon)                                        \
+/**
+ *  @brief  Coefficients of the `log2(1 + t) / t` polynomial, starting from the highest power,
+ *          interpolated in the Chebyshev nodes of `[sqrt(0.5) - 1, sqrt(2) - 1)`.
+ */
+#if SIMSIMD_LOG_PRECISION == SIMSIMD_LOG_PRECISION_FAST
+#define SIMSIMD_LOG2_DEGREE 5
+static simsimd_f64_t const simsimd_log2_coefficients[SIMSIMD_LOG2_DEGREE + 1] = {
+    -0.20228926373027359, 0.31689818715682966, -0.36692577095739515,
+    0.47992557347074771,  -0.7211957523938719, 1.442700440013496,
+};
+#else
+#define SIMSIMD_LOG2_DEGREE 8
+static simsimd_f64_t const simsimd_log2_coefficients[SIMSIMD_LOG2_DEGREE + 1] = {
+    0.12310968463235697,  -0.20586188049558118, 0.21607822552232919,
+    -0.23916988140029871, 0.28790326092471519,  -0.36069326813563668,
+    0.48091075345941414,  -0.72134746824955176, 1.4426950035679822,
+};
+#endif
+
+#define SIMSIMD_MAKE_KL(name, input_type, accumulator_type, converter, logarithm, epsilon)                             \
     inline static simsimd_f32_t simsimd_##name##_##input_type##_kl(                                                    \
         simsimd_##input_type##_t const* a, simsimd_##input_type##_t const* b, simsimd_size_t n) {                      \
         simsimd_##accumulator_type##_t d = 0;                                                                          \
         for (simsimd_size_t i = 0; i != n; ++i) {                                                                      \
             simsimd_##accumulator_type##_t ai = converter(a[i]);                                                       \
             simsimd_##accumulator_type##_t bi = converter(b[i]);                                                       \
-            d += ai * SIMSIMD_LOG((ai + epsilon) / (bi + epsilon));                                                    \
+            d += ai * logarithm((ai + epsilon) / (bi + epsilon));                                                      \
         }                                                                                                              \
-        return d;                                                                                                      \
+        return (simsimd_f32_t)(d * 0.6931471805599453);                                                            \
     }
 
-#define SIMSIMD_MAKE_JS(name, input_type, accumulator_type, converter, epsilon)                                        \
+#define SIMSIMD_MAKE_JS(name, input_type, accumulator_type, converter, logarithm, epsilon)                             \
     inline static simsimd_f32_t simsimd_##name##_##input_type##_js(                                                    \
         simsimd_##input_type##_t const* a, simsimd_##input_type##_t const* b, simsimd_size_t n) {                      \
         simsimd_##accumulator_type##_t d = 0;                                                                          \
@@ -42,27 +72,135 @@
             simsimd_##accumulator_type##_t ai = converter(a[i]);                                                       \
             simsimd_##accumulator_type##_t bi = converter(b[i]);                                                       \
             simsimd_##accumulator_type##_t mi = (ai + bi) / 2;                                                         \
-            d += ai * SIMSIMD_LOG((ai + epsilon) / (mi + epsilon));                                                    \
-            d += bi * SIMSIMD_LOG((bi + epsilon) / (mi + epsilon));                                                    \
+            d += ai * logarithm((ai + epsilon) / (mi + epsilon));                                                      \
+            d += bi * logarithm((bi + epsilon) / (mi + epsilon));                                                      \
         }                                                                                                              \
-        return d / 2;                                                                                                  \
+        return (simsimd_f32_t)(d * 0.5 * 0.6931471805599453);                                                      \
+    }
+
+#define SIMSIMD_MAKE_JS_MIXTURE(name, input_type, log_type, accumulator_type, converter, logarithm, epsilon)           \
+    inline static simsimd_f64_t simsimd_##name##_##input_type##_js_mixture(                                            \
+        simsimd_##input_type##_t const* a, simsimd_##input_type##_t const* b, simsimd_size_t n) {                      \
+        simsimd_##accumulator_type##_t d = 0;                                                                          \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                                      \
+            simsimd_##log_type##_t ai = converter(a[i]), bi = converter(b[i]);                                         \
+            simsimd_##log_type##_t si = ai + bi;                                                                       \
+            d += (simsimd_##accumulator_type##_t)si * logarithm(si / 2 + epsilon);                                     \
+        }                                                                                                              \
+        return (simsimd_f64_t)d;                                                                                       \
+    }
+
+#define SIMSIMD_MAKE_CROSS_ENTROPY(name, input_type, log_type, accumulator_type, converter)                            \
+    inline static simsimd_f64_t simsimd_##name##_##input_type##_cross_entropy(                                         \
+        simsimd_##log_type##_t const* logs, simsimd_##input_type##_t const* a, simsimd_size_t n) {                     \
+        simsimd_##accumulator_type##_t d = 0;                                                                          \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                                      \
+            simsimd_##log_type##_t ai = converter(a[i]);                                                               \
+            d += (simsimd_##accumulator_type##_t)ai * logs[i];                                                         \
+        }                                                                                                              \
+        return -(simsimd_f64_t)d;                                                                                      \
+    }
+
+#define SIMSIMD_MAKE_LOG_TERMS(name, input_type, log_type, accumulator_type, converter, logarithm, epsilon)            \
+    inline static simsimd_f64_t simsimd_##name##_##input_type##_log_terms(                                             \
+        simsimd_##input_type##_t const* a, simsimd_size_t n, simsimd_##log_type##_t* logs) {                           \
+        simsimd_##accumulator_type##_t d = 0;                                                                          \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                                      \
+            simsimd_##log_type##_t ai = converter(a[i]);                                                               \
+            simsimd_##log_type##_t li = logarithm(ai + epsilon);                                                       \
+            if (logs)                                                                                                  \
+                logs[i] = li;                                                                                          \
+            d += (simsimd_##accumulator_type##_t)ai * li;                                                              \
+        }                                                                                                              \
+        return -(simsimd_f64_t)d;                                                                                      \
     }
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-SIMSIMD_MAKE_KL(serial, f32, f32, SIMSIMD_IDENTIFY, 1e-6) // simsimd_serial_f32_kl
-SIMSIMD_MAKE_JS(serial, f32, f32, SIMSIMD_IDENTIFY, 1e-6) // simsimd_serial_f32_js
+/**
+ *  @brief  Computes `log2(x)` for positive normal numbers with the shared polynomial,
+ *          matching the vectorized approximations below element-by-element.
+ */
+inline static simsimd_f32_t simsimd_serial_f32_log2(simsimd_f32_t x) {
+    simsimd_f32i32_t conv;
+    conv.f = x;
+    unsigned i = conv.i + 0x004AFB0Du; // `0x3F800000` minus the bits of `sqrt(0.5)`
+    simsimd_f32_t e = (simsimd_f32_t)((int)(i >> 23) - 127);
+    conv.i = (i & 0x007FFFFFu) + 0x3F3504F3u;
+    simsimd_f32_t t = conv.f - 1;
+    simsimd_f32_t p = (simsimd_f32_t)simsimd_log2_coefficients[0];
+    for (int k = 1; k <= SIMSIMD_LOG2_DEGREE; ++k)
+        p = p * t + (simsimd_f32_t)simsimd_log2_coefficients[k];
+    return p * t + e;
+}
+
+inline static simsimd_f64_t simsimd_serial_f64_log2(simsimd_f64_t x) {
+    simsimd_f64i64_t conv;
+    conv.f = x;
+    unsigned long long i = conv.i + 0x00095F619980C433ull; // `0x3FF0000000000000` minus the bits of `sqrt(0.5)`
+    simsimd_f64_t e = (simsimd_f64_t)((long long)(i >> 52) - 1023);
+    conv.i = (i & 0x000FFFFFFFFFFFFFull) + 0x3FE6A09E667F3BCDull;
+    simsimd_f64_t t = conv.f - 1;
+    simsimd_f64_t p = simsimd_log2_coefficients[0];
+    for (int k = 1; k <= SIMSIMD_LOG2_DEGREE; ++k)
+        p = p * t + simsimd_log2_coefficients[k];
+    return p * t + e;
+}
+
+SIMSIMD_MAKE_KL(serial, f64, f64, SIMSIMD_IDENTIFY, simsimd_serial_f64_log2,
+                SIMSIMD_PROBABILITY_EPSILON) // simsimd_serial_f64_kl
+SIMSIMD_MAKE_JS(serial, f64, f64, SIMSIMD_IDENTIFY, simsimd_serial_f64_log2,
+                SIMSIMD_PROBABILITY_EPSILON) // simsimd_serial_f64_js
+
+SIMSIMD_MAKE_KL(serial, f32, f32, SIMSIMD_IDENTIFY, simsimd_serial_f32_log2,
+                (simsimd_f32_t)SIMSIMD_PROBABILITY_EPSILON) // simsimd_serial_f32_kl
+SIMSIMD_MAKE_JS(serial, f32, f32, SIMSIMD_IDENTIFY, simsimd_serial_f32_log2,
+                (simsimd_f32_t)SIMSIMD_PROBABILITY_EPSILON) // simsimd_serial_f32_js
 
-SIMSIMD_MAKE_KL(serial, f16, f32, SIMSIMD_UNCOMPRESS_F16, 1e-3) // simsimd_serial_f16_kl
-SIMSIMD_MAKE_JS(serial, f16, f32, SIMSIMD_UNCOMPRESS_F16, 1e-3) // simsimd_serial_f16_js
+SIMSIMD_MAKE_KL(serial, f16, f32, SIMSIMD_UNCOMPRESS_F16, simsimd_serial_f32_log2,
+                (simsimd_f32_t)SIMSIMD_PROBABILITY_EPSILON) // simsimd_serial_f16_kl
+SIMSIMD_MAKE_JS(serial, f16, f32, SIMSIMD_UNCOMPRESS_F16, simsimd_serial_f32_log2,
+                (simsimd_f32_t)SIMSIMD_PROBABILITY_EPSILON) // simsimd_serial_f16_js
 
-SIMSIMD_MAKE_KL(accurate, f32, f64, SIMSIMD_IDENTIFY, 1e-6) // simsimd_accurate_f32_kl
-SIMSIMD_MAKE_JS(accurate, f32, f64, SIMSIMD_IDENTIFY, 1e-6) // simsimd_accurate_f32_js
+/*  The mixture terms of the Jensen–Shannon divergence, `sum((a + b) * log2((a + b) / 2))` in bits, are the only
+ *  part of it that depends on both distributions. Together with the per-distribution entropies, produced by the
+ *  `log_terms` kernels, they allow computing all-pairs divergences with half as many logarithms. The cached terms
+ *  are subtracted from each other, so the logarithms are taken in the input precision, like in the `log_terms`,
+ *  but the products are accumulated in `f64`, for the differences of close distributions to stay accurate.
+ */
+SIMSIMD_MAKE_JS_MIXTURE(serial, f64, f64, f64, SIMSIMD_IDENTIFY, simsimd_serial_f64_log2,
+                        SIMSIMD_PROBABILITY_EPSILON) // simsimd_serial_f64_js_mixture
+SIMSIMD_MAKE_JS_MIXTURE(serial, f32, f32, f64, SIMSIMD_IDENTIFY, simsimd_serial_f32_log2,
+                        (simsimd_f32_t)SIMSIMD_PROBABILITY_EPSILON) // simsimd_serial_f32_js_mixture
+SIMSIMD_MAKE_JS_MIXTURE(serial, f16, f32, f64, SIMSIMD_UNCOMPRESS_F16, simsimd_serial_f32_log2,
+                        (simsimd_f32_t)SIMSIMD_PROBABILITY_EPSILON) // simsimd_serial_f16_js_mixture
+
+/*  The cross-entropy terms of the Kullback-Leibler divergence, `-sum(a * log2(b + epsilon))` in bits, take the
+ *  logarithms of the second distribution, exported by the `log_terms` kernels, and accumulate in `f64`.
+ */
+SIMSIMD_MAKE_CROSS_ENTROPY(serial, f64, f64, f64, SIMSIMD_IDENTIFY) // simsimd_serial_f64_cross_entropy
+SIMSIMD_MAKE_CROSS_ENTROPY(serial, f32, f32, f64, SIMSIMD_IDENTIFY) // simsimd_serial_f32_cross_entropy
+SIMSIMD_MAKE_CROSS_ENTROPY(serial, f16, f32, f64, SIMSIMD_UNCOMPRESS_F16) // simsimd_serial_f16_cross_entropy
+
+/*  The `log_terms` kernels export `log2(a + epsilon)` for every element into the optional `logs` array,
+ *  and return the entropy `-sum(a * log2(a + epsilon))` in bits, accumulated in double precision.
+ */
+SIMSIMD_MAKE_LOG_TERMS(serial, f64, f64, f64, SIMSIMD_IDENTIFY, simsimd_serial_f64_log2,
+                       SIMSIMD_PROBABILITY_EPSILON) // simsimd_serial_f64_log_terms
+SIMSIMD_MAKE_LOG_TERMS(serial, f32, f32, f64, SIMSIMD_IDENTIFY, simsimd_serial_f32_log2,
+                       (simsimd_f32_t)SIMSIMD_PROBABILITY_EPSILON) // simsimd_serial_f32_log_terms
+SIMSIMD_MAKE_LOG_TERMS(serial, f16, f32, f64, SIMSIMD_UNCOMPRESS_F16, simsimd_serial_f32_log2,
+                       (simsimd_f32_t)SIMSIMD_PROBABILITY_EPSILON) // simsimd_serial_f16_log_terms
+
+SIMSIMD_MAKE_KL(accurate, f32, f64, SIMSIMD_IDENTIFY, log2, SIMSIMD_PROBABILITY_EPSILON) // simsimd_accurate_f32_kl
+SIMSIMD_MAKE_JS(accurate, f32, f64, SIMSIMD_IDENTIFY, log2, SIMSIMD_PROBABILITY_EPSILON) // simsimd_accurate_f32_js
 
-SIMSIMD_MAKE_KL(accurate, f16, f64, SIMSIMD_UNCOMPRESS_F16, 1e-6) // simsimd_accurate_f16_kl
-SIMSIMD_MAKE_JS(accurate, f16, f64, SIMSIMD_UNCOMPRESS_F16, 1e-6) // simsimd_accurate_f16_js
+SIMSIMD_MAKE_KL(accurate, f16, f64, SIMSIMD_UNCOMPRESS_F16, log2,
+                SIMSIMD_PROBABILITY_EPSILON) // simsimd_accurate_f16_kl
+SIMSIMD_MAKE_JS(accurate, f16, f64, SIMSIMD_UNCOMPRESS_F16, log2,
+                SIMSIMD_PROBABILITY_EPSILON) // simsimd_accurate_f16_js
 
 #if SIMSIMD_TARGET_ARM
 #if SIMSIMD_TARGET_ARM_NEON
@@ -72,86 +210,221 @@ SIMSIMD_MAKE_JS(accurate, f16, f64, SIMSIMD_UNCOMPRESS_F16, 1e-6) // simsimd_acc
  *  @brief  Arm NEON implementation of the most common similarity metrics for 32-bit floating point numbers.
  *  @author Ash Vardanian
  *
- *  - Implements: Kullback-Leibler and Jensen–Shannon divergence.
+ *  - Implements: Kullback-Leibler and Jensen–Shannon divergence, and their cached mixture and cross-entropy terms.
  *  - Uses `f32` for storage and `f32` for accumulation.
+ *  - Uses `simsimd_serial_f32_log2` for the tails, to match the vectorized body.
  *  - Requires compiler capabilities: +simd.
  */
 
 __attribute__((target("+simd"))) //
-inline float32x4_t
+inline static float32x4_t
 simsimd_neon_f32_log2(float32x4_t x) {
-    // Extracting the exponent
-    int32x4_t i = vreinterpretq_s32_f32(x);
-    int32x4_t e = vsubq_s32(vshrq_n_s32(vandq_s32(i, vdupq_n_s32(0x7F800000)), 23), vdupq_n_s32(127));
-    float32x4_t e_float = vcvtq_f32_s32(e);
-
-    // Extracting the mantissa
-    float32x4_t m = vreinterpretq_f32_s32(vorrq_s32(vandq_s32(i, vdupq_n_s32(0x007FFFFF)), vdupq_n_s32(0x3F800000)));
-
-    // Constants for polynomial
-    float32x4_t one = vdupq_n_f32(1.0f);
-    float32x4_t p = vdupq_n_f32(-3.4436006e-2f);
+    // Splitting into `2^e * (1 + t)`, where `1 + t` is between `sqrt(0.5)` and `sqrt(2)`
+    uint32x4_t i = vaddq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x004AFB0D));
+    int32x4_t e = vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(i, 23)), vdupq_n_s32(127));
+    uint32x4_t m = vaddq_u32(vandq_u32(i, vdupq_n_u32(0x007FFFFF)), vdupq_n_u32(0x3F3504F3));
+    float32x4_t t = vsubq_f32(vreinterpretq_f32_u32(m), vdupq_n_f32(1.0f));
 
     // Compute polynomial using Horner's method
-    p = vmlaq_f32(vdupq_n_f32(3.1821337e-1f), m, p);
-    p = vmlaq_f32(vdupq_n_f32(-1.2315303f), m, p);
-    p = vmlaq_f32(vdupq_n_f32(2.5988452f), m, p);
-    p = vmlaq_f32(vdupq_n_f32(-3.3241990f), m, p);
-    p = vmlaq_f32(vdupq_n_f32(3.1157899f), m, p);
+    float32x4_t p = vdupq_n_f32((simsimd_f32_t)simsimd_log2_coefficients[0]);
+    for (int k = 1; k <= SIMSIMD_LOG2_DEGREE; ++k)
+        p = vfmaq_f32(vdupq_n_f32((simsimd_f32_t)simsimd_log2_coefficients[k]), p, t);
+    return vfmaq_f32(vcvtq_f32_s32(e), p, t);
+}
 
-    // Final computation
-    float32x4_t result = vaddq_f32(vmulq_f32(p, vsubq_f32(m, one)), e_float);
-    return result;
+/**
+ *  @brief  Accumulates the products of four pairs of `f32` values into two vectors of `f64` sums, as the cached
+ *          divergence terms are later subtracted from each other and would cancel out in single precision.
+ */
+__attribute__((target("+simd"))) //
+inline static void
+simsimd_neon_f32_fma_f64(float32x4_t x, float32x4_t y, float64x2_t* sum_low, float64x2_t* sum_high) {
+    *sum_low = vfmaq_f64(*sum_low, vcvt_f64_f32(vget_low_f32(x)), vcvt_f64_f32(vget_low_f32(y)));
+    *sum_high = vfmaq_f64(*sum_high, vcvt_high_f64_f32(x), vcvt_high_f64_f32(y));
 }
 
 __attribute__((target("+simd"))) //
 inline static simsimd_f32_t
 simsimd_neon_f32_kl(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
     float32x4_t sum_vec = vdupq_n_f32(0);
-    simsimd_f32_t epsilon = 1e-6;
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
     float32x4_t epsilon_vec = vdupq_n_f32(epsilon);
     simsimd_size_t i = 0;
     for (; i + 4 <= n; i += 4) {
         float32x4_t a_vec = vld1q_f32(a + i);
         float32x4_t b_vec = vld1q_f32(b + i);
         float32x4_t ratio_vec = vdivq_f32(vaddq_f32(a_vec, epsilon_vec), vaddq_f32(b_vec, epsilon_vec));
-        float32x4_t log_ratio_vec = simsimd_neon_f32_log2(ratio_vec);
-        float32x4_t prod_vec = vmulq_f32(a_vec, log_ratio_vec);
-        sum_vec = vaddq_f32(sum_vec, prod_vec);
+        sum_vec = vfmaq_f32(sum_vec, a_vec, simsimd_neon_f32_log2(ratio_vec));
     }
-    simsimd_f32_t log2_normalizer = 0.693147181f;
-    simsimd_f32_t sum = vaddvq_f32(sum_vec) * log2_normalizer;
+    simsimd_f32_t sum = vaddvq_f32(sum_vec);
     for (; i < n; ++i)
-        sum += a[i] * SIMSIMD_LOG((a[i] + epsilon) / (b[i] + epsilon));
-    return sum;
+        sum += a[i] * simsimd_serial_f32_log2((a[i] + epsilon) / (b[i] + epsilon));
+    simsimd_f32_t log2_normalizer = 0.693147181f;
+    return sum * log2_normalizer;
 }
 
-__attribute__((target("+simd"))) inline static simsimd_f32_t
+__attribute__((target("+simd"))) //
+inline static simsimd_f32_t
 simsimd_neon_f32_js(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
     float32x4_t sum_vec = vdupq_n_f32(0);
-    simsimd_f32_t epsilon = 1e-6;
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
     float32x4_t epsilon_vec = vdupq_n_f32(epsilon);
     simsimd_size_t i = 0;
     for (; i + 4 <= n; i += 4) {
         float32x4_t a_vec = vld1q_f32(a + i);
         float32x4_t b_vec = vld1q_f32(b + i);
-        float32x4_t m_vec = vmulq_f32(vaddq_f32(a_vec, b_vec), vdupq_n_f32(0.5));
-        float32x4_t ratio_a_vec = vdivq_f32(vaddq_f32(a_vec, epsilon_vec), vaddq_f32(m_vec, epsilon_vec));
-        float32x4_t ratio_b_vec = vdivq_f32(vaddq_f32(b_vec, epsilon_vec), vaddq_f32(m_vec, epsilon_vec));
-        float32x4_t log_ratio_a_vec = simsimd_neon_f32_log2(ratio_a_vec);
-        float32x4_t log_ratio_b_vec = simsimd_neon_f32_log2(ratio_b_vec);
-        float32x4_t prod_a_vec = vmulq_f32(a_vec, log_ratio_a_vec);
-        float32x4_t prod_b_vec = vmulq_f32(b_vec, log_ratio_b_vec);
-        sum_vec = vaddq_f32(sum_vec, vaddq_f32(prod_a_vec, prod_b_vec));
+        float32x4_t m_vec = vfmaq_f32(epsilon_vec, vaddq_f32(a_vec, b_vec), vdupq_n_f32(0.5f)); // M = (P + Q) / 2
+        float32x4_t ratio_a_vec = vdivq_f32(vaddq_f32(a_vec, epsilon_vec), m_vec);
+        float32x4_t ratio_b_vec = vdivq_f32(vaddq_f32(b_vec, epsilon_vec), m_vec);
+        sum_vec = vfmaq_f32(sum_vec, a_vec, simsimd_neon_f32_log2(ratio_a_vec));
+        sum_vec = vfmaq_f32(sum_vec, b_vec, simsimd_neon_f32_log2(ratio_b_vec));
+    }
+    simsimd_f32_t sum = vaddvq_f32(sum_vec);
+    for (; i < n; ++i) {
+        simsimd_f32_t mi = (a[i] + b[i]) / 2;
+        sum += a[i] * simsimd_serial_f32_log2((a[i] + epsilon) / (mi + epsilon));
+        sum += b[i] * simsimd_serial_f32_log2((b[i] + epsilon) / (mi + epsilon));
     }
     simsimd_f32_t log2_normalizer = 0.693147181f;
-    simsimd_f32_t sum = vaddvq_f32(sum_vec) * log2_normalizer;
+    return sum * 0.5f * log2_normalizer;
+}
+
+__attribute__((target("+simd"))) //
+inline static simsimd_f64_t
+simsimd_neon_f32_js_mixture(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
+    float64x2_t sum_low_vec = vdupq_n_f64(0), sum_high_vec = vdupq_n_f64(0);
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    float32x4_t epsilon_vec = vdupq_n_f32(epsilon);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t s_vec = vaddq_f32(vld1q_f32(a + i), vld1q_f32(b + i));
+        float32x4_t m_vec = vfmaq_f32(epsilon_vec, s_vec, vdupq_n_f32(0.5f)); // M = (P + Q) / 2
+        simsimd_neon_f32_fma_f64(s_vec, simsimd_neon_f32_log2(m_vec), &sum_low_vec, &sum_high_vec);
+    }
+    simsimd_f64_t sum = vaddvq_f64(vaddq_f64(sum_low_vec, sum_high_vec));
     for (; i < n; ++i) {
-        simsimd_f32_t mi = a[i] + b[i];
-        sum += a[i] * SIMSIMD_LOG((a[i] + epsilon) / (mi + epsilon));
-        sum += b[i] * SIMSIMD_LOG((b[i] + epsilon) / (mi + epsilon));
+        simsimd_f32_t si = a[i] + b[i];
+        sum += (simsimd_f64_t)si * simsimd_serial_f32_log2(si / 2 + epsilon);
     }
-    return sum * 0.5f;
+    return sum;
+}
+
+__attribute__((target("+simd"))) //
+inline static simsimd_f64_t
+simsimd_neon_f32_cross_entropy(simsimd_f32_t const* logs, simsimd_f32_t const* a, simsimd_size_t n) {
+    float64x2_t sum_low_vec = vdupq_n_f64(0), sum_high_vec = vdupq_n_f64(0);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        simsimd_neon_f32_fma_f64(vld1q_f32(a + i), vld1q_f32(logs + i), &sum_low_vec, &sum_high_vec);
+    simsimd_f64_t sum = vaddvq_f64(vaddq_f64(sum_low_vec, sum_high_vec));
+    for (; i < n; ++i)
+        sum += (simsimd_f64_t)a[i] * logs[i];
+    return -sum;
+}
+
+/*
+ *  @file   arm_neon_f64.h
+ *  @brief  Arm NEON implementation of the most common similarity metrics for 64-bit floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: Kullback-Leibler and Jensen–Shannon divergence, and their cached mixture and cross-entropy terms.
+ *  - Uses `f64` for storage and `f64` for accumulation.
+ *  - Requires compiler capabilities: +simd.
+ */
+
+__attribute__((target("+simd"))) //
+inline static float64x2_t
+simsimd_neon_f64_log2(float64x2_t x) {
+    // Splitting into `2^e * (1 + t)`, where `1 + t` is between `sqrt(0.5)` and `sqrt(2)`
+    uint64x2_t i = vaddq_u64(vreinterpretq_u64_f64(x), vdupq_n_u64(0x00095F619980C433ull));
+    int64x2_t e = vsubq_s64(vreinterpretq_s64_u64(vshrq_n_u64(i, 52)), vdupq_n_s64(1023));
+    uint64x2_t m = vaddq_u64(vandq_u64(i, vdupq_n_u64(0x000FFFFFFFFFFFFFull)), vdupq_n_u64(0x3FE6A09E667F3BCDull));
+    float64x2_t t = vsubq_f64(vreinterpretq_f64_u64(m), vdupq_n_f64(1.0));
+
+    // Compute polynomial using Horner's method
+    float64x2_t p = vdupq_n_f64(simsimd_log2_coefficients[0]);
+    for (int k = 1; k <= SIMSIMD_LOG2_DEGREE; ++k)
+        p = vfmaq_f64(vdupq_n_f64(simsimd_log2_coefficients[k]), p, t);
+    return vfmaq_f64(vcvtq_f64_s64(e), p, t);
+}
+
+__attribute__((target("+simd"))) //
+inline static simsimd_f32_t
+simsimd_neon_f64_kl(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    float64x2_t sum_vec = vdupq_n_f64(0);
+    simsimd_f64_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    float64x2_t epsilon_vec = vdupq_n_f64(epsilon);
+    simsimd_size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        float64x2_t a_vec = vld1q_f64(a + i);
+        float64x2_t b_vec = vld1q_f64(b + i);
+        float64x2_t ratio_vec = vdivq_f64(vaddq_f64(a_vec, epsilon_vec), vaddq_f64(b_vec, epsilon_vec));
+        sum_vec = vfmaq_f64(sum_vec, a_vec, simsimd_neon_f64_log2(ratio_vec));
+    }
+    simsimd_f64_t sum = vaddvq_f64(sum_vec);
+    for (; i < n; ++i)
+        sum += a[i] * simsimd_serial_f64_log2((a[i] + epsilon) / (b[i] + epsilon));
+    simsimd_f64_t log2_normalizer = 0.6931471805599453;
+    return (simsimd_f32_t)(sum * log2_normalizer);
+}
+
+__attribute__((target("+simd"))) //
+inline static simsimd_f32_t
+simsimd_neon_f64_js(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    float64x2_t sum_vec = vdupq_n_f64(0);
+    simsimd_f64_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    float64x2_t epsilon_vec = vdupq_n_f64(epsilon);
+    simsimd_size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        float64x2_t a_vec = vld1q_f64(a + i);
+        float64x2_t b_vec = vld1q_f64(b + i);
+        float64x2_t m_vec = vfmaq_f64(epsilon_vec, vaddq_f64(a_vec, b_vec), vdupq_n_f64(0.5)); // M = (P + Q) / 2
+        float64x2_t ratio_a_vec = vdivq_f64(vaddq_f64(a_vec, epsilon_vec), m_vec);
+        float64x2_t ratio_b_vec = vdivq_f64(vaddq_f64(b_vec, epsilon_vec), m_vec);
+        sum_vec = vfmaq_f64(sum_vec, a_vec, simsimd_neon_f64_log2(ratio_a_vec));
+        sum_vec = vfmaq_f64(sum_vec, b_vec, simsimd_neon_f64_log2(ratio_b_vec));
+    }
+    simsimd_f64_t sum = vaddvq_f64(sum_vec);
+    for (; i < n; ++i) {
+        simsimd_f64_t mi = (a[i] + b[i]) / 2;
+        sum += a[i] * simsimd_serial_f64_log2((a[i] + epsilon) / (mi + epsilon));
+        sum += b[i] * simsimd_serial_f64_log2((b[i] + epsilon) / (mi + epsilon));
+    }
+    simsimd_f64_t log2_normalizer = 0.6931471805599453;
+    return (simsimd_f32_t)(sum * 0.5 * log2_normalizer);
+}
+
+__attribute__((target("+simd"))) //
+inline static simsimd_f64_t
+simsimd_neon_f64_js_mixture(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    float64x2_t sum_vec = vdupq_n_f64(0);
+    simsimd_f64_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    float64x2_t epsilon_vec = vdupq_n_f64(epsilon);
+    simsimd_size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        float64x2_t s_vec = vaddq_f64(vld1q_f64(a + i), vld1q_f64(b + i));
+        float64x2_t m_vec = vfmaq_f64(epsilon_vec, s_vec, vdupq_n_f64(0.5)); // M = (P + Q) / 2
+        sum_vec = vfmaq_f64(sum_vec, s_vec, simsimd_neon_f64_log2(m_vec));
+    }
+    simsimd_f64_t sum = vaddvq_f64(sum_vec);
+    for (; i < n; ++i) {
+        simsimd_f64_t si = a[i] + b[i];
+        sum += si * simsimd_serial_f64_log2(si / 2 + epsilon);
+    }
+    return sum;
+}
+
+__attribute__((target("+simd"))) //
+inline static simsimd_f64_t
+simsimd_neon_f64_cross_entropy(simsimd_f64_t const* logs, simsimd_f64_t const* a, simsimd_size_t n) {
+    float64x2_t sum_vec = vdupq_n_f64(0);
+    simsimd_size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+        sum_vec = vfmaq_f64(sum_vec, vld1q_f64(a + i), vld1q_f64(logs + i));
+    simsimd_f64_t sum = vaddvq_f64(sum_vec);
+    for (; i < n; ++i)
+        sum += a[i] * logs[i];
+    return -sum;
 }
 
 /*
@@ -159,7 +432,7 @@ simsimd_neon_f32_js(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size
  *  @brief  Arm NEON implementation of the most common similarity metrics for 16-bit floating point numbers.
  *  @author Ash Vardanian
  *
- *  - Implements: Kullback-Leibler and Jensen–Shannon divergence.
+ *  - Implements: Kullback-Leibler and Jensen–Shannon divergence, and their cached mixture and cross-entropy terms.
  *  - Uses `f16` for storage and `f32` for accumulation, as the 16-bit FMA may not always be available.
  *  - Requires compiler capabilities: +simd+fp16.
  */
@@ -168,57 +441,393 @@ __attribute__((target("+simd+fp16"))) //
 inline static simsimd_f32_t
 simsimd_neon_f16_kl(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n) {
     float32x4_t sum_vec = vdupq_n_f32(0);
-    simsimd_f32_t epsilon = 1e-3;
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
     float32x4_t epsilon_vec = vdupq_n_f32(epsilon);
     simsimd_size_t i = 0;
     for (; i + 4 <= n; i += 4) {
         float32x4_t a_vec = vcvt_f32_f16(vld1_f16((float16_t const*)a + i));
         float32x4_t b_vec = vcvt_f32_f16(vld1_f16((float16_t const*)b + i));
         float32x4_t ratio_vec = vdivq_f32(vaddq_f32(a_vec, epsilon_vec), vaddq_f32(b_vec, epsilon_vec));
-        float32x4_t log_ratio_vec = simsimd_neon_f32_log2(ratio_vec);
-        float32x4_t prod_vec = vmulq_f32(a_vec, log_ratio_vec);
-        sum_vec = vaddq_f32(sum_vec, prod_vec);
+        sum_vec = vfmaq_f32(sum_vec, a_vec, simsimd_neon_f32_log2(ratio_vec));
+    }
+    simsimd_f32_t sum = vaddvq_f32(sum_vec);
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = SIMSIMD_UNCOMPRESS_F16(a[i]);
+        simsimd_f32_t bi = SIMSIMD_UNCOMPRESS_F16(b[i]);
+        sum += ai * simsimd_serial_f32_log2((ai + epsilon) / (bi + epsilon));
     }
     simsimd_f32_t log2_normalizer = 0.693147181f;
-    simsimd_f32_t sum = vaddvq_f32(sum_vec) * log2_normalizer;
-    for (; i < n; ++i)
-        sum += SIMSIMD_UNCOMPRESS_F16(a[i]) *
-               SIMSIMD_LOG((SIMSIMD_UNCOMPRESS_F16(a[i]) + epsilon) / (SIMSIMD_UNCOMPRESS_F16(b[i]) + epsilon));
-    return sum;
+    return sum * log2_normalizer;
 }
 
 __attribute__((target("+simd+fp16"))) //
 inline static simsimd_f32_t
 simsimd_neon_f16_js(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n) {
     float32x4_t sum_vec = vdupq_n_f32(0);
-    simsimd_f32_t epsilon = 1e-3;
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
     float32x4_t epsilon_vec = vdupq_n_f32(epsilon);
     simsimd_size_t i = 0;
     for (; i + 4 <= n; i += 4) {
         float32x4_t a_vec = vcvt_f32_f16(vld1_f16((float16_t const*)a + i));
         float32x4_t b_vec = vcvt_f32_f16(vld1_f16((float16_t const*)b + i));
-        float32x4_t m_vec = vmulq_f32(vaddq_f32(a_vec, b_vec), vdupq_n_f32(0.5));
-        float32x4_t ratio_a_vec = vdivq_f32(vaddq_f32(a_vec, epsilon_vec), vaddq_f32(m_vec, epsilon_vec));
-        float32x4_t ratio_b_vec = vdivq_f32(vaddq_f32(b_vec, epsilon_vec), vaddq_f32(m_vec, epsilon_vec));
-        float32x4_t log_ratio_a_vec = simsimd_neon_f32_log2(ratio_a_vec);
-        float32x4_t log_ratio_b_vec = simsimd_neon_f32_log2(ratio_b_vec);
-        float32x4_t prod_a_vec = vmulq_f32(a_vec, log_ratio_a_vec);
-        float32x4_t prod_b_vec = vmulq_f32(b_vec, log_ratio_b_vec);
-        sum_vec = vaddq_f32(sum_vec, vaddq_f32(prod_a_vec, prod_b_vec));
+        float32x4_t m_vec = vfmaq_f32(epsilon_vec, vaddq_f32(a_vec, b_vec), vdupq_n_f32(0.5f)); // M = (P + Q) / 2
+        float32x4_t ratio_a_vec = vdivq_f32(vaddq_f32(a_vec, epsilon_vec), m_vec);
+        float32x4_t ratio_b_vec = vdivq_f32(vaddq_f32(b_vec, epsilon_vec), m_vec);
+        sum_vec = vfmaq_f32(sum_vec, a_vec, simsimd_neon_f32_log2(ratio_a_vec));
+        sum_vec = vfmaq_f32(sum_vec, b_vec, simsimd_neon_f32_log2(ratio_b_vec));
     }
-    simsimd_f32_t log2_normalizer = 0.693147181f;
-    simsimd_f32_t sum = vaddvq_f32(sum_vec) * log2_normalizer;
+    simsimd_f32_t sum = vaddvq_f32(sum_vec);
     for (; i < n; ++i) {
         simsimd_f32_t ai = SIMSIMD_UNCOMPRESS_F16(a[i]);
         simsimd_f32_t bi = SIMSIMD_UNCOMPRESS_F16(b[i]);
-        simsimd_f32_t mi = ai + bi;
-        sum += ai * SIMSIMD_LOG((ai + epsilon) / (mi + epsilon));
-        sum += bi * SIMSIMD_LOG((bi + epsilon) / (mi + epsilon));
+        simsimd_f32_t mi = (ai + bi) / 2;
+        sum += ai * simsimd_serial_f32_log2((ai + epsilon) / (mi + epsilon));
+        sum += bi * simsimd_serial_f32_log2((bi + epsilon) / (mi + epsilon));
     }
-    return sum / 2;
+    simsimd_f32_t log2_normalizer = 0.693147181f;
+    return sum * 0.5f * log2_normalizer;
+}
+
+__attribute__((target("+simd+fp16"))) //
+inline static simsimd_f64_t
+simsimd_neon_f16_js_mixture(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n) {
+    float64x2_t sum_low_vec = vdupq_n_f64(0), sum_high_vec = vdupq_n_f64(0);
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    float32x4_t epsilon_vec = vdupq_n_f32(epsilon);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t a_vec = vcvt_f32_f16(vld1_f16((float16_t const*)a + i));
+        float32x4_t b_vec = vcvt_f32_f16(vld1_f16((float16_t const*)b + i));
+        float32x4_t s_vec = vaddq_f32(a_vec, b_vec);
+        float32x4_t m_vec = vfmaq_f32(epsilon_vec, s_vec, vdupq_n_f32(0.5f)); // M = (P + Q) / 2
+        simsimd_neon_f32_fma_f64(s_vec, simsimd_neon_f32_log2(m_vec), &sum_low_vec, &sum_high_vec);
+    }
+    simsimd_f64_t sum = vaddvq_f64(vaddq_f64(sum_low_vec, sum_high_vec));
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = SIMSIMD_UNCOMPRESS_F16(a[i]), bi = SIMSIMD_UNCOMPRESS_F16(b[i]);
+        simsimd_f32_t si = ai + bi;
+        sum += (simsimd_f64_t)si * simsimd_serial_f32_log2(si / 2 + epsilon);
+    }
+    return sum;
+}
+
+__attribute__((target("+simd+fp16"))) //
+inline static simsimd_f64_t
+simsimd_neon_f16_cross_entropy(simsimd_f32_t const* logs, simsimd_f16_t const* a, simsimd_size_t n) {
+    float64x2_t sum_low_vec = vdupq_n_f64(0), sum_high_vec = vdupq_n_f64(0);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t a_vec = vcvt_f32_f16(vld1_f16((float16_t const*)a + i));
+        simsimd_neon_f32_fma_f64(a_vec, vld1q_f32(logs + i), &sum_low_vec, &sum_high_vec);
+    }
+    simsimd_f64_t sum = vaddvq_f64(vaddq_f64(sum_low_vec, sum_high_vec));
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = SIMSIMD_UNCOMPRESS_F16(a[i]);
+        sum += (simsimd_f64_t)ai * logs[i];
+    }
+    return -sum;
 }
 
 #endif // SIMSIMD_TARGET_ARM_NEON
+
+#if SIMSIMD_TARGET_ARM_SVE
+
+/*
+ *  @file   arm_sve_f32.h
+ *  @brief  Arm SVE implementation of the most common similarity metrics for 32-bit floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: Kullback-Leibler and Jensen–Shannon divergence, and their cached mixture and cross-entropy terms.
+ *  - Uses `f32` for storage and `f32` for accumulation.
+ *  - Uses predicated loads for the tails, so no serial epilogue is needed.
+ *  - Requires compiler capabilities: +sve.
+ */
+
+__attribute__((target("+sve"))) //
+inline static svfloat32_t
+simsimd_sve_f32_log2(svbool_t pg_vec, svfloat32_t x) {
+    // Splitting into `2^e * (1 + t)`, where `1 + t` is between `sqrt(0.5)` and `sqrt(2)`
+    svuint32_t i = svadd_n_u32_x(pg_vec, svreinterpret_u32_f32(x), 0x004AFB0D);
+    svint32_t e = svsub_n_s32_x(pg_vec, svreinterpret_s32_u32(svlsr_n_u32_x(pg_vec, i, 23)), 127);
+    svuint32_t m = svadd_n_u32_x(pg_vec, svand_n_u32_x(pg_vec, i, 0x007FFFFF), 0x3F3504F3);
+    svfloat32_t t = svsub_n_f32_x(pg_vec, svreinterpret_f32_u32(m), 1.0f);
+
+    // Compute polynomial using Horner's method
+    svfloat32_t p = svdup_n_f32((simsimd_f32_t)simsimd_log2_coefficients[0]);
+    for (int k = 1; k <= SIMSIMD_LOG2_DEGREE; ++k)
+        p = svmad_n_f32_x(pg_vec, p, t, (simsimd_f32_t)simsimd_log2_coefficients[k]);
+    return svmla_f32_x(pg_vec, svcvt_f32_s32_x(pg_vec, e), p, t);
+}
+
+/**
+ *  @brief  Loads `f32` values into the lower halves of 64-bit lanes. The cached divergence terms take their
+ *          logarithms in `f32`, but widen them with `svcvt_f64_f32_x` before accumulating in `f64`, as those
+ *          terms are later subtracted from each other and would cancel out in single precision.
+ */
+__attribute__((target("+sve"))) //
+inline static svfloat32_t
+simsimd_sve_f32_load_wide(svbool_t pg_vec, simsimd_f32_t const* x) {
+    return svreinterpret_f32_u64(svld1uw_u64(pg_vec, (uint32_t const*)x));
+}
+
+__attribute__((target("+sve"))) //
+inline static simsimd_f32_t
+simsimd_sve_f32_kl(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat32_t sum_vec = svdup_n_f32(0.f);
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    do {
+        svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
+        svfloat32_t a_vec = svld1_f32(pg_vec, a + i);
+        svfloat32_t b_vec = svld1_f32(pg_vec, b + i);
+        svfloat32_t ratio_vec =
+            svdiv_f32_x(pg_vec, svadd_n_f32_x(pg_vec, a_vec, epsilon), svadd_n_f32_x(pg_vec, b_vec, epsilon));
+        sum_vec = svmla_f32_m(pg_vec, sum_vec, a_vec, simsimd_sve_f32_log2(pg_vec, ratio_vec));
+        i += svcntw();
+    } while (i < n);
+    simsimd_f32_t log2_normalizer = 0.693147181f;
+    return svaddv_f32(svptrue_b32(), sum_vec) * log2_normalizer;
+}
+
+__attribute__((target("+sve"))) //
+inline static simsimd_f32_t
+simsimd_sve_f32_js(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat32_t sum_vec = svdup_n_f32(0.f);
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    do {
+        svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
+        svfloat32_t a_vec = svld1_f32(pg_vec, a + i);
+        svfloat32_t b_vec = svld1_f32(pg_vec, b + i);
+        svfloat32_t m_vec = svmad_n_f32_x(pg_vec, svadd_f32_x(pg_vec, a_vec, b_vec), svdup_n_f32(0.5f), epsilon);
+        svfloat32_t ratio_a_vec = svdiv_f32_x(pg_vec, svadd_n_f32_x(pg_vec, a_vec, epsilon), m_vec);
+        svfloat32_t ratio_b_vec = svdiv_f32_x(pg_vec, svadd_n_f32_x(pg_vec, b_vec, epsilon), m_vec);
+        sum_vec = svmla_f32_m(pg_vec, sum_vec, a_vec, simsimd_sve_f32_log2(pg_vec, ratio_a_vec));
+        sum_vec = svmla_f32_m(pg_vec, sum_vec, b_vec, simsimd_sve_f32_log2(pg_vec, ratio_b_vec));
+        i += svcntw();
+    } while (i < n);
+    simsimd_f32_t log2_normalizer = 0.693147181f;
+    return svaddv_f32(svptrue_b32(), sum_vec) * 0.5f * log2_normalizer;
+}
+
+__attribute__((target("+sve"))) //
+inline static simsimd_f64_t
+simsimd_sve_f32_js_mixture(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat64_t sum_vec = svdup_n_f64(0.);
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    svbool_t all_vec = svptrue_b32();
+    do {
+        svbool_t pg_vec = svwhilelt_b64((unsigned int)i, (unsigned int)n);
+        svfloat32_t s_vec =
+            svadd_f32_x(all_vec, simsimd_sve_f32_load_wide(pg_vec, a + i), simsimd_sve_f32_load_wide(pg_vec, b + i));
+        svfloat32_t m_vec = svmad_n_f32_x(all_vec, s_vec, svdup_n_f32(0.5f), epsilon);
+        svfloat32_t log_vec = simsimd_sve_f32_log2(all_vec, m_vec);
+        sum_vec = svmla_f64_m(pg_vec, sum_vec, svcvt_f64_f32_x(pg_vec, s_vec), svcvt_f64_f32_x(pg_vec, log_vec));
+        i += svcntd();
+    } while (i < n);
+    return svaddv_f64(svptrue_b64(), sum_vec);
+}
+
+__attribute__((target("+sve"))) //
+inline static simsimd_f64_t
+simsimd_sve_f32_cross_entropy(simsimd_f32_t const* logs, simsimd_f32_t const* a, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat64_t sum_vec = svdup_n_f64(0.);
+    do {
+        svbool_t pg_vec = svwhilelt_b64((unsigned int)i, (unsigned int)n);
+        svfloat64_t a_vec = svcvt_f64_f32_x(pg_vec, simsimd_sve_f32_load_wide(pg_vec, a + i));
+        svfloat64_t logs_vec = svcvt_f64_f32_x(pg_vec, simsimd_sve_f32_load_wide(pg_vec, logs + i));
+        sum_vec = svmla_f64_m(pg_vec, sum_vec, a_vec, logs_vec);
+        i += svcntd();
+    } while (i < n);
+    return -svaddv_f64(svptrue_b64(), sum_vec);
+}
+
+/*
+ *  @file   arm_sve_f64.h
+ *  @brief  Arm SVE implementation of the most common similarity metrics for 64-bit floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: Kullback-Leibler and Jensen–Shannon divergence, and their cached mixture and cross-entropy terms.
+ *  - Uses `f64` for storage and `f64` for accumulation.
+ *  - Requires compiler capabilities: +sve.
+ */
+
+__attribute__((target("+sve"))) //
+inline static svfloat64_t
+simsimd_sve_f64_log2(svbool_t pg_vec, svfloat64_t x) {
+    // Splitting into `2^e * (1 + t)`, where `1 + t` is between `sqrt(0.5)` and `sqrt(2)`
+    svuint64_t i = svadd_n_u64_x(pg_vec, svreinterpret_u64_f64(x), 0x00095F619980C433ull);
+    svint64_t e = svsub_n_s64_x(pg_vec, svreinterpret_s64_u64(svlsr_n_u64_x(pg_vec, i, 52)), 1023);
+    svuint64_t m = svadd_n_u64_x(pg_vec, svand_n_u64_x(pg_vec, i, 0x000FFFFFFFFFFFFFull), 0x3FE6A09E667F3BCDull);
+    svfloat64_t t = svsub_n_f64_x(pg_vec, svreinterpret_f64_u64(m), 1.0);
+
+    // Compute polynomial using Horner's method
+    svfloat64_t p = svdup_n_f64(simsimd_log2_coefficients[0]);
+    for (int k = 1; k <= SIMSIMD_LOG2_DEGREE; ++k)
+        p = svmad_n_f64_x(pg_vec, p, t, simsimd_log2_coefficients[k]);
+    return svmla_f64_x(pg_vec, svcvt_f64_s64_x(pg_vec, e), p, t);
+}
+
+__attribute__((target("+sve"))) //
+inline static simsimd_f32_t
+simsimd_sve_f64_kl(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat64_t sum_vec = svdup_n_f64(0.);
+    simsimd_f64_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    do {
+        svbool_t pg_vec = svwhilelt_b64((unsigned int)i, (unsigned int)n);
+        svfloat64_t a_vec = svld1_f64(pg_vec, a + i);
+        svfloat64_t b_vec = svld1_f64(pg_vec, b + i);
+        svfloat64_t ratio_vec =
+            svdiv_f64_x(pg_vec, svadd_n_f64_x(pg_vec, a_vec, epsilon), svadd_n_f64_x(pg_vec, b_vec, epsilon));
+        sum_vec = svmla_f64_m(pg_vec, sum_vec, a_vec, simsimd_sve_f64_log2(pg_vec, ratio_vec));
+        i += svcntd();
+    } while (i < n);
+    simsimd_f64_t log2_normalizer = 0.6931471805599453;
+    return (simsimd_f32_t)(svaddv_f64(svptrue_b64(), sum_vec) * log2_normalizer);
+}
+
+__attribute__((target("+sve"))) //
+inline static simsimd_f32_t
+simsimd_sve_f64_js(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat64_t sum_vec = svdup_n_f64(0.);
+    simsimd_f64_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    do {
+        svbool_t pg_vec = svwhilelt_b64((unsigned int)i, (unsigned int)n);
+        svfloat64_t a_vec = svld1_f64(pg_vec, a + i);
+        svfloat64_t b_vec = svld1_f64(pg_vec, b + i);
+        svfloat64_t m_vec = svmad_n_f64_x(pg_vec, svadd_f64_x(pg_vec, a_vec, b_vec), svdup_n_f64(0.5), epsilon);
+        svfloat64_t ratio_a_vec = svdiv_f64_x(pg_vec, svadd_n_f64_x(pg_vec, a_vec, epsilon), m_vec);
+        svfloat64_t ratio_b_vec = svdiv_f64_x(pg_vec, svadd_n_f64_x(pg_vec, b_vec, epsilon), m_vec);
+        sum_vec = svmla_f64_m(pg_vec, sum_vec, a_vec, simsimd_sve_f64_log2(pg_vec, ratio_a_vec));
+        sum_vec = svmla_f64_m(pg_vec, sum_vec, b_vec, simsimd_sve_f64_log2(pg_vec, ratio_b_vec));
+        i += svcntd();
+    } while (i < n);
+    simsimd_f64_t log2_normalizer = 0.6931471805599453;
+    return (simsimd_f32_t)(svaddv_f64(svptrue_b64(), sum_vec) * 0.5 * log2_normalizer);
+}
+
+__attribute__((target("+sve"))) //
+inline static simsimd_f64_t
+simsimd_sve_f64_js_mixture(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat64_t sum_vec = svdup_n_f64(0.);
+    simsimd_f64_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    do {
+        svbool_t pg_vec = svwhilelt_b64((unsigned int)i, (unsigned int)n);
+        svfloat64_t s_vec = svadd_f64_x(pg_vec, svld1_f64(pg_vec, a + i), svld1_f64(pg_vec, b + i));
+        svfloat64_t m_vec = svmad_n_f64_x(pg_vec, s_vec, svdup_n_f64(0.5), epsilon);
+        sum_vec = svmla_f64_m(pg_vec, sum_vec, s_vec, simsimd_sve_f64_log2(pg_vec, m_vec));
+        i += svcntd();
+    } while (i < n);
+    return svaddv_f64(svptrue_b64(), sum_vec);
+}
+
+__attribute__((target("+sve"))) //
+inline static simsimd_f64_t
+simsimd_sve_f64_cross_entropy(simsimd_f64_t const* logs, simsimd_f64_t const* a, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat64_t sum_vec = svdup_n_f64(0.);
+    do {
+        svbool_t pg_vec = svwhilelt_b64((unsigned int)i, (unsigned int)n);
+        sum_vec = svmla_f64_m(pg_vec, sum_vec, svld1_f64(pg_vec, a + i), svld1_f64(pg_vec, logs + i));
+        i += svcntd();
+    } while (i < n);
+    return -svaddv_f64(svptrue_b64(), sum_vec);
+}
+
+/*
+ *  @file   arm_sve_f16.h
+ *  @brief  Arm SVE implementation of the most common similarity metrics for 16-bit floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: Kullback-Leibler and Jensen–Shannon divergence, and their cached mixture and cross-entropy terms.
+ *  - Uses `f16` for storage and `f32` for accumulation, widening the halves into 32-bit lanes on load.
+ *  - Requires compiler capabilities: +sve+fp16.
+ */
+
+__attribute__((target("+sve+fp16"))) //
+inline static simsimd_f32_t
+simsimd_sve_f16_kl(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat32_t sum_vec = svdup_n_f32(0.f);
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    do {
+        svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
+        svfloat32_t a_vec = svcvt_f32_f16_x(pg_vec, svreinterpret_f16_u32(svld1uh_u32(pg_vec, (uint16_t const*)a + i)));
+        svfloat32_t b_vec = svcvt_f32_f16_x(pg_vec, svreinterpret_f16_u32(svld1uh_u32(pg_vec, (uint16_t const*)b + i)));
+        svfloat32_t ratio_vec =
+            svdiv_f32_x(pg_vec, svadd_n_f32_x(pg_vec, a_vec, epsilon), svadd_n_f32_x(pg_vec, b_vec, epsilon));
+        sum_vec = svmla_f32_m(pg_vec, sum_vec, a_vec, simsimd_sve_f32_log2(pg_vec, ratio_vec));
+        i += svcntw();
+    } while (i < n);
+    simsimd_f32_t log2_normalizer = 0.693147181f;
+    return svaddv_f32(svptrue_b32(), sum_vec) * log2_normalizer;
+}
+
+__attribute__((target("+sve+fp16"))) //
+inline static simsimd_f32_t
+simsimd_sve_f16_js(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat32_t sum_vec = svdup_n_f32(0.f);
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    do {
+        svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
+        svfloat32_t a_vec = svcvt_f32_f16_x(pg_vec, svreinterpret_f16_u32(svld1uh_u32(pg_vec, (uint16_t const*)a + i)));
+        svfloat32_t b_vec = svcvt_f32_f16_x(pg_vec, svreinterpret_f16_u32(svld1uh_u32(pg_vec, (uint16_t const*)b + i)));
+        svfloat32_t m_vec = svmad_n_f32_x(pg_vec, svadd_f32_x(pg_vec, a_vec, b_vec), svdup_n_f32(0.5f), epsilon);
+        svfloat32_t ratio_a_vec = svdiv_f32_x(pg_vec, svadd_n_f32_x(pg_vec, a_vec, epsilon), m_vec);
+        svfloat32_t ratio_b_vec = svdiv_f32_x(pg_vec, svadd_n_f32_x(pg_vec, b_vec, epsilon), m_vec);
+        sum_vec = svmla_f32_m(pg_vec, sum_vec, a_vec, simsimd_sve_f32_log2(pg_vec, ratio_a_vec));
+        sum_vec = svmla_f32_m(pg_vec, sum_vec, b_vec, simsimd_sve_f32_log2(pg_vec, ratio_b_vec));
+        i += svcntw();
+    } while (i < n);
+    simsimd_f32_t log2_normalizer = 0.693147181f;
+    return svaddv_f32(svptrue_b32(), sum_vec) * 0.5f * log2_normalizer;
+}
+
+__attribute__((target("+sve+fp16"))) //
+inline static simsimd_f64_t
+simsimd_sve_f16_js_mixture(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat64_t sum_vec = svdup_n_f64(0.);
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    svbool_t all_vec = svptrue_b32();
+    do {
+        // Every half lands into the lower quarter of a 64-bit lane, and is widened into its lower half
+        svbool_t pg_vec = svwhilelt_b64((unsigned int)i, (unsigned int)n);
+        svuint64_t a_bits_vec = svld1uh_u64(pg_vec, (uint16_t const*)a + i);
+        svfloat32_t a_vec = svcvt_f32_f16_x(all_vec, svreinterpret_f16_u64(a_bits_vec));
+        svuint64_t b_bits_vec = svld1uh_u64(pg_vec, (uint16_t const*)b + i);
+        svfloat32_t b_vec = svcvt_f32_f16_x(all_vec, svreinterpret_f16_u64(b_bits_vec));
+        svfloat32_t s_vec = svadd_f32_x(all_vec, a_vec, b_vec);
+        svfloat32_t m_vec = svmad_n_f32_x(all_vec, s_vec, svdup_n_f32(0.5f), epsilon);
+        svfloat32_t log_vec = simsimd_sve_f32_log2(all_vec, m_vec);
+        sum_vec = svmla_f64_m(pg_vec, sum_vec, svcvt_f64_f32_x(pg_vec, s_vec), svcvt_f64_f32_x(pg_vec, log_vec));
+        i += svcntd();
+    } while (i < n);
+    return svaddv_f64(svptrue_b64(), sum_vec);
+}
+
+__attribute__((target("+sve+fp16"))) //
+inline static simsimd_f64_t
+simsimd_sve_f16_cross_entropy(simsimd_f32_t const* logs, simsimd_f16_t const* a, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat64_t sum_vec = svdup_n_f64(0.);
+    do {
+        svbool_t pg_vec = svwhilelt_b64((unsigned int)i, (unsigned int)n);
+        svfloat64_t a_vec = svcvt_f64_f16_x(pg_vec, svreinterpret_f16_u64(svld1uh_u64(pg_vec, (uint16_t const*)a + i)));
+        svfloat64_t logs_vec = svcvt_f64_f32_x(pg_vec, simsimd_sve_f32_load_wide(pg_vec, logs + i));
+        sum_vec = svmla_f64_m(pg_vec, sum_vec, a_vec, logs_vec);
+        i += svcntd();
+    } while (i < n);
+    return -svaddv_f64(svptrue_b64(), sum_vec);
+}
+
+#endif // SIMSIMD_TARGET_ARM_SVE
 #endif // SIMSIMD_TARGET_ARM
 
 #if SIMSIMD_TARGET_X86
@@ -229,112 +838,423 @@ simsimd_neon_f16_js(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size
  *  @brief  x86 AVX2 implementation of the most common similarity metrics for 16-bit floating point numbers.
  *  @author Ash Vardanian
  *
- *  - Implements: Kullback-Leibler and Jensen–Shannon divergence.
+ *  - Implements: Kullback-Leibler and Jensen–Shannon divergence, and their cached mixture and cross-entropy terms.
  *  - As AVX2 doesn't support masked loads of 16-bit words, implementations have a separate `for`-loop for tails.
  *  - Uses `f16` for both storage and `f32` for accumulation.
  *  - Requires compiler capabilities: avx2, f16c, fma.
  */
 
 __attribute__((target("avx2,f16c,fma"))) //
-inline __m256
+inline static __m256
 simsimd_avx2_f32_log2(__m256 x) {
-    // Extracting the exponent
-    __m256i i = _mm256_castps_si256(x);
-    __m256i e = _mm256_srli_epi32(_mm256_and_si256(i, _mm256_set1_epi32(0x7F800000)), 23);
-    e = _mm256_sub_epi32(e, _mm256_set1_epi32(127)); // removing the bias
-    __m256 e_float = _mm256_cvtepi32_ps(e);
-
-    // Extracting the mantissa
-    __m256 m = _mm256_castsi256_ps(
-        _mm256_or_si256(_mm256_and_si256(i, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F800000)));
-
-    // Constants for polynomial
-    __m256 one = _mm256_set1_ps(1.0f);
-    __m256 p = _mm256_set1_ps(-3.4436006e-2f);
+    // Splitting into `2^e * (1 + t)`, where `1 + t` is between `sqrt(0.5)` and `sqrt(2)`
+    __m256i i = _mm256_add_epi32(_mm256_castps_si256(x), _mm256_set1_epi32(0x004AFB0D));
+    __m256i e = _mm256_sub_epi32(_mm256_srli_epi32(i, 23), _mm256_set1_epi32(127)); // removing the bias
+    __m256i m = _mm256_add_epi32(_mm256_and_si256(i, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F3504F3));
+    __m256 t = _mm256_sub_ps(_mm256_castsi256_ps(m), _mm256_set1_ps(1.0f));
 
     // Compute the polynomial using Horner's method
-    p = _mm256_fmadd_ps(m, p, _mm256_set1_ps(3.1821337e-1f));
-    p = _mm256_fmadd_ps(m, p, _mm256_set1_ps(-1.2315303f));
-    p = _mm256_fmadd_ps(m, p, _mm256_set1_ps(2.5988452f));
-    p = _mm256_fmadd_ps(m, p, _mm256_set1_ps(-3.3241990f));
-    p = _mm256_fmadd_ps(m, p, _mm256_set1_ps(3.1157899f));
+    __m256 p = _mm256_set1_ps((simsimd_f32_t)simsimd_log2_coefficients[0]);
+    for (int k = 1; k <= SIMSIMD_LOG2_DEGREE; ++k)
+        p = _mm256_fmadd_ps(p, t, _mm256_set1_ps((simsimd_f32_t)simsimd_log2_coefficients[k]));
+    return _mm256_fmadd_ps(p, t, _mm256_cvtepi32_ps(e));
+}
 
-    // Final computation
-    __m256 result = _mm256_add_ps(_mm256_mul_ps(p, _mm256_sub_ps(m, one)), e_float);
-    return result;
+/**
+ *  @brief  Accumulates the products of eight pairs of `f32` values into two vectors of `f64` sums, as the cached
+ *          divergence terms are later subtracted from each other and would cancel out in single precision.
+ */
+__attribute__((target("avx2,f16c,fma"))) //
+inline static void
+simsimd_avx2_f32_fma_f64(__m256 x, __m256 y, __m256d* sum_low, __m256d* sum_high) {
+    __m256d x_low = _mm256_cvtps_pd(_mm256_castps256_ps128(x)), y_low = _mm256_cvtps_pd(_mm256_castps256_ps128(y));
+    __m256d x_high = _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1));
+    __m256d y_high = _mm256_cvtps_pd(_mm256_extractf128_ps(y, 1));
+    *sum_low = _mm256_fmadd_pd(x_low, y_low, *sum_low);
+    *sum_high = _mm256_fmadd_pd(x_high, y_high, *sum_high);
+}
+
+__attribute__((target("avx2,f16c,fma"))) //
+inline static simsimd_f64_t
+simsimd_avx2_reduce_f64x4(__m256d x) {
+    __m128d sum_vec = _mm_add_pd(_mm256_castpd256_pd128(x), _mm256_extractf128_pd(x, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(sum_vec, _mm_unpackhi_pd(sum_vec, sum_vec)));
 }
 
 __attribute__((target("avx2,f16c,fma"))) //
 inline static simsimd_f32_t
 simsimd_avx2_f16_kl(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n) {
     __m256 sum_vec = _mm256_set1_ps(0);
-    simsimd_f32_t epsilon = 1e-5;
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
     __m256 epsilon_vec = _mm256_set1_ps(epsilon);
     simsimd_size_t i = 0;
     for (; i + 8 <= n; i += 8) {
         __m256 a_vec = _mm256_cvtph_ps(_mm_loadu_si128((__m128i const*)(a + i)));
         __m256 b_vec = _mm256_cvtph_ps(_mm_loadu_si128((__m128i const*)(b + i)));
         __m256 ratio_vec = _mm256_div_ps(_mm256_add_ps(a_vec, epsilon_vec), _mm256_add_ps(b_vec, epsilon_vec));
-        __m256 log_ratio_vec = simsimd_avx2_f32_log2(ratio_vec);
-        __m256 prod_vec = _mm256_mul_ps(a_vec, log_ratio_vec);
-        sum_vec = _mm256_add_ps(sum_vec, prod_vec);
+        sum_vec = _mm256_fmadd_ps(a_vec, simsimd_avx2_f32_log2(ratio_vec), sum_vec);
     }
 
     sum_vec = _mm256_add_ps(_mm256_permute2f128_ps(sum_vec, sum_vec, 1), sum_vec);
     sum_vec = _mm256_hadd_ps(sum_vec, sum_vec);
     sum_vec = _mm256_hadd_ps(sum_vec, sum_vec);
 
-    simsimd_f32_t log2_normalizer = 0.693147181f;
     simsimd_f32_t sum;
     _mm_store_ss(&sum, _mm256_castps256_ps128(sum_vec));
-    sum *= log2_normalizer;
 
     // Accumulate the tail:
-    for (; i < n; ++i)
-        sum += SIMSIMD_UNCOMPRESS_F16(a[i]) *
-               SIMSIMD_LOG((SIMSIMD_UNCOMPRESS_F16(a[i]) + epsilon) / (SIMSIMD_UNCOMPRESS_F16(b[i]) + epsilon));
-    return sum;
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = SIMSIMD_UNCOMPRESS_F16(a[i]);
+        simsimd_f32_t bi = SIMSIMD_UNCOMPRESS_F16(b[i]);
+        sum += ai * simsimd_serial_f32_log2((ai + epsilon) / (bi + epsilon));
+    }
+    simsimd_f32_t log2_normalizer = 0.693147181f;
+    return sum * log2_normalizer;
 }
 
 __attribute__((target("avx2,f16c,fma"))) //
 inline static simsimd_f32_t
 simsimd_avx2_f16_js(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n) {
     __m256 sum_vec = _mm256_set1_ps(0);
-    simsimd_f32_t epsilon = 1e-5;
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
     __m256 epsilon_vec = _mm256_set1_ps(epsilon);
+    __m256 half_vec = _mm256_set1_ps(0.5f);
     simsimd_size_t i = 0;
     for (; i + 8 <= n; i += 8) {
-        __m256 a_vec = _mm256_add_ps(_mm256_cvtph_ps(_mm_loadu_si128((__m128i const*)(a + i))), epsilon_vec);
-        __m256 b_vec = _mm256_add_ps(_mm256_cvtph_ps(_mm_loadu_si128((__m128i const*)(b + i))), epsilon_vec);
-        __m256 m_vec = _mm256_mul_ps(_mm256_add_ps(a_vec, b_vec), _mm256_set1_ps(0.5f)); // M = (P + Q) / 2
-        __m256 ratio_a_vec = _mm256_div_ps(a_vec, m_vec);
-        __m256 ratio_b_vec = _mm256_div_ps(b_vec, m_vec);
-        __m256 log_ratio_a_vec = simsimd_avx2_f32_log2(ratio_a_vec);
-        __m256 log_ratio_b_vec = simsimd_avx2_f32_log2(ratio_b_vec);
-        __m256 prod_a_vec = _mm256_mul_ps(a_vec, log_ratio_a_vec);
-        __m256 prod_b_vec = _mm256_mul_ps(b_vec, log_ratio_b_vec);
-        sum_vec = _mm256_add_ps(sum_vec, prod_a_vec);
-        sum_vec = _mm256_add_ps(sum_vec, prod_b_vec);
+        __m256 a_vec = _mm256_cvtph_ps(_mm_loadu_si128((__m128i const*)(a + i)));
+        __m256 b_vec = _mm256_cvtph_ps(_mm_loadu_si128((__m128i const*)(b + i)));
+        __m256 m_vec = _mm256_fmadd_ps(_mm256_add_ps(a_vec, b_vec), half_vec, epsilon_vec); // M = (P + Q) / 2
+        __m256 ratio_a_vec = _mm256_div_ps(_mm256_add_ps(a_vec, epsilon_vec), m_vec);
+        __m256 ratio_b_vec = _mm256_div_ps(_mm256_add_ps(b_vec, epsilon_vec), m_vec);
+        sum_vec = _mm256_fmadd_ps(a_vec, simsimd_avx2_f32_log2(ratio_a_vec), sum_vec);
+        sum_vec = _mm256_fmadd_ps(b_vec, simsimd_avx2_f32_log2(ratio_b_vec), sum_vec);
     }
 
     sum_vec = _mm256_add_ps(_mm256_permute2f128_ps(sum_vec, sum_vec, 1), sum_vec);
     sum_vec = _mm256_hadd_ps(sum_vec, sum_vec);
     sum_vec = _mm256_hadd_ps(sum_vec, sum_vec);
 
-    simsimd_f32_t log2_normalizer = 0.693147181f;
     simsimd_f32_t sum;
     _mm_store_ss(&sum, _mm256_castps256_ps128(sum_vec));
-    sum *= log2_normalizer;
 
     // Accumulate the tail:
     for (; i < n; ++i) {
         simsimd_f32_t ai = SIMSIMD_UNCOMPRESS_F16(a[i]);
         simsimd_f32_t bi = SIMSIMD_UNCOMPRESS_F16(b[i]);
-        simsimd_f32_t mi = ai + bi;
-        sum += ai * SIMSIMD_LOG((ai + epsilon) / (mi + epsilon));
-        sum += bi * SIMSIMD_LOG((bi + epsilon) / (mi + epsilon));
+        simsimd_f32_t mi = (ai + bi) / 2;
+        sum += ai * simsimd_serial_f32_log2((ai + epsilon) / (mi + epsilon));
+        sum += bi * simsimd_serial_f32_log2((bi + epsilon) / (mi + epsilon));
     }
-    return sum / 2;
+    simsimd_f32_t log2_normalizer = 0.693147181f;
+    return sum * 0.5f * log2_normalizer;
+}
+
+__attribute__((target("avx2,f16c,fma"))) //
+inline static simsimd_f64_t
+simsimd_avx2_f16_js_mixture(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n) {
+    __m256d sum_low_vec = _mm256_setzero_pd(), sum_high_vec = _mm256_setzero_pd();
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    __m256 epsilon_vec = _mm256_set1_ps(epsilon);
+    __m256 half_vec = _mm256_set1_ps(0.5f);
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _mm256_cvtph_ps(_mm_loadu_si128((__m128i const*)(a + i)));
+        __m256 b_vec = _mm256_cvtph_ps(_mm_loadu_si128((__m128i const*)(b + i)));
+        __m256 s_vec = _mm256_add_ps(a_vec, b_vec);
+        __m256 m_vec = _mm256_fmadd_ps(s_vec, half_vec, epsilon_vec); // M = (P + Q) / 2
+        simsimd_avx2_f32_fma_f64(s_vec, simsimd_avx2_f32_log2(m_vec), &sum_low_vec, &sum_high_vec);
+    }
+    simsimd_f64_t sum = simsimd_avx2_reduce_f64x4(_mm256_add_pd(sum_low_vec, sum_high_vec));
+
+    // Accumulate the tail:
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = SIMSIMD_UNCOMPRESS_F16(a[i]), bi = SIMSIMD_UNCOMPRESS_F16(b[i]);
+        simsimd_f32_t si = ai + bi;
+        sum += (simsimd_f64_t)si * simsimd_serial_f32_log2(si / 2 + epsilon);
+    }
+    return sum;
+}
+
+__attribute__((target("avx2,f16c,fma"))) //
+inline static simsimd_f64_t
+simsimd_avx2_f16_cross_entropy(simsimd_f32_t const* logs, simsimd_f16_t const* a, simsimd_size_t n) {
+    __m256d sum_low_vec = _mm256_setzero_pd(), sum_high_vec = _mm256_setzero_pd();
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _mm256_cvtph_ps(_mm_loadu_si128((__m128i const*)(a + i)));
+        simsimd_avx2_f32_fma_f64(a_vec, _mm256_loadu_ps(logs + i), &sum_low_vec, &sum_high_vec);
+    }
+    simsimd_f64_t sum = simsimd_avx2_reduce_f64x4(_mm256_add_pd(sum_low_vec, sum_high_vec));
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = SIMSIMD_UNCOMPRESS_F16(a[i]);
+        sum += (simsimd_f64_t)ai * logs[i];
+    }
+    return -sum;
+}
+
+/*
+ *  @file   x86_avx2_f32.h
+ *  @brief  x86 AVX2 implementation of the most common similarity metrics for 32-bit floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: Kullback-Leibler and Jensen–Shannon divergence, and their cached mixture and cross-entropy terms.
+ *  - Uses two independent accumulators, to overlap the long dependency chains of the logarithm approximations.
+ *  - Uses `_mm256_maskload_ps` intrinsics to load the tails, as those are available for 32-bit words.
+ *  - Uses `f32` for storage and `f32` for accumulation.
+ *  - Requires compiler capabilities: avx2, f16c, fma.
+ */
+
+__attribute__((target("avx2,f16c,fma"))) //
+inline static simsimd_f32_t
+simsimd_avx2_f32_kl(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
+    __m256 sum_first_vec = _mm256_setzero_ps(), sum_second_vec = _mm256_setzero_ps();
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    __m256 epsilon_vec = _mm256_set1_ps(epsilon);
+    simsimd_size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256 a_first_vec = _mm256_loadu_ps(a + i), a_second_vec = _mm256_loadu_ps(a + i + 8);
+        __m256 b_first_vec = _mm256_loadu_ps(b + i), b_second_vec = _mm256_loadu_ps(b + i + 8);
+        __m256 ratio_first_vec =
+            _mm256_div_ps(_mm256_add_ps(a_first_vec, epsilon_vec), _mm256_add_ps(b_first_vec, epsilon_vec));
+        __m256 ratio_second_vec =
+            _mm256_div_ps(_mm256_add_ps(a_second_vec, epsilon_vec), _mm256_add_ps(b_second_vec, epsilon_vec));
+        sum_first_vec = _mm256_fmadd_ps(a_first_vec, simsimd_avx2_f32_log2(ratio_first_vec), sum_first_vec);
+        sum_second_vec = _mm256_fmadd_ps(a_second_vec, simsimd_avx2_f32_log2(ratio_second_vec), sum_second_vec);
+    }
+    for (; i < n; i += 8) {
+        __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32((int)(n - i)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        __m256 a_vec = _mm256_maskload_ps(a + i, mask);
+        __m256 b_vec = _mm256_maskload_ps(b + i, mask);
+        __m256 ratio_vec = _mm256_div_ps(_mm256_add_ps(a_vec, epsilon_vec), _mm256_add_ps(b_vec, epsilon_vec));
+        sum_first_vec = _mm256_fmadd_ps(a_vec, simsimd_avx2_f32_log2(ratio_vec), sum_first_vec);
+    }
+
+    __m256 sum_vec = _mm256_add_ps(sum_first_vec, sum_second_vec);
+    sum_vec = _mm256_add_ps(_mm256_permute2f128_ps(sum_vec, sum_vec, 1), sum_vec);
+    sum_vec = _mm256_hadd_ps(sum_vec, sum_vec);
+    sum_vec = _mm256_hadd_ps(sum_vec, sum_vec);
+
+    simsimd_f32_t log2_normalizer = 0.693147181f;
+    return _mm256_cvtss_f32(sum_vec) * log2_normalizer;
+}
+
+__attribute__((target("avx2,f16c,fma"))) //
+inline static simsimd_f32_t
+simsimd_avx2_f32_js(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
+    __m256 sum_a_vec = _mm256_setzero_ps(), sum_b_vec = _mm256_setzero_ps();
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    __m256 epsilon_vec = _mm256_set1_ps(epsilon);
+    __m256 half_vec = _mm256_set1_ps(0.5f);
+    simsimd_size_t i = 0;
+    for (; i < n; i += 8) {
+        __m256 a_vec, b_vec;
+        if (i + 8 <= n) {
+            a_vec = _mm256_loadu_ps(a + i);
+            b_vec = _mm256_loadu_ps(b + i);
+        } else {
+            __m256i mask =
+                _mm256_cmpgt_epi32(_mm256_set1_epi32((int)(n - i)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            a_vec = _mm256_maskload_ps(a + i, mask);
+            b_vec = _mm256_maskload_ps(b + i, mask);
+        }
+        __m256 m_vec = _mm256_fmadd_ps(_mm256_add_ps(a_vec, b_vec), half_vec, epsilon_vec); // M = (P + Q) / 2
+        __m256 ratio_a_vec = _mm256_div_ps(_mm256_add_ps(a_vec, epsilon_vec), m_vec);
+        __m256 ratio_b_vec = _mm256_div_ps(_mm256_add_ps(b_vec, epsilon_vec), m_vec);
+        sum_a_vec = _mm256_fmadd_ps(a_vec, simsimd_avx2_f32_log2(ratio_a_vec), sum_a_vec);
+        sum_b_vec = _mm256_fmadd_ps(b_vec, simsimd_avx2_f32_log2(ratio_b_vec), sum_b_vec);
+    }
+
+    __m256 sum_vec = _mm256_add_ps(sum_a_vec, sum_b_vec);
+    sum_vec = _mm256_add_ps(_mm256_permute2f128_ps(sum_vec, sum_vec, 1), sum_vec);
+    sum_vec = _mm256_hadd_ps(sum_vec, sum_vec);
+    sum_vec = _mm256_hadd_ps(sum_vec, sum_vec);
+
+    simsimd_f32_t log2_normalizer = 0.693147181f;
+    return _mm256_cvtss_f32(sum_vec) * 0.5f * log2_normalizer;
+}
+
+__attribute__((target("avx2,f16c,fma"))) //
+inline static simsimd_f64_t
+simsimd_avx2_f32_js_mixture(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
+    __m256d sum_low_vec = _mm256_setzero_pd(), sum_high_vec = _mm256_setzero_pd();
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    __m256 epsilon_vec = _mm256_set1_ps(epsilon);
+    __m256 half_vec = _mm256_set1_ps(0.5f);
+    simsimd_size_t i = 0;
+    for (; i < n; i += 8) {
+        __m256 a_vec, b_vec;
+        if (i + 8 <= n) {
+            a_vec = _mm256_loadu_ps(a + i);
+            b_vec = _mm256_loadu_ps(b + i);
+        } else {
+            __m256i mask =
+                _mm256_cmpgt_epi32(_mm256_set1_epi32((int)(n - i)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            a_vec = _mm256_maskload_ps(a + i, mask);
+            b_vec = _mm256_maskload_ps(b + i, mask);
+        }
+        __m256 s_vec = _mm256_add_ps(a_vec, b_vec);
+        __m256 m_vec = _mm256_fmadd_ps(s_vec, half_vec, epsilon_vec); // M = (P + Q) / 2
+        simsimd_avx2_f32_fma_f64(s_vec, simsimd_avx2_f32_log2(m_vec), &sum_low_vec, &sum_high_vec);
+    }
+    return simsimd_avx2_reduce_f64x4(_mm256_add_pd(sum_low_vec, sum_high_vec));
+}
+
+__attribute__((target("avx2,f16c,fma"))) //
+inline static simsimd_f64_t
+simsimd_avx2_f32_cross_entropy(simsimd_f32_t const* logs, simsimd_f32_t const* a, simsimd_size_t n) {
+    __m256d sum_low_vec = _mm256_setzero_pd(), sum_high_vec = _mm256_setzero_pd();
+    simsimd_size_t i = 0;
+    for (; i < n; i += 8) {
+        __m256 a_vec, logs_vec;
+        if (i + 8 <= n) {
+            a_vec = _mm256_loadu_ps(a + i);
+            logs_vec = _mm256_loadu_ps(logs + i);
+        } else {
+            __m256i mask =
+                _mm256_cmpgt_epi32(_mm256_set1_epi32((int)(n - i)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            a_vec = _mm256_maskload_ps(a + i, mask);
+            logs_vec = _mm256_maskload_ps(logs + i, mask);
+        }
+        simsimd_avx2_f32_fma_f64(a_vec, logs_vec, &sum_low_vec, &sum_high_vec);
+    }
+    return -simsimd_avx2_reduce_f64x4(_mm256_add_pd(sum_low_vec, sum_high_vec));
+}
+
+/*
+ *  @file   x86_avx2_f64.h
+ *  @brief  x86 AVX2 implementation of the most common similarity metrics for 64-bit floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: Kullback-Leibler and Jensen–Shannon divergence, and their cached mixture and cross-entropy terms.
+ *  - Uses `_mm256_maskload_pd` intrinsics to load the tails, as those are available for 64-bit words.
+ *  - Uses `f64` for storage and `f64` for accumulation.
+ *  - Requires compiler capabilities: avx2, fma.
+ */
+
+__attribute__((target("avx2,fma"))) //
+inline static __m256d
+simsimd_avx2_f64_log2(__m256d x) {
+    // Splitting into `2^e * (1 + t)`, where `1 + t` is between `sqrt(0.5)` and `sqrt(2)`
+    __m256i i = _mm256_add_epi64(_mm256_castpd_si256(x), _mm256_set1_epi64x(0x00095F619980C433ll));
+    __m256i m = _mm256_add_epi64(_mm256_and_si256(i, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFll)),
+                                 _mm256_set1_epi64x(0x3FE6A09E667F3BCDll));
+    __m256d t = _mm256_sub_pd(_mm256_castsi256_pd(m), _mm256_set1_pd(1.0));
+
+    // AVX2 can't convert 64-bit integers, so the biased exponent is planted into the mantissa of `2^52`
+    __m256i e = _mm256_or_si256(_mm256_srli_epi64(i, 52), _mm256_set1_epi64x(0x4330000000000000ll));
+    __m256d e_float = _mm256_sub_pd(_mm256_castsi256_pd(e), _mm256_set1_pd(4503599627370496.0 + 1023));
+
+    // Compute the polynomial using Horner's method
+    __m256d p = _mm256_set1_pd(simsimd_log2_coefficients[0]);
+    for (int k = 1; k <= SIMSIMD_LOG2_DEGREE; ++k)
+        p = _mm256_fmadd_pd(p, t, _mm256_set1_pd(simsimd_log2_coefficients[k]));
+    return _mm256_fmadd_pd(p, t, e_float);
+}
+
+__attribute__((target("avx2,fma"))) //
+inline static simsimd_f32_t
+simsimd_avx2_f64_kl(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    __m256d sum_vec = _mm256_setzero_pd();
+    simsimd_f64_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    __m256d epsilon_vec = _mm256_set1_pd(epsilon);
+    simsimd_size_t i = 0;
+    for (; i < n; i += 4) {
+        __m256d a_vec, b_vec;
+        if (i + 4 <= n) {
+            a_vec = _mm256_loadu_pd(a + i);
+            b_vec = _mm256_loadu_pd(b + i);
+        } else {
+            __m256i mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long)(n - i)), _mm256_setr_epi64x(0, 1, 2, 3));
+            a_vec = _mm256_maskload_pd(a + i, mask);
+            b_vec = _mm256_maskload_pd(b + i, mask);
+        }
+        __m256d ratio_vec = _mm256_div_pd(_mm256_add_pd(a_vec, epsilon_vec), _mm256_add_pd(b_vec, epsilon_vec));
+        sum_vec = _mm256_fmadd_pd(a_vec, simsimd_avx2_f64_log2(ratio_vec), sum_vec);
+    }
+
+    __m128d sum_half_vec = _mm_add_pd(_mm256_castpd256_pd128(sum_vec), _mm256_extractf128_pd(sum_vec, 1));
+    sum_half_vec = _mm_add_sd(sum_half_vec, _mm_unpackhi_pd(sum_half_vec, sum_half_vec));
+
+    simsimd_f64_t log2_normalizer = 0.6931471805599453;
+    return (simsimd_f32_t)(_mm_cvtsd_f64(sum_half_vec) * log2_normalizer);
+}
+
+__attribute__((target("avx2,fma"))) //
+inline static simsimd_f32_t
+simsimd_avx2_f64_js(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    __m256d sum_a_vec = _mm256_setzero_pd(), sum_b_vec = _mm256_setzero_pd();
+    simsimd_f64_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    __m256d epsilon_vec = _mm256_set1_pd(epsilon);
+    __m256d half_vec = _mm256_set1_pd(0.5);
+    simsimd_size_t i = 0;
+    for (; i < n; i += 4) {
+        __m256d a_vec, b_vec;
+        if (i + 4 <= n) {
+            a_vec = _mm256_loadu_pd(a + i);
+            b_vec = _mm256_loadu_pd(b + i);
+        } else {
+            __m256i mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long)(n - i)), _mm256_setr_epi64x(0, 1, 2, 3));
+            a_vec = _mm256_maskload_pd(a + i, mask);
+            b_vec = _mm256_maskload_pd(b + i, mask);
+        }
+        __m256d m_vec = _mm256_fmadd_pd(_mm256_add_pd(a_vec, b_vec), half_vec, epsilon_vec); // M = (P + Q) / 2
+        __m256d ratio_a_vec = _mm256_div_pd(_mm256_add_pd(a_vec, epsilon_vec), m_vec);
+        __m256d ratio_b_vec = _mm256_div_pd(_mm256_add_pd(b_vec, epsilon_vec), m_vec);
+        sum_a_vec = _mm256_fmadd_pd(a_vec, simsimd_avx2_f64_log2(ratio_a_vec), sum_a_vec);
+        sum_b_vec = _mm256_fmadd_pd(b_vec, simsimd_avx2_f64_log2(ratio_b_vec), sum_b_vec);
+    }
+
+    __m256d sum_vec = _mm256_add_pd(sum_a_vec, sum_b_vec);
+    __m128d sum_half_vec = _mm_add_pd(_mm256_castpd256_pd128(sum_vec), _mm256_extractf128_pd(sum_vec, 1));
+    sum_half_vec = _mm_add_sd(sum_half_vec, _mm_unpackhi_pd(sum_half_vec, sum_half_vec));
+
+    simsimd_f64_t log2_normalizer = 0.6931471805599453;
+    return (simsimd_f32_t)(_mm_cvtsd_f64(sum_half_vec) * 0.5 * log2_normalizer);
+}
+
+__attribute__((target("avx2,fma"))) //
+inline static simsimd_f64_t
+simsimd_avx2_f64_js_mixture(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    __m256d sum_vec = _mm256_setzero_pd();
+    simsimd_f64_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    __m256d epsilon_vec = _mm256_set1_pd(epsilon);
+    __m256d half_vec = _mm256_set1_pd(0.5);
+    simsimd_size_t i = 0;
+    for (; i < n; i += 4) {
+        __m256d a_vec, b_vec;
+        if (i + 4 <= n) {
+            a_vec = _mm256_loadu_pd(a + i);
+            b_vec = _mm256_loadu_pd(b + i);
+        } else {
+            __m256i mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long)(n - i)), _mm256_setr_epi64x(0, 1, 2, 3));
+            a_vec = _mm256_maskload_pd(a + i, mask);
+            b_vec = _mm256_maskload_pd(b + i, mask);
+        }
+        __m256d s_vec = _mm256_add_pd(a_vec, b_vec);
+        __m256d m_vec = _mm256_fmadd_pd(s_vec, half_vec, epsilon_vec); // M = (P + Q) / 2
+        sum_vec = _mm256_fmadd_pd(s_vec, simsimd_avx2_f64_log2(m_vec), sum_vec);
+    }
+    return simsimd_avx2_reduce_f64x4(sum_vec);
+}
+
+__attribute__((target("avx2,fma"))) //
+inline static simsimd_f64_t
+simsimd_avx2_f64_cross_entropy(simsimd_f64_t const* logs, simsimd_f64_t const* a, simsimd_size_t n) {
+    __m256d sum_vec = _mm256_setzero_pd();
+    simsimd_size_t i = 0;
+    for (; i < n; i += 4) {
+        __m256d a_vec, logs_vec;
+        if (i + 4 <= n) {
+            a_vec = _mm256_loadu_pd(a + i);
+            logs_vec = _mm256_loadu_pd(logs + i);
+        } else {
+            __m256i mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long)(n - i)), _mm256_setr_epi64x(0, 1, 2, 3));
+            a_vec = _mm256_maskload_pd(a + i, mask);
+            logs_vec = _mm256_maskload_pd(logs + i, mask);
+        }
+        sum_vec = _mm256_fmadd_pd(a_vec, logs_vec, sum_vec);
+    }
+    return -simsimd_avx2_reduce_f64x4(sum_vec);
 }
 
 #endif // SIMSIMD_TARGET_X86_AVX2
@@ -346,53 +1266,64 @@ simsimd_avx2_f16_js(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size
  *  @brief  x86 AVX-512 implementation of the most common similarity metrics for 32-bit floating point numbers.
  *  @author Ash Vardanian
  *
- *  - Implements: Kullback-Leibler and Jensen–Shannon divergence.
+ *  - Implements: Kullback-Leibler and Jensen–Shannon divergence, and their cached mixture and cross-entropy terms.
  *  - Uses `f32` for storage and `f32` for accumulation.
+ *  - Splits the arguments with integer arithmetic rather than `vgetexpps` and `vgetmantps`,
+ *    as those can't center the mantissa around one, and to match the other backends bit-for-bit.
  *  - Requires compiler capabilities: avx512f, avx512vl.
  */
 
 __attribute__((target("avx512f,avx512vl"))) //
-inline __m512
+inline static __m512
 simsimd_avx512_f32_log2(__m512 x) {
-    // Extract the exponent and mantissa
-    __m512 one = _mm512_set1_ps(1.0f);
-    __m512 e = _mm512_getexp_ps(x);
-    __m512 m = _mm512_getmant_ps(x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_src);
+    // Splitting into `2^e * (1 + t)`, where `1 + t` is between `sqrt(0.5)` and `sqrt(2)`
+    __m512i i = _mm512_add_epi32(_mm512_castps_si512(x), _mm512_set1_epi32(0x004AFB0D));
+    __m512i e = _mm512_sub_epi32(_mm512_srli_epi32(i, 23), _mm512_set1_epi32(127));
+    __m512i m = _mm512_add_epi32(_mm512_and_si512(i, _mm512_set1_epi32(0x007FFFFF)), _mm512_set1_epi32(0x3F3504F3));
+    __m512 t = _mm512_sub_ps(_mm512_castsi512_ps(m), _mm512_set1_ps(1.0f));
 
     // Compute the polynomial using Horner's method
-    __m512 p = _mm512_set1_ps(-3.4436006e-2f);
-    p = _mm512_fmadd_ps(m, p, _mm512_set1_ps(3.1821337e-1f));
-    p = _mm512_fmadd_ps(m, p, _mm512_set1_ps(-1.2315303f));
-    p = _mm512_fmadd_ps(m, p, _mm512_set1_ps(2.5988452f));
-    p = _mm512_fmadd_ps(m, p, _mm512_set1_ps(-3.3241990f));
-    p = _mm512_fmadd_ps(m, p, _mm512_set1_ps(3.1157899f));
+    __m512 p = _mm512_set1_ps((simsimd_f32_t)simsimd_log2_coefficients[0]);
+    for (int k = 1; k <= SIMSIMD_LOG2_DEGREE; ++k)
+        p = _mm512_fmadd_ps(p, t, _mm512_set1_ps((simsimd_f32_t)simsimd_log2_coefficients[k]));
+    return _mm512_fmadd_ps(p, t, _mm512_cvtepi32_ps(e));
+}
 
-    return _mm512_add_ps(_mm512_mul_ps(p, _mm512_sub_ps(m, one)), e);
+/**
+ *  @brief  Accumulates the products of 16 pairs of `f32` values into two vectors of `f64` sums, as the cached
+ *          divergence terms are later subtracted from each other and would cancel out in single precision.
+ */
+__attribute__((target("avx512f,avx512vl"))) //
+inline static void
+simsimd_avx512_f32_fma_f64(__m512 x, __m512 y, __m512d* sum_low, __m512d* sum_high) {
+    __m512d x_low = _mm512_cvtps_pd(_mm512_castps512_ps256(x)), y_low = _mm512_cvtps_pd(_mm512_castps512_ps256(y));
+    __m512d x_high = _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(x), 1)));
+    __m512d y_high = _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(y), 1)));
+    *sum_low = _mm512_fmadd_pd(x_low, y_low, *sum_low);
+    *sum_high = _mm512_fmadd_pd(x_high, y_high, *sum_high);
 }
 
 __attribute__((target("avx512f,avx512vl,bmi2"))) //
 inline static simsimd_f32_t
 simsimd_avx512_f32_kl(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
     __m512 sum_vec = _mm512_set1_ps(0);
-    simsimd_f32_t epsilon = 1e-6;
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
     __m512 epsilon_vec = _mm512_set1_ps(epsilon);
     __m512 a_vec, b_vec;
 
 simsimd_avx512_f32_kl_cycle:
     if (n < 16) {
         __mmask16 mask = _bzhi_u32(0xFFFFFFFF, n);
-        a_vec = _mm512_add_ps(_mm512_maskz_loadu_ps(mask, a), epsilon_vec);
-        b_vec = _mm512_add_ps(_mm512_maskz_loadu_ps(mask, b), epsilon_vec);
+        a_vec = _mm512_maskz_loadu_ps(mask, a);
+        b_vec = _mm512_maskz_loadu_ps(mask, b);
         n = 0;
     } else {
-        a_vec = _mm512_add_ps(_mm512_loadu_ps(a), epsilon_vec);
-        b_vec = _mm512_add_ps(_mm512_loadu_ps(b), epsilon_vec);
+        a_vec = _mm512_loadu_ps(a);
+        b_vec = _mm512_loadu_ps(b);
         a += 16, b += 16, n -= 16;
     }
-    __m512 ratio_vec = _mm512_div_ps(a_vec, b_vec);
-    __m512 log_ratio_vec = simsimd_avx512_f32_log2(ratio_vec);
-    __m512 prod_vec = _mm512_mul_ps(a_vec, log_ratio_vec);
-    sum_vec = _mm512_add_ps(sum_vec, prod_vec);
+    __m512 ratio_vec = _mm512_div_ps(_mm512_add_ps(a_vec, epsilon_vec), _mm512_add_ps(b_vec, epsilon_vec));
+    sum_vec = _mm512_fmadd_ps(a_vec, simsimd_avx512_f32_log2(ratio_vec), sum_vec);
     if (n)
         goto simsimd_avx512_f32_kl_cycle;
 
@@ -405,7 +1336,7 @@ inline static simsimd_f32_t
 simsimd_avx512_f32_js(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
     __m512 sum_a_vec = _mm512_set1_ps(0);
     __m512 sum_b_vec = _mm512_set1_ps(0);
-    simsimd_f32_t epsilon = 1e-6;
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
     __m512 epsilon_vec = _mm512_set1_ps(epsilon);
     __m512 a_vec, b_vec;
 
@@ -420,17 +1351,11 @@ simsimd_avx512_f32_js_cycle:
         b_vec = _mm512_loadu_ps(b);
         a += 16, b += 16, n -= 16;
     }
-    __m512 m_vec = _mm512_mul_ps(_mm512_add_ps(a_vec, b_vec), _mm512_set1_ps(0.5f));
-    __mmask16 nonzero_mask_a = _mm512_cmp_ps_mask(a_vec, epsilon_vec, _CMP_GE_OQ);
-    __mmask16 nonzero_mask_b = _mm512_cmp_ps_mask(b_vec, epsilon_vec, _CMP_GE_OQ);
-    __mmask16 nonzero_mask = nonzero_mask_a & nonzero_mask_b;
-    __m512 m_recip_approx = _mm512_rcp14_ps(m_vec);
-    __m512 ratio_a_vec = _mm512_mul_ps(a_vec, m_recip_approx);
-    __m512 ratio_b_vec = _mm512_mul_ps(b_vec, m_recip_approx);
-    __m512 log_ratio_a_vec = simsimd_avx512_f32_log2(ratio_a_vec);
-    __m512 log_ratio_b_vec = simsimd_avx512_f32_log2(ratio_b_vec);
-    sum_a_vec = _mm512_maskz_fmadd_ps(nonzero_mask, a_vec, log_ratio_a_vec, sum_a_vec);
-    sum_b_vec = _mm512_maskz_fmadd_ps(nonzero_mask, b_vec, log_ratio_b_vec, sum_b_vec);
+    __m512 m_vec = _mm512_fmadd_ps(_mm512_add_ps(a_vec, b_vec), _mm512_set1_ps(0.5f), epsilon_vec); // M = (P + Q) / 2
+    __m512 ratio_a_vec = _mm512_div_ps(_mm512_add_ps(a_vec, epsilon_vec), m_vec);
+    __m512 ratio_b_vec = _mm512_div_ps(_mm512_add_ps(b_vec, epsilon_vec), m_vec);
+    sum_a_vec = _mm512_fmadd_ps(a_vec, simsimd_avx512_f32_log2(ratio_a_vec), sum_a_vec);
+    sum_b_vec = _mm512_fmadd_ps(b_vec, simsimd_avx512_f32_log2(ratio_b_vec), sum_b_vec);
     if (n)
         goto simsimd_avx512_f32_js_cycle;
 
@@ -438,100 +1363,322 @@ simsimd_avx512_f32_js_cycle:
     return _mm512_reduce_add_ps(_mm512_add_ps(sum_a_vec, sum_b_vec)) * 0.5f * log2_normalizer;
 }
 
+__attribute__((target("avx512f,avx512vl,bmi2"))) //
+inline static simsimd_f64_t
+simsimd_avx512_f32_js_mixture(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
+    __m512d sum_low_vec = _mm512_set1_pd(0), sum_high_vec = _mm512_set1_pd(0);
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    __m512 epsilon_vec = _mm512_set1_ps(epsilon);
+    __m512 a_vec, b_vec;
+
+simsimd_avx512_f32_js_mixture_cycle:
+    if (n < 16) {
+        __mmask16 mask = _bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_ps(mask, a);
+        b_vec = _mm512_maskz_loadu_ps(mask, b);
+        n = 0;
+    } else {
+        a_vec = _mm512_loadu_ps(a);
+        b_vec = _mm512_loadu_ps(b);
+        a += 16, b += 16, n -= 16;
+    }
+    __m512 s_vec = _mm512_add_ps(a_vec, b_vec);
+    __m512 m_vec = _mm512_fmadd_ps(s_vec, _mm512_set1_ps(0.5f), epsilon_vec); // M = (P + Q) / 2
+    simsimd_avx512_f32_fma_f64(s_vec, simsimd_avx512_f32_log2(m_vec), &sum_low_vec, &sum_high_vec);
+    if (n)
+        goto simsimd_avx512_f32_js_mixture_cycle;
+
+    return _mm512_reduce_add_pd(_mm512_add_pd(sum_low_vec, sum_high_vec));
+}
+
+__attribute__((target("avx512f,avx512vl,bmi2"))) //
+inline static simsimd_f64_t
+simsimd_avx512_f32_cross_entropy(simsimd_f32_t const* logs, simsimd_f32_t const* a, simsimd_size_t n) {
+    __m512d sum_low_vec = _mm512_set1_pd(0), sum_high_vec = _mm512_set1_pd(0);
+    __m512 a_vec, logs_vec;
+
+simsimd_avx512_f32_cross_entropy_cycle:
+    if (n < 16) {
+        __mmask16 mask = _bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_ps(mask, a);
+        logs_vec = _mm512_maskz_loadu_ps(mask, logs);
+        n = 0;
+    } else {
+        a_vec = _mm512_loadu_ps(a);
+        logs_vec = _mm512_loadu_ps(logs);
+        a += 16, logs += 16, n -= 16;
+    }
+    simsimd_avx512_f32_fma_f64(a_vec, logs_vec, &sum_low_vec, &sum_high_vec);
+    if (n)
+        goto simsimd_avx512_f32_cross_entropy_cycle;
+
+    return -_mm512_reduce_add_pd(_mm512_add_pd(sum_low_vec, sum_high_vec));
+}
+
 /*
- *  @file   x86_avx512_f16.h
- *  @brief  x86 AVX-512 implementation of the most common similarity metrics for 16-bit floating point numbers.
+ *  @file   x86_avx512_f64.h
+ *  @brief  x86 AVX-512 implementation of the most common similarity metrics for 64-bit floating point numbers.
  *  @author Ash Vardanian
  *
- *  - Implements: Kullback-Leibler and Jensen–Shannon divergence.
- *  - Uses `_mm512_maskz_loadu_epi16` intrinsics to perform masked unaligned loads.
- *  - Uses `f16` for both storage and accumulation, assuming it's resolution is enough for average case.
- *  - Requires compiler capabilities: avx512fp16, avx512f, avx512vl.
+ *  - Implements: Kullback-Leibler and Jensen–Shannon divergence, and their cached mixture and cross-entropy terms.
+ *  - Uses `f64` for storage and `f64` for accumulation.
+ *  - Requires compiler capabilities: avx512f, avx512vl, bmi2.
  */
 
-__attribute__((target("avx512f,avx512vl,avx512fp16"))) //
-inline __m512h
-simsimd_avx512_f16_log2(__m512h x) {
-    // Extract the exponent and mantissa
-    __m512h one = _mm512_set1_ph((_Float16)1);
-    __m512h e = _mm512_getexp_ph(x);
-    __m512h m = _mm512_getmant_ph(x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_src);
+__attribute__((target("avx512f,avx512vl"))) //
+inline static __m512d
+simsimd_avx512_f64_log2(__m512d x) {
+    // Splitting into `2^e * (1 + t)`, where `1 + t` is between `sqrt(0.5)` and `sqrt(2)`
+    __m512i i = _mm512_add_epi64(_mm512_castpd_si512(x), _mm512_set1_epi64(0x00095F619980C433ll));
+    __m512i m = _mm512_add_epi64(_mm512_and_si512(i, _mm512_set1_epi64(0x000FFFFFFFFFFFFFll)),
+                                 _mm512_set1_epi64(0x3FE6A09E667F3BCDll));
+    __m512d t = _mm512_sub_pd(_mm512_castsi512_pd(m), _mm512_set1_pd(1.0));
+
+    // Converting 64-bit integers requires AVX-512DQ, so the biased exponent is planted into the mantissa of `2^52`
+    __m512i e = _mm512_or_si512(_mm512_srli_epi64(i, 52), _mm512_set1_epi64(0x4330000000000000ll));
+    __m512d e_float = _mm512_sub_pd(_mm512_castsi512_pd(e), _mm512_set1_pd(4503599627370496.0 + 1023));
 
     // Compute the polynomial using Horner's method
-    __m512h p = _mm512_set1_ph((_Float16)-3.4436006e-2f);
-    p = _mm512_fmadd_ph(m, p, _mm512_set1_ph((_Float16)3.1821337e-1f));
-    p = _mm512_fmadd_ph(m, p, _mm512_set1_ph((_Float16)-1.2315303f));
-    p = _mm512_fmadd_ph(m, p, _mm512_set1_ph((_Float16)2.5988452f));
-    p = _mm512_fmadd_ph(m, p, _mm512_set1_ph((_Float16)-3.3241990f));
-    p = _mm512_fmadd_ph(m, p, _mm512_set1_ph((_Float16)3.1157899f));
+    __m512d p = _mm512_set1_pd(simsimd_log2_coefficients[0]);
+    for (int k = 1; k <= SIMSIMD_LOG2_DEGREE; ++k)
+        p = _mm512_fmadd_pd(p, t, _mm512_set1_pd(simsimd_log2_coefficients[k]));
+    return _mm512_fmadd_pd(p, t, e_float);
+}
+
+__attribute__((target("avx512f,avx512vl,bmi2"))) //
+inline static simsimd_f32_t
+simsimd_avx512_f64_kl(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    __m512d sum_vec = _mm512_set1_pd(0);
+    simsimd_f64_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    __m512d epsilon_vec = _mm512_set1_pd(epsilon);
+    __m512d a_vec, b_vec;
+
+simsimd_avx512_f64_kl_cycle:
+    if (n < 8) {
+        __mmask8 mask = (__mmask8)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_pd(mask, a);
+        b_vec = _mm512_maskz_loadu_pd(mask, b);
+        n = 0;
+    } else {
+        a_vec = _mm512_loadu_pd(a);
+        b_vec = _mm512_loadu_pd(b);
+        a += 8, b += 8, n -= 8;
+    }
+    __m512d ratio_vec = _mm512_div_pd(_mm512_add_pd(a_vec, epsilon_vec), _mm512_add_pd(b_vec, epsilon_vec));
+    sum_vec = _mm512_fmadd_pd(a_vec, simsimd_avx512_f64_log2(ratio_vec), sum_vec);
+    if (n)
+        goto simsimd_avx512_f64_kl_cycle;
+
+    simsimd_f64_t log2_normalizer = 0.6931471805599453;
+    return (simsimd_f32_t)(_mm512_reduce_add_pd(sum_vec) * log2_normalizer);
+}
+
+__attribute__((target("avx512f,avx512vl,bmi2"))) //
+inline static simsimd_f32_t
+simsimd_avx512_f64_js(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    __m512d sum_a_vec = _mm512_set1_pd(0);
+    __m512d sum_b_vec = _mm512_set1_pd(0);
+    simsimd_f64_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    __m512d epsilon_vec = _mm512_set1_pd(epsilon);
+    __m512d a_vec, b_vec;
+
+simsimd_avx512_f64_js_cycle:
+    if (n < 8) {
+        __mmask8 mask = (__mmask8)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_pd(mask, a);
+        b_vec = _mm512_maskz_loadu_pd(mask, b);
+        n = 0;
+    } else {
+        a_vec = _mm512_loadu_pd(a);
+        b_vec = _mm512_loadu_pd(b);
+        a += 8, b += 8, n -= 8;
+    }
+    __m512d m_vec = _mm512_fmadd_pd(_mm512_add_pd(a_vec, b_vec), _mm512_set1_pd(0.5), epsilon_vec);
+    __m512d ratio_a_vec = _mm512_div_pd(_mm512_add_pd(a_vec, epsilon_vec), m_vec);
+    __m512d ratio_b_vec = _mm512_div_pd(_mm512_add_pd(b_vec, epsilon_vec), m_vec);
+    sum_a_vec = _mm512_fmadd_pd(a_vec, simsimd_avx512_f64_log2(ratio_a_vec), sum_a_vec);
+    sum_b_vec = _mm512_fmadd_pd(b_vec, simsimd_avx512_f64_log2(ratio_b_vec), sum_b_vec);
+    if (n)
+        goto simsimd_avx512_f64_js_cycle;
+
+    simsimd_f64_t log2_normalizer = 0.6931471805599453;
+    return (simsimd_f32_t)(_mm512_reduce_add_pd(_mm512_add_pd(sum_a_vec, sum_b_vec)) * 0.5 * log2_normalizer);
+}
+
+__attribute__((target("avx512f,avx512vl,bmi2"))) //
+inline static simsimd_f64_t
+simsimd_avx512_f64_js_mixture(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    __m512d sum_vec = _mm512_set1_pd(0);
+    simsimd_f64_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    __m512d epsilon_vec = _mm512_set1_pd(epsilon);
+    __m512d a_vec, b_vec;
+
+simsimd_avx512_f64_js_mixture_cycle:
+    if (n < 8) {
+        __mmask8 mask = (__mmask8)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_pd(mask, a);
+        b_vec = _mm512_maskz_loadu_pd(mask, b);
+        n = 0;
+    } else {
+        a_vec = _mm512_loadu_pd(a);
+        b_vec = _mm512_loadu_pd(b);
+        a += 8, b += 8, n -= 8;
+    }
+    __m512d s_vec = _mm512_add_pd(a_vec, b_vec);
+    __m512d m_vec = _mm512_fmadd_pd(s_vec, _mm512_set1_pd(0.5), epsilon_vec);
+    sum_vec = _mm512_fmadd_pd(s_vec, simsimd_avx512_f64_log2(m_vec), sum_vec);
+    if (n)
+        goto simsimd_avx512_f64_js_mixture_cycle;
 
-    return _mm512_add_ph(_mm512_mul_ph(p, _mm512_sub_ph(m, one)), e);
+    return _mm512_reduce_add_pd(sum_vec);
 }
 
-__attribute__((target("avx512f,avx512vl,avx512fp16,bmi2"))) //
+__attribute__((target("avx512f,avx512vl,bmi2"))) //
+inline static simsimd_f64_t
+simsimd_avx512_f64_cross_entropy(simsimd_f64_t const* logs, simsimd_f64_t const* a, simsimd_size_t n) {
+    __m512d sum_vec = _mm512_set1_pd(0);
+    __m512d a_vec, logs_vec;
+
+simsimd_avx512_f64_cross_entropy_cycle:
+    if (n < 8) {
+        __mmask8 mask = (__mmask8)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_pd(mask, a);
+        logs_vec = _mm512_maskz_loadu_pd(mask, logs);
+        n = 0;
+    } else {
+        a_vec = _mm512_loadu_pd(a);
+        logs_vec = _mm512_loadu_pd(logs);
+        a += 8, logs += 8, n -= 8;
+    }
+    sum_vec = _mm512_fmadd_pd(a_vec, logs_vec, sum_vec);
+    if (n)
+        goto simsimd_avx512_f64_cross_entropy_cycle;
+
+    return -_mm512_reduce_add_pd(sum_vec);
+}
+
+/*
+ *  @file   x86_avx512_f16.h
+ *  @brief  x86 AVX-512 implementation of the most common similarity metrics for 16-bit floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: Kullback-Leibler and Jensen–Shannon divergence, and their cached mixture and cross-entropy terms.
+ *  - Uses `_mm256_maskz_loadu_epi16` intrinsics to perform masked unaligned loads.
+ *  - Uses `f16` for storage and `f32` for accumulation, as the logarithm of half-precision ratios
+ *    would otherwise be limited to 3 decimal digits.
+ *  - Requires compiler capabilities: avx512f, avx512vl, avx512bw.
+ */
+
+__attribute__((target("avx512f,avx512vl,avx512bw,bmi2"))) //
 inline static simsimd_f32_t
 simsimd_avx512_f16_kl(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n) {
-    __m512h sum_vec = _mm512_set1_ph((_Float16)0);
-    __m512h epsilon_vec = _mm512_set1_ph((_Float16)1e-6f);
-    __m512h a_vec, b_vec;
+    __m512 sum_vec = _mm512_set1_ps(0);
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    __m512 epsilon_vec = _mm512_set1_ps(epsilon);
+    __m512 a_vec, b_vec;
 
 simsimd_avx512_f16_kl_cycle:
-    if (n < 32) {
-        __mmask32 mask = _bzhi_u32(0xFFFFFFFF, n);
-        a_vec = _mm512_maskz_add_ph(mask, _mm512_castsi512_ph(_mm512_maskz_loadu_epi16(mask, a)), epsilon_vec);
-        b_vec = _mm512_maskz_add_ph(mask, _mm512_castsi512_ph(_mm512_maskz_loadu_epi16(mask, b)), epsilon_vec);
+    if (n < 16) {
+        __mmask16 mask = _bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, a));
+        b_vec = _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, b));
         n = 0;
     } else {
-        a_vec = _mm512_add_ph(_mm512_castsi512_ph(_mm512_loadu_epi16(a)), epsilon_vec);
-        b_vec = _mm512_add_ph(_mm512_castsi512_ph(_mm512_loadu_epi16(b)), epsilon_vec);
-        a += 32, b += 32, n -= 32;
-    }
-    __m512h ratio_vec = _mm512_div_ph(a_vec, b_vec);
-    __m512h log_ratio_vec = simsimd_avx512_f16_log2(ratio_vec);
-    __m512h prod_vec = _mm512_mul_ph(a_vec, log_ratio_vec);
-    sum_vec = _mm512_add_ph(sum_vec, prod_vec);
+        a_vec = _mm512_cvtph_ps(_mm256_loadu_si256((__m256i const*)a));
+        b_vec = _mm512_cvtph_ps(_mm256_loadu_si256((__m256i const*)b));
+        a += 16, b += 16, n -= 16;
+    }
+    __m512 ratio_vec = _mm512_div_ps(_mm512_add_ps(a_vec, epsilon_vec), _mm512_add_ps(b_vec, epsilon_vec));
+    sum_vec = _mm512_fmadd_ps(a_vec, simsimd_avx512_f32_log2(ratio_vec), sum_vec);
     if (n)
         goto simsimd_avx512_f16_kl_cycle;
 
     simsimd_f32_t log2_normalizer = 0.693147181f;
-    return _mm512_reduce_add_ph(sum_vec) * log2_normalizer;
+    return _mm512_reduce_add_ps(sum_vec) * log2_normalizer;
 }
 
-__attribute__((target("avx512f,avx512vl,avx512fp16,bmi2"))) //
+__attribute__((target("avx512f,avx512vl,avx512bw,bmi2"))) //
 inline static simsimd_f32_t
 simsimd_avx512_f16_js(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n) {
-    __m512h sum_a_vec = _mm512_set1_ph((_Float16)0);
-    __m512h sum_b_vec = _mm512_set1_ph((_Float16)0);
-    __m512h epsilon_vec = _mm512_set1_ph((_Float16)1e-6f);
-    __m512h a_vec, b_vec;
+    __m512 sum_a_vec = _mm512_set1_ps(0);
+    __m512 sum_b_vec = _mm512_set1_ps(0);
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    __m512 epsilon_vec = _mm512_set1_ps(epsilon);
+    __m512 a_vec, b_vec;
 
 simsimd_avx512_f16_js_cycle:
-    if (n < 32) {
-        __mmask32 mask = _bzhi_u32(0xFFFFFFFF, n);
-        a_vec = _mm512_castsi512_ph(_mm512_maskz_loadu_epi16(mask, a));
-        b_vec = _mm512_castsi512_ph(_mm512_maskz_loadu_epi16(mask, b));
+    if (n < 16) {
+        __mmask16 mask = _bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, a));
+        b_vec = _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, b));
         n = 0;
     } else {
-        a_vec = _mm512_castsi512_ph(_mm512_loadu_epi16(a));
-        b_vec = _mm512_castsi512_ph(_mm512_loadu_epi16(b));
-        a += 32, b += 32, n -= 32;
-    }
-    __m512h m_vec = _mm512_mul_ph(_mm512_add_ph(a_vec, b_vec), _mm512_set1_ph((_Float16)0.5f));
-    __mmask32 nonzero_mask_a = _mm512_cmp_ph_mask(a_vec, epsilon_vec, _CMP_GE_OQ);
-    __mmask32 nonzero_mask_b = _mm512_cmp_ph_mask(b_vec, epsilon_vec, _CMP_GE_OQ);
-    __mmask32 nonzero_mask = nonzero_mask_a & nonzero_mask_b;
-    __m512h m_recip_approx = _mm512_rcp_ph(m_vec);
-    __m512h ratio_a_vec = _mm512_mul_ph(a_vec, m_recip_approx);
-    __m512h ratio_b_vec = _mm512_mul_ph(b_vec, m_recip_approx);
-    __m512h log_ratio_a_vec = simsimd_avx512_f16_log2(ratio_a_vec);
-    __m512h log_ratio_b_vec = simsimd_avx512_f16_log2(ratio_b_vec);
-    sum_a_vec = _mm512_maskz_fmadd_ph(nonzero_mask, a_vec, log_ratio_a_vec, sum_a_vec);
-    sum_b_vec = _mm512_maskz_fmadd_ph(nonzero_mask, b_vec, log_ratio_b_vec, sum_b_vec);
+        a_vec = _mm512_cvtph_ps(_mm256_loadu_si256((__m256i const*)a));
+        b_vec = _mm512_cvtph_ps(_mm256_loadu_si256((__m256i const*)b));
+        a += 16, b += 16, n -= 16;
+    }
+    __m512 m_vec = _mm512_fmadd_ps(_mm512_add_ps(a_vec, b_vec), _mm512_set1_ps(0.5f), epsilon_vec); // M = (P + Q) / 2
+    __m512 ratio_a_vec = _mm512_div_ps(_mm512_add_ps(a_vec, epsilon_vec), m_vec);
+    __m512 ratio_b_vec = _mm512_div_ps(_mm512_add_ps(b_vec, epsilon_vec), m_vec);
+    sum_a_vec = _mm512_fmadd_ps(a_vec, simsimd_avx512_f32_log2(ratio_a_vec), sum_a_vec);
+    sum_b_vec = _mm512_fmadd_ps(b_vec, simsimd_avx512_f32_log2(ratio_b_vec), sum_b_vec);
     if (n)
         goto simsimd_avx512_f16_js_cycle;
 
     simsimd_f32_t log2_normalizer = 0.693147181f;
-    return _mm512_reduce_add_ph(_mm512_add_ph(sum_a_vec, sum_b_vec)) * 0.5f * log2_normalizer;
+    return _mm512_reduce_add_ps(_mm512_add_ps(sum_a_vec, sum_b_vec)) * 0.5f * log2_normalizer;
+}
+
+__attribute__((target("avx512f,avx512vl,avx512bw,bmi2"))) //
+inline static simsimd_f64_t
+simsimd_avx512_f16_js_mixture(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n) {
+    __m512d sum_low_vec = _mm512_set1_pd(0), sum_high_vec = _mm512_set1_pd(0);
+    simsimd_f32_t epsilon = SIMSIMD_PROBABILITY_EPSILON;
+    __m512 epsilon_vec = _mm512_set1_ps(epsilon);
+    __m512 a_vec, b_vec;
+
+simsimd_avx512_f16_js_mixture_cycle:
+    if (n < 16) {
+        __mmask16 mask = _bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, a));
+        b_vec = _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, b));
+        n = 0;
+    } else {
+        a_vec = _mm512_cvtph_ps(_mm256_loadu_si256((__m256i const*)a));
+        b_vec = _mm512_cvtph_ps(_mm256_loadu_si256((__m256i const*)b));
+        a += 16, b += 16, n -= 16;
+    }
+    __m512 s_vec = _mm512_add_ps(a_vec, b_vec);
+    __m512 m_vec = _mm512_fmadd_ps(s_vec, _mm512_set1_ps(0.5f), epsilon_vec); // M = (P + Q) / 2
+    simsimd_avx512_f32_fma_f64(s_vec, simsimd_avx512_f32_log2(m_vec), &sum_low_vec, &sum_high_vec);
+    if (n)
+        goto simsimd_avx512_f16_js_mixture_cycle;
+
+    return _mm512_reduce_add_pd(_mm512_add_pd(sum_low_vec, sum_high_vec));
+}
+
+__attribute__((target("avx512f,avx512vl,avx512bw,bmi2"))) //
+inline static simsimd_f64_t
+simsimd_avx512_f16_cross_entropy(simsimd_f32_t const* logs, simsimd_f16_t const* a, simsimd_size_t n) {
+    __m512d sum_low_vec = _mm512_set1_pd(0), sum_high_vec = _mm512_set1_pd(0);
+    __m512 a_vec, logs_vec;
+
+simsimd_avx512_f16_cross_entropy_cycle:
+    if (n < 16) {
+        __mmask16 mask = _bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, a));
+        logs_vec = _mm512_maskz_loadu_ps(mask, logs);
+        n = 0;
+    } else {
+        a_vec = _mm512_cvtph_ps(_mm256_loadu_si256((__m256i const*)a));
+        logs_vec = _mm512_loadu_ps(logs);
+        a += 16, logs += 16, n -= 16;
+    }
+    simsimd_avx512_f32_fma_f64(a_vec, logs_vec, &sum_low_vec, &sum_high_vec);
+    if (n)
+        goto simsimd_avx512_f16_cross_entropy_cycle;
+
+    return -_mm512_reduce_add_pd(_mm512_add_pd(sum_low_vec, sum_high_vec));
 }
 
 #endif // SIMSIMD_TARGET_X86_AVX512
@@ -539,4 +1686,4 @@ simsimd_avx512_f16_js_cycle:
 
 #ifdef __cplusplus
 }
-#endif
\ No newline at end of file
+#endif
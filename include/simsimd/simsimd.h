@@ -13,9 +13,14 @@
 
 #pragma once
 #include "binary.h"      // Hamming, Jaccard
+#include "convert.h"     // Conversions, Quantization, Binarization
+#include "pq.h"          // Product Quantization
 #include "probability.h" // Kullback-Leibler, Jensen–Shannon
+#include "sparse.h"      // Sorted-Set Intersections, Sparse Dot Products
 #include "spatial.h"     // L2, Inner Product, Cosine
 
+#include <math.h> // `sqrt`, for the exact inverse norms
+
 #if SIMSIMD_TARGET_ARM
 #ifdef __linux__
 #include <asm/hwcap.h>
@@ -23,6 +28,49 @@
 #endif
 #endif
 
+#ifndef SIMSIMD_THREAD_POOL
+#define SIMSIMD_THREAD_POOL 0
+#endif
+
+/*
+ *  The dispatch table is not process-wide by default. Every translation unit, that includes this header,
+ *  gets its own table, filled on first use, its own `simsimd_dispatch_restrict` tables, and its own kernel
+ *  counters. Only if every unit is compiled with `SIMSIMD_DYNAMIC_DISPATCH=1`, and exactly one of them
+ *  defines `SIMSIMD_DYNAMIC_DISPATCH_IMPLEMENTATION`, emitting the external definitions of the functions,
+ *  that own that state, does the whole program share them.
+ */
+#ifndef SIMSIMD_DYNAMIC_DISPATCH
+#define SIMSIMD_DYNAMIC_DISPATCH 0
+#endif
+
+#if SIMSIMD_DYNAMIC_DISPATCH
+#define SIMSIMD_DISPATCH_LINKAGE
+#else
+#define SIMSIMD_DISPATCH_LINKAGE inline static
+#endif
+
+#if SIMSIMD_THREAD_POOL
+#include <pthread.h> // `pthread_create`, `pthread_cond_wait`
+#include <stdlib.h>  // `malloc`, `free`
+#include <unistd.h>  // `sysconf`
+#endif
+
+/*
+ *  The memory-mapped dataset scanner needs `posix_madvise`, so with strict ISO C compiler modes,
+ *  like `-std=c11`, also define `_POSIX_C_SOURCE` to at least `200112L` before any header.
+ */
+#ifndef SIMSIMD_MMAP
+#define SIMSIMD_MMAP 0
+#endif
+
+#if SIMSIMD_MMAP
+#include <fcntl.h>    // `open`
+#include <stdlib.h>   // `malloc`, `calloc`, `free`
+#include <sys/mman.h> // `mmap`, `posix_madvise`
+#include <sys/stat.h> // `fstat`
+#include <unistd.h>   // `close`, `sysconf`
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -56,6 +104,10 @@ typedef enum {
     simsimd_metric_js_k = 's',             ///< Jensen-Shannon divergence
     simsimd_metric_jensen_shannon_k = 's', ///< Jensen-Shannon divergence alias
 
+    // Product quantization, where the first argument is a `f32` lookup table, and the second one - a code:
+    simsimd_metric_adc_k = 'q', ///< Asymmetric distance to 8-bit product-quantized codes
+    simsimd_metric_pq_k = 'q',  ///< Asymmetric distance alias
+
 } simsimd_metric_kind_t;
 
 /**
@@ -65,9 +117,13 @@ typedef enum {
     simsimd_cap_serial_k = 1,       ///< Serial (non-SIMD) capability
     simsimd_cap_any_k = 0xFFFFFFFF, ///< Mask representing any capability
 
-    simsimd_cap_arm_neon_k = 1 << 10, ///< ARM NEON capability
-    simsimd_cap_arm_sve_k = 1 << 11,  ///< ARM SVE capability
-    simsimd_cap_arm_sve2_k = 1 << 12, ///< ARM SVE2 capability
+    simsimd_cap_arm_neon_k = 1 << 10,     ///< ARM NEON capability
+    simsimd_cap_arm_sve_k = 1 << 11,      ///< ARM SVE capability
+    simsimd_cap_arm_sve2_k = 1 << 12,     ///< ARM SVE2 capability
+    simsimd_cap_arm_bf16_k = 1 << 13,     ///< ARM NEON with BF16 `bfdot` and `bfmmla` capability
+    simsimd_cap_arm_sve_bf16_k = 1 << 14, ///< ARM SVE with BF16 `bfdot` and `bfmmla` capability
+    simsimd_cap_arm_dotprod_k = 1 << 15,  ///< ARM NEON with `sdot` and `udot` capability
+    simsimd_cap_arm_i8mm_k = 1 << 16,     ///< ARM NEON with I8MM `usdot` and `smmla` capability
 
     simsimd_cap_x86_avx2_k = 1 << 20,            ///< x86 AVX2 capability
     simsimd_cap_x86_avx512_k = 1 << 21,          ///< x86 AVX512 capability
@@ -75,6 +131,9 @@ typedef enum {
     simsimd_cap_x86_avx512fp16_k = 1 << 23,      ///< x86 AVX512 with FP16 capability
     simsimd_cap_x86_avx512vpopcntdq_k = 1 << 24, ///< x86 AVX512 VPOPCNTDQ instruction capability
     simsimd_cap_x86_avx512vnni_k = 1 << 25,      ///< x86 AVX512 VNNI instruction capability
+    simsimd_cap_x86_avx512bf16_k = 1 << 26,      ///< x86 AVX512 BF16 `vdpbf16ps` instruction capability
+    simsimd_cap_x86_amx_int8_k = 1 << 27,        ///< x86 AMX `tdpbssd` tile instruction capability
+    simsimd_cap_x86_amx_bf16_k = 1 << 28,        ///< x86 AMX `tdpbf16ps` tile instruction capability
 
 } simsimd_capability_t;
 
@@ -88,6 +147,10 @@ typedef enum {
     simsimd_datatype_f16_k,     ///< Half precision floating point
     simsimd_datatype_i8_k,      ///< 8-bit integer
     simsimd_datatype_b8_k,      ///< Single-bit values packed into 8-bit words
+    simsimd_datatype_bf16_k,    ///< Brain floating point
+    simsimd_datatype_u8_k,      ///< 8-bit unsigned integer
+    simsimd_datatype_i4x2_k,    ///< Pairs of 4-bit signed integers packed into 8-bit words, low nibble first
+    simsimd_datatype_pq8_k,     ///< Product-quantization codes, indexing one of 256 centroids per subspace
 } simsimd_datatype_t;
 
 /**
@@ -102,6 +165,155 @@ typedef enum {
 typedef simsimd_f32_t (*simsimd_metric_punned_t)(void const* a, void const* b, simsimd_size_t size_a,
                                                  simsimd_size_t size_b);
 
+/**
+ *  @brief  Type-punned function pointer for the terms of the divergences, that depend on both distributions,
+ *          like the Jensen–Shannon mixture or the Kullback-Leibler cross-entropy. Those are combined with the
+ *          cached entropies, so they are returned in double precision.
+ *
+ *  @param[in] a Pointer to the first distribution, or to the logarithms of it for the cross-entropy.
+ *  @param[in] b Pointer to the second distribution.
+ *  @param[in] n Number of scalars in every distribution.
+ *  @return Computed term in bits.
+ */
+typedef simsimd_f64_t (*simsimd_divergence_term_punned_t)(void const* a, void const* b, simsimd_size_t n);
+
+/**
+ *  @brief  Type-punned function pointer comparing one vector against many equidistant rows,
+ *          outputting the similarity/distance for every row.
+ *
+ *  @param[in] a Pointer to the query vector.
+ *  @param[in] b Pointer to the first row.
+ *  @param[in] count Number of rows.
+ *  @param[in] stride Distance between the starts of consecutive rows in bytes.
+ *  @param[in] dimensions Number of scalars (or words for binary vectors) in every vector.
+ *  @param[out] results Output array for `count` single-precision distances.
+ */
+typedef void (*simsimd_batch_punned_t)(void const* a, void const* b, simsimd_size_t count, simsimd_size_t stride,
+                                       simsimd_size_t dimensions, simsimd_f32_t* results);
+
+/**
+ *  @brief  Type-punned function pointer comparing one vector against many equidistant rows, that may stop
+ *          early for rows known to be further than `max_distance`. Such rows get some partial distance,
+ *          which is still guaranteed to exceed `max_distance`, and all other rows get the exact one.
+ *
+ *  @param[in] a Pointer to the query vector.
+ *  @param[in] b Pointer to the first row.
+ *  @param[in] count Number of rows.
+ *  @param[in] stride Distance between the starts of consecutive rows in bytes.
+ *  @param[in] dimensions Number of scalars (or words for binary vectors) in every vector.
+ *  @param[in] max_distance Largest distance of interest.
+ *  @param[out] results Output array for `count` single-precision distances.
+ */
+typedef void (*simsimd_bounded_batch_punned_t)(void const* a, void const* b, simsimd_size_t count,
+                                               simsimd_size_t stride, simsimd_size_t dimensions,
+                                               simsimd_f32_t max_distance, simsimd_f32_t* results);
+
+/**
+ *  @brief  Type-punned function pointer scoring blocks of interleaved 4-bit product-quantized codes
+ *          against a quantized lookup table, as produced by `simsimd_pq4_pack` and `simsimd_pq4_quantize_lut`.
+ *
+ *  @param[in] lut Pointer to the `u8` lookup table with 32 entries for every byte of a code.
+ *  @param[in] packed Pointer to the interleaved blocks of codes.
+ *  @param[in] count Number of codes.
+ *  @param[in] n_bytes Number of bytes in every code, or half the number of subspaces, rounded up.
+ *  @param[in] scale Step of the quantized lookup table.
+ *  @param[in] bias Sum of the minimums of all rows of the original lookup table.
+ *  @param[out] results Output array for `count` single-precision distances.
+ */
+typedef void (*simsimd_pq4_scan_punned_t)(simsimd_b8_t const* lut, simsimd_b8_t const* packed, simsimd_size_t count,
+                                          simsimd_size_t n_bytes, simsimd_f32_t scale, simsimd_f32_t bias,
+                                          simsimd_f32_t* results);
+
+/**
+ *  @brief  Type-punned function pointer counting the common indices of two sparse vectors.
+ *
+ *  @param[in] a Pointer to the strictly increasing indices of the first vector.
+ *  @param[in] b Pointer to the strictly increasing indices of the second vector.
+ *  @param[in] a_length Number of indices in the first vector.
+ *  @param[in] b_length Number of indices in the second vector.
+ *  @return The size of the intersection.
+ */
+typedef simsimd_size_t (*simsimd_sparse_intersect_punned_t)(simsimd_u32_t const* a, simsimd_u32_t const* b,
+                                                            simsimd_size_t a_length, simsimd_size_t b_length);
+
+/**
+ *  @brief  Type-punned function pointer computing the dot product of two sparse vectors, summing the products
+ *          of the weights of their common indices, and counting those indices on the way.
+ *
+ *  @param[in] a Pointer to the strictly increasing indices of the first vector.
+ *  @param[in] b Pointer to the strictly increasing indices of the second vector.
+ *  @param[in] a_weights Pointer to the `a_length` weights of the first vector.
+ *  @param[in] b_weights Pointer to the `b_length` weights of the second vector.
+ *  @param[in] a_length Number of indices in the first vector.
+ *  @param[in] b_length Number of indices in the second vector.
+ *  @param[out] intersection Output for the size of the intersection.
+ *  @param[out] product Output for the single-precision dot product.
+ */
+typedef void (*simsimd_sparse_dot_punned_t)(simsimd_u32_t const* a, simsimd_u32_t const* b, void const* a_weights,
+                                            void const* b_weights, simsimd_size_t a_length, simsimd_size_t b_length,
+                                            simsimd_size_t* intersection, simsimd_f32_t* product);
+
+/**
+ *  @brief  Type-punned function pointer converting a `f32` vector into another datatype.
+ *
+ *  @param[in] x Pointer to the `f32` input vector.
+ *  @param[in] n Number of scalars in the input vector.
+ *  @param[in] scale Step of the `i8` quantization, so that `x[i] ~ y[i] * scale`, ignored for other outputs.
+ *  @param[out] y Pointer to the output vector, with `n` scalars, or `n / 8` bytes, rounded up, for `b8`.
+ */
+typedef void (*simsimd_convert_punned_t)(simsimd_f32_t const* x, simsimd_size_t n, simsimd_f32_t scale, void* y);
+
+/**
+ *  @brief  Type-punned function pointer computing the maximum absolute value of a `f32` vector,
+ *          to derive the step of its symmetric quantization.
+ */
+typedef simsimd_f32_t (*simsimd_absmax_punned_t)(simsimd_f32_t const* x, simsimd_size_t n);
+
+/**
+ *  @brief  Type-punned function pointer computing all pairwise distances between two collections
+ *          of equidistant rows into a matrix at once, like the tile-based kernels do.
+ *
+ *  @param[in] a Pointer to the first row of the first collection.
+ *  @param[in] a_count Number of rows in the first collection.
+ *  @param[in] a_stride Distance between the starts of consecutive rows of `a` in bytes.
+ *  @param[in] b Pointer to the first row of the second collection.
+ *  @param[in] b_count Number of rows in the second collection.
+ *  @param[in] b_stride Distance between the starts of consecutive rows of `b` in bytes.
+ *  @param[in] dimensions Number of scalars in every vector.
+ *  @param[out] results Output matrix with `a_count` rows and `b_count` columns.
+ *  @param[in] results_stride Distance between the starts of consecutive rows of `results` in bytes.
+ */
+typedef void (*simsimd_matrix_punned_t)(void const* a, simsimd_size_t a_count, simsimd_size_t a_stride,
+                                        void const* b, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                        simsimd_size_t dimensions, simsimd_f32_t* results,
+                                        simsimd_size_t results_stride);
+
+#if SIMSIMD_TARGET_X86 && defined(__linux__) && !defined(_MSC_VER)
+/**
+ *  @brief  Asks Linux for the permission to use the AMX tile data, requesting it only once and caching the
+ *          outcome for later calls. Linux only allocates the 8 KB of tile data state for processes that ask
+ *          for it with `arch_prctl`, and kills the others with SIGILL on the first tile instruction. The
+ *          request is process-wide and idempotent, so concurrent first calls may both issue it harmlessly.
+ *          It fails on kernels without AMX support, which then shouldn't be used either.
+ *          https://docs.kernel.org/arch/x86/xstate.html
+ *  @return One if the tile data can be used, zero otherwise.
+ */
+inline static unsigned simsimd_request_amx_permission(void) {
+    static int state = 0; // Zero if not requested yet, one if granted, and two if denied
+    int known = __atomic_load_n(&state, __ATOMIC_RELAXED);
+    if (!known) {
+        long status, arch_prctl = 158, request_permission = 0x1023, tile_data = 18;
+        __asm__ __volatile__("syscall"
+                             : "=a"(status)
+                             : "a"(arch_prctl), "D"(request_permission), "S"(tile_data)
+                             : "rcx", "r11", "memory");
+        known = status == 0 ? 1 : 2;
+        __atomic_store_n(&state, known, __ATOMIC_RELAXED);
+    }
+    return known == 1;
+}
+#endif
+
 /**
  *  @brief  Function to determine the SIMD capabilities of the current machine at @b runtime.
  *  @return A bitmask of the SIMD capabilities represented as a `simsimd_capability_t` enum value.
@@ -116,11 +328,15 @@ inline static simsimd_capability_t simsimd_capabilities() {
         struct separate_t {
             unsigned eax, ebx, ecx, edx;
         } named;
-    } info1, info7;
+    } info1, info7, info7sub1;
+    unsigned long long xcr0 = 0;
 
 #ifdef _MSC_VER
     __cpuidex(info1.array, 1, 0);
     __cpuidex(info7.array, 7, 0);
+    __cpuidex(info7sub1.array, 7, 1);
+    if (info1.named.ecx & 0x08000000)
+        xcr0 = _xgetbv(0);
 #else
     __asm__ __volatile__("cpuid"
                          : "=a"(info1.named.eax), "=b"(info1.named.ebx), "=c"(info1.named.ecx), "=d"(info1.named.edx)
@@ -128,6 +344,16 @@ inline static simsimd_capability_t simsimd_capabilities() {
     __asm__ __volatile__("cpuid"
                          : "=a"(info7.named.eax), "=b"(info7.named.ebx), "=c"(info7.named.ecx), "=d"(info7.named.edx)
                          : "a"(7), "c"(0));
+    __asm__ __volatile__("cpuid"
+                         : "=a"(info7sub1.named.eax), "=b"(info7sub1.named.ebx), "=c"(info7sub1.named.ecx),
+                           "=d"(info7sub1.named.edx)
+                         : "a"(7), "c"(1));
+    // Reading the extended control register with `xgetbv` is only legal if the OS enabled `xsave`
+    if (info1.named.ecx & 0x08000000) {
+        unsigned xcr0_low, xcr0_high;
+        __asm__ __volatile__("xgetbv" : "=a"(xcr0_low), "=d"(xcr0_high) : "c"(0));
+        xcr0 = ((unsigned long long)xcr0_high << 32) | xcr0_low;
+    }
 #endif
 
     // Check for AVX2 (Function ID 7, EBX register)
@@ -142,20 +368,35 @@ inline static simsimd_capability_t simsimd_capabilities() {
     // Check for AVX512FP16 (Function ID 7, EDX register)
     // https://github.com/llvm/llvm-project/blob/50598f0ff44f3a4e75706f8c53f3380fe7faa896/clang/lib/Headers/cpuid.h#L198C9-L198C23
     unsigned supports_avx512fp16 = (info7.named.edx & 0x00800000) != 0;
-    // Check for VPOPCNTDQ (Function ID 1, ECX register)
+    // Check for VPOPCNTDQ (Function ID 7, ECX register)
     // https://github.com/llvm/llvm-project/blob/50598f0ff44f3a4e75706f8c53f3380fe7faa896/clang/lib/Headers/cpuid.h#L182C30-L182C40
-    unsigned supports_avx512vpopcntdq = (info1.named.ecx & 0x00004000) != 0;
-    // Check for VNNI (Function ID 1, ECX register)
+    unsigned supports_avx512vpopcntdq = (info7.named.ecx & 0x00004000) != 0;
+    // Check for VNNI (Function ID 7, ECX register)
     // https://github.com/llvm/llvm-project/blob/50598f0ff44f3a4e75706f8c53f3380fe7faa896/clang/lib/Headers/cpuid.h#L180
-    unsigned supports_avx512vnni = (info1.named.ecx & 0x00000800) != 0;
-
-    return (simsimd_capability_t)(                                                   //
-        (simsimd_cap_x86_avx2_k * supports_avx2) |                                   //
-        (simsimd_cap_x86_avx512_k * supports_avx512f) |                              //
-        (simsimd_cap_x86_avx2fp16_k * (supports_avx2 && supports_f16c)) |            //
-        (simsimd_cap_x86_avx512fp16_k * (supports_avx512fp16 && supports_avx512f)) | //
-        (simsimd_cap_x86_avx512vpopcntdq_k * (supports_avx512vpopcntdq)) |           //
-        (simsimd_cap_x86_avx512vnni_k * (supports_avx512vnni)) |                     //
+    unsigned supports_avx512vnni = (info7.named.ecx & 0x00000800) != 0;
+    // Check for AVX512_BF16 (Function ID 7, Sub-leaf 1, EAX register)
+    // https://github.com/llvm/llvm-project/blob/50598f0ff44f3a4e75706f8c53f3380fe7faa896/clang/lib/Headers/cpuid.h#L205
+    unsigned supports_avx512bf16 = (info7sub1.named.eax & 0x00000020) != 0;
+    // Check for AMX-TILE, AMX-INT8, and AMX-BF16 (Function ID 7, EDX register), and that the OS saves
+    // the tile configuration and data on context switches (XCR0 bits 17 and 18)
+    unsigned supports_amx = (info7.named.edx & 0x01000000) != 0 && (xcr0 & 0x60000) == 0x60000;
+    unsigned supports_amx_int8 = (info7.named.edx & 0x02000000) != 0;
+    unsigned supports_amx_bf16 = (info7.named.edx & 0x00400000) != 0;
+#if defined(__linux__) && !defined(_MSC_VER)
+    if (supports_amx)
+        supports_amx = simsimd_request_amx_permission();
+#endif
+
+    return (simsimd_capability_t)(                                                                  //
+        (simsimd_cap_x86_avx2_k * supports_avx2) |                                                  //
+        (simsimd_cap_x86_avx512_k * supports_avx512f) |                                             //
+        (simsimd_cap_x86_avx2fp16_k * (supports_avx2 && supports_f16c)) |                           //
+        (simsimd_cap_x86_avx512fp16_k * (supports_avx512fp16 && supports_avx512f)) |                //
+        (simsimd_cap_x86_avx512vpopcntdq_k * (supports_avx512vpopcntdq)) |                          //
+        (simsimd_cap_x86_avx512vnni_k * (supports_avx512vnni)) |                                    //
+        (simsimd_cap_x86_avx512bf16_k * (supports_avx512bf16 && supports_avx512f)) |                //
+        (simsimd_cap_x86_amx_int8_k * (supports_amx && supports_amx_int8 && supports_avx512f)) |    //
+        (simsimd_cap_x86_amx_bf16_k * (supports_amx && supports_amx_bf16 && supports_avx512bf16)) | //
         (simsimd_cap_serial_k));
 
 #endif // SIMSIMD_TARGET_X86
@@ -166,18 +407,32 @@ inline static simsimd_capability_t simsimd_capabilities() {
     unsigned supports_neon = 1;
     unsigned supports_sve = 0;
     unsigned supports_sve2 = 0;
+    unsigned supports_bf16 = 0;
+    unsigned supports_sve_bf16 = 0;
+    unsigned supports_dotprod = 0;
+    unsigned supports_i8mm = 0;
 
 #ifdef __linux__
     unsigned long hwcap = getauxval(AT_HWCAP);
     unsigned long hwcap2 = getauxval(AT_HWCAP2);
     supports_sve = (hwcap & HWCAP_SVE) != 0;
     supports_sve2 = (hwcap2 & HWCAP2_SVE2) != 0;
+    supports_dotprod = (hwcap & HWCAP_ASIMDDP) != 0;
+    // Older kernel headers may lack the BF16 bits, added in Linux 5.10
+    // https://github.com/torvalds/linux/blob/v5.10/arch/arm64/include/uapi/asm/hwcap.h
+    supports_bf16 = (hwcap2 & (1ul << 14)) != 0;     // HWCAP2_BF16
+    supports_sve_bf16 = (hwcap2 & (1ul << 12)) != 0; // HWCAP2_SVEBF16
+    supports_i8mm = (hwcap2 & (1ul << 13)) != 0;     // HWCAP2_I8MM
 #endif
 
-    return (simsimd_capability_t)(                 //
-        (simsimd_cap_arm_neon_k * supports_neon) | //
-        (simsimd_cap_arm_sve_k * supports_sve) |   //
-        (simsimd_cap_arm_sve2_k * supports_sve2) | //
+    return (simsimd_capability_t)(                                           //
+        (simsimd_cap_arm_neon_k * supports_neon) |                           //
+        (simsimd_cap_arm_sve_k * supports_sve) |                             //
+        (simsimd_cap_arm_sve2_k * supports_sve2) |                           //
+        (simsimd_cap_arm_bf16_k * supports_bf16) |                           //
+        (simsimd_cap_arm_sve_bf16_k * (supports_sve && supports_sve_bf16)) | //
+        (simsimd_cap_arm_dotprod_k * supports_dotprod) |                     //
+        (simsimd_cap_arm_i8mm_k * supports_i8mm) |                           //
         (simsimd_cap_serial_k));
 
 #endif // SIMSIMD_TARGET_ARM
@@ -185,10 +440,40 @@ inline static simsimd_capability_t simsimd_capabilities() {
     return simsimd_cap_serial_k;
 }
 
+/**
+ *  @brief  Names a single capability, like the ones reported by the `simsimd_dispatch_capability` lookups,
+ *          matching the suffix of its enum value, like "x86_avx512" for `simsimd_cap_x86_avx512_k`.
+ *  @return A static string, or NULL if the argument isn't one of the known capability bits.
+ */
+inline static char const* simsimd_capability_name(simsimd_capability_t capability) {
+    switch (capability) {
+    case simsimd_cap_serial_k: return "serial";
+    case simsimd_cap_arm_neon_k: return "arm_neon";
+    case simsimd_cap_arm_sve_k: return "arm_sve";
+    case simsimd_cap_arm_sve2_k: return "arm_sve2";
+    case simsimd_cap_arm_bf16_k: return "arm_bf16";
+    case simsimd_cap_arm_sve_bf16_k: return "arm_sve_bf16";
+    case simsimd_cap_arm_dotprod_k: return "arm_dotprod";
+    case simsimd_cap_arm_i8mm_k: return "arm_i8mm";
+    case simsimd_cap_x86_avx2_k: return "x86_avx2";
+    case simsimd_cap_x86_avx512_k: return "x86_avx512";
+    case simsimd_cap_x86_avx2fp16_k: return "x86_avx2fp16";
+    case simsimd_cap_x86_avx512fp16_k: return "x86_avx512fp16";
+    case simsimd_cap_x86_avx512vpopcntdq_k: return "x86_avx512vpopcntdq";
+    case simsimd_cap_x86_avx512vnni_k: return "x86_avx512vnni";
+    case simsimd_cap_x86_avx512bf16_k: return "x86_avx512bf16";
+    case simsimd_cap_x86_amx_int8_k: return "x86_amx_int8";
+    case simsimd_cap_x86_amx_bf16_k: return "x86_amx_bf16";
+    default: return (char const*)0;
+    }
+}
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcast-function-type"
+#if defined(__clang__)
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wcast-function-type"
+#endif
 
 /**
  *  @brief  Determines the best suited metric implementation based on the given datatype,
@@ -219,11 +504,77 @@ inline static void simsimd_find_metric_punned( //
     switch (datatype) {
 
     case simsimd_datatype_unknown_k: break;
-    case simsimd_datatype_f64_k: break;
+
+    // Double-precision floating-point vectors
+    case simsimd_datatype_f64_k:
+
+    #if SIMSIMD_TARGET_ARM_SVE
+        if (viable & simsimd_cap_arm_sve_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_sve_f64_ip, *c = simsimd_cap_arm_sve_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_sve_f64_cos, *c = simsimd_cap_arm_sve_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_sve_f64_l2sq, *c = simsimd_cap_arm_sve_k; return;
+            case simsimd_metric_js_k: *m = (simsimd_metric_punned_t)&simsimd_sve_f64_js, *c = simsimd_cap_arm_sve_k; return;
+            case simsimd_metric_kl_k: *m = (simsimd_metric_punned_t)&simsimd_sve_f64_kl, *c = simsimd_cap_arm_sve_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_neon_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_neon_f64_ip, *c = simsimd_cap_arm_neon_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_neon_f64_cos, *c = simsimd_cap_arm_neon_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_neon_f64_l2sq, *c = simsimd_cap_arm_neon_k; return;
+            case simsimd_metric_js_k: *m = (simsimd_metric_punned_t)&simsimd_neon_f64_js, *c = simsimd_cap_arm_neon_k; return;
+            case simsimd_metric_kl_k: *m = (simsimd_metric_punned_t)&simsimd_neon_f64_kl, *c = simsimd_cap_arm_neon_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f64_ip, *c = simsimd_cap_x86_avx512_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f64_cos, *c = simsimd_cap_x86_avx512_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f64_l2sq, *c = simsimd_cap_x86_avx512_k; return;
+            case simsimd_metric_js_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f64_js, *c = simsimd_cap_x86_avx512_k; return;
+            case simsimd_metric_kl_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f64_kl, *c = simsimd_cap_x86_avx512_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f64_ip, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f64_cos, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f64_l2sq, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_js_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f64_js, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_kl_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f64_kl, *c = simsimd_cap_x86_avx2_k; return;
+            default: break;
+            }
+    #endif
+        if (viable & simsimd_cap_serial_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_serial_f64_ip, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_serial_f64_cos, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_serial_f64_l2sq, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_js_k: *m = (simsimd_metric_punned_t)&simsimd_serial_f64_js, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_kl_k: *m = (simsimd_metric_punned_t)&simsimd_serial_f64_kl, *c = simsimd_cap_serial_k; return;
+            default: break;
+            }
+
+        break;
 
     // Single-precision floating-point vectors
     case simsimd_datatype_f32_k:
 
+    #if SIMSIMD_TARGET_ARM_SVE
+        if (viable & simsimd_cap_arm_sve_k)
+            switch (kind) {
+            case simsimd_metric_js_k: *m = (simsimd_metric_punned_t)&simsimd_sve_f32_js, *c = simsimd_cap_arm_sve_k; return;
+            case simsimd_metric_kl_k: *m = (simsimd_metric_punned_t)&simsimd_sve_f32_kl, *c = simsimd_cap_arm_sve_k; return;
+            default: break;
+            }
+    #endif
     #if SIMSIMD_TARGET_ARM_NEON
         if (viable & simsimd_cap_arm_neon_k)
             switch (kind) {
@@ -245,6 +596,17 @@ inline static void simsimd_find_metric_punned( //
             case simsimd_metric_kl_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f32_kl, *c = simsimd_cap_x86_avx512_k; return;
             default: break;
             }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f32_ip, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f32_cos, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f32_l2sq, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_js_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f32_js, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_kl_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f32_kl, *c = simsimd_cap_x86_avx2_k; return;
+            default: break;
+            }
     #endif
         if (viable & simsimd_cap_serial_k)
             switch (kind) {
@@ -267,6 +629,8 @@ inline static void simsimd_find_metric_punned( //
             case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_sve_f16_ip, *c = simsimd_cap_arm_sve_k; return;
             case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_sve_f16_cos, *c = simsimd_cap_arm_sve_k; return;
             case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_sve_f16_l2sq, *c = simsimd_cap_arm_sve_k; return;
+            case simsimd_metric_js_k: *m = (simsimd_metric_punned_t)&simsimd_sve_f16_js, *c = simsimd_cap_arm_sve_k; return;
+            case simsimd_metric_kl_k: *m = (simsimd_metric_punned_t)&simsimd_sve_f16_kl, *c = simsimd_cap_arm_sve_k; return;
             default: break;
             }
     #endif
@@ -287,8 +651,12 @@ inline static void simsimd_find_metric_punned( //
             case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f16_ip, *c = simsimd_cap_x86_avx512fp16_k; return;
             case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f16_cos, *c = simsimd_cap_x86_avx512fp16_k; return;
             case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f16_l2sq, *c = simsimd_cap_x86_avx512fp16_k; return;
-            case simsimd_metric_js_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f16_js, *c = simsimd_cap_x86_avx512fp16_k; return;
-            case simsimd_metric_kl_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f16_kl, *c = simsimd_cap_x86_avx512fp16_k; return;
+            default: break;
+            }
+        if (viable & simsimd_cap_x86_avx512_k)
+            switch (kind) {
+            case simsimd_metric_js_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f16_js, *c = simsimd_cap_x86_avx512_k; return;
+            case simsimd_metric_kl_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f16_kl, *c = simsimd_cap_x86_avx512_k; return;
             default: break;
             }
     #endif
@@ -316,9 +684,75 @@ inline static void simsimd_find_metric_punned( //
         
         break;
 
+    // Brain floating-point vectors
+    case simsimd_datatype_bf16_k:
+
+    #if SIMSIMD_TARGET_ARM_SVE
+        if (viable & simsimd_cap_arm_sve_bf16_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_sve_bf16_ip, *c = simsimd_cap_arm_sve_bf16_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_sve_bf16_cos, *c = simsimd_cap_arm_sve_bf16_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_sve_bf16_l2sq, *c = simsimd_cap_arm_sve_bf16_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_bf16_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_neon_bf16_ip, *c = simsimd_cap_arm_bf16_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_neon_bf16_cos, *c = simsimd_cap_arm_bf16_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_neon_bf16_l2sq, *c = simsimd_cap_arm_bf16_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512bf16_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_bf16_ip, *c = simsimd_cap_x86_avx512bf16_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_bf16_cos, *c = simsimd_cap_x86_avx512bf16_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_bf16_l2sq, *c = simsimd_cap_x86_avx512bf16_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_bf16_ip, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_bf16_cos, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_bf16_l2sq, *c = simsimd_cap_x86_avx2_k; return;
+            default: break;
+            }
+    #endif
+
+        if (viable & simsimd_cap_serial_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_serial_bf16_ip, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_serial_bf16_cos, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_serial_bf16_l2sq, *c = simsimd_cap_serial_k; return;
+            default: break;
+            }
+
+        break;
+
     // Single-byte integer vectors
     case simsimd_datatype_i8_k:
+    #if SIMSIMD_TARGET_ARM_SVE
+        if (viable & simsimd_cap_arm_sve_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_sve_i8_ip, *c = simsimd_cap_arm_sve_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_sve_i8_cos, *c = simsimd_cap_arm_sve_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_sve_i8_l2sq, *c = simsimd_cap_arm_sve_k; return;
+            default: break;
+            }
+    #endif
     #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_dotprod_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_dotprod_i8_ip, *c = simsimd_cap_arm_dotprod_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_dotprod_i8_cos, *c = simsimd_cap_arm_dotprod_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_dotprod_i8_l2sq, *c = simsimd_cap_arm_dotprod_k; return;
+            default: break;
+            }
         if (viable & simsimd_cap_arm_neon_k)
             switch (kind) {
             case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_neon_i8_ip, *c = simsimd_cap_arm_neon_k; return;
@@ -356,6 +790,86 @@ inline static void simsimd_find_metric_punned( //
         
         break;
 
+    // Single-byte unsigned integer vectors
+    case simsimd_datatype_u8_k:
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_dotprod_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_dotprod_u8_ip, *c = simsimd_cap_arm_dotprod_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_dotprod_u8_cos, *c = simsimd_cap_arm_dotprod_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_dotprod_u8_l2sq, *c = simsimd_cap_arm_dotprod_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512vnni_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_u8_ip, *c = simsimd_cap_x86_avx512vnni_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_u8_cos, *c = simsimd_cap_x86_avx512vnni_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_u8_l2sq, *c = simsimd_cap_x86_avx512vnni_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_u8_ip, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_u8_cos, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_u8_l2sq, *c = simsimd_cap_x86_avx2_k; return;
+            default: break;
+            }
+    #endif
+
+        if (viable & simsimd_cap_serial_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_serial_u8_ip, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_serial_u8_cos, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_serial_u8_l2sq, *c = simsimd_cap_serial_k; return;
+            default: break;
+            }
+
+        break;
+
+    // Pairs of 4-bit integers packed into single bytes
+    case simsimd_datatype_i4x2_k:
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_dotprod_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_dotprod_i4x2_ip, *c = simsimd_cap_arm_dotprod_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_dotprod_i4x2_cos, *c = simsimd_cap_arm_dotprod_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_dotprod_i4x2_l2sq, *c = simsimd_cap_arm_dotprod_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512vnni_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_i4x2_ip, *c = simsimd_cap_x86_avx512vnni_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_i4x2_cos, *c = simsimd_cap_x86_avx512vnni_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_i4x2_l2sq, *c = simsimd_cap_x86_avx512vnni_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_i4x2_ip, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_i4x2_cos, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_i4x2_l2sq, *c = simsimd_cap_x86_avx2_k; return;
+            default: break;
+            }
+    #endif
+
+        if (viable & simsimd_cap_serial_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_serial_i4x2_ip, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_serial_i4x2_cos, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_serial_i4x2_l2sq, *c = simsimd_cap_serial_k; return;
+            default: break;
+            }
+
+        break;
+
     // Binary vectors
     case simsimd_datatype_b8_k:
 
@@ -383,6 +897,14 @@ inline static void simsimd_find_metric_punned( //
             default: break;
             }
     #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k)
+            switch (kind) {
+            case simsimd_metric_hamming_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_b8_hamming, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_jaccard_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_b8_jaccard, *c = simsimd_cap_x86_avx2_k; return;
+            default: break;
+            }
+    #endif
 
         if (viable & simsimd_cap_serial_k)
             switch (kind) {
@@ -390,35 +912,2853 @@ inline static void simsimd_find_metric_punned( //
             case simsimd_metric_jaccard_k: *m = (simsimd_metric_punned_t)&simsimd_serial_b8_jaccard, *c = simsimd_cap_serial_k; return;
             default: break;
             }
-        
+
+        break;
+
+    // Product-quantization codes
+    case simsimd_datatype_pq8_k:
+
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k)
+            switch (kind) {
+            case simsimd_metric_adc_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_pq8_adc, *c = simsimd_cap_x86_avx512_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k)
+            switch (kind) {
+            case simsimd_metric_adc_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_pq8_adc, *c = simsimd_cap_x86_avx2_k; return;
+            default: break;
+            }
+    #endif
+
+        if (viable & simsimd_cap_serial_k)
+            switch (kind) {
+            case simsimd_metric_adc_k: *m = (simsimd_metric_punned_t)&simsimd_serial_pq8_adc, *c = simsimd_cap_serial_k; return;
+            default: break;
+            }
+
         break;
     }
     // clang-format on
 }
 
-#pragma clang diagnostic pop
-#pragma GCC diagnostic pop
-
 /**
- *  @brief  Selects the most suitable metric implementation based on the given metric kind, datatype,
- *          and allowed capabilities. @b Don't call too often and prefer caching the `simsimd_capabilities()`.
+ *  @brief  Determines the best suited one-to-many batch implementation based on the given datatype,
+ *          supported and allowed by hardware capabilities. Not every metric has a dedicated batch
+ *          kernel, so the output may be empty, in which case `simsimd_one_to_many` and
+ *          `simsimd_many_to_many` fall back to the single-pair metric.
  *
  *  @param kind The kind of metric to be evaluated.
  *  @param datatype The data type for which the metric needs to be evaluated.
+ *  @param supported The hardware capabilities supported by the CPU.
  *  @param allowed The hardware capabilities allowed for use.
- *  @return A function pointer to the selected metric implementation.
+ *  @param batch_output Output variable for the selected batch function.
+ *  @param capability_output Output variable for the utilized hardware capabilities.
  */
-inline static simsimd_metric_punned_t simsimd_metric_punned( //
-    simsimd_metric_kind_t kind,                              //
-    simsimd_datatype_t datatype,                             //
-    simsimd_capability_t allowed) {
+inline static void simsimd_find_batch_punned( //
+    simsimd_metric_kind_t kind,               //
+    simsimd_datatype_t datatype,              //
+    simsimd_capability_t supported,           //
+    simsimd_capability_t allowed,             //
+    simsimd_batch_punned_t* batch_output,     //
+    simsimd_capability_t* capability_output) {
 
-    simsimd_metric_punned_t result = 0;
-    simsimd_capability_t c = simsimd_cap_serial_k;
-    simsimd_capability_t supported = simsimd_capabilities();
-    simsimd_find_metric_punned(kind, datatype, supported, allowed, &result, &c);
-    return result;
-}
+    simsimd_batch_punned_t* m = batch_output;
+    simsimd_capability_t* c = capability_output;
+    simsimd_capability_t viable = (simsimd_capability_t)(supported & allowed);
+    *m = (simsimd_batch_punned_t)0;
+    *c = (simsimd_capability_t)0;
+
+    // clang-format off
+    switch (datatype) {
+
+    // Single-precision floating-point vectors
+    case simsimd_datatype_f32_k:
+
+    #if SIMSIMD_TARGET_ARM_SVE
+        if (viable & simsimd_cap_arm_sve_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_batch_punned_t)&simsimd_sve_f32_ip_batch, *c = simsimd_cap_arm_sve_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_batch_punned_t)&simsimd_sve_f32_cos_batch, *c = simsimd_cap_arm_sve_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_batch_punned_t)&simsimd_sve_f32_l2sq_batch, *c = simsimd_cap_arm_sve_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_neon_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_batch_punned_t)&simsimd_neon_f32_ip_batch, *c = simsimd_cap_arm_neon_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_batch_punned_t)&simsimd_neon_f32_cos_batch, *c = simsimd_cap_arm_neon_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_batch_punned_t)&simsimd_neon_f32_l2sq_batch, *c = simsimd_cap_arm_neon_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_batch_punned_t)&simsimd_avx512_f32_ip_batch, *c = simsimd_cap_x86_avx512_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_batch_punned_t)&simsimd_avx512_f32_cos_batch, *c = simsimd_cap_x86_avx512_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_batch_punned_t)&simsimd_avx512_f32_l2sq_batch, *c = simsimd_cap_x86_avx512_k; return;
+            default: break;
+            }
+    #endif
+        break;
+
+    // Binary vectors
+    case simsimd_datatype_b8_k:
+
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_neon_k)
+            switch (kind) {
+            case simsimd_metric_hamming_k: *m = (simsimd_batch_punned_t)&simsimd_neon_b8_hamming_batch, *c = simsimd_cap_arm_neon_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512vpopcntdq_k)
+            switch (kind) {
+            case simsimd_metric_hamming_k: *m = (simsimd_batch_punned_t)&simsimd_avx512_b8_hamming_batch, *c = simsimd_cap_x86_avx512vpopcntdq_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k)
+            switch (kind) {
+            case simsimd_metric_hamming_k: *m = (simsimd_batch_punned_t)&simsimd_avx2_b8_hamming_batch, *c = simsimd_cap_x86_avx2_k; return;
+            default: break;
+            }
+    #endif
+
+        if (viable & simsimd_cap_serial_k)
+            switch (kind) {
+            case simsimd_metric_hamming_k: *m = (simsimd_batch_punned_t)&simsimd_serial_b8_hamming_batch, *c = simsimd_cap_serial_k; return;
+            default: break;
+            }
+
+        break;
+
+    default: break;
+    }
+    // clang-format on
+}
+
+/**
+ *  @brief  Determines the best suited one-to-many batch implementation with early termination, based
+ *          on the given datatype, supported and allowed by hardware capabilities. Only the metrics,
+ *          that grow monotonically with every processed dimension, like the Hamming distance,
+ *          can be terminated early, so the output may be empty for others.
+ *
+ *  @param kind The kind of metric to be evaluated.
+ *  @param datatype The data type for which the metric needs to be evaluated.
+ *  @param supported The hardware capabilities supported by the CPU.
+ *  @param allowed The hardware capabilities allowed for use.
+ *  @param batch_output Output variable for the selected batch function.
+ *  @param capability_output Output variable for the utilized hardware capabilities.
+ */
+inline static void simsimd_find_bounded_batch_punned( //
+    simsimd_metric_kind_t kind,                       //
+    simsimd_datatype_t datatype,                      //
+    simsimd_capability_t supported,                   //
+    simsimd_capability_t allowed,                     //
+    simsimd_bounded_batch_punned_t* batch_output,     //
+    simsimd_capability_t* capability_output) {
+
+    simsimd_bounded_batch_punned_t* m = batch_output;
+    simsimd_capability_t* c = capability_output;
+    simsimd_capability_t viable = (simsimd_capability_t)(supported & allowed);
+    *m = (simsimd_bounded_batch_punned_t)0;
+    *c = (simsimd_capability_t)0;
+
+    // clang-format off
+    switch (datatype) {
+
+    // Binary vectors
+    case simsimd_datatype_b8_k:
+
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_neon_k)
+            switch (kind) {
+            case simsimd_metric_hamming_k: *m = (simsimd_bounded_batch_punned_t)&simsimd_neon_b8_hamming_bounded, *c = simsimd_cap_arm_neon_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512vpopcntdq_k)
+            switch (kind) {
+            case simsimd_metric_hamming_k: *m = (simsimd_bounded_batch_punned_t)&simsimd_avx512_b8_hamming_bounded, *c = simsimd_cap_x86_avx512vpopcntdq_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k)
+            switch (kind) {
+            case simsimd_metric_hamming_k: *m = (simsimd_bounded_batch_punned_t)&simsimd_avx2_b8_hamming_bounded, *c = simsimd_cap_x86_avx2_k; return;
+            default: break;
+            }
+    #endif
+
+        if (viable & simsimd_cap_serial_k)
+            switch (kind) {
+            case simsimd_metric_hamming_k: *m = (simsimd_bounded_batch_punned_t)&simsimd_serial_b8_hamming_bounded, *c = simsimd_cap_serial_k; return;
+            default: break;
+            }
+
+        break;
+
+    default: break;
+    }
+    // clang-format on
+}
+
+/**
+ *  @brief  Determines the best suited mixed-precision metric implementation, comparing vectors of two
+ *          different datatypes, like an `f32` query against an `i8` or `f16` database row. Only the
+ *          symmetric spatial metrics are supported, so the callers may swap the arguments to match
+ *          one of the available orders: `f32` and `f16`, `f32` and `i8`, `f16` and `i8`.
+ *
+ *  @param kind The kind of metric to be evaluated.
+ *  @param first The data type of the first argument of the metric.
+ *  @param second The data type of the second argument of the metric.
+ *  @param supported The hardware capabilities supported by the CPU.
+ *  @param allowed The hardware capabilities allowed for use.
+ *  @param metric_output Output variable for the selected similarity function.
+ *  @param capability_output Output variable for the utilized hardware capabilities.
+ */
+inline static void simsimd_find_mixed_metric_punned( //
+    simsimd_metric_kind_t kind,                      //
+    simsimd_datatype_t first,                        //
+    simsimd_datatype_t second,                       //
+    simsimd_capability_t supported,                  //
+    simsimd_capability_t allowed,                    //
+    simsimd_metric_punned_t* metric_output,          //
+    simsimd_capability_t* capability_output) {
+
+    simsimd_metric_punned_t* m = metric_output;
+    simsimd_capability_t* c = capability_output;
+    simsimd_capability_t viable = (simsimd_capability_t)(supported & allowed);
+    *m = (simsimd_metric_punned_t)0;
+    *c = (simsimd_capability_t)0;
+
+    // clang-format off
+    // Single-precision queries against half-precision vectors
+    if (first == simsimd_datatype_f32_k && second == simsimd_datatype_f16_k) {
+
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_neon_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_neon_f32f16_ip, *c = simsimd_cap_arm_neon_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_neon_f32f16_cos, *c = simsimd_cap_arm_neon_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_neon_f32f16_l2sq, *c = simsimd_cap_arm_neon_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f32f16_ip, *c = simsimd_cap_x86_avx512_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f32f16_cos, *c = simsimd_cap_x86_avx512_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f32f16_l2sq, *c = simsimd_cap_x86_avx512_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f32f16_ip, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f32f16_cos, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f32f16_l2sq, *c = simsimd_cap_x86_avx2_k; return;
+            default: break;
+            }
+    #endif
+
+        if (viable & simsimd_cap_serial_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_serial_f32f16_ip, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_serial_f32f16_cos, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_serial_f32f16_l2sq, *c = simsimd_cap_serial_k; return;
+            default: break;
+            }
+
+        return;
+    }
+
+    // Single-precision queries against 8-bit integer vectors
+    if (first == simsimd_datatype_f32_k && second == simsimd_datatype_i8_k) {
+
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_neon_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_neon_f32i8_ip, *c = simsimd_cap_arm_neon_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_neon_f32i8_cos, *c = simsimd_cap_arm_neon_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_neon_f32i8_l2sq, *c = simsimd_cap_arm_neon_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f32i8_ip, *c = simsimd_cap_x86_avx512_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f32i8_cos, *c = simsimd_cap_x86_avx512_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f32i8_l2sq, *c = simsimd_cap_x86_avx512_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f32i8_ip, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f32i8_cos, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f32i8_l2sq, *c = simsimd_cap_x86_avx2_k; return;
+            default: break;
+            }
+    #endif
+
+        if (viable & simsimd_cap_serial_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_serial_f32i8_ip, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_serial_f32i8_cos, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_serial_f32i8_l2sq, *c = simsimd_cap_serial_k; return;
+            default: break;
+            }
+
+        return;
+    }
+
+    // Half-precision queries against 8-bit integer vectors
+    if (first == simsimd_datatype_f16_k && second == simsimd_datatype_i8_k) {
+
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_neon_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_neon_f16i8_ip, *c = simsimd_cap_arm_neon_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_neon_f16i8_cos, *c = simsimd_cap_arm_neon_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_neon_f16i8_l2sq, *c = simsimd_cap_arm_neon_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f16i8_ip, *c = simsimd_cap_x86_avx512_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f16i8_cos, *c = simsimd_cap_x86_avx512_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_avx512_f16i8_l2sq, *c = simsimd_cap_x86_avx512_k; return;
+            default: break;
+            }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f16i8_ip, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f16i8_cos, *c = simsimd_cap_x86_avx2_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_avx2_f16i8_l2sq, *c = simsimd_cap_x86_avx2_k; return;
+            default: break;
+            }
+    #endif
+
+        if (viable & simsimd_cap_serial_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_metric_punned_t)&simsimd_serial_f16i8_ip, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_metric_punned_t)&simsimd_serial_f16i8_cos, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_metric_punned_t)&simsimd_serial_f16i8_l2sq, *c = simsimd_cap_serial_k; return;
+            default: break;
+            }
+
+        return;
+    }
+    // clang-format on
+}
+
+/**
+ *  @brief  Determines the best suited many-to-many matrix implementation based on the given datatype,
+ *          supported and allowed by hardware capabilities. Those only exist for the tile-based instructions,
+ *          so the output is empty on most machines, where `simsimd_many_to_many` should be used instead.
+ *
+ *  @param kind The kind of metric to be evaluated.
+ *  @param datatype The data type for which the metric needs to be evaluated.
+ *  @param supported The hardware capabilities supported by the CPU.
+ *  @param allowed The hardware capabilities allowed for use.
+ *  @param matrix_output Output variable for the selected matrix function.
+ *  @param capability_output Output variable for the utilized hardware capabilities.
+ */
+inline static void simsimd_find_matrix_punned( //
+    simsimd_metric_kind_t kind,                //
+    simsimd_datatype_t datatype,               //
+    simsimd_capability_t supported,            //
+    simsimd_capability_t allowed,              //
+    simsimd_matrix_punned_t* matrix_output,    //
+    simsimd_capability_t* capability_output) {
+
+    simsimd_matrix_punned_t* m = matrix_output;
+    simsimd_capability_t* c = capability_output;
+    simsimd_capability_t viable = (simsimd_capability_t)(supported & allowed);
+    *m = (simsimd_matrix_punned_t)0;
+    *c = (simsimd_capability_t)0;
+
+    // clang-format off
+    switch (datatype) {
+
+    // Single-byte integer vectors
+    case simsimd_datatype_i8_k:
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_amx_int8_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_matrix_punned_t)&simsimd_amx_i8_ip_matrix, *c = simsimd_cap_x86_amx_int8_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_matrix_punned_t)&simsimd_amx_i8_cos_matrix, *c = simsimd_cap_x86_amx_int8_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_matrix_punned_t)&simsimd_amx_i8_l2sq_matrix, *c = simsimd_cap_x86_amx_int8_k; return;
+            default: break;
+            }
+    #endif
+        break;
+
+    // Brain floating-point vectors
+    case simsimd_datatype_bf16_k:
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_amx_bf16_k)
+            switch (kind) {
+            case simsimd_metric_ip_k: *m = (simsimd_matrix_punned_t)&simsimd_amx_bf16_ip_matrix, *c = simsimd_cap_x86_amx_bf16_k; return;
+            case simsimd_metric_cos_k: *m = (simsimd_matrix_punned_t)&simsimd_amx_bf16_cos_matrix, *c = simsimd_cap_x86_amx_bf16_k; return;
+            case simsimd_metric_l2sq_k: *m = (simsimd_matrix_punned_t)&simsimd_amx_bf16_l2sq_matrix, *c = simsimd_cap_x86_amx_bf16_k; return;
+            default: break;
+            }
+    #endif
+        break;
+
+    default: break;
+    }
+    // clang-format on
+
+    // Only the tile-based backends read those, and they may not be compiled in
+    (void)kind, (void)viable;
+}
+
+/**
+ *  @brief  Determines the best suited fast-scan implementation for 4-bit product-quantized codes,
+ *          supported and allowed by hardware capabilities.
+ *
+ *  @param supported The hardware capabilities supported by the CPU.
+ *  @param allowed The hardware capabilities allowed for use.
+ *  @param scan_output Output variable for the selected scanning function.
+ *  @param capability_output Output variable for the utilized hardware capabilities.
+ */
+inline static void simsimd_find_pq4_scan_punned( //
+    simsimd_capability_t supported,              //
+    simsimd_capability_t allowed,                //
+    simsimd_pq4_scan_punned_t* scan_output,      //
+    simsimd_capability_t* capability_output) {
+
+    simsimd_pq4_scan_punned_t* m = scan_output;
+    simsimd_capability_t* c = capability_output;
+    simsimd_capability_t viable = (simsimd_capability_t)(supported & allowed);
+    *m = (simsimd_pq4_scan_punned_t)0;
+    *c = (simsimd_capability_t)0;
+
+    // clang-format off
+    #if SIMSIMD_TARGET_ARM_NEON
+    if (viable & simsimd_cap_arm_neon_k) { *m = &simsimd_neon_pq4_scan, *c = simsimd_cap_arm_neon_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+    if (viable & simsimd_cap_x86_avx512_k) { *m = &simsimd_avx512_pq4_scan, *c = simsimd_cap_x86_avx512_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+    if (viable & simsimd_cap_x86_avx2_k) { *m = &simsimd_avx2_pq4_scan, *c = simsimd_cap_x86_avx2_k; return; }
+    #endif
+    if (viable & simsimd_cap_serial_k) { *m = &simsimd_serial_pq4_scan, *c = simsimd_cap_serial_k; return; }
+    // clang-format on
+}
+
+/**
+ *  @brief  Determines the best suited sorted-set intersection kernel for sparse vectors,
+ *          supported and allowed by hardware capabilities.
+ *
+ *  @param supported The hardware capabilities supported by the CPU.
+ *  @param allowed The hardware capabilities allowed for use.
+ *  @param intersect_output Output variable for the selected intersection function.
+ *  @param capability_output Output variable for the utilized hardware capabilities.
+ */
+inline static void simsimd_find_sparse_intersect_punned( //
+    simsimd_capability_t supported,                      //
+    simsimd_capability_t allowed,                        //
+    simsimd_sparse_intersect_punned_t* intersect_output, //
+    simsimd_capability_t* capability_output) {
+
+    simsimd_sparse_intersect_punned_t* m = intersect_output;
+    simsimd_capability_t* c = capability_output;
+    simsimd_capability_t viable = (simsimd_capability_t)(supported & allowed);
+    *m = (simsimd_sparse_intersect_punned_t)0;
+    *c = (simsimd_capability_t)0;
+
+    // clang-format off
+    #if SIMSIMD_TARGET_ARM_SVE
+    if (viable & simsimd_cap_arm_sve_k) { *m = &simsimd_sve_u32_intersect, *c = simsimd_cap_arm_sve_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+    if (viable & simsimd_cap_x86_avx512_k) { *m = &simsimd_avx512_u32_intersect, *c = simsimd_cap_x86_avx512_k; return; }
+    #endif
+    if (viable & simsimd_cap_serial_k) { *m = &simsimd_serial_u32_intersect, *c = simsimd_cap_serial_k; return; }
+    // clang-format on
+}
+
+/**
+ *  @brief  Determines the best suited weighted dot product kernel for sparse vectors with the given type
+ *          of weights, supported and allowed by hardware capabilities.
+ *
+ *  @param datatype The data type of the weights, `f32` or `f16`.
+ *  @param supported The hardware capabilities supported by the CPU.
+ *  @param allowed The hardware capabilities allowed for use.
+ *  @param dot_output Output variable for the selected dot product function.
+ *  @param capability_output Output variable for the utilized hardware capabilities.
+ */
+inline static void simsimd_find_sparse_dot_punned( //
+    simsimd_datatype_t datatype,                   //
+    simsimd_capability_t supported,                //
+    simsimd_capability_t allowed,                  //
+    simsimd_sparse_dot_punned_t* dot_output,       //
+    simsimd_capability_t* capability_output) {
+
+    simsimd_sparse_dot_punned_t* m = dot_output;
+    simsimd_capability_t* c = capability_output;
+    simsimd_capability_t viable = (simsimd_capability_t)(supported & allowed);
+    *m = (simsimd_sparse_dot_punned_t)0;
+    *c = (simsimd_capability_t)0;
+
+    // clang-format off
+    switch (datatype) {
+
+    case simsimd_datatype_f32_k:
+    #if SIMSIMD_TARGET_ARM_SVE
+        if (viable & simsimd_cap_arm_sve_k) { *m = &simsimd_sve_f32_spdot, *c = simsimd_cap_arm_sve_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k) { *m = &simsimd_avx512_f32_spdot, *c = simsimd_cap_x86_avx512_k; return; }
+    #endif
+        if (viable & simsimd_cap_serial_k) { *m = &simsimd_serial_f32_spdot, *c = simsimd_cap_serial_k; return; }
+        break;
+
+    case simsimd_datatype_f16_k:
+    #if SIMSIMD_TARGET_ARM_SVE
+        if (viable & simsimd_cap_arm_sve_k) { *m = &simsimd_sve_f16_spdot, *c = simsimd_cap_arm_sve_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k) { *m = &simsimd_avx512_f16_spdot, *c = simsimd_cap_x86_avx512_k; return; }
+    #endif
+        if (viable & simsimd_cap_serial_k) { *m = &simsimd_serial_f16_spdot, *c = simsimd_cap_serial_k; return; }
+        break;
+
+    default: break;
+    }
+    // clang-format on
+}
+
+/**
+ *  @brief  Determines the best suited kernel for converting `f32` vectors into the given datatype,
+ *          supported and allowed by hardware capabilities.
+ *
+ *  @param datatype The data type of the outputs: `f16`, `bf16`, `i8`, or `b8`.
+ *  @param supported The hardware capabilities supported by the CPU.
+ *  @param allowed The hardware capabilities allowed for use.
+ *  @param convert_output Output variable for the selected conversion function.
+ *  @param capability_output Output variable for the utilized hardware capabilities.
+ */
+inline static void simsimd_find_convert_punned( //
+    simsimd_datatype_t datatype,                //
+    simsimd_capability_t supported,             //
+    simsimd_capability_t allowed,               //
+    simsimd_convert_punned_t* convert_output,   //
+    simsimd_capability_t* capability_output) {
+
+    simsimd_convert_punned_t* m = convert_output;
+    simsimd_capability_t* c = capability_output;
+    simsimd_capability_t viable = (simsimd_capability_t)(supported & allowed);
+    *m = (simsimd_convert_punned_t)0;
+    *c = (simsimd_capability_t)0;
+
+    // clang-format off
+    switch (datatype) {
+
+    case simsimd_datatype_f16_k:
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_neon_k) { *m = &simsimd_neon_f32_to_f16, *c = simsimd_cap_arm_neon_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k) { *m = &simsimd_avx512_f32_to_f16, *c = simsimd_cap_x86_avx512_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k) { *m = &simsimd_avx2_f32_to_f16, *c = simsimd_cap_x86_avx2_k; return; }
+    #endif
+        if (viable & simsimd_cap_serial_k) { *m = &simsimd_serial_f32_to_f16, *c = simsimd_cap_serial_k; return; }
+        break;
+
+    case simsimd_datatype_bf16_k:
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_neon_k) { *m = &simsimd_neon_f32_to_bf16, *c = simsimd_cap_arm_neon_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k) { *m = &simsimd_avx512_f32_to_bf16, *c = simsimd_cap_x86_avx512_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k) { *m = &simsimd_avx2_f32_to_bf16, *c = simsimd_cap_x86_avx2_k; return; }
+    #endif
+        if (viable & simsimd_cap_serial_k) { *m = &simsimd_serial_f32_to_bf16, *c = simsimd_cap_serial_k; return; }
+        break;
+
+    case simsimd_datatype_i8_k:
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_neon_k) { *m = &simsimd_neon_f32_to_i8, *c = simsimd_cap_arm_neon_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k) { *m = &simsimd_avx512_f32_to_i8, *c = simsimd_cap_x86_avx512_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k) { *m = &simsimd_avx2_f32_to_i8, *c = simsimd_cap_x86_avx2_k; return; }
+    #endif
+        if (viable & simsimd_cap_serial_k) { *m = &simsimd_serial_f32_to_i8, *c = simsimd_cap_serial_k; return; }
+        break;
+
+    case simsimd_datatype_b8_k:
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_neon_k) { *m = &simsimd_neon_f32_to_b8, *c = simsimd_cap_arm_neon_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k) { *m = &simsimd_avx512_f32_to_b8, *c = simsimd_cap_x86_avx512_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k) { *m = &simsimd_avx2_f32_to_b8, *c = simsimd_cap_x86_avx2_k; return; }
+    #endif
+        if (viable & simsimd_cap_serial_k) { *m = &simsimd_serial_f32_to_b8, *c = simsimd_cap_serial_k; return; }
+        break;
+
+    default: break;
+    }
+    // clang-format on
+}
+
+/**
+ *  @brief  Determines the best suited kernel for the maximum absolute value of `f32` vectors,
+ *          supported and allowed by hardware capabilities.
+ *
+ *  @param supported The hardware capabilities supported by the CPU.
+ *  @param allowed The hardware capabilities allowed for use.
+ *  @param absmax_output Output variable for the selected reduction function.
+ *  @param capability_output Output variable for the utilized hardware capabilities.
+ */
+inline static void simsimd_find_absmax_punned( //
+    simsimd_capability_t supported,            //
+    simsimd_capability_t allowed,              //
+    simsimd_absmax_punned_t* absmax_output,    //
+    simsimd_capability_t* capability_output) {
+
+    simsimd_absmax_punned_t* m = absmax_output;
+    simsimd_capability_t* c = capability_output;
+    simsimd_capability_t viable = (simsimd_capability_t)(supported & allowed);
+    *m = (simsimd_absmax_punned_t)0;
+    *c = (simsimd_capability_t)0;
+
+    // clang-format off
+    #if SIMSIMD_TARGET_ARM_NEON
+    if (viable & simsimd_cap_arm_neon_k) { *m = &simsimd_neon_f32_absmax, *c = simsimd_cap_arm_neon_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+    if (viable & simsimd_cap_x86_avx512_k) { *m = &simsimd_avx512_f32_absmax, *c = simsimd_cap_x86_avx512_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+    if (viable & simsimd_cap_x86_avx2_k) { *m = &simsimd_avx2_f32_absmax, *c = simsimd_cap_x86_avx2_k; return; }
+    #endif
+    if (viable & simsimd_cap_serial_k) { *m = &simsimd_serial_f32_absmax, *c = simsimd_cap_serial_k; return; }
+    // clang-format on
+}
+
+/**
+ *  @brief  Determines the best suited kernel for the mixture terms of the Jensen–Shannon divergence,
+ *          `sum((a + b) * log2((a + b) / 2))` in bits, which are the only part of it that has to be
+ *          recomputed for every pair, when the entropies of the distributions are known in advance.
+ *
+ *  @param datatype The data type of both distributions.
+ *  @param supported The hardware capabilities supported by the CPU.
+ *  @param allowed The hardware capabilities allowed for use.
+ *  @param metric_output Output variable for the selected mixture function.
+ *  @param capability_output Output variable for the utilized hardware capabilities.
+ *  @see `simsimd_js_cached`, that combines the mixture with the entropies.
+ */
+inline static void simsimd_find_js_mixture_punned(   //
+    simsimd_datatype_t datatype,                     //
+    simsimd_capability_t supported,                  //
+    simsimd_capability_t allowed,                    //
+    simsimd_divergence_term_punned_t* metric_output, //
+    simsimd_capability_t* capability_output) {
+
+    simsimd_divergence_term_punned_t* m = metric_output;
+    simsimd_capability_t* c = capability_output;
+    simsimd_capability_t viable = (simsimd_capability_t)(supported & allowed);
+    *m = (simsimd_divergence_term_punned_t)0;
+    *c = (simsimd_capability_t)0;
+
+    // clang-format off
+    switch (datatype) {
+    case simsimd_datatype_f64_k:
+    #if SIMSIMD_TARGET_ARM_SVE
+        if (viable & simsimd_cap_arm_sve_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_sve_f64_js_mixture, *c = simsimd_cap_arm_sve_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_neon_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_neon_f64_js_mixture, *c = simsimd_cap_arm_neon_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_avx512_f64_js_mixture, *c = simsimd_cap_x86_avx512_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_avx2_f64_js_mixture, *c = simsimd_cap_x86_avx2_k; return; }
+    #endif
+        if (viable & simsimd_cap_serial_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_serial_f64_js_mixture, *c = simsimd_cap_serial_k; return; }
+        break;
+    case simsimd_datatype_f32_k:
+    #if SIMSIMD_TARGET_ARM_SVE
+        if (viable & simsimd_cap_arm_sve_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_sve_f32_js_mixture, *c = simsimd_cap_arm_sve_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_neon_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_neon_f32_js_mixture, *c = simsimd_cap_arm_neon_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_avx512_f32_js_mixture, *c = simsimd_cap_x86_avx512_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_avx2_f32_js_mixture, *c = simsimd_cap_x86_avx2_k; return; }
+    #endif
+        if (viable & simsimd_cap_serial_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_serial_f32_js_mixture, *c = simsimd_cap_serial_k; return; }
+        break;
+    case simsimd_datatype_f16_k:
+    #if SIMSIMD_TARGET_ARM_SVE
+        if (viable & simsimd_cap_arm_sve_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_sve_f16_js_mixture, *c = simsimd_cap_arm_sve_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_neon_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_neon_f16_js_mixture, *c = simsimd_cap_arm_neon_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_avx512_f16_js_mixture, *c = simsimd_cap_x86_avx512_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2fp16_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_avx2_f16_js_mixture, *c = simsimd_cap_x86_avx2fp16_k; return; }
+    #endif
+        if (viable & simsimd_cap_serial_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_serial_f16_js_mixture, *c = simsimd_cap_serial_k; return; }
+        break;
+    default: break;
+    }
+    // clang-format on
+}
+
+/**
+ *  @brief  Determines the best suited kernel for the cross-entropy terms of the Kullback-Leibler divergence,
+ *          `-sum(a * log2(b + epsilon))` in bits, which take the cached logarithms of the second distribution
+ *          as the first argument, called as `cross_entropy(b_logs, a, n)`. The logarithms are stored in `f64`
+ *          for `f64` distributions, and in `f32` otherwise.
+ *
+ *  @param datatype The data type of the distributions.
+ *  @param supported The hardware capabilities supported by the CPU.
+ *  @param allowed The hardware capabilities allowed for use.
+ *  @param metric_output Output variable for the selected cross-entropy function.
+ *  @param capability_output Output variable for the utilized hardware capabilities.
+ *  @see `simsimd_kl_cached`, that combines the cross-entropy with the entropy.
+ */
+inline static void simsimd_find_cross_entropy_punned( //
+    simsimd_datatype_t datatype,                      //
+    simsimd_capability_t supported,                   //
+    simsimd_capability_t allowed,                     //
+    simsimd_divergence_term_punned_t* metric_output,  //
+    simsimd_capability_t* capability_output) {
+
+    simsimd_divergence_term_punned_t* m = metric_output;
+    simsimd_capability_t* c = capability_output;
+    simsimd_capability_t viable = (simsimd_capability_t)(supported & allowed);
+    *m = (simsimd_divergence_term_punned_t)0;
+    *c = (simsimd_capability_t)0;
+
+    // clang-format off
+    switch (datatype) {
+    case simsimd_datatype_f64_k:
+    #if SIMSIMD_TARGET_ARM_SVE
+        if (viable & simsimd_cap_arm_sve_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_sve_f64_cross_entropy, *c = simsimd_cap_arm_sve_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_neon_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_neon_f64_cross_entropy, *c = simsimd_cap_arm_neon_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_avx512_f64_cross_entropy, *c = simsimd_cap_x86_avx512_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_avx2_f64_cross_entropy, *c = simsimd_cap_x86_avx2_k; return; }
+    #endif
+        if (viable & simsimd_cap_serial_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_serial_f64_cross_entropy, *c = simsimd_cap_serial_k; return; }
+        break;
+    case simsimd_datatype_f32_k:
+    #if SIMSIMD_TARGET_ARM_SVE
+        if (viable & simsimd_cap_arm_sve_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_sve_f32_cross_entropy, *c = simsimd_cap_arm_sve_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_neon_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_neon_f32_cross_entropy, *c = simsimd_cap_arm_neon_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_avx512_f32_cross_entropy, *c = simsimd_cap_x86_avx512_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_avx2_f32_cross_entropy, *c = simsimd_cap_x86_avx2_k; return; }
+    #endif
+        if (viable & simsimd_cap_serial_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_serial_f32_cross_entropy, *c = simsimd_cap_serial_k; return; }
+        break;
+    case simsimd_datatype_f16_k:
+    #if SIMSIMD_TARGET_ARM_SVE
+        if (viable & simsimd_cap_arm_sve_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_sve_f16_cross_entropy, *c = simsimd_cap_arm_sve_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_ARM_NEON
+        if (viable & simsimd_cap_arm_neon_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_neon_f16_cross_entropy, *c = simsimd_cap_arm_neon_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX512
+        if (viable & simsimd_cap_x86_avx512_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_avx512_f16_cross_entropy, *c = simsimd_cap_x86_avx512_k; return; }
+    #endif
+    #if SIMSIMD_TARGET_X86_AVX2
+        if (viable & simsimd_cap_x86_avx2fp16_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_avx2_f16_cross_entropy, *c = simsimd_cap_x86_avx2fp16_k; return; }
+    #endif
+        if (viable & simsimd_cap_serial_k) { *m = (simsimd_divergence_term_punned_t)&simsimd_serial_f16_cross_entropy, *c = simsimd_cap_serial_k; return; }
+        break;
+    default: break;
+    }
+    // clang-format on
+}
+
+/**
+ *  @brief  Number of distinct metric kinds, that the dispatch table has slots for.
+ */
+#define SIMSIMD_DISPATCH_METRICS 8
+
+/**
+ *  @brief  Number of distinct datatypes, that the dispatch table has slots for.
+ */
+#define SIMSIMD_DISPATCH_DATATYPES (simsimd_datatype_pq8_k + 1)
+
+/**
+ *  @brief  Maps the metric kind, which is a character code, into a dense row index of the dispatch table.
+ *  @return Row index, or -1 for unknown metric kinds.
+ */
+inline static int simsimd_metric_kind_index(simsimd_metric_kind_t kind) {
+    switch (kind) {
+    case simsimd_metric_ip_k: return 0;
+    case simsimd_metric_cos_k: return 1;
+    case simsimd_metric_l2sq_k: return 2;
+    case simsimd_metric_hamming_k: return 3;
+    case simsimd_metric_jaccard_k: return 4;
+    case simsimd_metric_kl_k: return 5;
+    case simsimd_metric_js_k: return 6;
+    case simsimd_metric_adc_k: return 7;
+    default: return -1;
+    }
+}
+
+/**
+ *  @brief  Number of the common embedding sizes, that have fixed-dimension kernels: 384, 768, 1024, and 1536.
+ */
+#define SIMSIMD_DISPATCH_DIMENSIONS 4
+
+/**
+ *  @brief  Maps the number of dimensions into a slot of the dispatch table for fixed-dimension kernels.
+ *  @return Slot index, or -1 for dimensions, that only have the generic kernels.
+ */
+inline static int simsimd_fixed_dimensions_index(simsimd_size_t dimensions) {
+    switch (dimensions) {
+    case 384: return 0;
+    case 768: return 1;
+    case 1024: return 2;
+    case 1536: return 3;
+    default: return -1;
+    }
+}
+
+/**
+ *  @brief  Determines the best suited fixed-dimension metric implementation, that has no loop tails and
+ *          ignores the runtime length argument. Only a few metrics, datatypes, and dimensions have such
+ *          kernels, so the output is NULL for others, and the generic kernel has to be used instead.
+ *
+ *  @param kind The kind of metric to be evaluated.
+ *  @param datatype The data type for which the metric needs to be evaluated.
+ *  @param dimensions The number of scalars in every vector.
+ *  @param supported The hardware capabilities supported by the CPU.
+ *  @param allowed The hardware capabilities allowed for use.
+ *  @param metric_output Output variable for the selected metric function.
+ *  @param capability_output Output variable for the utilized hardware capabilities.
+ */
+inline static void simsimd_find_fixed_metric_punned( //
+    simsimd_metric_kind_t kind,                      //
+    simsimd_datatype_t datatype,                     //
+    simsimd_size_t dimensions,                       //
+    simsimd_capability_t supported,                  //
+    simsimd_capability_t allowed,                    //
+    simsimd_metric_punned_t* metric_output,          //
+    simsimd_capability_t* capability_output) {
+
+    simsimd_metric_punned_t* m = metric_output;
+    simsimd_capability_t* c = capability_output;
+    simsimd_capability_t viable = (simsimd_capability_t)(supported & allowed);
+    *m = (simsimd_metric_punned_t)0;
+    *c = (simsimd_capability_t)0;
+
+    // The rows of the tables below follow `simsimd_fixed_dimensions_index`,
+    // and the columns follow the first three rows of `simsimd_metric_kind_index`
+    int const kind_index = simsimd_metric_kind_index(kind);
+    int const dimensions_index = simsimd_fixed_dimensions_index(dimensions);
+    if (kind_index < 0 || kind_index > 2 || dimensions_index < 0)
+        return;
+
+#define SIMSIMD_FIXED_KERNELS(isa, type, dimensions)                                                                   \
+    {(simsimd_metric_punned_t)&simsimd_##isa##_##type##_ip_##dimensions,                                               \
+     (simsimd_metric_punned_t)&simsimd_##isa##_##type##_cos_##dimensions,                                              \
+     (simsimd_metric_punned_t)&simsimd_##isa##_##type##_l2sq_##dimensions}
+#define SIMSIMD_FIXED_TABLE(isa, type)                                                                                 \
+    {SIMSIMD_FIXED_KERNELS(isa, type, 384), SIMSIMD_FIXED_KERNELS(isa, type, 768),                                     \
+     SIMSIMD_FIXED_KERNELS(isa, type, 1024), SIMSIMD_FIXED_KERNELS(isa, type, 1536)}
+
+    switch (datatype) {
+
+    case simsimd_datatype_f32_k: {
+#if SIMSIMD_TARGET_X86_AVX512
+        static simsimd_metric_punned_t const avx512_kernels[SIMSIMD_DISPATCH_DIMENSIONS][3] =
+            SIMSIMD_FIXED_TABLE(avx512, f32);
+        if (viable & simsimd_cap_x86_avx512_k) {
+            *m = avx512_kernels[dimensions_index][kind_index], *c = simsimd_cap_x86_avx512_k;
+            return;
+        }
+#endif
+#if SIMSIMD_TARGET_X86_AVX2
+        static simsimd_metric_punned_t const avx2_kernels[SIMSIMD_DISPATCH_DIMENSIONS][3] =
+            SIMSIMD_FIXED_TABLE(avx2, f32);
+        if (viable & simsimd_cap_x86_avx2_k) {
+            *m = avx2_kernels[dimensions_index][kind_index], *c = simsimd_cap_x86_avx2_k;
+            return;
+        }
+#endif
+        break;
+    }
+
+    // The generic AVX-512 FP16 kernels process twice as many scalars per instruction,
+    // so the fixed-dimension ones, that upcast to `f32`, are only used on older CPUs
+    case simsimd_datatype_f16_k: {
+        if (viable & simsimd_cap_x86_avx512fp16_k)
+            return;
+#if SIMSIMD_TARGET_X86_AVX512
+        static simsimd_metric_punned_t const avx512_kernels[SIMSIMD_DISPATCH_DIMENSIONS][3] =
+            SIMSIMD_FIXED_TABLE(avx512, f16);
+        if (viable & simsimd_cap_x86_avx512_k) {
+            *m = avx512_kernels[dimensions_index][kind_index], *c = simsimd_cap_x86_avx512_k;
+            return;
+        }
+#endif
+#if SIMSIMD_TARGET_X86_AVX2
+        static simsimd_metric_punned_t const avx2_kernels[SIMSIMD_DISPATCH_DIMENSIONS][3] =
+            SIMSIMD_FIXED_TABLE(avx2, f16);
+        if (viable & simsimd_cap_x86_avx2fp16_k) {
+            *m = avx2_kernels[dimensions_index][kind_index], *c = simsimd_cap_x86_avx2fp16_k;
+            return;
+        }
+#endif
+        break;
+    }
+
+    default: break;
+    }
+
+#undef SIMSIMD_FIXED_TABLE
+#undef SIMSIMD_FIXED_KERNELS
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+#pragma GCC diagnostic pop
+
+#ifndef SIMSIMD_DISPATCH_COUNTERS
+/**
+ *  @brief  Enables the per-kernel counters of `simsimd_dispatch_count`, that are no-ops by default.
+ */
+#define SIMSIMD_DISPATCH_COUNTERS 0
+#endif
+
+/**
+ *  @brief  Usage statistics of the kernels of one (metric, datatype) pair, accumulated by the callers
+ *          of `simsimd_dispatch_count`, like the bindings, once per call rather than once per pair.
+ */
+typedef struct simsimd_kernel_counters_t {
+    simsimd_size_t calls;   ///< Number of API calls, each comparing one or more pairs
+    simsimd_size_t vectors; ///< Number of compared pairs of vectors
+    simsimd_size_t bytes;   ///< Number of input bytes, counting every row of the inputs once
+} simsimd_kernel_counters_t;
+
+/**
+ *  @brief  Table of the best metric and batch kernels for every (metric, datatype) pair on this machine,
+ *          so that they can be looked up in constant time, without the dispatch switch or CPUID.
+ */
+typedef struct simsimd_dispatch_table_t {
+    simsimd_capability_t capabilities;
+    simsimd_metric_punned_t metrics[SIMSIMD_DISPATCH_METRICS][SIMSIMD_DISPATCH_DATATYPES];
+    simsimd_batch_punned_t batches[SIMSIMD_DISPATCH_METRICS][SIMSIMD_DISPATCH_DATATYPES];
+    simsimd_bounded_batch_punned_t bounded_batches[SIMSIMD_DISPATCH_METRICS][SIMSIMD_DISPATCH_DATATYPES];
+    simsimd_matrix_punned_t matrices[SIMSIMD_DISPATCH_METRICS][SIMSIMD_DISPATCH_DATATYPES];
+    simsimd_capability_t metric_capabilities[SIMSIMD_DISPATCH_METRICS][SIMSIMD_DISPATCH_DATATYPES];
+    simsimd_metric_punned_t fixed_metrics[SIMSIMD_DISPATCH_METRICS][SIMSIMD_DISPATCH_DATATYPES]
+                                         [SIMSIMD_DISPATCH_DIMENSIONS];
+    simsimd_capability_t fixed_capabilities[SIMSIMD_DISPATCH_METRICS][SIMSIMD_DISPATCH_DATATYPES]
+                                           [SIMSIMD_DISPATCH_DIMENSIONS];
+    simsimd_pq4_scan_punned_t pq4_scan;
+    simsimd_divergence_term_punned_t js_mixtures[SIMSIMD_DISPATCH_DATATYPES];
+    simsimd_divergence_term_punned_t cross_entropies[SIMSIMD_DISPATCH_DATATYPES];
+    simsimd_sparse_intersect_punned_t sparse_intersect;
+    simsimd_sparse_dot_punned_t sparse_dots[SIMSIMD_DISPATCH_DATATYPES];
+    simsimd_convert_punned_t converters[SIMSIMD_DISPATCH_DATATYPES];
+    simsimd_absmax_punned_t absmax;
+} simsimd_dispatch_table_t;
+
+/**
+ *  @brief  Fills the dispatch table with the best kernels for the given capabilities. The shared table,
+ *          returned by `simsimd_dispatch_table`, is never refilled in place, as other threads may be reading
+ *          it, so use `simsimd_dispatch_restrict` to change the capabilities of all the lookups.
+ */
+inline static void simsimd_dispatch_table_init(simsimd_dispatch_table_t* table, simsimd_capability_t capabilities) {
+    static simsimd_metric_kind_t const kinds[SIMSIMD_DISPATCH_METRICS] = {
+        simsimd_metric_ip_k,      simsimd_metric_cos_k, simsimd_metric_l2sq_k, simsimd_metric_hamming_k,
+        simsimd_metric_jaccard_k, simsimd_metric_kl_k,  simsimd_metric_js_k,   simsimd_metric_adc_k,
+    };
+    static simsimd_size_t const fixed_dimensions[SIMSIMD_DISPATCH_DIMENSIONS] = {384, 768, 1024, 1536};
+    simsimd_capability_t scan_capability, intersect_capability, absmax_capability;
+    table->capabilities = capabilities;
+    simsimd_find_pq4_scan_punned(capabilities, simsimd_cap_any_k, &table->pq4_scan, &scan_capability);
+    simsimd_find_sparse_intersect_punned(capabilities, simsimd_cap_any_k, &table->sparse_intersect,
+                                         &intersect_capability);
+    simsimd_find_absmax_punned(capabilities, simsimd_cap_any_k, &table->absmax, &absmax_capability);
+    for (int i = 0; i != SIMSIMD_DISPATCH_METRICS; ++i)
+        for (int j = 0; j != SIMSIMD_DISPATCH_DATATYPES; ++j) {
+            simsimd_capability_t batch_capability;
+            simsimd_find_metric_punned(kinds[i], (simsimd_datatype_t)j, capabilities, simsimd_cap_any_k,
+                                       &table->metrics[i][j], &table->metric_capabilities[i][j]);
+            simsimd_find_batch_punned(kinds[i], (simsimd_datatype_t)j, capabilities, simsimd_cap_any_k,
+                                      &table->batches[i][j], &batch_capability);
+            simsimd_find_bounded_batch_punned(kinds[i], (simsimd_datatype_t)j, capabilities, simsimd_cap_any_k,
+                                              &table->bounded_batches[i][j], &batch_capability);
+            simsimd_find_matrix_punned(kinds[i], (simsimd_datatype_t)j, capabilities, simsimd_cap_any_k,
+                                       &table->matrices[i][j], &batch_capability);
+            for (int k = 0; k != SIMSIMD_DISPATCH_DIMENSIONS; ++k)
+                simsimd_find_fixed_metric_punned(kinds[i], (simsimd_datatype_t)j, fixed_dimensions[k], capabilities,
+                                                 simsimd_cap_any_k, &table->fixed_metrics[i][j][k],
+                                                 &table->fixed_capabilities[i][j][k]);
+        }
+    for (int j = 0; j != SIMSIMD_DISPATCH_DATATYPES; ++j) {
+        simsimd_capability_t mixture_capability, entropy_capability, dot_capability, convert_capability;
+        simsimd_find_js_mixture_punned((simsimd_datatype_t)j, capabilities, simsimd_cap_any_k, &table->js_mixtures[j],
+                                       &mixture_capability);
+        simsimd_find_cross_entropy_punned((simsimd_datatype_t)j, capabilities, simsimd_cap_any_k,
+                                          &table->cross_entropies[j], &entropy_capability);
+        simsimd_find_sparse_dot_punned((simsimd_datatype_t)j, capabilities, simsimd_cap_any_k, &table->sparse_dots[j],
+                                       &dot_capability);
+        simsimd_find_convert_punned((simsimd_datatype_t)j, capabilities, simsimd_cap_any_k, &table->converters[j],
+                                    &convert_capability);
+    }
+}
+
+/**
+ *  @brief  Hints the CPU, that the calling thread is spinning on a flag, handing the pipeline resources over
+ *          to the sibling hyper-thread, that may be the one filling the dispatch table.
+ */
+inline static void simsimd_spin_pause(void) {
+#if defined(_MSC_VER) && SIMSIMD_TARGET_X86
+    _mm_pause();
+#elif defined(_MSC_VER) && SIMSIMD_TARGET_ARM
+    __yield();
+#elif SIMSIMD_TARGET_X86
+    __asm__ __volatile__("pause");
+#elif SIMSIMD_TARGET_ARM
+    __asm__ __volatile__("yield");
+#endif
+}
+
+SIMSIMD_DISPATCH_LINKAGE simsimd_dispatch_table_t** simsimd_dispatch_table_slot(void);
+SIMSIMD_DISPATCH_LINKAGE simsimd_capability_t simsimd_dispatch_restrict(simsimd_capability_t allowed);
+
+#if !SIMSIMD_DYNAMIC_DISPATCH || defined(SIMSIMD_DYNAMIC_DISPATCH_IMPLEMENTATION)
+/**
+ *  @brief  Returns the address of the pointer to the shared dispatch table, filling the default table on
+ *          first use. The first caller claims the state flag with a compare-and-swap and publishes the table
+ *          with a release store, while the concurrent ones wait, so every caller observes a filled table.
+ *          The table belongs to the translation unit, unless compiled with `SIMSIMD_DYNAMIC_DISPATCH`.
+ */
+SIMSIMD_DISPATCH_LINKAGE simsimd_dispatch_table_t** simsimd_dispatch_table_slot(void) {
+    static simsimd_dispatch_table_t table;
+    static simsimd_dispatch_table_t* current = 0;
+    static long state = 0; // Zero if empty, one while being filled, and two when ready
+#if defined(_MSC_VER)
+    if (_InterlockedOr((long volatile*)&state, 0) != 2) {
+        if (_InterlockedCompareExchange((long volatile*)&state, 1, 0) == 0) {
+            simsimd_dispatch_table_init(&table, simsimd_capabilities());
+            _InterlockedExchangePointer((void* volatile*)&current, &table);
+            _InterlockedExchange((long volatile*)&state, 2);
+        } else
+            while (_InterlockedOr((long volatile*)&state, 0) != 2) simsimd_spin_pause();
+    }
+#else
+    if (__atomic_load_n(&state, __ATOMIC_ACQUIRE) != 2) {
+        long expected = 0;
+        if (__atomic_compare_exchange_n(&state, &expected, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+            simsimd_dispatch_table_init(&table, simsimd_capabilities());
+            __atomic_store_n(&current, &table, __ATOMIC_RELEASE);
+            __atomic_store_n(&state, 2, __ATOMIC_RELEASE);
+        } else
+            while (__atomic_load_n(&state, __ATOMIC_ACQUIRE) != 2) simsimd_spin_pause();
+    }
+#endif
+    return &current;
+}
+#endif // !SIMSIMD_DYNAMIC_DISPATCH || SIMSIMD_DYNAMIC_DISPATCH_IMPLEMENTATION
+
+/**
+ *  @brief  Returns the dispatch table, filling it on first use. The table is shared by all callers in the
+ *          translation unit, or the program with `SIMSIMD_DYNAMIC_DISPATCH`, and is immutable once published,
+ *          so it can be read from any number of threads, even while `simsimd_dispatch_restrict` publishes
+ *          a replacement.
+ */
+inline static simsimd_dispatch_table_t const* simsimd_dispatch_table(void) {
+    simsimd_dispatch_table_t** slot = simsimd_dispatch_table_slot();
+#if defined(_MSC_VER)
+    return (simsimd_dispatch_table_t const*)_InterlockedCompareExchangePointer((void* volatile*)slot, 0, 0);
+#else
+    return __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+#endif
+}
+
+/**
+ *  @brief  Looks up the best metric kernel for the given kind and datatype in the dispatch table.
+ *  @return A function pointer to the metric implementation, or NULL if the combination is unsupported.
+ */
+inline static simsimd_metric_punned_t simsimd_dispatch_metric(simsimd_metric_kind_t kind,
+                                                              simsimd_datatype_t datatype) {
+    int index = simsimd_metric_kind_index(kind);
+    if (index < 0 || (unsigned)datatype >= SIMSIMD_DISPATCH_DATATYPES)
+        return (simsimd_metric_punned_t)0;
+    return simsimd_dispatch_table()->metrics[index][datatype];
+}
+
+/**
+ *  @brief  Looks up the best metric kernel for vectors of the given length in the dispatch table, preferring
+ *          the fixed-dimension kernels, that have no loop tails, for the common embedding sizes.
+ *  @return A function pointer to the metric implementation, or NULL if the combination is unsupported.
+ */
+inline static simsimd_metric_punned_t simsimd_dispatch_metric_sized(simsimd_metric_kind_t kind,
+                                                                    simsimd_datatype_t datatype,
+                                                                    simsimd_size_t dimensions) {
+    int index = simsimd_metric_kind_index(kind);
+    if (index < 0 || (unsigned)datatype >= SIMSIMD_DISPATCH_DATATYPES)
+        return (simsimd_metric_punned_t)0;
+    simsimd_dispatch_table_t const* table = simsimd_dispatch_table();
+    int dimensions_index = simsimd_fixed_dimensions_index(dimensions);
+    if (dimensions_index >= 0 && table->fixed_metrics[index][datatype][dimensions_index])
+        return table->fixed_metrics[index][datatype][dimensions_index];
+    return table->metrics[index][datatype];
+}
+
+/**
+ *  @brief  Reports the capability, that the metric kernel found by `simsimd_dispatch_metric` relies on,
+ *          to check which implementation a (metric, datatype) pair resolves to on this machine.
+ *  @return A single capability bit, that `simsimd_capability_name` can name, or zero if unsupported.
+ */
+inline static simsimd_capability_t simsimd_dispatch_capability(simsimd_metric_kind_t kind,
+                                                               simsimd_datatype_t datatype) {
+    int index = simsimd_metric_kind_index(kind);
+    if (index < 0 || (unsigned)datatype >= SIMSIMD_DISPATCH_DATATYPES)
+        return (simsimd_capability_t)0;
+    return simsimd_dispatch_table()->metric_capabilities[index][datatype];
+}
+
+/**
+ *  @brief  Reports the capability, that the metric kernel found by `simsimd_dispatch_metric_sized` relies on.
+ *  @return A single capability bit, that `simsimd_capability_name` can name, or zero if unsupported.
+ */
+inline static simsimd_capability_t simsimd_dispatch_capability_sized(simsimd_metric_kind_t kind,
+                                                                     simsimd_datatype_t datatype,
+                                                                     simsimd_size_t dimensions) {
+    int index = simsimd_metric_kind_index(kind);
+    if (index < 0 || (unsigned)datatype >= SIMSIMD_DISPATCH_DATATYPES)
+        return (simsimd_capability_t)0;
+    simsimd_dispatch_table_t const* table = simsimd_dispatch_table();
+    int dimensions_index = simsimd_fixed_dimensions_index(dimensions);
+    if (dimensions_index >= 0 && table->fixed_metrics[index][datatype][dimensions_index])
+        return table->fixed_capabilities[index][datatype][dimensions_index];
+    return table->metric_capabilities[index][datatype];
+}
+
+#ifndef SIMSIMD_DISPATCH_RESTRICTIONS
+/**
+ *  @brief  Number of distinct capability sets, that `simsimd_dispatch_restrict` keeps the tables for.
+ */
+#define SIMSIMD_DISPATCH_RESTRICTIONS 8
+#endif
+
+/**
+ *  @brief  Replaces the shared dispatch table, allowing only the given subset of the capabilities of this
+ *          machine, to compare the backends or work around a misbehaving one. The serial kernels always
+ *          stay allowed. The new table is filled separately and published atomically, so concurrent lookups
+ *          see either the old or the new kernels. Other threads may still be reading the replaced tables, so
+ *          they are kept in static storage, one per distinct capability set, and reused on repeated calls,
+ *          allowing up to `SIMSIMD_DISPATCH_RESTRICTIONS` different sets to be requested.
+ *
+ *          Like the shared table itself, the restriction only affects the lookups of the translation unit,
+ *          that calls it, as every other one has a separate copy of the table, unless all of them are
+ *          compiled with `SIMSIMD_DYNAMIC_DISPATCH`.
+ *
+ *  @param allowed The capabilities allowed for use, like `simsimd_cap_any_k & ~simsimd_cap_x86_avx512_k`,
+ *                 or `simsimd_cap_any_k` to restore the defaults.
+ *  @return The capabilities, that the table was filled for, or zero if too many distinct sets were requested.
+ */
+#if !SIMSIMD_DYNAMIC_DISPATCH || defined(SIMSIMD_DYNAMIC_DISPATCH_IMPLEMENTATION)
+SIMSIMD_DISPATCH_LINKAGE simsimd_capability_t simsimd_dispatch_restrict(simsimd_capability_t allowed) {
+    static simsimd_dispatch_table_t tables[SIMSIMD_DISPATCH_RESTRICTIONS];
+    static int tables_count = 0;
+    static long lock = 0;
+    simsimd_capability_t const capabilities =
+        (simsimd_capability_t)((simsimd_capabilities() & allowed) | simsimd_cap_serial_k);
+    simsimd_dispatch_table_t** slot = simsimd_dispatch_table_slot();
+    simsimd_dispatch_table_t* table = 0;
+
+    // Filled tables are never modified, so the lock only guards the search and the filling of a new one
+#if defined(_MSC_VER)
+    while (_InterlockedCompareExchange((long volatile*)&lock, 1, 0) != 0) simsimd_spin_pause();
+#else
+    long expected = 0;
+    while (!__atomic_compare_exchange_n(&lock, &expected, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        expected = 0, simsimd_spin_pause();
+#endif
+    for (int i = 0; i != tables_count && !table; ++i)
+        if (tables[i].capabilities == capabilities)
+            table = &tables[i];
+    if (!table && tables_count != SIMSIMD_DISPATCH_RESTRICTIONS)
+        table = &tables[tables_count++], simsimd_dispatch_table_init(table, capabilities);
+#if defined(_MSC_VER)
+    _InterlockedExchange((long volatile*)&lock, 0);
+#else
+    __atomic_store_n(&lock, 0, __ATOMIC_RELEASE);
+#endif
+    if (!table)
+        return (simsimd_capability_t)0;
+
+#if defined(_MSC_VER)
+    _InterlockedExchangePointer((void* volatile*)slot, table);
+#else
+    __atomic_store_n(slot, table, __ATOMIC_RELEASE);
+#endif
+    return capabilities;
+}
+#endif // !SIMSIMD_DYNAMIC_DISPATCH || SIMSIMD_DYNAMIC_DISPATCH_IMPLEMENTATION
+
+SIMSIMD_DISPATCH_LINKAGE simsimd_kernel_counters_t* simsimd_kernel_counters_slot(int index,
+                                                                                   simsimd_datatype_t datatype);
+
+#if !SIMSIMD_DYNAMIC_DISPATCH || defined(SIMSIMD_DYNAMIC_DISPATCH_IMPLEMENTATION)
+/**
+ *  @brief  Returns the usage statistics of the kernels of one (metric, datatype) pair. They are kept apart
+ *          from the dispatch table, so that they survive `simsimd_dispatch_restrict`. Like the table, they
+ *          belong to the translation unit, unless compiled with `SIMSIMD_DYNAMIC_DISPATCH`.
+ */
+SIMSIMD_DISPATCH_LINKAGE simsimd_kernel_counters_t* simsimd_kernel_counters_slot(int index,
+                                                                                   simsimd_datatype_t datatype) {
+    static simsimd_kernel_counters_t counters[SIMSIMD_DISPATCH_METRICS][SIMSIMD_DISPATCH_DATATYPES];
+    return &counters[index][datatype];
+}
+#endif // !SIMSIMD_DYNAMIC_DISPATCH || SIMSIMD_DYNAMIC_DISPATCH_IMPLEMENTATION
+
+/**
+ *  @brief  Accumulates the usage statistics of the kernels of one (metric, datatype) pair, if compiled with
+ *          `SIMSIMD_DISPATCH_COUNTERS`. The counters are updated with relaxed atomics, so they can be
+ *          bumped from many threads, but should be bumped once per call rather than once per pair.
+ *
+ *  @param kind The kind of the metric.
+ *  @param datatype The datatype of the inputs.
+ *  @param vectors Number of compared pairs of vectors.
+ *  @param bytes Number of input bytes.
+ */
+inline static void simsimd_dispatch_count(simsimd_metric_kind_t kind, simsimd_datatype_t datatype,
+                                          simsimd_size_t vectors, simsimd_size_t bytes) {
+#if SIMSIMD_DISPATCH_COUNTERS
+    int index = simsimd_metric_kind_index(kind);
+    if (index < 0 || (unsigned)datatype >= SIMSIMD_DISPATCH_DATATYPES)
+        return;
+    simsimd_kernel_counters_t* counters = simsimd_kernel_counters_slot(index, datatype);
+#if defined(_MSC_VER)
+    _InterlockedExchangeAdd64((__int64 volatile*)&counters->calls, 1);
+    _InterlockedExchangeAdd64((__int64 volatile*)&counters->vectors, (__int64)vectors);
+    _InterlockedExchangeAdd64((__int64 volatile*)&counters->bytes, (__int64)bytes);
+#else
+    __atomic_fetch_add(&counters->calls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&counters->vectors, vectors, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&counters->bytes, bytes, __ATOMIC_RELAXED);
+#endif
+#else
+    (void)kind, (void)datatype, (void)vectors, (void)bytes;
+#endif
+}
+
+/**
+ *  @brief  Reads the usage statistics of the kernels of one (metric, datatype) pair, accumulated with
+ *          `simsimd_dispatch_count`, and optionally resets them to zero.
+ *  @return The counters, all zeros for unknown pairs or without `SIMSIMD_DISPATCH_COUNTERS`.
+ */
+inline static simsimd_kernel_counters_t simsimd_dispatch_counters(simsimd_metric_kind_t kind,
+                                                                  simsimd_datatype_t datatype, int reset) {
+    simsimd_kernel_counters_t result = {0, 0, 0};
+    int index = simsimd_metric_kind_index(kind);
+    if (index < 0 || (unsigned)datatype >= SIMSIMD_DISPATCH_DATATYPES)
+        return result;
+    simsimd_kernel_counters_t* counters = simsimd_kernel_counters_slot(index, datatype);
+#if SIMSIMD_DISPATCH_COUNTERS
+    simsimd_size_t* fields[3] = {&counters->calls, &counters->vectors, &counters->bytes};
+    simsimd_size_t* outputs[3] = {&result.calls, &result.vectors, &result.bytes};
+    for (int i = 0; i != 3; ++i)
+#if defined(_MSC_VER)
+        *outputs[i] = (simsimd_size_t)(reset ? _InterlockedExchange64((__int64 volatile*)fields[i], 0)
+                                             : _InterlockedExchangeAdd64((__int64 volatile*)fields[i], 0));
+#else
+        *outputs[i] = reset ? __atomic_exchange_n(fields[i], 0, __ATOMIC_RELAXED)
+                            : __atomic_load_n(fields[i], __ATOMIC_RELAXED);
+#endif
+#else
+    (void)counters, (void)reset;
+#endif
+    return result;
+}
+
+/**
+ *  @brief  Looks up the best batch kernel for the given kind and datatype in the dispatch table.
+ *  @return A function pointer to the batch implementation, or NULL if there is none, and the single-pair
+ *          metric has to be used for every row.
+ */
+inline static simsimd_batch_punned_t simsimd_dispatch_batch(simsimd_metric_kind_t kind, simsimd_datatype_t datatype) {
+    int index = simsimd_metric_kind_index(kind);
+    if (index < 0 || (unsigned)datatype >= SIMSIMD_DISPATCH_DATATYPES)
+        return (simsimd_batch_punned_t)0;
+    return simsimd_dispatch_table()->batches[index][datatype];
+}
+
+/**
+ *  @brief  Looks up the best batch kernel with early termination for the given kind and datatype.
+ *  @return A function pointer to the bounded batch implementation, or NULL if there is none.
+ */
+inline static simsimd_bounded_batch_punned_t simsimd_dispatch_bounded_batch(simsimd_metric_kind_t kind,
+                                                                            simsimd_datatype_t datatype) {
+    int index = simsimd_metric_kind_index(kind);
+    if (index < 0 || (unsigned)datatype >= SIMSIMD_DISPATCH_DATATYPES)
+        return (simsimd_bounded_batch_punned_t)0;
+    return simsimd_dispatch_table()->bounded_batches[index][datatype];
+}
+
+/**
+ *  @brief  Looks up the best many-to-many matrix kernel for the given kind and datatype in the dispatch table.
+ *  @return A function pointer to the matrix implementation, or NULL if there is none, and the rows have to be
+ *          compared with `simsimd_many_to_many`.
+ */
+inline static simsimd_matrix_punned_t simsimd_dispatch_matrix(simsimd_metric_kind_t kind,
+                                                              simsimd_datatype_t datatype) {
+    int index = simsimd_metric_kind_index(kind);
+    if (index < 0 || (unsigned)datatype >= SIMSIMD_DISPATCH_DATATYPES)
+        return (simsimd_matrix_punned_t)0;
+    return simsimd_dispatch_table()->matrices[index][datatype];
+}
+
+/**
+ *  @brief  Looks up the best fast-scan kernel for 4-bit product-quantized codes in the dispatch table.
+ */
+inline static simsimd_pq4_scan_punned_t simsimd_dispatch_pq4_scan(void) { return simsimd_dispatch_table()->pq4_scan; }
+
+/**
+ *  @brief  Looks up the best kernel for the mixture terms of the Jensen–Shannon divergence in the dispatch table.
+ *  @return A function pointer to the mixture implementation, or NULL if the datatype is unsupported.
+ */
+inline static simsimd_divergence_term_punned_t simsimd_dispatch_js_mixture(simsimd_datatype_t datatype) {
+    if ((unsigned)datatype >= SIMSIMD_DISPATCH_DATATYPES)
+        return (simsimd_divergence_term_punned_t)0;
+    return simsimd_dispatch_table()->js_mixtures[datatype];
+}
+
+/**
+ *  @brief  Looks up the best kernel for the cross-entropy terms of the Kullback-Leibler divergence in the dispatch
+ *          table.
+ *  @return A function pointer to the cross-entropy implementation, or NULL if the datatype is unsupported.
+ */
+inline static simsimd_divergence_term_punned_t simsimd_dispatch_cross_entropy(simsimd_datatype_t datatype) {
+    if ((unsigned)datatype >= SIMSIMD_DISPATCH_DATATYPES)
+        return (simsimd_divergence_term_punned_t)0;
+    return simsimd_dispatch_table()->cross_entropies[datatype];
+}
+
+/**
+ *  @brief  Looks up the best sorted-set intersection kernel for sparse vectors in the dispatch table.
+ */
+inline static simsimd_sparse_intersect_punned_t simsimd_dispatch_sparse_intersect(void) {
+    return simsimd_dispatch_table()->sparse_intersect;
+}
+
+/**
+ *  @brief  Looks up the best weighted dot product kernel for sparse vectors in the dispatch table.
+ *  @return A function pointer to the dot product implementation, or NULL if the type of weights is unsupported.
+ */
+inline static simsimd_sparse_dot_punned_t simsimd_dispatch_sparse_dot(simsimd_datatype_t datatype) {
+    if ((unsigned)datatype >= SIMSIMD_DISPATCH_DATATYPES)
+        return (simsimd_sparse_dot_punned_t)0;
+    return simsimd_dispatch_table()->sparse_dots[datatype];
+}
+
+/**
+ *  @brief  Looks up the best kernel for converting `f32` vectors into the given datatype in the dispatch table.
+ *  @return A function pointer to the conversion implementation, or NULL if the datatype is unsupported.
+ */
+inline static simsimd_convert_punned_t simsimd_dispatch_convert(simsimd_datatype_t datatype) {
+    if ((unsigned)datatype >= SIMSIMD_DISPATCH_DATATYPES)
+        return (simsimd_convert_punned_t)0;
+    return simsimd_dispatch_table()->converters[datatype];
+}
+
+/**
+ *  @brief  Looks up the best kernel for the maximum absolute value of `f32` vectors in the dispatch table.
+ */
+inline static simsimd_absmax_punned_t simsimd_dispatch_absmax(void) { return simsimd_dispatch_table()->absmax; }
+
+/**
+ *  @brief  Quantizes equidistant `f32` rows into `i8` ones, with a separate symmetric scale for every row,
+ *          so that the largest magnitude maps to 127. The scales can be passed as `b_scale` to the
+ *          mixed-precision `_scaled` kernels, or multiplied by the codes to restore the values.
+ *
+ *  @param absmax The maximum absolute value kernel, found with `simsimd_find_absmax_punned`.
+ *  @param convert The `i8` conversion kernel, found with `simsimd_find_convert_punned`.
+ *  @param x Pointer to the first `f32` row.
+ *  @param count Number of rows.
+ *  @param stride Distance between the starts of consecutive input rows in bytes.
+ *  @param dimensions Number of scalars in every row.
+ *  @param codes Output matrix with `count` contiguous rows of `dimensions` codes.
+ *  @param scales Output array for `count` scales, zero for the rows of zeros.
+ */
+inline static void simsimd_quantize_i8(                                                             //
+    simsimd_absmax_punned_t absmax, simsimd_convert_punned_t convert,                               //
+    simsimd_f32_t const* x, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t dimensions, //
+    simsimd_i8_t* codes, simsimd_f32_t* scales) {
+    for (simsimd_size_t i = 0; i != count; ++i) {
+        simsimd_f32_t const* row = (simsimd_f32_t const*)((char const*)x + i * stride);
+        scales[i] = absmax(row, dimensions) / 127;
+        convert(row, dimensions, scales[i], codes + i * dimensions);
+    }
+}
+
+/**
+ *  @brief  Selects the most suitable metric implementation based on the given metric kind, datatype,
+ *          and allowed capabilities. When any capability is allowed, the answer comes from the cached
+ *          `simsimd_dispatch_table`, otherwise the full dispatch runs, so prefer caching the result.
+ *
+ *  @param kind The kind of metric to be evaluated.
+ *  @param datatype The data type for which the metric needs to be evaluated.
+ *  @param allowed The hardware capabilities allowed for use.
+ *  @return A function pointer to the selected metric implementation.
+ */
+inline static simsimd_metric_punned_t simsimd_metric_punned( //
+    simsimd_metric_kind_t kind,                              //
+    simsimd_datatype_t datatype,                             //
+    simsimd_capability_t allowed) {
+
+    if (allowed == simsimd_cap_any_k)
+        return simsimd_dispatch_metric(kind, datatype);
+
+    simsimd_metric_punned_t result = 0;
+    simsimd_capability_t c = simsimd_cap_serial_k;
+    simsimd_capability_t supported = simsimd_capabilities();
+    simsimd_find_metric_punned(kind, datatype, supported, allowed, &result, &c);
+    return result;
+}
+
+#ifndef SIMSIMD_BATCH_TILE_BYTES
+/**
+ *  @brief  Size of the tile of rows of the second collection, that `simsimd_many_to_many` keeps hot
+ *          in cache, while streaming the rows of the first collection against it. Defaults to a
+ *          fraction of the L2 cache of most modern CPU cores.
+ */
+#define SIMSIMD_BATCH_TILE_BYTES (256 * 1024)
+#endif
+
+/**
+ *  @brief  Compares one vector against many equidistant rows, using a dedicated batch kernel if
+ *          one is available and falling back to the single-pair metric otherwise.
+ *
+ *  @param metric The single-pair metric, found with `simsimd_find_metric_punned`.
+ *  @param batch The optional batch kernel, found with `simsimd_find_batch_punned`, or NULL.
+ *  @param a Pointer to the query vector.
+ *  @param b Pointer to the first row.
+ *  @param count Number of rows.
+ *  @param stride Distance between the starts of consecutive rows in bytes.
+ *  @param dimensions Number of scalars (or words for binary vectors) in every vector.
+ *  @param results Output array for `count` distances.
+ */
+inline static void simsimd_one_to_many(                                          //
+    simsimd_metric_punned_t metric, simsimd_batch_punned_t batch,                //
+    void const* a, void const* b, simsimd_size_t count, simsimd_size_t stride, //
+    simsimd_size_t dimensions, simsimd_f32_t* results) {
+
+    if (batch) {
+        batch(a, b, count, stride, dimensions, results);
+        return;
+    }
+    for (simsimd_size_t j = 0; j != count; ++j)
+        results[j] = metric(a, (char const*)b + j * stride, dimensions, dimensions);
+}
+
+/**
+ *  @brief  Computes all pairwise distances between two collections of equidistant rows, tiling the
+ *          second collection into `SIMSIMD_BATCH_TILE_BYTES` blocks, so that every tile is loaded
+ *          from memory once and reused for all the rows of the first collection.
+ *
+ *  @param metric The single-pair metric, found with `simsimd_find_metric_punned`.
+ *  @param batch The optional batch kernel, found with `simsimd_find_batch_punned`, or NULL.
+ *  @param a Pointer to the first row of the first collection.
+ *  @param a_count Number of rows in the first collection.
+ *  @param a_stride Distance between the starts of consecutive rows of `a` in bytes.
+ *  @param b Pointer to the first row of the second collection.
+ *  @param b_count Number of rows in the second collection.
+ *  @param b_stride Distance between the starts of consecutive rows of `b` in bytes.
+ *  @param dimensions Number of scalars (or words for binary vectors) in every vector.
+ *  @param results Output matrix with `a_count` rows and `b_count` columns.
+ *  @param results_stride Distance between the starts of consecutive rows of `results` in bytes.
+ */
+inline static void simsimd_many_to_many(                                  //
+    simsimd_metric_punned_t metric, simsimd_batch_punned_t batch,        //
+    void const* a, simsimd_size_t a_count, simsimd_size_t a_stride,    //
+    void const* b, simsimd_size_t b_count, simsimd_size_t b_stride,    //
+    simsimd_size_t dimensions, simsimd_f32_t* results, simsimd_size_t results_stride) {
+
+    simsimd_size_t tile_count = b_stride ? SIMSIMD_BATCH_TILE_BYTES / b_stride : b_count;
+    if (tile_count == 0)
+        tile_count = 1;
+
+    for (simsimd_size_t tile_start = 0; tile_start < b_count; tile_start += tile_count) {
+        simsimd_size_t tile_length = b_count - tile_start < tile_count ? b_count - tile_start : tile_count;
+        void const* tile = (char const*)b + tile_start * b_stride;
+        for (simsimd_size_t i = 0; i != a_count; ++i)
+            simsimd_one_to_many(metric, batch, (char const*)a + i * a_stride, tile, tile_length, b_stride, dimensions,
+                                (simsimd_f32_t*)((char*)results + i * results_stride) + tile_start);
+    }
+}
+
+/**
+ *  @brief  Offset of the distance between rows `i` and `i + 1` in the condensed output of `simsimd_pdist`.
+ *          The distances between row `i` and all of the following rows are stored contiguously after it.
+ */
+inline static simsimd_size_t simsimd_pdist_offset(simsimd_size_t count, simsimd_size_t i) {
+    return i * count - i * (i + 1) / 2;
+}
+
+/**
+ *  @brief  Computes the upper-triangle distances between the rows [`first_row`, `first_row + rows`) of
+ *          one collection and all of the rows following them, writing them into the condensed output.
+ *  @see `simsimd_pdist` for the arguments.
+ */
+inline static void simsimd_pdist_rows(                                                     //
+    simsimd_metric_punned_t metric, simsimd_batch_punned_t batch,                          //
+    void const* a, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t dimensions, //
+    simsimd_size_t first_row, simsimd_size_t rows, simsimd_f32_t* results) {
+
+    simsimd_size_t tile_count = stride ? SIMSIMD_BATCH_TILE_BYTES / stride : count;
+    if (tile_count == 0)
+        tile_count = 1;
+
+    // Columns left of the diagonal are skipped, so the tiles start right after the first row.
+    simsimd_size_t last_row = first_row + rows;
+    for (simsimd_size_t tile_start = first_row + 1; tile_start < count; tile_start += tile_count) {
+        simsimd_size_t tile_end = count - tile_start < tile_count ? count : tile_start + tile_count;
+        for (simsimd_size_t i = first_row; i != last_row && i + 1 < tile_end; ++i) {
+            simsimd_size_t first_column = i + 1 > tile_start ? i + 1 : tile_start;
+            simsimd_one_to_many(metric, batch, (char const*)a + i * stride, (char const*)a + first_column * stride,
+                                tile_end - first_column, stride, dimensions,
+                                results + simsimd_pdist_offset(count, i) + (first_column - i - 1));
+        }
+    }
+}
+
+/**
+ *  @brief  Computes the distances between all the unordered pairs of rows of one collection, skipping
+ *          the diagonal and the lower triangle, which only mirror the upper one for symmetric metrics.
+ *          The output is condensed, like in `scipy.spatial.distance.pdist`: the distance between the
+ *          rows `i < j` is stored at `simsimd_pdist_offset(count, i) + j - i - 1`.
+ *
+ *  @param metric The single-pair metric, found with `simsimd_find_metric_punned`.
+ *  @param batch The optional batch kernel, found with `simsimd_find_batch_punned`, or NULL.
+ *  @param a Pointer to the first row of the collection.
+ *  @param count Number of rows in the collection.
+ *  @param stride Distance between the starts of consecutive rows in bytes.
+ *  @param dimensions Number of scalars (or words for binary vectors) in every vector.
+ *  @param results Output array for `count * (count - 1) / 2` distances.
+ */
+inline static void simsimd_pdist(                                                          //
+    simsimd_metric_punned_t metric, simsimd_batch_punned_t batch,                          //
+    void const* a, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t dimensions, //
+    simsimd_f32_t* results) {
+    simsimd_pdist_rows(metric, batch, a, count, stride, dimensions, 0, count, results);
+}
+
+/**
+ *  @brief  Computes the inverse L2 norms of many equidistant rows, to be cached and reused across
+ *          `simsimd_cos_normalized` calls. Zero vectors get a zero inverse norm, so their cosine
+ *          distance to any other vector is 1, matching the regular cosine kernels. The squared norms
+ *          come from the dispatched inner product kernel of every row with itself, in the precision of
+ *          the inputs. It returns `1 - aa` in `f32`, so squared norms much smaller than one lose precision,
+ *          and the cosine distances of such vectors are better computed with the regular kernels.
+ *
+ *  @param datatype The datatype of the rows: `f64`, `f32`, `f16`, or `bf16`.
+ *  @param a Pointer to the first row.
+ *  @param count Number of rows.
+ *  @param stride Distance between the starts of consecutive rows in bytes.
+ *  @param dimensions Number of scalars in every vector.
+ *  @param results Output array for `count` inverse norms.
+ *  @return Zero on success, or -1 if the datatype is unsupported.
+ */
+inline static int simsimd_inverse_norms(                                                     //
+    simsimd_datatype_t datatype, void const* a, simsimd_size_t count, simsimd_size_t stride, //
+    simsimd_size_t dimensions, simsimd_f32_t* results) {
+
+    switch (datatype) {
+    case simsimd_datatype_f64_k:
+    case simsimd_datatype_f32_k:
+    case simsimd_datatype_f16_k:
+    case simsimd_datatype_bf16_k: break;
+    default: return -1;
+    }
+    simsimd_metric_punned_t ip = simsimd_dispatch_metric_sized(simsimd_metric_ip_k, datatype, dimensions);
+    if (!ip)
+        return -1;
+
+    for (simsimd_size_t j = 0; j != count; ++j) {
+        void const* row = (char const*)a + j * stride;
+        simsimd_f64_t a2 = 1 - (simsimd_f64_t)ip(row, row, dimensions, dimensions);
+        results[j] = a2 > 0 ? (simsimd_f32_t)(1 / sqrt(a2)) : 0;
+    }
+    return 0;
+}
+
+/**
+ *  @brief  Computes the cosine distance between two vectors with known inverse norms,
+ *          so that only the dot product has to be accumulated.
+ *
+ *  @param ip The inner product metric, found with `simsimd_find_metric_punned`.
+ *  @param a Pointer to the first vector.
+ *  @param a_inverse_norm Inverse L2 norm of `a`, computed with `simsimd_inverse_norms`.
+ *  @param b Pointer to the second vector.
+ *  @param b_inverse_norm Inverse L2 norm of `b`, computed with `simsimd_inverse_norms`.
+ *  @param dimensions Number of scalars in every vector.
+ */
+inline static simsimd_f32_t simsimd_cos_normalized(                             //
+    simsimd_metric_punned_t ip, void const* a, simsimd_f32_t a_inverse_norm, //
+    void const* b, simsimd_f32_t b_inverse_norm, simsimd_size_t dimensions) {
+
+    if (a_inverse_norm == 0 || b_inverse_norm == 0)
+        return 1;
+    simsimd_f32_t ab = 1 - ip(a, b, dimensions, dimensions);
+    return 1 - ab * a_inverse_norm * b_inverse_norm;
+}
+
+/**
+ *  @brief  Computes the cosine distances between one vector and many equidistant rows with known
+ *          inverse norms, running just the inner product kernels and rescaling their outputs.
+ *
+ *  @param ip The inner product metric, found with `simsimd_find_metric_punned`.
+ *  @param ip_batch The optional inner product batch kernel, found with `simsimd_find_batch_punned`, or NULL.
+ *  @param a Pointer to the query vector.
+ *  @param a_inverse_norm Inverse L2 norm of the query.
+ *  @param b Pointer to the first row.
+ *  @param b_inverse_norms Inverse L2 norms of all `count` rows.
+ *  @param count Number of rows.
+ *  @param stride Distance between the starts of consecutive rows in bytes.
+ *  @param dimensions Number of scalars in every vector.
+ *  @param results Output array for `count` distances.
+ */
+inline static void simsimd_one_to_many_normalized(                                                    //
+    simsimd_metric_punned_t ip, simsimd_batch_punned_t ip_batch,                                      //
+    void const* a, simsimd_f32_t a_inverse_norm,                                                      //
+    void const* b, simsimd_f32_t const* b_inverse_norms, simsimd_size_t count, simsimd_size_t stride, //
+    simsimd_size_t dimensions, simsimd_f32_t* results) {
+
+    simsimd_one_to_many(ip, ip_batch, a, b, count, stride, dimensions, results);
+    for (simsimd_size_t j = 0; j != count; ++j)
+        results[j] = a_inverse_norm == 0 || b_inverse_norms[j] == 0
+                         ? 1
+                         : 1 - (1 - results[j]) * a_inverse_norm * b_inverse_norms[j];
+}
+
+/**
+ *  @brief  Computes all pairwise cosine distances between two collections of rows with known inverse
+ *          norms, tiling the second collection just like `simsimd_many_to_many`.
+ *
+ *  @param ip The inner product metric, found with `simsimd_find_metric_punned`.
+ *  @param ip_batch The optional inner product batch kernel, found with `simsimd_find_batch_punned`, or NULL.
+ *  @param a Pointer to the first row of the first collection.
+ *  @param a_inverse_norms Inverse L2 norms of all `a_count` rows of the first collection.
+ *  @param a_count Number of rows in the first collection.
+ *  @param a_stride Distance between the starts of consecutive rows of `a` in bytes.
+ *  @param b Pointer to the first row of the second collection.
+ *  @param b_inverse_norms Inverse L2 norms of all `b_count` rows of the second collection.
+ *  @param b_count Number of rows in the second collection.
+ *  @param b_stride Distance between the starts of consecutive rows of `b` in bytes.
+ *  @param dimensions Number of scalars in every vector.
+ *  @param results Output matrix with `a_count` rows and `b_count` columns.
+ *  @param results_stride Distance between the starts of consecutive rows of `results` in bytes.
+ */
+inline static void simsimd_many_to_many_normalized(                                                       //
+    simsimd_metric_punned_t ip, simsimd_batch_punned_t ip_batch,                                          //
+    void const* a, simsimd_f32_t const* a_inverse_norms, simsimd_size_t a_count, simsimd_size_t a_stride, //
+    void const* b, simsimd_f32_t const* b_inverse_norms, simsimd_size_t b_count, simsimd_size_t b_stride, //
+    simsimd_size_t dimensions, simsimd_f32_t* results, simsimd_size_t results_stride) {
+
+    simsimd_size_t tile_count = b_stride ? SIMSIMD_BATCH_TILE_BYTES / b_stride : b_count;
+    if (tile_count == 0)
+        tile_count = 1;
+
+    for (simsimd_size_t tile_start = 0; tile_start < b_count; tile_start += tile_count) {
+        simsimd_size_t tile_length = b_count - tile_start < tile_count ? b_count - tile_start : tile_count;
+        void const* tile = (char const*)b + tile_start * b_stride;
+        for (simsimd_size_t i = 0; i != a_count; ++i)
+            simsimd_one_to_many_normalized(ip, ip_batch, (char const*)a + i * a_stride, a_inverse_norms[i], tile,
+                                           b_inverse_norms + tile_start, tile_length, b_stride, dimensions,
+                                           (simsimd_f32_t*)((char*)results + i * results_stride) + tile_start);
+    }
+}
+
+/**
+ *  @brief  Computes the entropies and, optionally, the logarithms of many equidistant probability
+ *          distributions, to be cached and reused across many `simsimd_kl_cached` and `simsimd_js_cached`
+ *          calls. Both use the same `log2` approximation and smoothing term as the regular kernels.
+ *
+ *  @param datatype The datatype of the distributions: `f64`, `f32`, or `f16`.
+ *  @param a Pointer to the first row.
+ *  @param count Number of rows.
+ *  @param stride Distance between the starts of consecutive rows in bytes.
+ *  @param dimensions Number of scalars in every distribution.
+ *  @param logs Optional output matrix of `count` dense rows of `log2(a + epsilon)`, or NULL if only the
+ *              entropies are needed. The logarithms are stored in `f64` for `f64` inputs and `f32` otherwise.
+ *  @param entropies Output array for `count` entropies `-sum(a * log2(a + epsilon))` in bits.
+ *  @return Zero on success, or -1 if the datatype is unsupported.
+ */
+inline static int simsimd_log_terms(                                                                  //
+    simsimd_datatype_t datatype, void const* a, simsimd_size_t count, simsimd_size_t stride,          //
+    simsimd_size_t dimensions, void* logs, simsimd_f64_t* entropies) {
+
+    for (simsimd_size_t j = 0; j != count; ++j) {
+        void const* row = (char const*)a + j * stride;
+        switch (datatype) {
+        case simsimd_datatype_f64_k:
+            entropies[j] = simsimd_serial_f64_log_terms((simsimd_f64_t const*)row, dimensions,
+                                                        logs ? (simsimd_f64_t*)logs + j * dimensions : 0);
+            break;
+        case simsimd_datatype_f32_k:
+            entropies[j] = simsimd_serial_f32_log_terms((simsimd_f32_t const*)row, dimensions,
+                                                        logs ? (simsimd_f32_t*)logs + j * dimensions : 0);
+            break;
+        case simsimd_datatype_f16_k:
+            entropies[j] = simsimd_serial_f16_log_terms((simsimd_f16_t const*)row, dimensions,
+                                                        logs ? (simsimd_f32_t*)logs + j * dimensions : 0);
+            break;
+        default: return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ *  @brief  Computes the Kullback-Leibler divergence between two distributions with a known entropy of
+ *          the first and known logarithms of the second, so that only a dot product has to be accumulated.
+ *          The terms are combined in `f64` and the rounding errors, that remain for close distributions,
+ *          are clamped to keep the divergence non-negative.
+ *
+ *  @param cross_entropy The cross-entropy kernel, found with `simsimd_find_cross_entropy_punned`.
+ *  @param a Pointer to the first distribution.
+ *  @param a_entropy Entropy of `a`, computed with `simsimd_log_terms`.
+ *  @param b_logs Logarithms of the second distribution, computed with `simsimd_log_terms`.
+ *  @param dimensions Number of scalars in every distribution.
+ */
+inline static simsimd_f32_t simsimd_kl_cached(                                              //
+    simsimd_divergence_term_punned_t cross_entropy, void const* a, simsimd_f64_t a_entropy, //
+    void const* b_logs, simsimd_size_t dimensions) {
+
+    simsimd_f64_t divergence = (cross_entropy(b_logs, a, dimensions) - a_entropy) * 0.6931471805599453;
+    return divergence > 0 ? (simsimd_f32_t)divergence : 0;
+}
+
+/**
+ *  @brief  Computes the Jensen–Shannon divergence between two distributions with known entropies,
+ *          so that only the mixture terms, with one logarithm per dimension, have to be accumulated.
+ *          The terms are combined in `f64` and the rounding errors, that remain for close distributions,
+ *          are clamped to keep the divergence non-negative.
+ *
+ *  @param mixture The mixture kernel, found with `simsimd_find_js_mixture_punned`.
+ *  @param a Pointer to the first distribution.
+ *  @param a_entropy Entropy of `a`, computed with `simsimd_log_terms`.
+ *  @param b Pointer to the second distribution.
+ *  @param b_entropy Entropy of `b`, computed with `simsimd_log_terms`.
+ *  @param dimensions Number of scalars in every distribution.
+ */
+inline static simsimd_f32_t simsimd_js_cached(                                        //
+    simsimd_divergence_term_punned_t mixture, void const* a, simsimd_f64_t a_entropy, //
+    void const* b, simsimd_f64_t b_entropy, simsimd_size_t dimensions) {
+
+    simsimd_f64_t divergence = (-mixture(a, b, dimensions) - a_entropy - b_entropy) * 0.5 * 0.6931471805599453;
+    return divergence > 0 ? (simsimd_f32_t)divergence : 0;
+}
+
+/**
+ *  @brief  Computes the Kullback-Leibler divergences between one distribution and many others with known
+ *          logarithms, running just the cross-entropy kernels.
+ *
+ *  @param cross_entropy The cross-entropy kernel, found with `simsimd_find_cross_entropy_punned`.
+ *  @param a Pointer to the first distribution.
+ *  @param a_entropy Entropy of `a`, computed with `simsimd_log_terms`.
+ *  @param b_logs Logarithms of the `count` other distributions, computed with `simsimd_log_terms`.
+ *  @param count Number of other distributions.
+ *  @param logs_stride Distance between the starts of consecutive rows of logarithms in bytes.
+ *  @param dimensions Number of scalars in every distribution.
+ *  @param results Output array for `count` divergences.
+ */
+inline static void simsimd_one_to_many_kl_cached(                                           //
+    simsimd_divergence_term_punned_t cross_entropy, void const* a, simsimd_f64_t a_entropy, //
+    void const* b_logs, simsimd_size_t count, simsimd_size_t logs_stride,                   //
+    simsimd_size_t dimensions, simsimd_f32_t* results) {
+
+    for (simsimd_size_t j = 0; j != count; ++j)
+        results[j] =
+            simsimd_kl_cached(cross_entropy, a, a_entropy, (char const*)b_logs + j * logs_stride, dimensions);
+}
+
+/**
+ *  @brief  Computes the Jensen–Shannon divergences between one distribution and many equidistant rows
+ *          with known entropies, running just the mixture kernels.
+ *
+ *  @param mixture The mixture kernel, found with `simsimd_find_js_mixture_punned`.
+ *  @param a Pointer to the first distribution.
+ *  @param a_entropy Entropy of `a`, computed with `simsimd_log_terms`.
+ *  @param b Pointer to the first row.
+ *  @param b_entropies Entropies of all `count` rows.
+ *  @param count Number of rows.
+ *  @param stride Distance between the starts of consecutive rows in bytes.
+ *  @param dimensions Number of scalars in every distribution.
+ *  @param results Output array for `count` divergences.
+ */
+inline static void simsimd_one_to_many_js_cached(                                                  //
+    simsimd_divergence_term_punned_t mixture, void const* a, simsimd_f64_t a_entropy,              //
+    void const* b, simsimd_f64_t const* b_entropies, simsimd_size_t count, simsimd_size_t stride, //
+    simsimd_size_t dimensions, simsimd_f32_t* results) {
+
+    for (simsimd_size_t j = 0; j != count; ++j)
+        results[j] = simsimd_js_cached(mixture, a, a_entropy, (char const*)b + j * stride, b_entropies[j], dimensions);
+}
+
+/**
+ *  @brief  Computes all pairwise Kullback-Leibler divergences between two collections of distributions,
+ *          with known entropies of the first and logarithms of the second, tiling the logarithms
+ *          just like `simsimd_many_to_many`.
+ *
+ *  @param cross_entropy The cross-entropy kernel, found with `simsimd_find_cross_entropy_punned`.
+ *  @param a Pointer to the first row of the first collection.
+ *  @param a_entropies Entropies of all `a_count` rows of the first collection.
+ *  @param a_count Number of rows in the first collection.
+ *  @param a_stride Distance between the starts of consecutive rows of `a` in bytes.
+ *  @param b_logs Logarithms of all `b_count` rows of the second collection.
+ *  @param b_count Number of rows in the second collection.
+ *  @param logs_stride Distance between the starts of consecutive rows of `b_logs` in bytes.
+ *  @param dimensions Number of scalars in every distribution.
+ *  @param results Output matrix with `a_count` rows and `b_count` columns.
+ *  @param results_stride Distance between the starts of consecutive rows of `results` in bytes.
+ */
+inline static void simsimd_many_to_many_kl_cached(                                                    //
+    simsimd_divergence_term_punned_t cross_entropy,                                                   //
+    void const* a, simsimd_f64_t const* a_entropies, simsimd_size_t a_count, simsimd_size_t a_stride, //
+    void const* b_logs, simsimd_size_t b_count, simsimd_size_t logs_stride,                           //
+    simsimd_size_t dimensions, simsimd_f32_t* results, simsimd_size_t results_stride) {
+
+    simsimd_size_t tile_count = logs_stride ? SIMSIMD_BATCH_TILE_BYTES / logs_stride : b_count;
+    if (tile_count == 0)
+        tile_count = 1;
+
+    for (simsimd_size_t tile_start = 0; tile_start < b_count; tile_start += tile_count) {
+        simsimd_size_t tile_length = b_count - tile_start < tile_count ? b_count - tile_start : tile_count;
+        void const* tile = (char const*)b_logs + tile_start * logs_stride;
+        for (simsimd_size_t i = 0; i != a_count; ++i)
+            simsimd_one_to_many_kl_cached(cross_entropy, (char const*)a + i * a_stride, a_entropies[i], tile,
+                                          tile_length, logs_stride, dimensions,
+                                          (simsimd_f32_t*)((char*)results + i * results_stride) + tile_start);
+    }
+}
+
+/**
+ *  @brief  Computes all pairwise Jensen–Shannon divergences between two collections of distributions
+ *          with known entropies, tiling the second collection just like `simsimd_many_to_many`.
+ *
+ *  @param mixture The mixture kernel, found with `simsimd_find_js_mixture_punned`.
+ *  @param a Pointer to the first row of the first collection.
+ *  @param a_entropies Entropies of all `a_count` rows of the first collection.
+ *  @param a_count Number of rows in the first collection.
+ *  @param a_stride Distance between the starts of consecutive rows of `a` in bytes.
+ *  @param b Pointer to the first row of the second collection.
+ *  @param b_entropies Entropies of all `b_count` rows of the second collection.
+ *  @param b_count Number of rows in the second collection.
+ *  @param b_stride Distance between the starts of consecutive rows of `b` in bytes.
+ *  @param dimensions Number of scalars in every distribution.
+ *  @param results Output matrix with `a_count` rows and `b_count` columns.
+ *  @param results_stride Distance between the starts of consecutive rows of `results` in bytes.
+ */
+inline static void simsimd_many_to_many_js_cached(                                                    //
+    simsimd_divergence_term_punned_t mixture,                                                         //
+    void const* a, simsimd_f64_t const* a_entropies, simsimd_size_t a_count, simsimd_size_t a_stride, //
+    void const* b, simsimd_f64_t const* b_entropies, simsimd_size_t b_count, simsimd_size_t b_stride, //
+    simsimd_size_t dimensions, simsimd_f32_t* results, simsimd_size_t results_stride) {
+
+    simsimd_size_t tile_count = b_stride ? SIMSIMD_BATCH_TILE_BYTES / b_stride : b_count;
+    if (tile_count == 0)
+        tile_count = 1;
+
+    for (simsimd_size_t tile_start = 0; tile_start < b_count; tile_start += tile_count) {
+        simsimd_size_t tile_length = b_count - tile_start < tile_count ? b_count - tile_start : tile_count;
+        void const* tile = (char const*)b + tile_start * b_stride;
+        for (simsimd_size_t i = 0; i != a_count; ++i)
+            simsimd_one_to_many_js_cached(mixture, (char const*)a + i * a_stride, a_entropies[i], tile,
+                                          b_entropies + tile_start, tile_length, b_stride, dimensions,
+                                          (simsimd_f32_t*)((char*)results + i * results_stride) + tile_start);
+    }
+}
+
+
+#ifndef SIMSIMD_TOPK_CHUNK
+/**
+ *  @brief  Number of rows `simsimd_topk` scores at once into an on-stack buffer, before pushing
+ *          their distances into the bounded heap.
+ */
+#define SIMSIMD_TOPK_CHUNK 256
+#endif
+
+/**
+ *  @brief  Restores the max-heap property of the first `size` entries, sifting the `root` down.
+ */
+inline static void simsimd_topk_heapify(simsimd_size_t* indices, simsimd_f32_t* distances, simsimd_size_t size,
+                                        simsimd_size_t root) {
+    simsimd_size_t index = indices[root];
+    simsimd_f32_t distance = distances[root];
+    for (simsimd_size_t child = root * 2 + 1; child < size; child = root * 2 + 1) {
+        if (child + 1 < size && distances[child + 1] > distances[child])
+            ++child;
+        if (!(distances[child] > distance))
+            break;
+        indices[root] = indices[child], distances[root] = distances[child];
+        root = child;
+    }
+    indices[root] = index, distances[root] = distance;
+}
+
+/**
+ *  @brief  Pushes a candidate into a bounded max-heap of the `capacity` closest entries found so far.
+ *          When the heap is full, the candidate replaces the furthest entry, if it's closer.
+ *
+ *  @param indices Heap of row indices with at least `capacity` slots.
+ *  @param distances Heap of distances with at least `capacity` slots.
+ *  @param size Pointer to the current number of entries in the heap, updated in place.
+ *  @param capacity Maximum number of entries, usually the `k` of the top-k search.
+ *  @param index Index of the candidate row.
+ *  @param distance Distance of the candidate row to the query.
+ */
+inline static void simsimd_topk_push(simsimd_size_t* indices, simsimd_f32_t* distances, simsimd_size_t* size,
+                                     simsimd_size_t capacity, simsimd_size_t index, simsimd_f32_t distance) {
+    simsimd_size_t current = *size;
+    if (current < capacity) {
+        // Sift the new entry up from the bottom of the heap
+        while (current != 0) {
+            simsimd_size_t parent = (current - 1) / 2;
+            if (!(distance > distances[parent]))
+                break;
+            indices[current] = indices[parent], distances[current] = distances[parent];
+            current = parent;
+        }
+        indices[current] = index, distances[current] = distance;
+        ++*size;
+    } else if (capacity != 0 && distance < distances[0]) {
+        indices[0] = index, distances[0] = distance;
+        simsimd_topk_heapify(indices, distances, capacity, 0);
+    }
+}
+
+/**
+ *  @brief  Sorts the entries of a max-heap produced by `simsimd_topk_push` in-place,
+ *          in the order of increasing distance.
+ */
+inline static void simsimd_topk_sort(simsimd_size_t* indices, simsimd_f32_t* distances, simsimd_size_t size) {
+    while (size > 1) {
+        --size;
+        simsimd_size_t index = indices[0];
+        simsimd_f32_t distance = distances[0];
+        indices[0] = indices[size], distances[0] = distances[size];
+        indices[size] = index, distances[size] = distance;
+        simsimd_topk_heapify(indices, distances, size, 0);
+    }
+}
+
+/**
+ *  @brief  Finds the `k` rows closest to the query, streaming them through the metric in chunks of
+ *          `SIMSIMD_TOPK_CHUNK` rows and keeping a bounded heap, without materializing all distances.
+ *
+ *  @param metric The single-pair metric, found with `simsimd_find_metric_punned`.
+ *  @param batch The optional batch kernel, found with `simsimd_find_batch_punned`, or NULL.
+ *  @param a Pointer to the query vector.
+ *  @param b Pointer to the first row.
+ *  @param count Number of rows.
+ *  @param stride Distance between the starts of consecutive rows in bytes.
+ *  @param dimensions Number of scalars (or words for binary vectors) in every vector.
+ *  @param k Maximum number of neighbors to find.
+ *  @param indices Output array for at least `k` row indices, sorted by increasing distance.
+ *  @param distances Output array for at least `k` distances, sorted in increasing order.
+ *  @return Number of found neighbors, equal to the smaller of `k` and `count`.
+ */
+inline static simsimd_size_t simsimd_topk(                                       //
+    simsimd_metric_punned_t metric, simsimd_batch_punned_t batch,                //
+    void const* a, void const* b, simsimd_size_t count, simsimd_size_t stride, //
+    simsimd_size_t dimensions, simsimd_size_t k, simsimd_size_t* indices, simsimd_f32_t* distances) {
+
+    simsimd_f32_t chunk_distances[SIMSIMD_TOPK_CHUNK];
+    simsimd_size_t size = 0;
+    for (simsimd_size_t chunk_start = 0; chunk_start < count; chunk_start += SIMSIMD_TOPK_CHUNK) {
+        simsimd_size_t chunk_length =
+            count - chunk_start < SIMSIMD_TOPK_CHUNK ? count - chunk_start : SIMSIMD_TOPK_CHUNK;
+        simsimd_one_to_many(metric, batch, a, (char const*)b + chunk_start * stride, chunk_length, stride, dimensions,
+                            chunk_distances);
+        for (simsimd_size_t j = 0; j != chunk_length; ++j)
+            simsimd_topk_push(indices, distances, &size, k, chunk_start + j, chunk_distances[j]);
+    }
+    simsimd_topk_sort(indices, distances, size);
+    return size;
+}
+
+/**
+ *  @brief  Finds all the rows within `max_distance` from the query, streaming them in chunks of
+ *          `SIMSIMD_TOPK_CHUNK` rows. If a bounded batch kernel is available, it is used to stop
+ *          comparing the rows, that are already known to be too far away.
+ *
+ *  @param metric The single-pair metric, found with `simsimd_find_metric_punned`.
+ *  @param batch The optional batch kernel, found with `simsimd_find_batch_punned`, or NULL.
+ *  @param bounded The optional bounded batch kernel, found with `simsimd_find_bounded_batch_punned`, or NULL.
+ *  @param a Pointer to the query vector.
+ *  @param b Pointer to the first row.
+ *  @param count Number of rows.
+ *  @param stride Distance between the starts of consecutive rows in bytes.
+ *  @param dimensions Number of scalars (or words for binary vectors) in every vector.
+ *  @param max_distance Largest distance to report, inclusive.
+ *  @param indices Output array for up to `count` row indices, in increasing order.
+ *  @param distances Output array for up to `count` distances, matching the `indices`.
+ *  @return Number of found rows.
+ */
+inline static simsimd_size_t simsimd_range(                                                         //
+    simsimd_metric_punned_t metric, simsimd_batch_punned_t batch, simsimd_bounded_batch_punned_t bounded, //
+    void const* a, void const* b, simsimd_size_t count, simsimd_size_t stride,                      //
+    simsimd_size_t dimensions, simsimd_f32_t max_distance, simsimd_size_t* indices, simsimd_f32_t* distances) {
+
+    simsimd_f32_t chunk_distances[SIMSIMD_TOPK_CHUNK];
+    simsimd_size_t found = 0;
+    for (simsimd_size_t chunk_start = 0; chunk_start < count; chunk_start += SIMSIMD_TOPK_CHUNK) {
+        simsimd_size_t chunk_length =
+            count - chunk_start < SIMSIMD_TOPK_CHUNK ? count - chunk_start : SIMSIMD_TOPK_CHUNK;
+        void const* chunk = (char const*)b + chunk_start * stride;
+        if (bounded)
+            bounded(a, chunk, chunk_length, stride, dimensions, max_distance, chunk_distances);
+        else
+            simsimd_one_to_many(metric, batch, a, chunk, chunk_length, stride, dimensions, chunk_distances);
+        for (simsimd_size_t j = 0; j != chunk_length; ++j)
+            if (chunk_distances[j] <= max_distance)
+                indices[found] = chunk_start + j, distances[found] = chunk_distances[j], ++found;
+    }
+    return found;
+}
+
+/**
+ *  @brief  Type-punned task, that computes the `index`-th part of some bigger job described by the `context`.
+ */
+typedef void (*simsimd_task_t)(void* context, simsimd_size_t index);
+
+/**
+ *  @brief  Type-punned executor, that must call the `task` for every index in [0, `count`), potentially
+ *          from different threads, and return only after all of the calls complete. Hosts can pass their
+ *          own thread pools through the `executor` pointer, or use `simsimd_thread_pool_execute`.
+ */
+typedef void (*simsimd_executor_t)(void* executor, simsimd_size_t count, simsimd_task_t task, void* context);
+
+/**
+ *  @brief  Executor that runs all the tasks one after another in the calling thread.
+ */
+inline static void simsimd_executor_serial(void* executor, simsimd_size_t count, simsimd_task_t task, void* context) {
+    (void)executor;
+    for (simsimd_size_t i = 0; i != count; ++i)
+        task(context, i);
+}
+
+#ifndef SIMSIMD_PARALLEL_ROWS
+/**
+ *  @brief  Number of consecutive rows of the first collection, that every task of the parallel
+ *          many-to-many helpers processes, so that each thread streams through the same tiles.
+ */
+#define SIMSIMD_PARALLEL_ROWS 16
+#endif
+
+/**
+ *  @brief  Arguments of the parallel many-to-many helpers, shared by all of their tasks.
+ *          The inverse norms are only set for the `simsimd_many_to_many_normalized_parallel`.
+ */
+typedef struct simsimd_many_to_many_job_t {
+    simsimd_metric_punned_t metric;
+    simsimd_batch_punned_t batch;
+    void const* a;
+    simsimd_f32_t const* a_inverse_norms;
+    simsimd_size_t a_count;
+    simsimd_size_t a_stride;
+    void const* b;
+    simsimd_f32_t const* b_inverse_norms;
+    simsimd_size_t b_count;
+    simsimd_size_t b_stride;
+    simsimd_size_t dimensions;
+    simsimd_f32_t* results;
+    simsimd_size_t results_stride;
+} simsimd_many_to_many_job_t;
+
+/**
+ *  @brief  Task computing the distances for the `slice`-th block of `SIMSIMD_PARALLEL_ROWS` rows of `a`.
+ */
+inline static void simsimd_many_to_many_slice(void* context, simsimd_size_t slice) {
+    simsimd_many_to_many_job_t const* job = (simsimd_many_to_many_job_t const*)context;
+    simsimd_size_t first_row = slice * SIMSIMD_PARALLEL_ROWS;
+    simsimd_size_t rows =
+        job->a_count - first_row < SIMSIMD_PARALLEL_ROWS ? job->a_count - first_row : SIMSIMD_PARALLEL_ROWS;
+    void const* a = (char const*)job->a + first_row * job->a_stride;
+    simsimd_f32_t* results = (simsimd_f32_t*)((char*)job->results + first_row * job->results_stride);
+    if (job->a_inverse_norms)
+        simsimd_many_to_many_normalized(                               //
+            job->metric, job->batch,                                   //
+            a, job->a_inverse_norms + first_row, rows, job->a_stride,  //
+            job->b, job->b_inverse_norms, job->b_count, job->b_stride, //
+            job->dimensions, results, job->results_stride);
+    else
+        simsimd_many_to_many(                                            //
+            job->metric, job->batch,                                     //
+            a, rows, job->a_stride, job->b, job->b_count, job->b_stride, //
+            job->dimensions, results, job->results_stride);
+}
+
+/**
+ *  @brief  Computes all pairwise distances between two collections, like `simsimd_many_to_many`,
+ *          splitting the rows of the first collection into tasks of `SIMSIMD_PARALLEL_ROWS` rows.
+ *
+ *  @param executor The executor to run the tasks on, or NULL to run them in the calling thread.
+ *  @param executor_context The opaque pointer passed to the executor, like a `simsimd_thread_pool_t`.
+ *  @see `simsimd_many_to_many` for the remaining arguments.
+ */
+inline static void simsimd_many_to_many_parallel(                   //
+    simsimd_executor_t executor, void* executor_context,            //
+    simsimd_metric_punned_t metric, simsimd_batch_punned_t batch,   //
+    void const* a, simsimd_size_t a_count, simsimd_size_t a_stride, //
+    void const* b, simsimd_size_t b_count, simsimd_size_t b_stride, //
+    simsimd_size_t dimensions, simsimd_f32_t* results, simsimd_size_t results_stride) {
+
+    simsimd_many_to_many_job_t job;
+    job.metric = metric, job.batch = batch;
+    job.a = a, job.a_inverse_norms = 0, job.a_count = a_count, job.a_stride = a_stride;
+    job.b = b, job.b_inverse_norms = 0, job.b_count = b_count, job.b_stride = b_stride;
+    job.dimensions = dimensions, job.results = results, job.results_stride = results_stride;
+    simsimd_size_t slices = (a_count + SIMSIMD_PARALLEL_ROWS - 1) / SIMSIMD_PARALLEL_ROWS;
+    (executor ? executor : &simsimd_executor_serial)(executor_context, slices, &simsimd_many_to_many_slice, &job);
+}
+
+/**
+ *  @brief  Computes all pairwise cosine distances between two collections with known inverse norms,
+ *          like `simsimd_many_to_many_normalized`, splitting the rows of the first collection into tasks.
+ *
+ *  @param executor The executor to run the tasks on, or NULL to run them in the calling thread.
+ *  @param executor_context The opaque pointer passed to the executor, like a `simsimd_thread_pool_t`.
+ *  @see `simsimd_many_to_many_normalized` for the remaining arguments.
+ */
+inline static void simsimd_many_to_many_normalized_parallel(                                              //
+    simsimd_executor_t executor, void* executor_context,                                                  //
+    simsimd_metric_punned_t ip, simsimd_batch_punned_t ip_batch,                                          //
+    void const* a, simsimd_f32_t const* a_inverse_norms, simsimd_size_t a_count, simsimd_size_t a_stride, //
+    void const* b, simsimd_f32_t const* b_inverse_norms, simsimd_size_t b_count, simsimd_size_t b_stride, //
+    simsimd_size_t dimensions, simsimd_f32_t* results, simsimd_size_t results_stride) {
+
+    simsimd_many_to_many_job_t job;
+    job.metric = ip, job.batch = ip_batch;
+    job.a = a, job.a_inverse_norms = a_inverse_norms, job.a_count = a_count, job.a_stride = a_stride;
+    job.b = b, job.b_inverse_norms = b_inverse_norms, job.b_count = b_count, job.b_stride = b_stride;
+    job.dimensions = dimensions, job.results = results, job.results_stride = results_stride;
+    simsimd_size_t slices = (a_count + SIMSIMD_PARALLEL_ROWS - 1) / SIMSIMD_PARALLEL_ROWS;
+    (executor ? executor : &simsimd_executor_serial)(executor_context, slices, &simsimd_many_to_many_slice, &job);
+}
+
+#ifndef SIMSIMD_PARALLEL_MATRIX_ROWS
+/**
+ *  @brief  Number of rows of the first collection in every task of `simsimd_matrix_parallel`. Tile-based
+ *          kernels repack the second collection once per call, so they need much larger tasks, than the
+ *          `SIMSIMD_PARALLEL_ROWS` of the other helpers.
+ */
+#define SIMSIMD_PARALLEL_MATRIX_ROWS 1024
+#endif
+
+#ifndef SIMSIMD_PARALLEL_MATRIX_COLUMNS
+/**
+ *  @brief  Number of rows of the second collection in every task of `simsimd_matrix_parallel`, so that
+ *          a few queries against a large collection are still split between threads.
+ */
+#define SIMSIMD_PARALLEL_MATRIX_COLUMNS 4096
+#endif
+
+/**
+ *  @brief  Arguments of the parallel many-to-many matrix kernels, shared by all of their tasks.
+ */
+typedef struct simsimd_matrix_job_t {
+    simsimd_matrix_punned_t matrix;
+    void const* a;
+    simsimd_size_t a_count;
+    simsimd_size_t a_stride;
+    void const* b;
+    simsimd_size_t b_count;
+    simsimd_size_t b_stride;
+    simsimd_size_t dimensions;
+    simsimd_f32_t* results;
+    simsimd_size_t results_stride;
+    simsimd_size_t column_slices;
+} simsimd_matrix_job_t;
+
+/**
+ *  @brief  Task computing the distances for a block of `SIMSIMD_PARALLEL_MATRIX_ROWS` rows of `a`
+ *          and `SIMSIMD_PARALLEL_MATRIX_COLUMNS` rows of `b`.
+ */
+inline static void simsimd_matrix_slice(void* context, simsimd_size_t slice) {
+    simsimd_matrix_job_t const* job = (simsimd_matrix_job_t const*)context;
+    simsimd_size_t first_row = slice / job->column_slices * SIMSIMD_PARALLEL_MATRIX_ROWS;
+    simsimd_size_t first_column = slice % job->column_slices * SIMSIMD_PARALLEL_MATRIX_COLUMNS;
+    simsimd_size_t rows = job->a_count - first_row < SIMSIMD_PARALLEL_MATRIX_ROWS ? job->a_count - first_row
+                                                                                 : SIMSIMD_PARALLEL_MATRIX_ROWS;
+    simsimd_size_t columns = job->b_count - first_column < SIMSIMD_PARALLEL_MATRIX_COLUMNS
+                                 ? job->b_count - first_column
+                                 : SIMSIMD_PARALLEL_MATRIX_COLUMNS;
+    job->matrix(                                                                                  //
+        (char const*)job->a + first_row * job->a_stride, rows, job->a_stride,                     //
+        (char const*)job->b + first_column * job->b_stride, columns, job->b_stride,               //
+        job->dimensions, (simsimd_f32_t*)((char*)job->results + first_row * job->results_stride) + first_column,
+        job->results_stride);
+}
+
+/**
+ *  @brief  Computes all pairwise distances between two collections with a matrix kernel, found with
+ *          `simsimd_find_matrix_punned`, splitting both collections into blocks, so that every task
+ *          fills a different tile of the output.
+ *
+ *  @param executor The executor to run the tasks on, or NULL to run them in the calling thread.
+ *  @param executor_context The opaque pointer passed to the executor, like a `simsimd_thread_pool_t`.
+ *  @param matrix The many-to-many kernel, found with `simsimd_find_matrix_punned`.
+ *  @see `simsimd_matrix_punned_t` for the remaining arguments.
+ */
+inline static void simsimd_matrix_parallel(                         //
+    simsimd_executor_t executor, void* executor_context,            //
+    simsimd_matrix_punned_t matrix,                                 //
+    void const* a, simsimd_size_t a_count, simsimd_size_t a_stride, //
+    void const* b, simsimd_size_t b_count, simsimd_size_t b_stride, //
+    simsimd_size_t dimensions, simsimd_f32_t* results, simsimd_size_t results_stride) {
+
+    simsimd_matrix_job_t job;
+    job.matrix = matrix;
+    job.a = a, job.a_count = a_count, job.a_stride = a_stride;
+    job.b = b, job.b_count = b_count, job.b_stride = b_stride;
+    job.dimensions = dimensions, job.results = results, job.results_stride = results_stride;
+    job.column_slices = (b_count + SIMSIMD_PARALLEL_MATRIX_COLUMNS - 1) / SIMSIMD_PARALLEL_MATRIX_COLUMNS;
+    simsimd_size_t row_slices = (a_count + SIMSIMD_PARALLEL_MATRIX_ROWS - 1) / SIMSIMD_PARALLEL_MATRIX_ROWS;
+    (executor ? executor : &simsimd_executor_serial)(executor_context, row_slices * job.column_slices,
+                                                     &simsimd_matrix_slice, &job);
+}
+
+/**
+ *  @brief  Arguments of the parallel many-to-many divergences with cached log terms, shared by all of their tasks.
+ *          The `b` points to the logarithms of the second collection for the Kullback-Leibler divergence,
+ *          which doesn't need its entropies, and to the distributions themselves for the Jensen–Shannon one.
+ */
+typedef struct simsimd_many_to_many_cached_job_t {
+    simsimd_metric_kind_t kind;
+    simsimd_divergence_term_punned_t term;
+    void const* a;
+    simsimd_f64_t const* a_entropies;
+    simsimd_size_t a_count;
+    simsimd_size_t a_stride;
+    void const* b;
+    simsimd_f64_t const* b_entropies;
+    simsimd_size_t b_count;
+    simsimd_size_t b_stride;
+    simsimd_size_t dimensions;
+    simsimd_f32_t* results;
+    simsimd_size_t results_stride;
+} simsimd_many_to_many_cached_job_t;
+
+/**
+ *  @brief  Task computing the divergences for the `slice`-th block of `SIMSIMD_PARALLEL_ROWS` rows of `a`.
+ */
+inline static void simsimd_many_to_many_cached_slice(void* context, simsimd_size_t slice) {
+    simsimd_many_to_many_cached_job_t const* job = (simsimd_many_to_many_cached_job_t const*)context;
+    simsimd_size_t first_row = slice * SIMSIMD_PARALLEL_ROWS;
+    simsimd_size_t rows =
+        job->a_count - first_row < SIMSIMD_PARALLEL_ROWS ? job->a_count - first_row : SIMSIMD_PARALLEL_ROWS;
+    void const* a = (char const*)job->a + first_row * job->a_stride;
+    simsimd_f32_t* results = (simsimd_f32_t*)((char*)job->results + first_row * job->results_stride);
+    if (job->kind == simsimd_metric_kl_k)
+        simsimd_many_to_many_kl_cached(                            //
+            job->term,                                             //
+            a, job->a_entropies + first_row, rows, job->a_stride,  //
+            job->b, job->b_count, job->b_stride,                   //
+            job->dimensions, results, job->results_stride);
+    else
+        simsimd_many_to_many_js_cached(                                //
+            job->term,                                                 //
+            a, job->a_entropies + first_row, rows, job->a_stride,      //
+            job->b, job->b_entropies, job->b_count, job->b_stride,     //
+            job->dimensions, results, job->results_stride);
+}
+
+/**
+ *  @brief  Computes all pairwise Kullback-Leibler divergences with cached log terms, like
+ *          `simsimd_many_to_many_kl_cached`, splitting the rows of the first collection into tasks.
+ *
+ *  @param executor The executor to run the tasks on, or NULL to run them in the calling thread.
+ *  @param executor_context The opaque pointer passed to the executor, like a `simsimd_thread_pool_t`.
+ *  @see `simsimd_many_to_many_kl_cached` for the remaining arguments.
+ */
+inline static void simsimd_many_to_many_kl_cached_parallel(                                           //
+    simsimd_executor_t executor, void* executor_context,                                              //
+    simsimd_divergence_term_punned_t cross_entropy,                                                   //
+    void const* a, simsimd_f64_t const* a_entropies, simsimd_size_t a_count, simsimd_size_t a_stride, //
+    void const* b_logs, simsimd_size_t b_count, simsimd_size_t logs_stride,                           //
+    simsimd_size_t dimensions, simsimd_f32_t* results, simsimd_size_t results_stride) {
+
+    simsimd_many_to_many_cached_job_t job;
+    job.kind = simsimd_metric_kl_k, job.term = cross_entropy;
+    job.a = a, job.a_entropies = a_entropies, job.a_count = a_count, job.a_stride = a_stride;
+    job.b = b_logs, job.b_entropies = 0, job.b_count = b_count, job.b_stride = logs_stride;
+    job.dimensions = dimensions, job.results = results, job.results_stride = results_stride;
+    simsimd_size_t slices = (a_count + SIMSIMD_PARALLEL_ROWS - 1) / SIMSIMD_PARALLEL_ROWS;
+    (executor ? executor : &simsimd_executor_serial)(executor_context, slices, &simsimd_many_to_many_cached_slice,
+                                                     &job);
+}
+
+/**
+ *  @brief  Computes all pairwise Jensen–Shannon divergences with cached entropies, like
+ *          `simsimd_many_to_many_js_cached`, splitting the rows of the first collection into tasks.
+ *
+ *  @param executor The executor to run the tasks on, or NULL to run them in the calling thread.
+ *  @param executor_context The opaque pointer passed to the executor, like a `simsimd_thread_pool_t`.
+ *  @see `simsimd_many_to_many_js_cached` for the remaining arguments.
+ */
+inline static void simsimd_many_to_many_js_cached_parallel(                                           //
+    simsimd_executor_t executor, void* executor_context, simsimd_divergence_term_punned_t mixture,    //
+    void const* a, simsimd_f64_t const* a_entropies, simsimd_size_t a_count, simsimd_size_t a_stride, //
+    void const* b, simsimd_f64_t const* b_entropies, simsimd_size_t b_count, simsimd_size_t b_stride, //
+    simsimd_size_t dimensions, simsimd_f32_t* results, simsimd_size_t results_stride) {
+
+    simsimd_many_to_many_cached_job_t job;
+    job.kind = simsimd_metric_js_k, job.term = mixture;
+    job.a = a, job.a_entropies = a_entropies, job.a_count = a_count, job.a_stride = a_stride;
+    job.b = b, job.b_entropies = b_entropies, job.b_count = b_count, job.b_stride = b_stride;
+    job.dimensions = dimensions, job.results = results, job.results_stride = results_stride;
+    simsimd_size_t slices = (a_count + SIMSIMD_PARALLEL_ROWS - 1) / SIMSIMD_PARALLEL_ROWS;
+    (executor ? executor : &simsimd_executor_serial)(executor_context, slices, &simsimd_many_to_many_cached_slice,
+                                                     &job);
+}
+
+/**
+ *  @brief  Arguments of `simsimd_pdist_parallel`, shared by all of its tasks.
+ */
+typedef struct simsimd_pdist_job_t {
+    simsimd_metric_punned_t metric;
+    simsimd_batch_punned_t batch;
+    void const* a;
+    simsimd_size_t count;
+    simsimd_size_t stride;
+    simsimd_size_t dimensions;
+    simsimd_f32_t* results;
+} simsimd_pdist_job_t;
+
+/**
+ *  @brief  Task computing the distances for two blocks of `SIMSIMD_PARALLEL_ROWS` rows: the `slice`-th from
+ *          the top of the triangle and the `slice`-th from the bottom, so that all tasks get similar work.
+ */
+inline static void simsimd_pdist_slice(void* context, simsimd_size_t slice) {
+    simsimd_pdist_job_t const* job = (simsimd_pdist_job_t const*)context;
+    simsimd_size_t blocks = (job->count + SIMSIMD_PARALLEL_ROWS - 1) / SIMSIMD_PARALLEL_ROWS;
+    simsimd_size_t folded[2] = {slice, blocks - 1 - slice};
+    for (simsimd_size_t k = 0; k != 2 - (folded[0] == folded[1]); ++k) {
+        simsimd_size_t first_row = folded[k] * SIMSIMD_PARALLEL_ROWS;
+        simsimd_size_t rows =
+            job->count - first_row < SIMSIMD_PARALLEL_ROWS ? job->count - first_row : SIMSIMD_PARALLEL_ROWS;
+        simsimd_pdist_rows(job->metric, job->batch, job->a, job->count, job->stride, job->dimensions, first_row,
+                           rows, job->results);
+    }
+}
+
+/**
+ *  @brief  Computes the condensed upper-triangle distances within one collection, like `simsimd_pdist`.
+ *          The rows are split into blocks of `SIMSIMD_PARALLEL_ROWS`, and every task pairs a block from
+ *          the top of the triangle, that has the longest rows, with one from the bottom, that has the
+ *          shortest, so the tasks are balanced without knowing the number of threads.
+ *
+ *  @param executor The executor to run the tasks on, or NULL to run them in the calling thread.
+ *  @param executor_context The opaque pointer passed to the executor, like a `simsimd_thread_pool_t`.
+ *  @see `simsimd_pdist` for the remaining arguments.
+ */
+inline static void simsimd_pdist_parallel(                                                 //
+    simsimd_executor_t executor, void* executor_context,                                   //
+    simsimd_metric_punned_t metric, simsimd_batch_punned_t batch,                          //
+    void const* a, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t dimensions, //
+    simsimd_f32_t* results) {
+
+    simsimd_pdist_job_t job;
+    job.metric = metric, job.batch = batch, job.a = a, job.count = count, job.stride = stride;
+    job.dimensions = dimensions, job.results = results;
+    simsimd_size_t blocks = (count + SIMSIMD_PARALLEL_ROWS - 1) / SIMSIMD_PARALLEL_ROWS;
+    simsimd_size_t slices = (blocks + 1) / 2;
+    (executor ? executor : &simsimd_executor_serial)(executor_context, slices, &simsimd_pdist_slice, &job);
+}
+
+#if SIMSIMD_MMAP
+
+#ifndef SIMSIMD_SCAN_CHUNK_BYTES
+/**
+ *  @brief  Number of bytes of a memory-mapped dataset, that `simsimd_mmap_topk` scans between the hints
+ *          to the kernel, asking to read the following chunks in advance.
+ */
+#define SIMSIMD_SCAN_CHUNK_BYTES (16 * 1024 * 1024)
+#endif
+
+#ifndef SIMSIMD_SCAN_PREFETCH_CHUNKS
+/**
+ *  @brief  Number of chunks ahead of the current one, that every task of `simsimd_mmap_topk` asks the
+ *          kernel to read in advance, so that the disk keeps working while the rows are being scored.
+ */
+#define SIMSIMD_SCAN_PREFETCH_CHUNKS 4
+#endif
+
+#ifndef SIMSIMD_SCAN_SLICES
+/**
+ *  @brief  Maximum number of tasks, that `simsimd_mmap_topk` splits a dataset into. Every task scans a
+ *          contiguous range of chunks sequentially, keeping its own heaps, that are merged in the end.
+ */
+#define SIMSIMD_SCAN_SLICES 64
+#endif
+
+/**
+ *  @brief  Read-only memory mapping of a dataset file with equidistant rows, either a raw row-major
+ *          matrix without any header, or the `.fvecs`, `.bvecs`, and `.ivecs` layouts, where every
+ *          row starts with a 32-bit integer, holding the number of dimensions.
+ */
+typedef struct simsimd_mmap_dataset_t {
+    char const* mapping;       ///< Start of the mapped file
+    simsimd_size_t bytes;      ///< Length of the mapped file
+    char const* rows;          ///< First scalar of the first row, past the optional row header
+    simsimd_size_t count;      ///< Number of rows
+    simsimd_size_t dimensions; ///< Number of scalars in every row
+    simsimd_size_t stride;     ///< Distance between the starts of consecutive rows in bytes
+} simsimd_mmap_dataset_t;
+
+/**
+ *  @brief  Maps a dataset file into memory, validating that its size matches the requested layout,
+ *          and hints the kernel, that the file will be read sequentially.
+ *
+ *  @param dataset The dataset to initialize.
+ *  @param path The path to the file.
+ *  @param scalar_bytes The number of bytes in every scalar, like 4 for `f32` or 1 for `i8`.
+ *  @param dimensions The number of scalars in every row, or zero to read it from the first `vecs` header.
+ *  @param with_headers Non-zero for the `vecs` layouts, where every row starts with its dimensions.
+ *  @return Zero on success, -1 if the file can't be opened or mapped, and `errno` is set,
+ *          or -2 if the size of the file doesn't match the layout.
+ */
+inline static int simsimd_mmap_dataset_open(simsimd_mmap_dataset_t* dataset, char const* path,
+                                            simsimd_size_t scalar_bytes, simsimd_size_t dimensions,
+                                            int with_headers) {
+    dataset->mapping = dataset->rows = NULL;
+    dataset->bytes = dataset->count = dataset->dimensions = dataset->stride = 0;
+    if (!with_headers && !dimensions)
+        return -2;
+
+    int descriptor = open(path, O_RDONLY);
+    if (descriptor < 0)
+        return -1;
+    struct stat status;
+    if (fstat(descriptor, &status) != 0) {
+        close(descriptor);
+        return -1;
+    }
+    simsimd_size_t const bytes = (simsimd_size_t)status.st_size;
+    if (bytes == 0) {
+        close(descriptor);
+        return -2;
+    }
+
+    // The descriptor isn't needed after mapping, as the mapping keeps its own reference to the file
+    void* mapping = mmap(NULL, bytes, PROT_READ, MAP_SHARED, descriptor, 0);
+    close(descriptor);
+    if (mapping == MAP_FAILED)
+        return -1;
+
+    simsimd_size_t header_bytes = 0;
+    if (with_headers) {
+        unsigned int first_dimensions = 0;
+        unsigned char const* header = (unsigned char const*)mapping;
+        if (bytes >= 4)
+            first_dimensions = (unsigned int)header[0] | ((unsigned int)header[1] << 8) |
+                               ((unsigned int)header[2] << 16) | ((unsigned int)header[3] << 24);
+        if (!first_dimensions || (dimensions && dimensions != first_dimensions)) {
+            munmap(mapping, bytes);
+            return -2;
+        }
+        dimensions = first_dimensions, header_bytes = 4;
+    }
+    simsimd_size_t const stride = header_bytes + dimensions * scalar_bytes;
+    if (bytes % stride) {
+        munmap(mapping, bytes);
+        return -2;
+    }
+
+    posix_madvise(mapping, bytes, POSIX_MADV_SEQUENTIAL);
+    dataset->mapping = (char const*)mapping;
+    dataset->bytes = bytes;
+    dataset->rows = (char const*)mapping + header_bytes;
+    dataset->count = bytes / stride;
+    dataset->dimensions = dimensions;
+    dataset->stride = stride;
+    return 0;
+}
+
+/**
+ *  @brief  Unmaps the dataset file.
+ */
+inline static void simsimd_mmap_dataset_close(simsimd_mmap_dataset_t* dataset) {
+    if (dataset->mapping)
+        munmap((void*)dataset->mapping, dataset->bytes);
+    dataset->mapping = dataset->rows = NULL;
+    dataset->bytes = dataset->count = 0;
+}
+
+/**
+ *  @brief  Arguments of the `simsimd_mmap_topk` tasks, shared by all of them, and the heaps of every
+ *          task for every query, each of `k` entries.
+ */
+typedef struct simsimd_mmap_topk_job_t {
+    simsimd_metric_punned_t metric;
+    simsimd_batch_punned_t batch;
+    simsimd_mmap_dataset_t const* dataset;
+    void const* queries;
+    simsimd_size_t queries_count;
+    simsimd_size_t queries_stride;
+    simsimd_size_t k;
+    simsimd_size_t chunk_rows;
+    simsimd_size_t chunks;
+    simsimd_size_t slices;
+    simsimd_size_t* slice_indices;
+    simsimd_f32_t* slice_distances;
+    simsimd_size_t* slice_sizes;
+} simsimd_mmap_topk_job_t;
+
+/**
+ *  @brief  Asks the kernel to read the given chunk of the dataset in advance, if it exists.
+ */
+inline static void simsimd_mmap_prefetch(simsimd_mmap_topk_job_t const* job, simsimd_size_t chunk) {
+    if (chunk >= job->chunks)
+        return;
+    simsimd_mmap_dataset_t const* dataset = job->dataset;
+    simsimd_size_t const page_mask = (simsimd_size_t)sysconf(_SC_PAGESIZE) - 1;
+    simsimd_size_t const first_byte = (chunk * job->chunk_rows * dataset->stride) & ~page_mask;
+    simsimd_size_t last_byte = (chunk + 1) * job->chunk_rows * dataset->stride;
+    if (last_byte > dataset->bytes)
+        last_byte = dataset->bytes;
+    posix_madvise((void*)(dataset->mapping + first_byte), last_byte - first_byte, POSIX_MADV_WILLNEED);
+}
+
+inline static void simsimd_mmap_topk_slice(void* context, simsimd_size_t slice) {
+    simsimd_mmap_topk_job_t const* job = (simsimd_mmap_topk_job_t const*)context;
+    simsimd_mmap_dataset_t const* dataset = job->dataset;
+    simsimd_size_t const k = job->k;
+    simsimd_size_t const first_chunk = slice * job->chunks / job->slices;
+    simsimd_size_t const last_chunk = (slice + 1) * job->chunks / job->slices;
+    simsimd_size_t* indices = job->slice_indices + slice * job->queries_count * k;
+    simsimd_f32_t* distances = job->slice_distances + slice * job->queries_count * k;
+    simsimd_size_t* sizes = job->slice_sizes + slice * job->queries_count;
+    simsimd_f32_t chunk_distances[SIMSIMD_TOPK_CHUNK];
+
+    for (simsimd_size_t chunk = first_chunk; chunk < first_chunk + SIMSIMD_SCAN_PREFETCH_CHUNKS; ++chunk)
+        if (chunk < last_chunk)
+            simsimd_mmap_prefetch(job, chunk);
+    for (simsimd_size_t chunk = first_chunk; chunk != last_chunk; ++chunk) {
+        if (chunk + SIMSIMD_SCAN_PREFETCH_CHUNKS < last_chunk)
+            simsimd_mmap_prefetch(job, chunk + SIMSIMD_SCAN_PREFETCH_CHUNKS);
+
+        // Every block of rows is scored against all the queries, while it's still in the cache
+        simsimd_size_t const first_row = chunk * job->chunk_rows;
+        simsimd_size_t const end_row =
+            first_row + job->chunk_rows < dataset->count ? first_row + job->chunk_rows : dataset->count;
+        for (simsimd_size_t block_start = first_row; block_start < end_row; block_start += SIMSIMD_TOPK_CHUNK) {
+            simsimd_size_t const block_length =
+                end_row - block_start < SIMSIMD_TOPK_CHUNK ? end_row - block_start : SIMSIMD_TOPK_CHUNK;
+            char const* block = dataset->rows + block_start * dataset->stride;
+            for (simsimd_size_t q = 0; q != job->queries_count; ++q) {
+                char const* query = (char const*)job->queries + q * job->queries_stride;
+                simsimd_one_to_many(job->metric, job->batch, query, block, block_length, dataset->stride,
+                                    dataset->dimensions, chunk_distances);
+                for (simsimd_size_t j = 0; j != block_length; ++j)
+                    simsimd_topk_push(indices + q * k, distances + q * k, sizes + q, k, block_start + j,
+                                      chunk_distances[j]);
+            }
+        }
+    }
+}
+
+/**
+ *  @brief  Finds the `k` closest rows of a memory-mapped dataset for every query, in a single pass over
+ *          the file. The dataset is split into up to `SIMSIMD_SCAN_SLICES` contiguous slices, scanned by
+ *          the `executor` tasks, that ask the kernel to read a few chunks ahead of the current one, so
+ *          that on multiple threads the reads overlap with the computation.
+ *
+ *  @param executor The executor to run the tasks on, or NULL to run them in the calling thread.
+ *  @param executor_context The context passed to the executor, like a `simsimd_thread_pool_t`.
+ *  @param metric The metric kernel for the datatype of the dataset.
+ *  @param batch The optional batch kernel for the same metric, or NULL.
+ *  @param dataset The mapped dataset.
+ *  @param queries Pointer to the first query, of the same datatype and dimensions.
+ *  @param queries_count Number of queries.
+ *  @param queries_stride Distance between the starts of consecutive queries in bytes.
+ *  @param k Number of the closest rows to find for every query.
+ *  @param indices Output matrix of `queries_count` rows of `k` indices, sorted by the distance.
+ *  @param distances Output matrix of `queries_count` rows of `k` distances.
+ *  @return Number of the found rows per query, the smaller of `k` and the number of rows,
+ *          or `(simsimd_size_t)-1` if the heaps couldn't be allocated.
+ */
+inline static simsimd_size_t simsimd_mmap_topk(                                       //
+    simsimd_executor_t executor, void* executor_context,                              //
+    simsimd_metric_punned_t metric, simsimd_batch_punned_t batch,                     //
+    simsimd_mmap_dataset_t const* dataset,                                            //
+    void const* queries, simsimd_size_t queries_count, simsimd_size_t queries_stride, //
+    simsimd_size_t k, simsimd_size_t* indices, simsimd_f32_t* distances) {
+
+    simsimd_mmap_topk_job_t job;
+    job.metric = metric, job.batch = batch, job.dataset = dataset;
+    job.queries = queries, job.queries_count = queries_count, job.queries_stride = queries_stride;
+    job.k = k < dataset->count ? k : dataset->count;
+    job.chunk_rows = SIMSIMD_SCAN_CHUNK_BYTES / dataset->stride;
+    if (job.chunk_rows < SIMSIMD_TOPK_CHUNK)
+        job.chunk_rows = SIMSIMD_TOPK_CHUNK;
+    job.chunks = (dataset->count + job.chunk_rows - 1) / job.chunk_rows;
+    job.slices = job.chunks < SIMSIMD_SCAN_SLICES ? job.chunks : SIMSIMD_SCAN_SLICES;
+    if (!job.k || !queries_count)
+        return job.k;
+
+    simsimd_size_t const heaps = job.slices * queries_count;
+    job.slice_indices = (simsimd_size_t*)malloc(heaps * job.k * sizeof(simsimd_size_t));
+    job.slice_distances = (simsimd_f32_t*)malloc(heaps * job.k * sizeof(simsimd_f32_t));
+    job.slice_sizes = (simsimd_size_t*)calloc(heaps, sizeof(simsimd_size_t));
+    if (!job.slice_indices || !job.slice_distances || !job.slice_sizes) {
+        free(job.slice_indices), free(job.slice_distances), free(job.slice_sizes);
+        return (simsimd_size_t)-1;
+    }
+    (executor ? executor : &simsimd_executor_serial)(executor_context, job.slices, &simsimd_mmap_topk_slice, &job);
+
+    // Merge the heaps of all the slices for every query
+    for (simsimd_size_t q = 0; q != queries_count; ++q) {
+        simsimd_size_t merged = 0;
+        for (simsimd_size_t slice = 0; slice != job.slices; ++slice) {
+            simsimd_size_t const heap = slice * queries_count + q;
+            for (simsimd_size_t j = 0; j != job.slice_sizes[heap]; ++j)
+                simsimd_topk_push(indices + q * job.k, distances + q * job.k, &merged, job.k,
+                                  job.slice_indices[heap * job.k + j], job.slice_distances[heap * job.k + j]);
+        }
+        simsimd_topk_sort(indices + q * job.k, distances + q * job.k, merged);
+    }
+    free(job.slice_indices), free(job.slice_distances), free(job.slice_sizes);
+    return job.k;
+}
+
+#endif // SIMSIMD_MMAP
+
+#if SIMSIMD_THREAD_POOL
+
+/**
+ *  @brief  Minimalistic POSIX thread pool, compatible with the `simsimd_executor_t` interface through
+ *          `simsimd_thread_pool_execute`. The calling thread participates in every execution, so a pool
+ *          for N threads keeps only N-1 workers, sleeping on a condition variable between the calls.
+ *          Tasks are claimed one at a time, so they should be coarse, like `SIMSIMD_PARALLEL_ROWS` rows.
+ *          Executions may be capped to fewer threads, than the pool has, with `simsimd_thread_pool_run`.
+ */
+typedef struct simsimd_thread_pool_t {
+    pthread_t* workers;
+    simsimd_size_t workers_count;
+    pthread_mutex_t mutex;
+    pthread_cond_t wake;
+    pthread_cond_t done;
+    simsimd_task_t task;
+    void* task_context;
+    simsimd_size_t tasks_count;
+    simsimd_size_t next_task;
+    simsimd_size_t finished_tasks;
+    simsimd_size_t generation;
+    simsimd_size_t helpers_limit; ///< Number of workers allowed to join the current execution
+    simsimd_size_t helpers;       ///< Number of workers, that joined the current execution
+    int busy;
+    int stopping;
+} simsimd_thread_pool_t;
+
+/**
+ *  @brief  Returns the address of the pointer to the pool, whose task the calling thread is running, if any.
+ *          A task, that runs another execution on the same pool, would otherwise wait for its own execution
+ *          to finish, so `simsimd_thread_pool_run` executes such nested calls inline instead.
+ */
+inline static simsimd_thread_pool_t** simsimd_thread_pool_running(void) {
+    static __thread simsimd_thread_pool_t* running = NULL;
+    return &running;
+}
+
+/**
+ *  @brief  Runs the unclaimed tasks of the current execution. Must be called with the `mutex` locked.
+ */
+inline static void simsimd_thread_pool_drain(simsimd_thread_pool_t* pool) {
+    simsimd_thread_pool_t** running = simsimd_thread_pool_running();
+    simsimd_thread_pool_t* outer = *running;
+    while (pool->next_task < pool->tasks_count) {
+        simsimd_size_t index = pool->next_task++;
+        simsimd_task_t task = pool->task;
+        void* task_context = pool->task_context;
+        pthread_mutex_unlock(&pool->mutex);
+        *running = pool;
+        task(task_context, index);
+        *running = outer;
+        pthread_mutex_lock(&pool->mutex);
+        if (++pool->finished_tasks == pool->tasks_count)
+            pthread_cond_broadcast(&pool->done);
+    }
+}
+
+inline static void* simsimd_thread_pool_worker(void* pool_ptr) {
+    simsimd_thread_pool_t* pool = (simsimd_thread_pool_t*)pool_ptr;
+    simsimd_size_t seen_generation = 0;
+    pthread_mutex_lock(&pool->mutex);
+    for (;;) {
+        while (!pool->stopping && pool->generation == seen_generation)
+            pthread_cond_wait(&pool->wake, &pool->mutex);
+        if (pool->stopping)
+            break;
+        seen_generation = pool->generation;
+        if (pool->helpers == pool->helpers_limit)
+            continue;
+        ++pool->helpers;
+        simsimd_thread_pool_drain(pool);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+    return NULL;
+}
+
+/**
+ *  @brief  Stops and joins all the workers of the pool, releasing its resources.
+ */
+inline static void simsimd_thread_pool_free(simsimd_thread_pool_t* pool) {
+    pthread_mutex_lock(&pool->mutex);
+    pool->stopping = 1;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->mutex);
+    for (simsimd_size_t i = 0; i != pool->workers_count; ++i)
+        pthread_join(pool->workers[i], NULL);
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->mutex);
+    free(pool->workers);
+    pool->workers = NULL;
+    pool->workers_count = 0;
+}
+
+/**
+ *  @brief  Initializes a thread pool, spawning the workers.
+ *
+ *  @param pool The pool to initialize.
+ *  @param threads The total number of threads, including the calling one, or zero for all the online cores.
+ *  @return Zero on success, or a non-zero value if the workers couldn't be spawned.
+ */
+inline static int simsimd_thread_pool_init(simsimd_thread_pool_t* pool, simsimd_size_t threads) {
+    if (threads == 0) {
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cores > 0 ? (simsimd_size_t)cores : 1;
+    }
+
+    pool->workers = threads > 1 ? (pthread_t*)malloc((threads - 1) * sizeof(pthread_t)) : NULL;
+    pool->workers_count = 0;
+    pool->task = NULL;
+    pool->task_context = NULL;
+    pool->tasks_count = pool->next_task = pool->finished_tasks = pool->generation = 0;
+    pool->helpers_limit = pool->helpers = 0;
+    pool->busy = pool->stopping = 0;
+    if (threads > 1 && !pool->workers)
+        return -1;
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    for (; pool->workers_count + 1 < threads; ++pool->workers_count)
+        if (pthread_create(&pool->workers[pool->workers_count], NULL, &simsimd_thread_pool_worker, pool) != 0) {
+            simsimd_thread_pool_free(pool);
+            return -1;
+        }
+    return 0;
+}
+
+/**
+ *  @brief  Executes `count` tasks on at most `threads` threads of the pool, including the calling one.
+ *          Concurrent executions on the same pool are serialized, waiting for the previous one to finish.
+ *          Nested executions, started from within a task of the same pool, run serially on the calling thread.
+ *
+ *  @param pool The pool to run on, or NULL to run serially.
+ *  @param threads The maximum number of threads to use, or zero for all the threads of the pool.
+ *  @param count The number of tasks to execute.
+ *  @param task The task to call with every index in `[0, count)`.
+ *  @param context The opaque pointer passed to every `task` call.
+ */
+inline static void simsimd_thread_pool_run(simsimd_thread_pool_t* pool, simsimd_size_t threads, simsimd_size_t count,
+                                           simsimd_task_t task, void* context) {
+    if (!pool || pool->workers_count == 0 || threads == 1 || count <= 1 || *simsimd_thread_pool_running() == pool) {
+        simsimd_executor_serial(NULL, count, task, context);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->mutex);
+    while (pool->busy)
+        pthread_cond_wait(&pool->done, &pool->mutex);
+    pool->busy = 1;
+    pool->task = task;
+    pool->task_context = context;
+    pool->tasks_count = count;
+    pool->next_task = pool->finished_tasks = 0;
+    pool->helpers_limit = threads == 0 || threads > pool->workers_count ? pool->workers_count : threads - 1;
+    pool->helpers = 0;
+    ++pool->generation;
+    pthread_cond_broadcast(&pool->wake);
+    simsimd_thread_pool_drain(pool);
+    while (pool->finished_tasks != pool->tasks_count)
+        pthread_cond_wait(&pool->done, &pool->mutex);
+    // Wake the callers waiting for their own execution to start
+    pool->busy = 0;
+    pthread_cond_broadcast(&pool->done);
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+/**
+ *  @brief  Executes `count` tasks on all the threads of the pool passed as the `executor`,
+ *          matching the `simsimd_executor_t`. Concurrent executions on the same pool are serialized.
+ */
+inline static void simsimd_thread_pool_execute(void* executor, simsimd_size_t count, simsimd_task_t task,
+                                               void* context) {
+    simsimd_thread_pool_run((simsimd_thread_pool_t*)executor, 0, count, task, context);
+}
+
+#endif // SIMSIMD_THREAD_POOL
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,265 @@
+/**
+ *  @brief      SIMD-accelerated Similarity Measures for Sparse Vectors.
+ *  @author     Ash Vardanian
+ *  @date       October 14, 2026
+ *
+ *  Contains:
+ *  - Intersection size of two sorted sets of indices
+ *  - Weighted dot product of two sparse vectors, with sorted indices and one weight per index
+ *
+ *  Sparse vectors, like the lexical SPLADE or BM25 ones, are stored as arrays of strictly increasing
+ *  `u32` indices of the non-zero dimensions, and arrays of weights of the same length. Only the weights
+ *  of the indices present in both vectors contribute to the dot product.
+ *
+ *  For datatypes:
+ *  - 32-bit unsigned integer indices
+ *  - 32-bit and 16-bit floating-point weights
+ *
+ *  For hardware architectures:
+ *  - Arm (SVE)
+ *  - x86 (AVX512)
+ *
+ *  x86 intrinsics: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/
+ *  Arm intrinsics: https://developer.arm.com/architectures/instruction-sets/intrinsics/
+ */
+
+#pragma once
+#include "types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  @brief  Merges two sorted sets of indices, starting from the given positions, and counts the common ones.
+ *          The SIMD kernels use it for the parts of the inputs shorter than a register.
+ */
+inline static simsimd_size_t simsimd_serial_u32_intersect( //
+    simsimd_u32_t const* a, simsimd_u32_t const* b, simsimd_size_t a_length, simsimd_size_t b_length) {
+    simsimd_size_t i = 0, j = 0, intersection = 0;
+    while (i != a_length && j != b_length) {
+        simsimd_u32_t a_index = a[i], b_index = b[j];
+        intersection += a_index == b_index;
+        i += a_index <= b_index;
+        j += b_index <= a_index;
+    }
+    return intersection;
+}
+
+#define SIMSIMD_MAKE_SPARSE_DOT(name, weight_type, converter)                                                   \
+    inline static void simsimd_##name##_##weight_type##_spdot(                                                  \
+        simsimd_u32_t const* a, simsimd_u32_t const* b, void const* a_weights, void const* b_weights,           \
+        simsimd_size_t a_length, simsimd_size_t b_length, simsimd_size_t* intersection, simsimd_f32_t* product) { \
+        simsimd_##weight_type##_t const* a_w = (simsimd_##weight_type##_t const*)a_weights;                     \
+        simsimd_##weight_type##_t const* b_w = (simsimd_##weight_type##_t const*)b_weights;                     \
+        simsimd_size_t i = 0, j = 0, matches = 0;                                                               \
+        simsimd_f32_t sum = 0;                                                                                  \
+        while (i != a_length && j != b_length) {                                                                \
+            simsimd_u32_t a_index = a[i], b_index = b[j];                                                       \
+            if (a_index == b_index) {                                                                           \
+                simsimd_f32_t a_weight = converter(a_w[i]), b_weight = converter(b_w[j]);                       \
+                sum += a_weight * b_weight, ++matches;                                                          \
+            }                                                                                                   \
+            i += a_index <= b_index;                                                                            \
+            j += b_index <= a_index;                                                                            \
+        }                                                                                                       \
+        *intersection = matches;                                                                                \
+        *product = sum;                                                                                         \
+    }
+
+SIMSIMD_MAKE_SPARSE_DOT(serial, f32, SIMSIMD_IDENTIFY) // simsimd_serial_f32_spdot
+SIMSIMD_MAKE_SPARSE_DOT(serial, f16, SIMSIMD_UNCOMPRESS_F16) // simsimd_serial_f16_spdot
+
+#undef SIMSIMD_MAKE_SPARSE_DOT
+
+#if SIMSIMD_TARGET_ARM
+#if SIMSIMD_TARGET_ARM_SVE
+
+/*
+ *  @file   arm_sve_sparse.h
+ *  @brief  Arm SVE implementation of the sparse intersections and weighted dot products.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: intersection size, weighted dot product with `f32` and `f16` weights.
+ *  - Compares every lane of one block of indices with every lane of the other, rotating it with `svext`,
+ *    as the SVE2 `svmatch` only supports 8-bit and 16-bit elements.
+ *  - Advances the block with the smaller last index, and merges the tails shorter than a register serially.
+ *  - Requires compiler capabilities: sve.
+ */
+
+__attribute__((target("+sve"))) //
+inline static simsimd_size_t
+simsimd_sve_u32_intersect(simsimd_u32_t const* a, simsimd_u32_t const* b, simsimd_size_t a_length,
+                          simsimd_size_t b_length) {
+    simsimd_size_t const lanes = svcntw();
+    svbool_t const pg_vec = svptrue_b32();
+    simsimd_size_t i = 0, j = 0, intersection = 0;
+    while (i + lanes <= a_length && j + lanes <= b_length) {
+        simsimd_u32_t a_max = a[i + lanes - 1], b_max = b[j + lanes - 1];
+        if (a_max < b[j] || b_max < a[i]) {
+            int const skip_a = a_max < b[j];
+            i += skip_a ? lanes : 0, j += skip_a ? 0 : lanes;
+            continue;
+        }
+        svuint32_t a_vec = svld1_u32(pg_vec, a + i);
+        svuint32_t b_vec = svld1_u32(pg_vec, b + j);
+        svbool_t matches = svpfalse_b();
+        for (simsimd_size_t k = 0; k != lanes; ++k) {
+            matches = svorr_b_z(pg_vec, matches, svcmpeq_u32(pg_vec, a_vec, b_vec));
+            b_vec = svext_u32(b_vec, b_vec, 1);
+        }
+        intersection += svcntp_b32(pg_vec, matches);
+        i += a_max <= b_max ? lanes : 0;
+        j += b_max <= a_max ? lanes : 0;
+    }
+    return intersection + simsimd_serial_u32_intersect(a + i, b + j, a_length - i, b_length - j);
+}
+
+#define SIMSIMD_SVE_MAKE_SPARSE_DOT(weight_type, load)                                                           \
+    __attribute__((target("+sve"))) inline static void simsimd_sve_##weight_type##_spdot(                        \
+        simsimd_u32_t const* a, simsimd_u32_t const* b, void const* a_weights, void const* b_weights,            \
+        simsimd_size_t a_length, simsimd_size_t b_length, simsimd_size_t* intersection, simsimd_f32_t* product) { \
+        simsimd_##weight_type##_t const* a_w = (simsimd_##weight_type##_t const*)a_weights;                      \
+        simsimd_##weight_type##_t const* b_w = (simsimd_##weight_type##_t const*)b_weights;                      \
+        simsimd_size_t const lanes = svcntw();                                                                   \
+        svbool_t const pg_vec = svptrue_b32();                                                                   \
+        svfloat32_t product_vec = svdup_f32(0);                                                                  \
+        simsimd_size_t i = 0, j = 0, matches_count = 0;                                                          \
+        while (i + lanes <= a_length && j + lanes <= b_length) {                                                 \
+            simsimd_u32_t a_max = a[i + lanes - 1], b_max = b[j + lanes - 1];                                    \
+            if (a_max < b[j] || b_max < a[i]) {                                                                  \
+                int const skip_a = a_max < b[j];                                                                 \
+                i += skip_a ? lanes : 0, j += skip_a ? 0 : lanes;                                                \
+                continue;                                                                                        \
+            }                                                                                                    \
+            svuint32_t a_vec = svld1_u32(pg_vec, a + i);                                                         \
+            svuint32_t b_vec = svld1_u32(pg_vec, b + j);                                                         \
+            svfloat32_t a_w_vec = load(pg_vec, a_w + i);                                                         \
+            svfloat32_t b_w_vec = load(pg_vec, b_w + j);                                                         \
+            svbool_t matches = svpfalse_b();                                                                     \
+            for (simsimd_size_t k = 0; k != lanes; ++k) {                                                        \
+                svbool_t equal = svcmpeq_u32(pg_vec, a_vec, b_vec);                                              \
+                product_vec = svmla_f32_m(equal, product_vec, a_w_vec, b_w_vec);                                 \
+                matches = svorr_b_z(pg_vec, matches, equal);                                                     \
+                b_vec = svext_u32(b_vec, b_vec, 1);                                                              \
+                b_w_vec = svext_f32(b_w_vec, b_w_vec, 1);                                                        \
+            }                                                                                                    \
+            matches_count += svcntp_b32(pg_vec, matches);                                                        \
+            i += a_max <= b_max ? lanes : 0;                                                                     \
+            j += b_max <= a_max ? lanes : 0;                                                                     \
+        }                                                                                                        \
+        simsimd_serial_##weight_type##_spdot(a + i, b + j, a_w + i, b_w + j, a_length - i, b_length - j,         \
+                                             intersection, product);                                             \
+        *intersection += matches_count;                                                                          \
+        *product += svaddv_f32(pg_vec, product_vec);                                                             \
+    }
+
+#define SIMSIMD_SVE_LOAD_F32(pg_vec, x) svld1_f32(pg_vec, x)
+#define SIMSIMD_SVE_LOAD_F16(pg_vec, x)                                                                                \
+    svcvt_f32_f16_x(pg_vec, svreinterpret_f16_u32(svld1uh_u32(pg_vec, (uint16_t const*)(x))))
+
+SIMSIMD_SVE_MAKE_SPARSE_DOT(f32, SIMSIMD_SVE_LOAD_F32) // simsimd_sve_f32_spdot
+SIMSIMD_SVE_MAKE_SPARSE_DOT(f16, SIMSIMD_SVE_LOAD_F16) // simsimd_sve_f16_spdot
+
+#undef SIMSIMD_SVE_LOAD_F32
+#undef SIMSIMD_SVE_LOAD_F16
+#undef SIMSIMD_SVE_MAKE_SPARSE_DOT
+
+#endif // SIMSIMD_TARGET_ARM_SVE
+#endif // SIMSIMD_TARGET_ARM
+
+#if SIMSIMD_TARGET_X86
+#if SIMSIMD_TARGET_X86_AVX512
+
+/*
+ *  @file   x86_avx512_sparse.h
+ *  @brief  x86 AVX-512 implementation of the sparse intersections and weighted dot products.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: intersection size, weighted dot product with `f32` and `f16` weights.
+ *  - Compares every lane of one block of 16 indices with every lane of the other, rotating it with
+ *    `_mm512_alignr_epi32`, instead of `vp2intersectd`, which only a few CPUs support, and slowly.
+ *  - Accumulates the products of matching weights with masked `_mm512_mask3_fmadd_ps`.
+ *  - Advances the block with the smaller last index, and merges the tails shorter than a register serially.
+ *  - Requires compiler capabilities: avx512f, avx512vl, popcnt.
+ */
+
+__attribute__((target("avx512f,avx512vl,popcnt"))) //
+inline static simsimd_size_t
+simsimd_avx512_u32_intersect(simsimd_u32_t const* a, simsimd_u32_t const* b, simsimd_size_t a_length,
+                             simsimd_size_t b_length) {
+    simsimd_size_t i = 0, j = 0, intersection = 0;
+    while (i + 16 <= a_length && j + 16 <= b_length) {
+        simsimd_u32_t a_max = a[i + 15], b_max = b[j + 15];
+        if (a_max < b[j] || b_max < a[i]) {
+            int const skip_a = a_max < b[j];
+            i += skip_a ? 16 : 0, j += skip_a ? 0 : 16;
+            continue;
+        }
+        __m512i a_vec = _mm512_loadu_si512(a + i);
+        __m512i b_vec = _mm512_loadu_si512(b + j);
+        __mmask16 matches = _mm512_cmpeq_epi32_mask(a_vec, b_vec);
+        for (int k = 1; k != 16; ++k) {
+            b_vec = _mm512_alignr_epi32(b_vec, b_vec, 1);
+            matches |= _mm512_cmpeq_epi32_mask(a_vec, b_vec);
+        }
+        intersection += _mm_popcnt_u32(matches);
+        i += a_max <= b_max ? 16 : 0;
+        j += b_max <= a_max ? 16 : 0;
+    }
+    return intersection + simsimd_serial_u32_intersect(a + i, b + j, a_length - i, b_length - j);
+}
+
+#define SIMSIMD_AVX512_MAKE_SPARSE_DOT(weight_type, load)                                                        \
+    __attribute__((target("avx512f,avx512vl,popcnt"))) inline static void simsimd_avx512_##weight_type##_spdot(  \
+        simsimd_u32_t const* a, simsimd_u32_t const* b, void const* a_weights, void const* b_weights,            \
+        simsimd_size_t a_length, simsimd_size_t b_length, simsimd_size_t* intersection, simsimd_f32_t* product) { \
+        simsimd_##weight_type##_t const* a_w = (simsimd_##weight_type##_t const*)a_weights;                      \
+        simsimd_##weight_type##_t const* b_w = (simsimd_##weight_type##_t const*)b_weights;                      \
+        __m512 product_vec = _mm512_setzero_ps();                                                                \
+        simsimd_size_t i = 0, j = 0, matches_count = 0;                                                          \
+        while (i + 16 <= a_length && j + 16 <= b_length) {                                                       \
+            simsimd_u32_t a_max = a[i + 15], b_max = b[j + 15];                                                  \
+            if (a_max < b[j] || b_max < a[i]) {                                                                  \
+                int const skip_a = a_max < b[j];                                                                 \
+                i += skip_a ? 16 : 0, j += skip_a ? 0 : 16;                                                      \
+                continue;                                                                                        \
+            }                                                                                                    \
+            __m512i a_vec = _mm512_loadu_si512(a + i);                                                           \
+            __m512i b_vec = _mm512_loadu_si512(b + j);                                                           \
+            __m512 a_w_vec = load(a_w + i);                                                                      \
+            __m512i b_w_vec = _mm512_castps_si512(load(b_w + j));                                                \
+            __mmask16 matches = 0;                                                                               \
+            for (int k = 0; k != 16; ++k) {                                                                      \
+                __mmask16 equal = _mm512_cmpeq_epi32_mask(a_vec, b_vec);                                         \
+                product_vec = _mm512_mask3_fmadd_ps(a_w_vec, _mm512_castsi512_ps(b_w_vec), product_vec, equal);  \
+                matches |= equal;                                                                                \
+                b_vec = _mm512_alignr_epi32(b_vec, b_vec, 1);                                                    \
+                b_w_vec = _mm512_alignr_epi32(b_w_vec, b_w_vec, 1);                                              \
+            }                                                                                                    \
+            matches_count += _mm_popcnt_u32(matches);                                                            \
+            i += a_max <= b_max ? 16 : 0;                                                                        \
+            j += b_max <= a_max ? 16 : 0;                                                                        \
+        }                                                                                                        \
+        simsimd_serial_##weight_type##_spdot(a + i, b + j, a_w + i, b_w + j, a_length - i, b_length - j,         \
+                                             intersection, product);                                             \
+        *intersection += matches_count;                                                                          \
+        *product += _mm512_reduce_add_ps(product_vec);                                                           \
+    }
+
+#define SIMSIMD_AVX512_LOAD_F32(x) _mm512_loadu_ps(x)
+#define SIMSIMD_AVX512_LOAD_F16(x) _mm512_cvtph_ps(_mm256_loadu_si256((__m256i const*)(x)))
+
+SIMSIMD_AVX512_MAKE_SPARSE_DOT(f32, SIMSIMD_AVX512_LOAD_F32) // simsimd_avx512_f32_spdot
+SIMSIMD_AVX512_MAKE_SPARSE_DOT(f16, SIMSIMD_AVX512_LOAD_F16) // simsimd_avx512_f16_spdot
+
+#undef SIMSIMD_AVX512_LOAD_F32
+#undef SIMSIMD_AVX512_LOAD_F16
+#undef SIMSIMD_AVX512_MAKE_SPARSE_DOT
+
+#endif // SIMSIMD_TARGET_X86_AVX512
+#endif // SIMSIMD_TARGET_X86
+
+#ifdef __cplusplus
+}
+#endif
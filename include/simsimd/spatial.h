@@ -7,15 +7,22 @@
  *  - L2 (Euclidean) squared distance
  *  - Inner product distance
  *  - Cosine similarity
+ *  - One-to-many batch variants of the above, comparing a query against many rows
+ *  - Mixed-precision variants of the above, comparing vectors of different datatypes
+ *  - Fixed-dimension variants of the above, for the common embedding sizes
  *
  *  For datatypes:
+ *  - 64-bit floating point numbers
  *  - 32-bit floating point numbers
  *  - 16-bit floating point numbers
- *  - 8-bit signed integral numbers
+ *  - 16-bit brain floating point numbers
+ *  - 8-bit signed and unsigned integral numbers
+ *  - 4-bit signed integral numbers, packed in pairs into 8-bit words
+ *  - Pairs of the above: `f32` and `f16`, `f32` and `i8`, `f16` and `i8`
  *
  *  For hardware architectures:
- *  - Arm (NEON, SVE)
- *  - x86 (AVX2, AVX512)
+ *  - Arm (NEON, DotProd, SVE)
+ *  - x86 (AVX2, AVX512, AMX)
  *
  *  x86 intrinsics: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/
  *  Arm intrinsics: https://developer.arm.com/architectures/instruction-sets/intrinsics/
@@ -62,10 +69,72 @@
         return ab != 0 ? (1 - ab * SIMSIMD_RSQRT(a2) * SIMSIMD_RSQRT(b2)) : 1;                                         \
     }
 
+/*
+ *  The mixed-precision kernels compare a query of one datatype against a vector of another, like an `f32` query
+ *  against an `i8` or `f16` database row. The second vector can be scaled by `b_scale`, to support per-vector
+ *  quantization, and the unscaled variants are compatible with `simsimd_metric_punned_t`.
+ */
+
+#define SIMSIMD_MAKE_MIXED_L2SQ(name, a_type, b_type, accumulator_type, a_converter, b_converter)                      \
+    inline static simsimd_f32_t simsimd_##name##_##a_type##b_type##_l2sq_scaled(                                       \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n, simsimd_f32_t b_scale) {       \
+        simsimd_##accumulator_type##_t d2 = 0;                                                                         \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                                      \
+            simsimd_##accumulator_type##_t ai = a_converter(a[i]);                                                     \
+            simsimd_##accumulator_type##_t bi = (simsimd_##accumulator_type##_t)b_scale * b_converter(b[i]);           \
+            d2 += (ai - bi) * (ai - bi);                                                                               \
+        }                                                                                                              \
+        return d2;                                                                                                     \
+    }                                                                                                                  \
+    inline static simsimd_f32_t simsimd_##name##_##a_type##b_type##_l2sq(                                              \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n) {                              \
+        return simsimd_##name##_##a_type##b_type##_l2sq_scaled(a, b, n, 1);                                            \
+    }
+
+#define SIMSIMD_MAKE_MIXED_IP(name, a_type, b_type, accumulator_type, a_converter, b_converter)                        \
+    inline static simsimd_f32_t simsimd_##name##_##a_type##b_type##_ip_scaled(                                         \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n, simsimd_f32_t b_scale) {       \
+        simsimd_##accumulator_type##_t ab = 0;                                                                         \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                                      \
+            simsimd_##accumulator_type##_t ai = a_converter(a[i]);                                                     \
+            simsimd_##accumulator_type##_t bi = b_converter(b[i]);                                                     \
+            ab += ai * bi;                                                                                             \
+        }                                                                                                              \
+        return 1 - (simsimd_##accumulator_type##_t)b_scale * ab;                                                       \
+    }                                                                                                                  \
+    inline static simsimd_f32_t simsimd_##name##_##a_type##b_type##_ip(                                                \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n) {                              \
+        return simsimd_##name##_##a_type##b_type##_ip_scaled(a, b, n, 1);                                              \
+    }
+
+#define SIMSIMD_MAKE_MIXED_COS(name, a_type, b_type, accumulator_type, a_converter, b_converter)                       \
+    inline static simsimd_f32_t simsimd_##name##_##a_type##b_type##_cos_scaled(                                        \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n, simsimd_f32_t b_scale) {       \
+        simsimd_##accumulator_type##_t ab = 0, a2 = 0, b2 = 0;                                                         \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                                      \
+            simsimd_##accumulator_type##_t ai = a_converter(a[i]);                                                     \
+            simsimd_##accumulator_type##_t bi = b_converter(b[i]);                                                     \
+            ab += ai * bi;                                                                                             \
+            a2 += ai * ai;                                                                                             \
+            b2 += bi * bi;                                                                                             \
+        }                                                                                                              \
+        /* The scale only affects the sign of the cosine, as the norm of `b` absorbs its magnitude */                  \
+        ab = b_scale < 0 ? -ab : ab;                                                                                   \
+        return ab != 0 ? (1 - ab * SIMSIMD_RSQRT(a2) * SIMSIMD_RSQRT(b2)) : 1;                                         \
+    }                                                                                                                  \
+    inline static simsimd_f32_t simsimd_##name##_##a_type##b_type##_cos(                                               \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n) {                              \
+        return simsimd_##name##_##a_type##b_type##_cos_scaled(a, b, n, 1);                                             \
+    }
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+SIMSIMD_MAKE_L2SQ(serial, f64, f64, SIMSIMD_IDENTIFY) // simsimd_serial_f64_l2sq
+SIMSIMD_MAKE_IP(serial, f64, f64, SIMSIMD_IDENTIFY)   // simsimd_serial_f64_ip
+SIMSIMD_MAKE_COS(serial, f64, f64, SIMSIMD_IDENTIFY)  // simsimd_serial_f64_cos
+
 SIMSIMD_MAKE_L2SQ(serial, f32, f32, SIMSIMD_IDENTIFY) // simsimd_serial_f32_l2sq
 SIMSIMD_MAKE_IP(serial, f32, f32, SIMSIMD_IDENTIFY)   // simsimd_serial_f32_ip
 SIMSIMD_MAKE_COS(serial, f32, f32, SIMSIMD_IDENTIFY)  // simsimd_serial_f32_cos
@@ -74,6 +143,10 @@ SIMSIMD_MAKE_L2SQ(serial, f16, f32, SIMSIMD_UNCOMPRESS_F16) // simsimd_serial_f1
 SIMSIMD_MAKE_IP(serial, f16, f32, SIMSIMD_UNCOMPRESS_F16)   // simsimd_serial_f16_ip
 SIMSIMD_MAKE_COS(serial, f16, f32, SIMSIMD_UNCOMPRESS_F16)  // simsimd_serial_f16_cos
 
+SIMSIMD_MAKE_L2SQ(serial, bf16, f32, SIMSIMD_UNCOMPRESS_BF16) // simsimd_serial_bf16_l2sq
+SIMSIMD_MAKE_IP(serial, bf16, f32, SIMSIMD_UNCOMPRESS_BF16)   // simsimd_serial_bf16_ip
+SIMSIMD_MAKE_COS(serial, bf16, f32, SIMSIMD_UNCOMPRESS_BF16)  // simsimd_serial_bf16_cos
+
 SIMSIMD_MAKE_L2SQ(serial, i8, i32, SIMSIMD_IDENTIFY) // simsimd_serial_i8_l2sq
 SIMSIMD_MAKE_COS(serial, i8, i32, SIMSIMD_IDENTIFY)  // simsimd_serial_i8_cos
 
@@ -81,6 +154,47 @@ inline static simsimd_f32_t simsimd_serial_i8_ip(simsimd_i8_t const* a, simsimd_
     return simsimd_serial_i8_cos(a, b, n);
 }
 
+SIMSIMD_MAKE_L2SQ(serial, u8, i32, SIMSIMD_IDENTIFY) // simsimd_serial_u8_l2sq
+SIMSIMD_MAKE_COS(serial, u8, i32, SIMSIMD_IDENTIFY)  // simsimd_serial_u8_cos
+
+inline static simsimd_f32_t simsimd_serial_u8_ip(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n) {
+    return simsimd_serial_u8_cos(a, b, n);
+}
+
+/*
+ *  The `i4x2` kernels take `n` as the number of bytes, like the `b8` kernels, so the vectors have `2n` dimensions.
+ *  Integer products of 4-bit numbers are exact, so no separate `accurate` variants are needed.
+ */
+
+inline static simsimd_f32_t simsimd_serial_i4x2_l2sq(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b,
+                                                     simsimd_size_t n) {
+    simsimd_i32_t d2 = 0;
+    for (simsimd_size_t i = 0; i != n; ++i) {
+        simsimd_i32_t d_low = SIMSIMD_I4X2_LOW(a[i]) - SIMSIMD_I4X2_LOW(b[i]);
+        simsimd_i32_t d_high = SIMSIMD_I4X2_HIGH(a[i]) - SIMSIMD_I4X2_HIGH(b[i]);
+        d2 += d_low * d_low + d_high * d_high;
+    }
+    return d2;
+}
+
+inline static simsimd_f32_t simsimd_serial_i4x2_cos(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b,
+                                                    simsimd_size_t n) {
+    simsimd_i32_t ab = 0, a2 = 0, b2 = 0;
+    for (simsimd_size_t i = 0; i != n; ++i) {
+        simsimd_i32_t a_low = SIMSIMD_I4X2_LOW(a[i]), a_high = SIMSIMD_I4X2_HIGH(a[i]);
+        simsimd_i32_t b_low = SIMSIMD_I4X2_LOW(b[i]), b_high = SIMSIMD_I4X2_HIGH(b[i]);
+        ab += a_low * b_low + a_high * b_high;
+        a2 += a_low * a_low + a_high * a_high;
+        b2 += b_low * b_low + b_high * b_high;
+    }
+    return ab != 0 ? (1 - ab * SIMSIMD_RSQRT(a2) * SIMSIMD_RSQRT(b2)) : 1;
+}
+
+inline static simsimd_f32_t simsimd_serial_i4x2_ip(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b,
+                                                   simsimd_size_t n) {
+    return simsimd_serial_i4x2_cos(a, b, n);
+}
+
 SIMSIMD_MAKE_L2SQ(accurate, f32, f64, SIMSIMD_IDENTIFY) // simsimd_accurate_f32_l2sq
 SIMSIMD_MAKE_IP(accurate, f32, f64, SIMSIMD_IDENTIFY)   // simsimd_accurate_f32_ip
 SIMSIMD_MAKE_COS(accurate, f32, f64, SIMSIMD_IDENTIFY)  // simsimd_accurate_f32_cos
@@ -89,6 +203,10 @@ SIMSIMD_MAKE_L2SQ(accurate, f16, f64, SIMSIMD_UNCOMPRESS_F16) // simsimd_accurat
 SIMSIMD_MAKE_IP(accurate, f16, f64, SIMSIMD_UNCOMPRESS_F16)   // simsimd_accurate_f16_ip
 SIMSIMD_MAKE_COS(accurate, f16, f64, SIMSIMD_UNCOMPRESS_F16)  // simsimd_accurate_f16_cos
 
+SIMSIMD_MAKE_L2SQ(accurate, bf16, f64, SIMSIMD_UNCOMPRESS_BF16) // simsimd_accurate_bf16_l2sq
+SIMSIMD_MAKE_IP(accurate, bf16, f64, SIMSIMD_UNCOMPRESS_BF16)   // simsimd_accurate_bf16_ip
+SIMSIMD_MAKE_COS(accurate, bf16, f64, SIMSIMD_UNCOMPRESS_BF16)  // simsimd_accurate_bf16_cos
+
 SIMSIMD_MAKE_L2SQ(accurate, i8, i32, SIMSIMD_IDENTIFY) // simsimd_accurate_i8_l2sq
 SIMSIMD_MAKE_COS(accurate, i8, i32, SIMSIMD_IDENTIFY)  // simsimd_accurate_i8_cos
 
@@ -96,9 +214,77 @@ inline static simsimd_f32_t simsimd_accurate_i8_ip(simsimd_i8_t const* a, simsim
     return simsimd_accurate_i8_cos(a, b, n);
 }
 
+SIMSIMD_MAKE_L2SQ(accurate, u8, i32, SIMSIMD_IDENTIFY) // simsimd_accurate_u8_l2sq
+SIMSIMD_MAKE_COS(accurate, u8, i32, SIMSIMD_IDENTIFY)  // simsimd_accurate_u8_cos
+
+inline static simsimd_f32_t simsimd_accurate_u8_ip(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n) {
+    return simsimd_accurate_u8_cos(a, b, n);
+}
+
+SIMSIMD_MAKE_MIXED_L2SQ(serial, f32, f16, f32, SIMSIMD_IDENTIFY, SIMSIMD_UNCOMPRESS_F16) // simsimd_serial_f32f16_l2sq
+SIMSIMD_MAKE_MIXED_IP(serial, f32, f16, f32, SIMSIMD_IDENTIFY, SIMSIMD_UNCOMPRESS_F16)   // simsimd_serial_f32f16_ip
+SIMSIMD_MAKE_MIXED_COS(serial, f32, f16, f32, SIMSIMD_IDENTIFY, SIMSIMD_UNCOMPRESS_F16)  // simsimd_serial_f32f16_cos
+
+SIMSIMD_MAKE_MIXED_L2SQ(serial, f32, i8, f32, SIMSIMD_IDENTIFY, SIMSIMD_IDENTIFY) // simsimd_serial_f32i8_l2sq
+SIMSIMD_MAKE_MIXED_IP(serial, f32, i8, f32, SIMSIMD_IDENTIFY, SIMSIMD_IDENTIFY)   // simsimd_serial_f32i8_ip
+SIMSIMD_MAKE_MIXED_COS(serial, f32, i8, f32, SIMSIMD_IDENTIFY, SIMSIMD_IDENTIFY)  // simsimd_serial_f32i8_cos
+
+SIMSIMD_MAKE_MIXED_L2SQ(serial, f16, i8, f32, SIMSIMD_UNCOMPRESS_F16, SIMSIMD_IDENTIFY) // simsimd_serial_f16i8_l2sq
+SIMSIMD_MAKE_MIXED_IP(serial, f16, i8, f32, SIMSIMD_UNCOMPRESS_F16, SIMSIMD_IDENTIFY)   // simsimd_serial_f16i8_ip
+SIMSIMD_MAKE_MIXED_COS(serial, f16, i8, f32, SIMSIMD_UNCOMPRESS_F16, SIMSIMD_IDENTIFY)  // simsimd_serial_f16i8_cos
+
+SIMSIMD_MAKE_MIXED_L2SQ(accurate, f32, f16, f64, SIMSIMD_IDENTIFY, SIMSIMD_UNCOMPRESS_F16) // simsimd_accurate_f32f16_l2sq
+SIMSIMD_MAKE_MIXED_IP(accurate, f32, f16, f64, SIMSIMD_IDENTIFY, SIMSIMD_UNCOMPRESS_F16)   // simsimd_accurate_f32f16_ip
+SIMSIMD_MAKE_MIXED_COS(accurate, f32, f16, f64, SIMSIMD_IDENTIFY, SIMSIMD_UNCOMPRESS_F16)  // simsimd_accurate_f32f16_cos
+
+SIMSIMD_MAKE_MIXED_L2SQ(accurate, f32, i8, f64, SIMSIMD_IDENTIFY, SIMSIMD_IDENTIFY) // simsimd_accurate_f32i8_l2sq
+SIMSIMD_MAKE_MIXED_IP(accurate, f32, i8, f64, SIMSIMD_IDENTIFY, SIMSIMD_IDENTIFY)   // simsimd_accurate_f32i8_ip
+SIMSIMD_MAKE_MIXED_COS(accurate, f32, i8, f64, SIMSIMD_IDENTIFY, SIMSIMD_IDENTIFY)  // simsimd_accurate_f32i8_cos
+
+SIMSIMD_MAKE_MIXED_L2SQ(accurate, f16, i8, f64, SIMSIMD_UNCOMPRESS_F16, SIMSIMD_IDENTIFY) // simsimd_accurate_f16i8_l2sq
+SIMSIMD_MAKE_MIXED_IP(accurate, f16, i8, f64, SIMSIMD_UNCOMPRESS_F16, SIMSIMD_IDENTIFY)   // simsimd_accurate_f16i8_ip
+SIMSIMD_MAKE_MIXED_COS(accurate, f16, i8, f64, SIMSIMD_UNCOMPRESS_F16, SIMSIMD_IDENTIFY)  // simsimd_accurate_f16i8_cos
+
 #if SIMSIMD_TARGET_ARM
 #if SIMSIMD_TARGET_ARM_NEON
 
+/**
+ *  @brief  Computes the reciprocal square roots of two numbers with the precision set by `SIMSIMD_COS_PRECISION`.
+ *          The `vrsqrte` estimate has about 8 bits of precision, and every `vrsqrts` step doubles it.
+ */
+__attribute__((target("+simd"))) //
+inline static float32x2_t
+simsimd_neon_rsqrt_f32x2(float32x2_t x) {
+#if SIMSIMD_COS_PRECISION == SIMSIMD_COS_PRECISION_EXACT
+    return vdiv_f32(vdup_n_f32(1), vsqrt_f32(x));
+#else
+    float32x2_t y = vrsqrte_f32(x);
+#if SIMSIMD_COS_PRECISION == SIMSIMD_COS_PRECISION_NEWTON
+    y = vmul_f32(y, vrsqrts_f32(vmul_f32(x, y), y));
+    y = vmul_f32(y, vrsqrts_f32(vmul_f32(x, y), y));
+#endif
+    return y;
+#endif
+}
+
+/**
+ *  @brief  Computes the reciprocal square roots of four numbers with the precision set by `SIMSIMD_COS_PRECISION`.
+ */
+__attribute__((target("+simd"))) //
+inline static float32x4_t
+simsimd_neon_rsqrt_f32x4(float32x4_t x) {
+#if SIMSIMD_COS_PRECISION == SIMSIMD_COS_PRECISION_EXACT
+    return vdivq_f32(vdupq_n_f32(1), vsqrtq_f32(x));
+#else
+    float32x4_t y = vrsqrteq_f32(x);
+#if SIMSIMD_COS_PRECISION == SIMSIMD_COS_PRECISION_NEWTON
+    y = vmulq_f32(y, vrsqrtsq_f32(vmulq_f32(x, y), y));
+    y = vmulq_f32(y, vrsqrtsq_f32(vmulq_f32(x, y), y));
+#endif
+    return y;
+#endif
+}
+
 /*
  *  @file   arm_neon_f32.h
  *  @brief  Arm NEON implementation of the most common similarity metrics for 32-bit floating point numbers.
@@ -164,10 +350,79 @@ simsimd_neon_f32_cos(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_siz
 
     // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
     simsimd_f32_t a2_b2_arr[2] = {a2, b2};
-    vst1_f32(a2_b2_arr, vrsqrte_f32(vld1_f32(a2_b2_arr)));
+    vst1_f32(a2_b2_arr, simsimd_neon_rsqrt_f32x2(vld1_f32(a2_b2_arr)));
     return ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
 }
 
+/*
+ *  @file   arm_neon_f64.h
+ *  @brief  Arm NEON implementation of the most common similarity metrics for 64-bit floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity.
+ *  - Uses `f64` for storage and `f64` for accumulation.
+ *  - Requires compiler capabilities: +simd.
+ */
+
+__attribute__((target("+simd"))) //
+inline static simsimd_f32_t
+simsimd_neon_f64_l2sq(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    float64x2_t sum_vec = vdupq_n_f64(0);
+    simsimd_size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        float64x2_t a_vec = vld1q_f64(a + i);
+        float64x2_t b_vec = vld1q_f64(b + i);
+        float64x2_t diff_vec = vsubq_f64(a_vec, b_vec);
+        sum_vec = vfmaq_f64(sum_vec, diff_vec, diff_vec);
+    }
+    simsimd_f64_t sum = vaddvq_f64(sum_vec);
+    for (; i < n; ++i) {
+        simsimd_f64_t diff = a[i] - b[i];
+        sum += diff * diff;
+    }
+    return (simsimd_f32_t)sum;
+}
+
+__attribute__((target("+simd"))) //
+inline static simsimd_f32_t
+simsimd_neon_f64_ip(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    float64x2_t ab_vec = vdupq_n_f64(0);
+    simsimd_size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        float64x2_t a_vec = vld1q_f64(a + i);
+        float64x2_t b_vec = vld1q_f64(b + i);
+        ab_vec = vfmaq_f64(ab_vec, a_vec, b_vec);
+    }
+    simsimd_f64_t ab = vaddvq_f64(ab_vec);
+    for (; i < n; ++i)
+        ab += a[i] * b[i];
+    return (simsimd_f32_t)(1 - ab);
+}
+
+__attribute__((target("+simd"))) //
+inline static simsimd_f32_t
+simsimd_neon_f64_cos(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    float64x2_t ab_vec = vdupq_n_f64(0), a2_vec = vdupq_n_f64(0), b2_vec = vdupq_n_f64(0);
+    simsimd_size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        float64x2_t a_vec = vld1q_f64(a + i);
+        float64x2_t b_vec = vld1q_f64(b + i);
+        ab_vec = vfmaq_f64(ab_vec, a_vec, b_vec);
+        a2_vec = vfmaq_f64(a2_vec, a_vec, a_vec);
+        b2_vec = vfmaq_f64(b2_vec, b_vec, b_vec);
+    }
+    simsimd_f64_t ab = vaddvq_f64(ab_vec), a2 = vaddvq_f64(a2_vec), b2 = vaddvq_f64(b2_vec);
+    for (; i < n; ++i) {
+        simsimd_f64_t ai = a[i], bi = b[i];
+        ab += ai * bi, a2 += ai * ai, b2 += bi * bi;
+    }
+
+    // Prefer the exact `fsqrt` to the estimates, as the precision is the reason to use `f64`
+    simsimd_f64_t a2_b2_arr[2] = {a2, b2};
+    vst1q_f64(a2_b2_arr, vsqrtq_f64(vld1q_f64(a2_b2_arr)));
+    return ab != 0 ? (simsimd_f32_t)(1 - ab / (a2_b2_arr[0] * a2_b2_arr[1])) : 1;
+}
+
 /*
  *  @file   arm_neon_f16.h
  *  @brief  Arm NEON implementation of the most common similarity metrics for 16-bit floating point numbers.
@@ -234,19 +489,95 @@ simsimd_neon_f16_cos(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_siz
     // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
     simsimd_f32_t a2_b2_arr[2] = {a2, b2};
     float32x2_t a2_b2 = vld1_f32(a2_b2_arr);
-    a2_b2 = vrsqrte_f32(a2_b2);
+    a2_b2 = simsimd_neon_rsqrt_f32x2(a2_b2);
     vst1_f32(a2_b2_arr, a2_b2);
     return ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
 }
 
+/*
+ *  @file   arm_neon_bf16.h
+ *  @brief  Arm NEON implementation of the most common similarity metrics for 16-bit brain floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity.
+ *  - Uses `bfdot` to multiply pairs of `bf16` words, accumulating in `f32`.
+ *  - Upcasts to `f32` for L2, as the differences of `bf16` numbers would lose precision.
+ *  - Requires compiler capabilities: +simd+bf16.
+ */
+
+__attribute__((target("+simd+bf16"))) //
+inline static simsimd_f32_t
+simsimd_neon_bf16_l2sq(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n) {
+    float32x4_t d2_low_vec = vdupq_n_f32(0), d2_high_vec = vdupq_n_f32(0);
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint16x8_t a_vec = vld1q_u16(a + i);
+        uint16x8_t b_vec = vld1q_u16(b + i);
+        // Shifting the `bf16` bits into the upper halves of 32-bit words produces valid `f32` numbers
+        float32x4_t d_low_vec = vsubq_f32(vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(a_vec), 16)),
+                                          vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(b_vec), 16)));
+        float32x4_t d_high_vec = vsubq_f32(vreinterpretq_f32_u32(vshll_high_n_u16(a_vec, 16)),
+                                           vreinterpretq_f32_u32(vshll_high_n_u16(b_vec, 16)));
+        d2_low_vec = vfmaq_f32(d2_low_vec, d_low_vec, d_low_vec);
+        d2_high_vec = vfmaq_f32(d2_high_vec, d_high_vec, d_high_vec);
+    }
+    simsimd_f32_t d2 = vaddvq_f32(vaddq_f32(d2_low_vec, d2_high_vec));
+    for (; i < n; ++i) {
+        simsimd_f32_t d = SIMSIMD_UNCOMPRESS_BF16(a[i]) - SIMSIMD_UNCOMPRESS_BF16(b[i]);
+        d2 += d * d;
+    }
+    return d2;
+}
+
+__attribute__((target("+simd+bf16"))) //
+inline static simsimd_f32_t
+simsimd_neon_bf16_ip(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n) {
+    float32x4_t ab_vec = vdupq_n_f32(0);
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        bfloat16x8_t a_vec = vreinterpretq_bf16_u16(vld1q_u16(a + i));
+        bfloat16x8_t b_vec = vreinterpretq_bf16_u16(vld1q_u16(b + i));
+        ab_vec = vbfdotq_f32(ab_vec, a_vec, b_vec);
+    }
+    simsimd_f32_t ab = vaddvq_f32(ab_vec);
+    for (; i < n; ++i)
+        ab += SIMSIMD_UNCOMPRESS_BF16(a[i]) * SIMSIMD_UNCOMPRESS_BF16(b[i]);
+    return 1 - ab;
+}
+
+__attribute__((target("+simd+bf16"))) //
+inline static simsimd_f32_t
+simsimd_neon_bf16_cos(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n) {
+    float32x4_t ab_vec = vdupq_n_f32(0), a2_vec = vdupq_n_f32(0), b2_vec = vdupq_n_f32(0);
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        bfloat16x8_t a_vec = vreinterpretq_bf16_u16(vld1q_u16(a + i));
+        bfloat16x8_t b_vec = vreinterpretq_bf16_u16(vld1q_u16(b + i));
+        ab_vec = vbfdotq_f32(ab_vec, a_vec, b_vec);
+        a2_vec = vbfdotq_f32(a2_vec, a_vec, a_vec);
+        b2_vec = vbfdotq_f32(b2_vec, b_vec, b_vec);
+    }
+    simsimd_f32_t ab = vaddvq_f32(ab_vec), a2 = vaddvq_f32(a2_vec), b2 = vaddvq_f32(b2_vec);
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = SIMSIMD_UNCOMPRESS_BF16(a[i]), bi = SIMSIMD_UNCOMPRESS_BF16(b[i]);
+        ab += ai * bi, a2 += ai * ai, b2 += bi * bi;
+    }
+
+    // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
+    simsimd_f32_t a2_b2_arr[2] = {a2, b2};
+    vst1_f32(a2_b2_arr, simsimd_neon_rsqrt_f32x2(vld1_f32(a2_b2_arr)));
+    return ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
+}
+
 /*
  *  @file   arm_neon_i8.h
  *  @brief  Arm NEON implementation of the most common similarity metrics for 8-bit signed integral numbers.
  *  @author Ash Vardanian
  *
  *  - Implements: L2 squared, cosine similarity, inner product (same as cosine).
- *  - Uses `i8` for storage, `i16` for multiplication, and `i32` for accumulation, if no better option is available.
- *  - Requires compiler capabilities: +simd+dotprod.
+ *  - Uses `i8` for storage, `i16` for multiplication, and `i32` for accumulation.
+ *  - Serves as a fallback for CPUs without the `sdot` and `udot` instructions.
+ *  - Requires compiler capabilities: +simd.
  */
 
 __attribute__((target("+simd"))) //
@@ -272,7 +603,7 @@ simsimd_neon_i8_l2sq(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_
     return d2;
 }
 
-__attribute__((target("arch=armv8.2-a+dotprod"))) //
+__attribute__((target("+simd"))) //
 inline static simsimd_f32_t
 simsimd_neon_i8_cos(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n) {
 
@@ -281,26 +612,16 @@ simsimd_neon_i8_cos(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t
     int32x4_t b2_vec = vdupq_n_s32(0);
     simsimd_size_t i = 0;
 
-    // If the 128-bit `vdot_s32` intrinsic is unavailable, we can use the 64-bit `vdot_s32`.
-    // for (simsimd_size_t i = 0; i != n; i += 8) {
-    //     int16x8_t a_vec = vmovl_s8(vld1_s8(a + i));
-    //     int16x8_t b_vec = vmovl_s8(vld1_s8(b + i));
-    //     int16x8_t ab_part_vec = vmulq_s16(a_vec, b_vec);
-    //     int16x8_t a2_part_vec = vmulq_s16(a_vec, a_vec);
-    //     int16x8_t b2_part_vec = vmulq_s16(b_vec, b_vec);
-    //     ab_vec = vaddq_s32(ab_vec, vaddq_s32(vmovl_s16(vget_high_s16(ab_part_vec)), //
-    //                                          vmovl_s16(vget_low_s16(ab_part_vec))));
-    //     a2_vec = vaddq_s32(a2_vec, vaddq_s32(vmovl_s16(vget_high_s16(a2_part_vec)), //
-    //                                          vmovl_s16(vget_low_s16(a2_part_vec))));
-    //     b2_vec = vaddq_s32(b2_vec, vaddq_s32(vmovl_s16(vget_high_s16(b2_part_vec)), //
-    //                                          vmovl_s16(vget_low_s16(b2_part_vec))));
-    // }
+    // Products of two `i8` numbers always fit into `i16`, and pairs of them are accumulated into `i32`
     for (; i + 15 < n; i += 16) {
         int8x16_t a_vec = vld1q_s8(a + i);
         int8x16_t b_vec = vld1q_s8(b + i);
-        ab_vec = vdotq_s32(ab_vec, a_vec, b_vec);
-        a2_vec = vdotq_s32(a2_vec, a_vec, a_vec);
-        b2_vec = vdotq_s32(b2_vec, b_vec, b_vec);
+        ab_vec = vpadalq_s16(ab_vec, vmull_s8(vget_low_s8(a_vec), vget_low_s8(b_vec)));
+        ab_vec = vpadalq_s16(ab_vec, vmull_high_s8(a_vec, b_vec));
+        a2_vec = vpadalq_s16(a2_vec, vmull_s8(vget_low_s8(a_vec), vget_low_s8(a_vec)));
+        a2_vec = vpadalq_s16(a2_vec, vmull_high_s8(a_vec, a_vec));
+        b2_vec = vpadalq_s16(b2_vec, vmull_s8(vget_low_s8(b_vec), vget_low_s8(b_vec)));
+        b2_vec = vpadalq_s16(b2_vec, vmull_high_s8(b_vec, b_vec));
     }
 
     int32_t ab = vaddvq_s32(ab_vec);
@@ -315,112 +636,641 @@ simsimd_neon_i8_cos(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t
 
     // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
     simsimd_f32_t a2_b2_arr[2] = {(simsimd_f32_t)a2, (simsimd_f32_t)b2};
-    float32x2_t a2_b2 = vld1_f32(a2_b2_arr);
-    a2_b2 = vrsqrte_f32(a2_b2);
-    vst1_f32(a2_b2_arr, a2_b2);
+    vst1_f32(a2_b2_arr, simsimd_neon_rsqrt_f32x2(vld1_f32(a2_b2_arr)));
     return ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
 }
 
-__attribute__((target("arch=armv8.2-a+dotprod"))) //
+__attribute__((target("+simd"))) //
 inline static simsimd_f32_t
 simsimd_neon_i8_ip(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n) {
     return simsimd_neon_i8_cos(a, b, n);
 }
 
-#endif // SIMSIMD_TARGET_ARM_NEON
-
-#if SIMSIMD_TARGET_ARM_SVE
-
 /*
- *  @file   arm_sve_f32.h
- *  @brief  Arm SVE implementation of the most common similarity metrics for 32-bit floating point numbers.
+ *  @file   arm_dotprod_i8.h
+ *  @brief  Arm NEON implementation of the most common similarity metrics for 8-bit signed integral numbers,
+ *          using the `sdot` and `udot` instructions of the DotProd extension, that multiply 4 pairs of bytes
+ *          and add them into a 32-bit lane at once.
  *  @author Ash Vardanian
  *
- *  - Implements: L2 squared, inner product, cosine similarity.
- *  - Uses `f16` for both storage and `f32` for accumulation.
- *  - Requires compiler capabilities: +sve.
+ *  - Implements: L2 squared, cosine similarity, inner product (same as cosine).
+ *  - Uses `i8` for storage and `i32` for accumulation.
+ *  - Squares the absolute differences, that fit into `u8`, with `udot` for L2.
+ *  - Requires compiler capabilities: +simd+dotprod.
  */
 
-__attribute__((target("+sve"))) //
+__attribute__((target("arch=armv8.2-a+dotprod"))) //
 inline static simsimd_f32_t
-simsimd_sve_f32_l2sq(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
+simsimd_dotprod_i8_l2sq(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n) {
+    uint32x4_t d2_vec = vdupq_n_u32(0);
     simsimd_size_t i = 0;
-    svfloat32_t d2_vec = svdupq_n_f32(0.f, 0.f, 0.f, 0.f);
-    do {
-        svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
-        svfloat32_t a_vec = svld1_f32(pg_vec, a + i);
-        svfloat32_t b_vec = svld1_f32(pg_vec, b + i);
-        svfloat32_t a_minus_b_vec = svsub_f32_x(pg_vec, a_vec, b_vec);
-        d2_vec = svmla_f32_x(pg_vec, d2_vec, a_minus_b_vec, a_minus_b_vec);
-        i += svcntw();
-    } while (i < n);
-    simsimd_f32_t d2 = svaddv_f32(svptrue_b32(), d2_vec);
+    for (; i + 15 < n; i += 16) {
+        uint8x16_t d_vec = vreinterpretq_u8_s8(vabdq_s8(vld1q_s8(a + i), vld1q_s8(b + i)));
+        d2_vec = vdotq_u32(d2_vec, d_vec, d_vec);
+    }
+    uint32_t d2 = vaddvq_u32(d2_vec);
+    for (; i < n; ++i) {
+        int32_t d = a[i] - b[i];
+        d2 += (uint32_t)(d * d);
+    }
     return d2;
 }
-__attribute__((target("+sve"))) //
-inline static simsimd_f32_t
-simsimd_sve_f32_ip(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
-    simsimd_size_t i = 0;
-    svfloat32_t ab_vec = svdupq_n_f32(0.f, 0.f, 0.f, 0.f);
-    do {
-        svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
-        svfloat32_t a_vec = svld1_f32(pg_vec, a + i);
-        svfloat32_t b_vec = svld1_f32(pg_vec, b + i);
-        ab_vec = svmla_f32_x(pg_vec, ab_vec, a_vec, b_vec);
-        i += svcntw();
-    } while (i < n);
-    return 1 - svaddv_f32(svptrue_b32(), ab_vec);
-}
 
-__attribute__((target("+sve"))) //
+__attribute__((target("arch=armv8.2-a+dotprod"))) //
 inline static simsimd_f32_t
-simsimd_sve_f32_cos(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
+simsimd_dotprod_i8_cos(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n) {
+
+    int32x4_t ab_vec = vdupq_n_s32(0);
+    int32x4_t a2_vec = vdupq_n_s32(0);
+    int32x4_t b2_vec = vdupq_n_s32(0);
     simsimd_size_t i = 0;
-    svfloat32_t ab_vec = svdupq_n_f32(0.f, 0.f, 0.f, 0.f);
-    svfloat32_t a2_vec = svdupq_n_f32(0.f, 0.f, 0.f, 0.f);
-    svfloat32_t b2_vec = svdupq_n_f32(0.f, 0.f, 0.f, 0.f);
-    do {
-        svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
-        svfloat32_t a_vec = svld1_f32(pg_vec, a + i);
-        svfloat32_t b_vec = svld1_f32(pg_vec, b + i);
-        ab_vec = svmla_f32_x(pg_vec, ab_vec, a_vec, b_vec);
-        a2_vec = svmla_f32_x(pg_vec, a2_vec, a_vec, a_vec);
-        b2_vec = svmla_f32_x(pg_vec, b2_vec, b_vec, b_vec);
-        i += svcntw();
-    } while (i < n);
+    for (; i + 15 < n; i += 16) {
+        int8x16_t a_vec = vld1q_s8(a + i);
+        int8x16_t b_vec = vld1q_s8(b + i);
+        ab_vec = vdotq_s32(ab_vec, a_vec, b_vec);
+        a2_vec = vdotq_s32(a2_vec, a_vec, a_vec);
+        b2_vec = vdotq_s32(b2_vec, b_vec, b_vec);
+    }
 
-    simsimd_f32_t ab = svaddv_f32(svptrue_b32(), ab_vec);
-    simsimd_f32_t a2 = svaddv_f32(svptrue_b32(), a2_vec);
-    simsimd_f32_t b2 = svaddv_f32(svptrue_b32(), b2_vec);
+    int32_t ab = vaddvq_s32(ab_vec);
+    int32_t a2 = vaddvq_s32(a2_vec);
+    int32_t b2 = vaddvq_s32(b2_vec);
+
+    // Take care of the tail:
+    for (; i < n; ++i) {
+        int32_t ai = a[i], bi = b[i];
+        ab += ai * bi, a2 += ai * ai, b2 += bi * bi;
+    }
 
     // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
-    simsimd_f32_t a2_b2_arr[2] = {a2, b2};
-    float32x2_t a2_b2 = vld1_f32(a2_b2_arr);
-    a2_b2 = vrsqrte_f32(a2_b2);
-    vst1_f32(a2_b2_arr, a2_b2);
+    simsimd_f32_t a2_b2_arr[2] = {(simsimd_f32_t)a2, (simsimd_f32_t)b2};
+    vst1_f32(a2_b2_arr, simsimd_neon_rsqrt_f32x2(vld1_f32(a2_b2_arr)));
     return ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
 }
 
+__attribute__((target("arch=armv8.2-a+dotprod"))) //
+inline static simsimd_f32_t
+simsimd_dotprod_i8_ip(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n) {
+    return simsimd_dotprod_i8_cos(a, b, n);
+}
+
 /*
- *  @file   arm_sve_f16.h
- *  @brief  Arm SVE implementation of the most common similarity metrics for 16-bit floating point numbers.
+ *  @file   arm_dotprod_u8.h
+ *  @brief  Arm NEON implementation of the most common similarity metrics for 8-bit unsigned integral numbers,
+ *          using the `udot` instruction of the DotProd extension.
  *  @author Ash Vardanian
  *
- *  - Implements: L2 squared, inner product, cosine similarity.
- *  - Uses `f16` for both storage and `f32` for accumulation.
- *  - Requires compiler capabilities: +sve+fp16.
+ *  - Implements: L2 squared, cosine similarity, inner product (same as cosine).
+ *  - Uses `u8` for storage and `u32` for accumulation.
+ *  - Squares the absolute differences, that fit into `u8`, with `udot` for L2.
+ *  - Requires compiler capabilities: +simd+dotprod.
  */
 
-__attribute__((target("+sve+fp16"))) //
+__attribute__((target("arch=armv8.2-a+dotprod"))) //
 inline static simsimd_f32_t
-simsimd_sve_f16_l2sq(simsimd_f16_t const* a_enum, simsimd_f16_t const* b_enum, simsimd_size_t n) {
+simsimd_dotprod_u8_l2sq(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n) {
+    uint32x4_t d2_vec = vdupq_n_u32(0);
     simsimd_size_t i = 0;
-    svfloat16_t d2_vec = svdupq_n_f16(0, 0, 0, 0, 0, 0, 0, 0);
-    simsimd_f16_t const* a = (simsimd_f16_t const*)(a_enum);
-    simsimd_f16_t const* b = (simsimd_f16_t const*)(b_enum);
-    do {
-        svbool_t pg_vec = svwhilelt_b16((unsigned int)i, (unsigned int)n);
-        svfloat16_t a_vec = svld1_f16(pg_vec, (float16_t const*)a + i);
+    for (; i + 15 < n; i += 16) {
+        uint8x16_t d_vec = vabdq_u8(vld1q_u8(a + i), vld1q_u8(b + i));
+        d2_vec = vdotq_u32(d2_vec, d_vec, d_vec);
+    }
+    uint32_t d2 = vaddvq_u32(d2_vec);
+    for (; i < n; ++i) {
+        int32_t d = (int32_t)a[i] - (int32_t)b[i];
+        d2 += (uint32_t)(d * d);
+    }
+    return d2;
+}
+
+__attribute__((target("arch=armv8.2-a+dotprod"))) //
+inline static simsimd_f32_t
+simsimd_dotprod_u8_cos(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n) {
+
+    uint32x4_t ab_vec = vdupq_n_u32(0);
+    uint32x4_t a2_vec = vdupq_n_u32(0);
+    uint32x4_t b2_vec = vdupq_n_u32(0);
+    simsimd_size_t i = 0;
+    for (; i + 15 < n; i += 16) {
+        uint8x16_t a_vec = vld1q_u8(a + i);
+        uint8x16_t b_vec = vld1q_u8(b + i);
+        ab_vec = vdotq_u32(ab_vec, a_vec, b_vec);
+        a2_vec = vdotq_u32(a2_vec, a_vec, a_vec);
+        b2_vec = vdotq_u32(b2_vec, b_vec, b_vec);
+    }
+
+    uint32_t ab = vaddvq_u32(ab_vec);
+    uint32_t a2 = vaddvq_u32(a2_vec);
+    uint32_t b2 = vaddvq_u32(b2_vec);
+
+    // Take care of the tail:
+    for (; i < n; ++i) {
+        uint32_t ai = a[i], bi = b[i];
+        ab += ai * bi, a2 += ai * ai, b2 += bi * bi;
+    }
+
+    // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
+    simsimd_f32_t a2_b2_arr[2] = {(simsimd_f32_t)a2, (simsimd_f32_t)b2};
+    vst1_f32(a2_b2_arr, simsimd_neon_rsqrt_f32x2(vld1_f32(a2_b2_arr)));
+    return ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
+}
+
+__attribute__((target("arch=armv8.2-a+dotprod"))) //
+inline static simsimd_f32_t
+simsimd_dotprod_u8_ip(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n) {
+    return simsimd_dotprod_u8_cos(a, b, n);
+}
+
+/*
+ *  @file   arm_dotprod_i4x2.h
+ *  @brief  Arm NEON implementation of the most common similarity metrics for 4-bit signed integral numbers,
+ *          packed in pairs into 8-bit words, using the `sdot` and `udot` instructions of the DotProd extension.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, cosine similarity, inner product (same as cosine).
+ *  - Sign-extends the low nibbles with a pair of shifts and the high ones with an arithmetic shift.
+ *  - Uses `i4x2` for storage, `i8` for multiplication, and `i32` for accumulation.
+ *  - Requires compiler capabilities: +simd+dotprod.
+ */
+
+__attribute__((target("arch=armv8.2-a+dotprod"))) //
+inline static simsimd_f32_t
+simsimd_dotprod_i4x2_l2sq(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n) {
+    uint32x4_t d2_vec = vdupq_n_u32(0);
+    simsimd_size_t i = 0;
+    for (; i + 15 < n; i += 16) {
+        int8x16_t a_vec = vld1q_s8((simsimd_i8_t const*)a + i);
+        int8x16_t b_vec = vld1q_s8((simsimd_i8_t const*)b + i);
+        int8x16_t a_low = vshrq_n_s8(vshlq_n_s8(a_vec, 4), 4), a_high = vshrq_n_s8(a_vec, 4);
+        int8x16_t b_low = vshrq_n_s8(vshlq_n_s8(b_vec, 4), 4), b_high = vshrq_n_s8(b_vec, 4);
+        uint8x16_t d_low = vreinterpretq_u8_s8(vabdq_s8(a_low, b_low));
+        uint8x16_t d_high = vreinterpretq_u8_s8(vabdq_s8(a_high, b_high));
+        d2_vec = vdotq_u32(vdotq_u32(d2_vec, d_low, d_low), d_high, d_high);
+    }
+    uint32_t d2 = vaddvq_u32(d2_vec);
+    for (; i < n; ++i) {
+        int32_t d_low = SIMSIMD_I4X2_LOW(a[i]) - SIMSIMD_I4X2_LOW(b[i]);
+        int32_t d_high = SIMSIMD_I4X2_HIGH(a[i]) - SIMSIMD_I4X2_HIGH(b[i]);
+        d2 += (uint32_t)(d_low * d_low + d_high * d_high);
+    }
+    return d2;
+}
+
+__attribute__((target("arch=armv8.2-a+dotprod"))) //
+inline static simsimd_f32_t
+simsimd_dotprod_i4x2_cos(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n) {
+
+    int32x4_t ab_vec = vdupq_n_s32(0);
+    int32x4_t a2_vec = vdupq_n_s32(0);
+    int32x4_t b2_vec = vdupq_n_s32(0);
+    simsimd_size_t i = 0;
+    for (; i + 15 < n; i += 16) {
+        int8x16_t a_vec = vld1q_s8((simsimd_i8_t const*)a + i);
+        int8x16_t b_vec = vld1q_s8((simsimd_i8_t const*)b + i);
+        int8x16_t a_low = vshrq_n_s8(vshlq_n_s8(a_vec, 4), 4), a_high = vshrq_n_s8(a_vec, 4);
+        int8x16_t b_low = vshrq_n_s8(vshlq_n_s8(b_vec, 4), 4), b_high = vshrq_n_s8(b_vec, 4);
+        ab_vec = vdotq_s32(vdotq_s32(ab_vec, a_low, b_low), a_high, b_high);
+        a2_vec = vdotq_s32(vdotq_s32(a2_vec, a_low, a_low), a_high, a_high);
+        b2_vec = vdotq_s32(vdotq_s32(b2_vec, b_low, b_low), b_high, b_high);
+    }
+
+    int32_t ab = vaddvq_s32(ab_vec);
+    int32_t a2 = vaddvq_s32(a2_vec);
+    int32_t b2 = vaddvq_s32(b2_vec);
+
+    // Take care of the tail:
+    for (; i < n; ++i) {
+        int32_t a_low = SIMSIMD_I4X2_LOW(a[i]), a_high = SIMSIMD_I4X2_HIGH(a[i]);
+        int32_t b_low = SIMSIMD_I4X2_LOW(b[i]), b_high = SIMSIMD_I4X2_HIGH(b[i]);
+        ab += a_low * b_low + a_high * b_high;
+        a2 += a_low * a_low + a_high * a_high;
+        b2 += b_low * b_low + b_high * b_high;
+    }
+
+    // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
+    simsimd_f32_t a2_b2_arr[2] = {(simsimd_f32_t)a2, (simsimd_f32_t)b2};
+    vst1_f32(a2_b2_arr, simsimd_neon_rsqrt_f32x2(vld1_f32(a2_b2_arr)));
+    return ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
+}
+
+__attribute__((target("arch=armv8.2-a+dotprod"))) //
+inline static simsimd_f32_t
+simsimd_dotprod_i4x2_ip(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n) {
+    return simsimd_dotprod_i4x2_cos(a, b, n);
+}
+
+
+/*
+ *  @file   arm_neon_f32_batch.h
+ *  @brief  Arm NEON implementation of one-to-many similarity metrics for 32-bit floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity.
+ *  - Compares the query against 4 rows at a time, loading every query chunk into a register just once.
+ *  - Rows are `stride` bytes apart, the remaining rows are handled with the single-pair kernels.
+ *  - Requires compiler capabilities: +simd.
+ */
+
+__attribute__((target("+simd"))) //
+inline static void
+simsimd_neon_f32_l2sq_batch(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t count,
+                            simsimd_size_t stride, simsimd_size_t n, simsimd_f32_t* results) {
+    simsimd_size_t j = 0;
+    for (; j + 4 <= count; j += 4) {
+        simsimd_f32_t const* b_0 = (simsimd_f32_t const*)((char const*)b + (j + 0) * stride);
+        simsimd_f32_t const* b_1 = (simsimd_f32_t const*)((char const*)b + (j + 1) * stride);
+        simsimd_f32_t const* b_2 = (simsimd_f32_t const*)((char const*)b + (j + 2) * stride);
+        simsimd_f32_t const* b_3 = (simsimd_f32_t const*)((char const*)b + (j + 3) * stride);
+        float32x4_t d2_0_vec = vdupq_n_f32(0), d2_1_vec = vdupq_n_f32(0);
+        float32x4_t d2_2_vec = vdupq_n_f32(0), d2_3_vec = vdupq_n_f32(0);
+        simsimd_size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            float32x4_t a_vec = vld1q_f32(a + i);
+            float32x4_t d_0_vec = vsubq_f32(a_vec, vld1q_f32(b_0 + i));
+            float32x4_t d_1_vec = vsubq_f32(a_vec, vld1q_f32(b_1 + i));
+            float32x4_t d_2_vec = vsubq_f32(a_vec, vld1q_f32(b_2 + i));
+            float32x4_t d_3_vec = vsubq_f32(a_vec, vld1q_f32(b_3 + i));
+            d2_0_vec = vfmaq_f32(d2_0_vec, d_0_vec, d_0_vec);
+            d2_1_vec = vfmaq_f32(d2_1_vec, d_1_vec, d_1_vec);
+            d2_2_vec = vfmaq_f32(d2_2_vec, d_2_vec, d_2_vec);
+            d2_3_vec = vfmaq_f32(d2_3_vec, d_3_vec, d_3_vec);
+        }
+        simsimd_f32_t d2_0 = vaddvq_f32(d2_0_vec), d2_1 = vaddvq_f32(d2_1_vec);
+        simsimd_f32_t d2_2 = vaddvq_f32(d2_2_vec), d2_3 = vaddvq_f32(d2_3_vec);
+        for (; i < n; ++i) {
+            simsimd_f32_t ai = a[i];
+            simsimd_f32_t d_0 = ai - b_0[i], d_1 = ai - b_1[i], d_2 = ai - b_2[i], d_3 = ai - b_3[i];
+            d2_0 += d_0 * d_0, d2_1 += d_1 * d_1, d2_2 += d_2 * d_2, d2_3 += d_3 * d_3;
+        }
+        results[j + 0] = d2_0, results[j + 1] = d2_1, results[j + 2] = d2_2, results[j + 3] = d2_3;
+    }
+    for (; j < count; ++j)
+        results[j] = simsimd_neon_f32_l2sq(a, (simsimd_f32_t const*)((char const*)b + j * stride), n);
+}
+
+__attribute__((target("+simd"))) //
+inline static void
+simsimd_neon_f32_ip_batch(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t count,
+                          simsimd_size_t stride, simsimd_size_t n, simsimd_f32_t* results) {
+    simsimd_size_t j = 0;
+    for (; j + 4 <= count; j += 4) {
+        simsimd_f32_t const* b_0 = (simsimd_f32_t const*)((char const*)b + (j + 0) * stride);
+        simsimd_f32_t const* b_1 = (simsimd_f32_t const*)((char const*)b + (j + 1) * stride);
+        simsimd_f32_t const* b_2 = (simsimd_f32_t const*)((char const*)b + (j + 2) * stride);
+        simsimd_f32_t const* b_3 = (simsimd_f32_t const*)((char const*)b + (j + 3) * stride);
+        float32x4_t ab_0_vec = vdupq_n_f32(0), ab_1_vec = vdupq_n_f32(0);
+        float32x4_t ab_2_vec = vdupq_n_f32(0), ab_3_vec = vdupq_n_f32(0);
+        simsimd_size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            float32x4_t a_vec = vld1q_f32(a + i);
+            ab_0_vec = vfmaq_f32(ab_0_vec, a_vec, vld1q_f32(b_0 + i));
+            ab_1_vec = vfmaq_f32(ab_1_vec, a_vec, vld1q_f32(b_1 + i));
+            ab_2_vec = vfmaq_f32(ab_2_vec, a_vec, vld1q_f32(b_2 + i));
+            ab_3_vec = vfmaq_f32(ab_3_vec, a_vec, vld1q_f32(b_3 + i));
+        }
+        simsimd_f32_t ab_0 = vaddvq_f32(ab_0_vec), ab_1 = vaddvq_f32(ab_1_vec);
+        simsimd_f32_t ab_2 = vaddvq_f32(ab_2_vec), ab_3 = vaddvq_f32(ab_3_vec);
+        for (; i < n; ++i) {
+            simsimd_f32_t ai = a[i];
+            ab_0 += ai * b_0[i], ab_1 += ai * b_1[i], ab_2 += ai * b_2[i], ab_3 += ai * b_3[i];
+        }
+        results[j + 0] = 1 - ab_0, results[j + 1] = 1 - ab_1, results[j + 2] = 1 - ab_2, results[j + 3] = 1 - ab_3;
+    }
+    for (; j < count; ++j)
+        results[j] = simsimd_neon_f32_ip(a, (simsimd_f32_t const*)((char const*)b + j * stride), n);
+}
+
+__attribute__((target("+simd"))) //
+inline static void
+simsimd_neon_f32_cos_batch(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t count,
+                           simsimd_size_t stride, simsimd_size_t n, simsimd_f32_t* results) {
+
+    // The norm of the query is computed just once for all the rows
+    float32x4_t a2_vec = vdupq_n_f32(0);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t a_vec = vld1q_f32(a + i);
+        a2_vec = vfmaq_f32(a2_vec, a_vec, a_vec);
+    }
+    simsimd_f32_t a2 = vaddvq_f32(a2_vec);
+    for (; i < n; ++i)
+        a2 += a[i] * a[i];
+    simsimd_f32_t a2_recip_sqrt = vget_lane_f32(simsimd_neon_rsqrt_f32x2(vdup_n_f32(a2)), 0);
+
+    simsimd_size_t j = 0;
+    for (; j + 4 <= count; j += 4) {
+        simsimd_f32_t const* b_0 = (simsimd_f32_t const*)((char const*)b + (j + 0) * stride);
+        simsimd_f32_t const* b_1 = (simsimd_f32_t const*)((char const*)b + (j + 1) * stride);
+        simsimd_f32_t const* b_2 = (simsimd_f32_t const*)((char const*)b + (j + 2) * stride);
+        simsimd_f32_t const* b_3 = (simsimd_f32_t const*)((char const*)b + (j + 3) * stride);
+        float32x4_t ab_0_vec = vdupq_n_f32(0), ab_1_vec = vdupq_n_f32(0);
+        float32x4_t ab_2_vec = vdupq_n_f32(0), ab_3_vec = vdupq_n_f32(0);
+        float32x4_t b2_0_vec = vdupq_n_f32(0), b2_1_vec = vdupq_n_f32(0);
+        float32x4_t b2_2_vec = vdupq_n_f32(0), b2_3_vec = vdupq_n_f32(0);
+        for (i = 0; i + 4 <= n; i += 4) {
+            float32x4_t a_vec = vld1q_f32(a + i);
+            float32x4_t b_0_vec = vld1q_f32(b_0 + i), b_1_vec = vld1q_f32(b_1 + i);
+            float32x4_t b_2_vec = vld1q_f32(b_2 + i), b_3_vec = vld1q_f32(b_3 + i);
+            ab_0_vec = vfmaq_f32(ab_0_vec, a_vec, b_0_vec), b2_0_vec = vfmaq_f32(b2_0_vec, b_0_vec, b_0_vec);
+            ab_1_vec = vfmaq_f32(ab_1_vec, a_vec, b_1_vec), b2_1_vec = vfmaq_f32(b2_1_vec, b_1_vec, b_1_vec);
+            ab_2_vec = vfmaq_f32(ab_2_vec, a_vec, b_2_vec), b2_2_vec = vfmaq_f32(b2_2_vec, b_2_vec, b_2_vec);
+            ab_3_vec = vfmaq_f32(ab_3_vec, a_vec, b_3_vec), b2_3_vec = vfmaq_f32(b2_3_vec, b_3_vec, b_3_vec);
+        }
+        simsimd_f32_t ab_arr[4] = {vaddvq_f32(ab_0_vec), vaddvq_f32(ab_1_vec), vaddvq_f32(ab_2_vec),
+                                   vaddvq_f32(ab_3_vec)};
+        simsimd_f32_t b2_arr[4] = {vaddvq_f32(b2_0_vec), vaddvq_f32(b2_1_vec), vaddvq_f32(b2_2_vec),
+                                   vaddvq_f32(b2_3_vec)};
+        for (; i < n; ++i) {
+            simsimd_f32_t ai = a[i], b_0i = b_0[i], b_1i = b_1[i], b_2i = b_2[i], b_3i = b_3[i];
+            ab_arr[0] += ai * b_0i, b2_arr[0] += b_0i * b_0i;
+            ab_arr[1] += ai * b_1i, b2_arr[1] += b_1i * b_1i;
+            ab_arr[2] += ai * b_2i, b2_arr[2] += b_2i * b_2i;
+            ab_arr[3] += ai * b_3i, b2_arr[3] += b_3i * b_3i;
+        }
+
+        // Estimate all 4 reciprocal square roots at once, avoiding `simsimd_approximate_inverse_square_root`
+        float32x4_t b2_recip_sqrt_vec = simsimd_neon_rsqrt_f32x4(vld1q_f32(b2_arr));
+        float32x4_t ab_norm_vec = vmulq_n_f32(vmulq_f32(vld1q_f32(ab_arr), b2_recip_sqrt_vec), a2_recip_sqrt);
+        float32x4_t result_vec = vsubq_f32(vdupq_n_f32(1), ab_norm_vec);
+        simsimd_f32_t result_arr[4];
+        vst1q_f32(result_arr, result_vec);
+        for (simsimd_size_t k = 0; k != 4; ++k)
+            results[j + k] = ab_arr[k] != 0 ? result_arr[k] : 1;
+    }
+    for (; j < count; ++j)
+        results[j] = simsimd_neon_f32_cos(a, (simsimd_f32_t const*)((char const*)b + j * stride), n);
+}
+
+/*
+ *  @file   arm_neon_mixed.h
+ *  @brief  Arm NEON implementation of the mixed-precision similarity metrics.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity, for `f32` and `f16`, `f32` and `i8`, `f16` and `i8`.
+ *  - Upcasts both sides to `f32` with `vcvt_f32_f16` and a chain of `vmovl` widenings on the fly.
+ *  - Requires compiler capabilities: +simd+fp16.
+ */
+
+__attribute__((target("+simd+fp16"))) //
+inline static float32x4_t
+simsimd_neon_f32_load_f32(simsimd_f32_t const* x) {
+    return vld1q_f32(x);
+}
+
+__attribute__((target("+simd+fp16"))) //
+inline static float32x4_t
+simsimd_neon_f16_load_f32(simsimd_f16_t const* x) {
+    return vcvt_f32_f16(vld1_f16((float16_t const*)x));
+}
+
+__attribute__((target("+simd+fp16"))) //
+inline static float32x4_t
+simsimd_neon_i8_load_f32(simsimd_i8_t const* x) {
+    // Load just 4 bytes, to avoid reading past the end of the vector
+    int8x8_t x_i8 = vreinterpret_s8_s32(vld1_lane_s32((int32_t const*)x, vdup_n_s32(0), 0));
+    return vcvtq_f32_s32(vmovl_s16(vget_low_s16(vmovl_s8(x_i8))));
+}
+
+#define SIMSIMD_NEON_MAKE_MIXED(a_type, b_type, a_converter, b_converter)                                              \
+    __attribute__((target("+simd+fp16")))                                                                              \
+    inline static simsimd_f32_t simsimd_neon_##a_type##b_type##_l2sq_scaled(                                           \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n, simsimd_f32_t b_scale) {       \
+        float32x4_t d2_vec = vdupq_n_f32(0);                                                                           \
+        simsimd_size_t i = 0;                                                                                          \
+        for (; i + 4 <= n; i += 4) {                                                                                   \
+            float32x4_t a_vec = simsimd_neon_##a_type##_load_f32(a + i);                                               \
+            float32x4_t b_vec = vmulq_n_f32(simsimd_neon_##b_type##_load_f32(b + i), b_scale);                         \
+            float32x4_t d_vec = vsubq_f32(a_vec, b_vec);                                                               \
+            d2_vec = vfmaq_f32(d2_vec, d_vec, d_vec);                                                                  \
+        }                                                                                                              \
+        simsimd_f32_t d2 = vaddvq_f32(d2_vec);                                                                         \
+        for (; i < n; ++i) {                                                                                           \
+            simsimd_f32_t d = a_converter(a[i]) - b_scale * b_converter(b[i]);                                         \
+            d2 += d * d;                                                                                               \
+        }                                                                                                              \
+        return d2;                                                                                                     \
+    }                                                                                                                  \
+    __attribute__((target("+simd+fp16")))                                                                              \
+    inline static simsimd_f32_t simsimd_neon_##a_type##b_type##_ip_scaled(                                             \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n, simsimd_f32_t b_scale) {       \
+        float32x4_t ab_vec = vdupq_n_f32(0);                                                                           \
+        simsimd_size_t i = 0;                                                                                          \
+        for (; i + 4 <= n; i += 4) {                                                                                   \
+            float32x4_t a_vec = simsimd_neon_##a_type##_load_f32(a + i);                                               \
+            float32x4_t b_vec = simsimd_neon_##b_type##_load_f32(b + i);                                               \
+            ab_vec = vfmaq_f32(ab_vec, a_vec, b_vec);                                                                  \
+        }                                                                                                              \
+        simsimd_f32_t ab = vaddvq_f32(ab_vec);                                                                         \
+        for (; i < n; ++i) {                                                                                           \
+            simsimd_f32_t ai = a_converter(a[i]), bi = b_converter(b[i]);                                              \
+            ab += ai * bi;                                                                                             \
+        }                                                                                                              \
+        return 1 - b_scale * ab;                                                                                       \
+    }                                                                                                                  \
+    __attribute__((target("+simd+fp16")))                                                                              \
+    inline static simsimd_f32_t simsimd_neon_##a_type##b_type##_cos_scaled(                                            \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n, simsimd_f32_t b_scale) {       \
+        float32x4_t ab_vec = vdupq_n_f32(0), a2_vec = vdupq_n_f32(0), b2_vec = vdupq_n_f32(0);                         \
+        simsimd_size_t i = 0;                                                                                          \
+        for (; i + 4 <= n; i += 4) {                                                                                   \
+            float32x4_t a_vec = simsimd_neon_##a_type##_load_f32(a + i);                                               \
+            float32x4_t b_vec = simsimd_neon_##b_type##_load_f32(b + i);                                               \
+            ab_vec = vfmaq_f32(ab_vec, a_vec, b_vec);                                                                  \
+            a2_vec = vfmaq_f32(a2_vec, a_vec, a_vec);                                                                  \
+            b2_vec = vfmaq_f32(b2_vec, b_vec, b_vec);                                                                  \
+        }                                                                                                              \
+        simsimd_f32_t ab = vaddvq_f32(ab_vec), a2 = vaddvq_f32(a2_vec), b2 = vaddvq_f32(b2_vec);                       \
+        for (; i < n; ++i) {                                                                                           \
+            simsimd_f32_t ai = a_converter(a[i]), bi = b_converter(b[i]);                                              \
+            ab += ai * bi, a2 += ai * ai, b2 += bi * bi;                                                               \
+        }                                                                                                              \
+        ab = b_scale < 0 ? -ab : ab;                                                                                   \
+        return ab != 0 ? (1 - ab * SIMSIMD_RSQRT(a2) * SIMSIMD_RSQRT(b2)) : 1;                                         \
+    }                                                                                                                  \
+    __attribute__((target("+simd+fp16")))                                                                              \
+    inline static simsimd_f32_t simsimd_neon_##a_type##b_type##_l2sq(                                                  \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n) {                              \
+        return simsimd_neon_##a_type##b_type##_l2sq_scaled(a, b, n, 1);                                                \
+    }                                                                                                                  \
+    __attribute__((target("+simd+fp16")))                                                                              \
+    inline static simsimd_f32_t simsimd_neon_##a_type##b_type##_ip(                                                    \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n) {                              \
+        return simsimd_neon_##a_type##b_type##_ip_scaled(a, b, n, 1);                                                  \
+    }                                                                                                                  \
+    __attribute__((target("+simd+fp16")))                                                                              \
+    inline static simsimd_f32_t simsimd_neon_##a_type##b_type##_cos(                                                   \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n) {                              \
+        return simsimd_neon_##a_type##b_type##_cos_scaled(a, b, n, 1);                                                 \
+    }
+
+SIMSIMD_NEON_MAKE_MIXED(f32, f16, SIMSIMD_IDENTIFY, SIMSIMD_UNCOMPRESS_F16) // simsimd_neon_f32f16_l2sq, ip, cos
+SIMSIMD_NEON_MAKE_MIXED(f32, i8, SIMSIMD_IDENTIFY, SIMSIMD_IDENTIFY)        // simsimd_neon_f32i8_l2sq, ip, cos
+SIMSIMD_NEON_MAKE_MIXED(f16, i8, SIMSIMD_UNCOMPRESS_F16, SIMSIMD_IDENTIFY)  // simsimd_neon_f16i8_l2sq, ip, cos
+
+#undef SIMSIMD_NEON_MAKE_MIXED
+
+#endif // SIMSIMD_TARGET_ARM_NEON
+
+#if SIMSIMD_TARGET_ARM_SVE
+
+/*
+ *  @file   arm_sve_f32.h
+ *  @brief  Arm SVE implementation of the most common similarity metrics for 32-bit floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity.
+ *  - Uses `f16` for both storage and `f32` for accumulation.
+ *  - Requires compiler capabilities: +sve.
+ */
+
+__attribute__((target("+sve"))) //
+inline static simsimd_f32_t
+simsimd_sve_f32_l2sq(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat32_t d2_vec = svdupq_n_f32(0.f, 0.f, 0.f, 0.f);
+    do {
+        svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
+        svfloat32_t a_vec = svld1_f32(pg_vec, a + i);
+        svfloat32_t b_vec = svld1_f32(pg_vec, b + i);
+        svfloat32_t a_minus_b_vec = svsub_f32_x(pg_vec, a_vec, b_vec);
+        d2_vec = svmla_f32_x(pg_vec, d2_vec, a_minus_b_vec, a_minus_b_vec);
+        i += svcntw();
+    } while (i < n);
+    simsimd_f32_t d2 = svaddv_f32(svptrue_b32(), d2_vec);
+    return d2;
+}
+__attribute__((target("+sve"))) //
+inline static simsimd_f32_t
+simsimd_sve_f32_ip(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat32_t ab_vec = svdupq_n_f32(0.f, 0.f, 0.f, 0.f);
+    do {
+        svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
+        svfloat32_t a_vec = svld1_f32(pg_vec, a + i);
+        svfloat32_t b_vec = svld1_f32(pg_vec, b + i);
+        ab_vec = svmla_f32_x(pg_vec, ab_vec, a_vec, b_vec);
+        i += svcntw();
+    } while (i < n);
+    return 1 - svaddv_f32(svptrue_b32(), ab_vec);
+}
+
+__attribute__((target("+sve"))) //
+inline static simsimd_f32_t
+simsimd_sve_f32_cos(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat32_t ab_vec = svdupq_n_f32(0.f, 0.f, 0.f, 0.f);
+    svfloat32_t a2_vec = svdupq_n_f32(0.f, 0.f, 0.f, 0.f);
+    svfloat32_t b2_vec = svdupq_n_f32(0.f, 0.f, 0.f, 0.f);
+    do {
+        svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
+        svfloat32_t a_vec = svld1_f32(pg_vec, a + i);
+        svfloat32_t b_vec = svld1_f32(pg_vec, b + i);
+        ab_vec = svmla_f32_x(pg_vec, ab_vec, a_vec, b_vec);
+        a2_vec = svmla_f32_x(pg_vec, a2_vec, a_vec, a_vec);
+        b2_vec = svmla_f32_x(pg_vec, b2_vec, b_vec, b_vec);
+        i += svcntw();
+    } while (i < n);
+
+    simsimd_f32_t ab = svaddv_f32(svptrue_b32(), ab_vec);
+    simsimd_f32_t a2 = svaddv_f32(svptrue_b32(), a2_vec);
+    simsimd_f32_t b2 = svaddv_f32(svptrue_b32(), b2_vec);
+
+    // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
+    simsimd_f32_t a2_b2_arr[2] = {a2, b2};
+    float32x2_t a2_b2 = vld1_f32(a2_b2_arr);
+    a2_b2 = simsimd_neon_rsqrt_f32x2(a2_b2);
+    vst1_f32(a2_b2_arr, a2_b2);
+    return ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
+}
+
+/*
+ *  @file   arm_sve_f64.h
+ *  @brief  Arm SVE implementation of the most common similarity metrics for 64-bit floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity.
+ *  - Uses `f64` for storage and `f64` for accumulation.
+ *  - Requires compiler capabilities: +sve.
+ */
+
+__attribute__((target("+sve"))) //
+inline static simsimd_f32_t
+simsimd_sve_f64_l2sq(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat64_t d2_vec = svdupq_n_f64(0., 0.);
+    do {
+        svbool_t pg_vec = svwhilelt_b64((unsigned int)i, (unsigned int)n);
+        svfloat64_t a_vec = svld1_f64(pg_vec, a + i);
+        svfloat64_t b_vec = svld1_f64(pg_vec, b + i);
+        svfloat64_t a_minus_b_vec = svsub_f64_x(pg_vec, a_vec, b_vec);
+        d2_vec = svmla_f64_m(pg_vec, d2_vec, a_minus_b_vec, a_minus_b_vec);
+        i += svcntd();
+    } while (i < n);
+    return (simsimd_f32_t)svaddv_f64(svptrue_b64(), d2_vec);
+}
+
+__attribute__((target("+sve"))) //
+inline static simsimd_f32_t
+simsimd_sve_f64_ip(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat64_t ab_vec = svdupq_n_f64(0., 0.);
+    do {
+        svbool_t pg_vec = svwhilelt_b64((unsigned int)i, (unsigned int)n);
+        svfloat64_t a_vec = svld1_f64(pg_vec, a + i);
+        svfloat64_t b_vec = svld1_f64(pg_vec, b + i);
+        ab_vec = svmla_f64_m(pg_vec, ab_vec, a_vec, b_vec);
+        i += svcntd();
+    } while (i < n);
+    return (simsimd_f32_t)(1 - svaddv_f64(svptrue_b64(), ab_vec));
+}
+
+__attribute__((target("+sve"))) //
+inline static simsimd_f32_t
+simsimd_sve_f64_cos(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat64_t ab_vec = svdupq_n_f64(0., 0.);
+    svfloat64_t a2_vec = svdupq_n_f64(0., 0.);
+    svfloat64_t b2_vec = svdupq_n_f64(0., 0.);
+    do {
+        svbool_t pg_vec = svwhilelt_b64((unsigned int)i, (unsigned int)n);
+        svfloat64_t a_vec = svld1_f64(pg_vec, a + i);
+        svfloat64_t b_vec = svld1_f64(pg_vec, b + i);
+        ab_vec = svmla_f64_m(pg_vec, ab_vec, a_vec, b_vec);
+        a2_vec = svmla_f64_m(pg_vec, a2_vec, a_vec, a_vec);
+        b2_vec = svmla_f64_m(pg_vec, b2_vec, b_vec, b_vec);
+        i += svcntd();
+    } while (i < n);
+
+    simsimd_f64_t ab = svaddv_f64(svptrue_b64(), ab_vec);
+    simsimd_f64_t a2 = svaddv_f64(svptrue_b64(), a2_vec);
+    simsimd_f64_t b2 = svaddv_f64(svptrue_b64(), b2_vec);
+
+    // Prefer the exact `fsqrt` to the estimates, as the precision is the reason to use `f64`
+    simsimd_f64_t a2_b2_arr[2] = {a2, b2};
+    vst1q_f64(a2_b2_arr, vsqrtq_f64(vld1q_f64(a2_b2_arr)));
+    return ab != 0 ? (simsimd_f32_t)(1 - ab / (a2_b2_arr[0] * a2_b2_arr[1])) : 1;
+}
+
+/*
+ *  @file   arm_sve_f16.h
+ *  @brief  Arm SVE implementation of the most common similarity metrics for 16-bit floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity.
+ *  - Uses `f16` for both storage and `f32` for accumulation.
+ *  - Requires compiler capabilities: +sve+fp16.
+ */
+
+__attribute__((target("+sve+fp16"))) //
+inline static simsimd_f32_t
+simsimd_sve_f16_l2sq(simsimd_f16_t const* a_enum, simsimd_f16_t const* b_enum, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat16_t d2_vec = svdupq_n_f16(0, 0, 0, 0, 0, 0, 0, 0);
+    simsimd_f16_t const* a = (simsimd_f16_t const*)(a_enum);
+    simsimd_f16_t const* b = (simsimd_f16_t const*)(b_enum);
+    do {
+        svbool_t pg_vec = svwhilelt_b16((unsigned int)i, (unsigned int)n);
+        svfloat16_t a_vec = svld1_f16(pg_vec, (float16_t const*)a + i);
         svfloat16_t b_vec = svld1_f16(pg_vec, (float16_t const*)b + i);
         svfloat16_t a_minus_b_vec = svsub_f16_x(pg_vec, a_vec, b_vec);
         d2_vec = svmla_f16_x(pg_vec, d2_vec, a_minus_b_vec, a_minus_b_vec);
@@ -429,60 +1279,557 @@ simsimd_sve_f16_l2sq(simsimd_f16_t const* a_enum, simsimd_f16_t const* b_enum, s
     float16_t d2_f16 = svaddv_f16(svptrue_b16(), d2_vec);
     return d2_f16;
 }
-__attribute__((target("+sve+fp16"))) //
+__attribute__((target("+sve+fp16"))) //
+inline static simsimd_f32_t
+simsimd_sve_f16_ip(simsimd_f16_t const* a_enum, simsimd_f16_t const* b_enum, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat16_t ab_vec = svdupq_n_f16(0, 0, 0, 0, 0, 0, 0, 0);
+    simsimd_f16_t const* a = (simsimd_f16_t const*)(a_enum);
+    simsimd_f16_t const* b = (simsimd_f16_t const*)(b_enum);
+    do {
+        svbool_t pg_vec = svwhilelt_b16((unsigned int)i, (unsigned int)n);
+        svfloat16_t a_vec = svld1_f16(pg_vec, (float16_t const*)a + i);
+        svfloat16_t b_vec = svld1_f16(pg_vec, (float16_t const*)b + i);
+        ab_vec = svmla_f16_x(pg_vec, ab_vec, a_vec, b_vec);
+        i += svcnth();
+    } while (i < n);
+    simsimd_f16_t ab = svaddv_f16(svptrue_b16(), ab_vec);
+    return 1 - ab;
+}
+
+__attribute__((target("+sve+fp16"))) //
+inline static simsimd_f32_t
+simsimd_sve_f16_cos(simsimd_f16_t const* a_enum, simsimd_f16_t const* b_enum, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat16_t ab_vec = svdupq_n_f16(0, 0, 0, 0, 0, 0, 0, 0);
+    svfloat16_t a2_vec = svdupq_n_f16(0, 0, 0, 0, 0, 0, 0, 0);
+    svfloat16_t b2_vec = svdupq_n_f16(0, 0, 0, 0, 0, 0, 0, 0);
+    simsimd_f16_t const* a = (simsimd_f16_t const*)(a_enum);
+    simsimd_f16_t const* b = (simsimd_f16_t const*)(b_enum);
+    do {
+        svbool_t pg_vec = svwhilelt_b16((unsigned int)i, (unsigned int)n);
+        svfloat16_t a_vec = svld1_f16(pg_vec, (float16_t const*)a + i);
+        svfloat16_t b_vec = svld1_f16(pg_vec, (float16_t const*)b + i);
+        ab_vec = svmla_f16_x(pg_vec, ab_vec, a_vec, b_vec);
+        a2_vec = svmla_f16_x(pg_vec, a2_vec, a_vec, a_vec);
+        b2_vec = svmla_f16_x(pg_vec, b2_vec, b_vec, b_vec);
+        i += svcnth();
+    } while (i < n);
+
+    simsimd_f16_t ab = svaddv_f16(svptrue_b16(), ab_vec);
+    simsimd_f16_t a2 = svaddv_f16(svptrue_b16(), a2_vec);
+    simsimd_f16_t b2 = svaddv_f16(svptrue_b16(), b2_vec);
+
+    // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
+    simsimd_f32_t a2_b2_arr[2] = {a2, b2};
+    float32x2_t a2_b2 = vld1_f32(a2_b2_arr);
+    a2_b2 = simsimd_neon_rsqrt_f32x2(a2_b2);
+    vst1_f32(a2_b2_arr, a2_b2);
+    return ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
+}
+
+
+/*
+ *  @file   arm_sve_bf16.h
+ *  @brief  Arm SVE implementation of the most common similarity metrics for 16-bit brain floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity.
+ *  - Uses `bfdot` to multiply pairs of `bf16` words, accumulating in `f32`.
+ *  - Upcasts to `f32` for L2, as the differences of `bf16` numbers would lose precision.
+ *  - Requires compiler capabilities: +sve+bf16.
+ */
+
+__attribute__((target("+sve+bf16"))) //
+inline static simsimd_f32_t
+simsimd_sve_bf16_l2sq(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat32_t d2_vec = svdupq_n_f32(0.f, 0.f, 0.f, 0.f);
+    do {
+        // Load every `bf16` word into the upper half of a 32-bit lane, producing valid `f32` numbers
+        svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
+        svfloat32_t a_vec = svreinterpret_f32_u32(svlsl_n_u32_x(pg_vec, svld1uh_u32(pg_vec, a + i), 16));
+        svfloat32_t b_vec = svreinterpret_f32_u32(svlsl_n_u32_x(pg_vec, svld1uh_u32(pg_vec, b + i), 16));
+        svfloat32_t a_minus_b_vec = svsub_f32_x(pg_vec, a_vec, b_vec);
+        d2_vec = svmla_f32_m(pg_vec, d2_vec, a_minus_b_vec, a_minus_b_vec);
+        i += svcntw();
+    } while (i < n);
+    return svaddv_f32(svptrue_b32(), d2_vec);
+}
+
+__attribute__((target("+sve+bf16"))) //
+inline static simsimd_f32_t
+simsimd_sve_bf16_ip(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat32_t ab_vec = svdupq_n_f32(0.f, 0.f, 0.f, 0.f);
+    do {
+        // Inactive lanes are zeroed by the loads, so they don't affect the dot products
+        svbool_t pg_vec = svwhilelt_b16((unsigned int)i, (unsigned int)n);
+        svbfloat16_t a_vec = svreinterpret_bf16_u16(svld1_u16(pg_vec, a + i));
+        svbfloat16_t b_vec = svreinterpret_bf16_u16(svld1_u16(pg_vec, b + i));
+        ab_vec = svbfdot_f32(ab_vec, a_vec, b_vec);
+        i += svcnth();
+    } while (i < n);
+    return 1 - svaddv_f32(svptrue_b32(), ab_vec);
+}
+
+__attribute__((target("+sve+bf16"))) //
+inline static simsimd_f32_t
+simsimd_sve_bf16_cos(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svfloat32_t ab_vec = svdupq_n_f32(0.f, 0.f, 0.f, 0.f);
+    svfloat32_t a2_vec = svdupq_n_f32(0.f, 0.f, 0.f, 0.f);
+    svfloat32_t b2_vec = svdupq_n_f32(0.f, 0.f, 0.f, 0.f);
+    do {
+        svbool_t pg_vec = svwhilelt_b16((unsigned int)i, (unsigned int)n);
+        svbfloat16_t a_vec = svreinterpret_bf16_u16(svld1_u16(pg_vec, a + i));
+        svbfloat16_t b_vec = svreinterpret_bf16_u16(svld1_u16(pg_vec, b + i));
+        ab_vec = svbfdot_f32(ab_vec, a_vec, b_vec);
+        a2_vec = svbfdot_f32(a2_vec, a_vec, a_vec);
+        b2_vec = svbfdot_f32(b2_vec, b_vec, b_vec);
+        i += svcnth();
+    } while (i < n);
+
+    simsimd_f32_t ab = svaddv_f32(svptrue_b32(), ab_vec);
+    simsimd_f32_t a2 = svaddv_f32(svptrue_b32(), a2_vec);
+    simsimd_f32_t b2 = svaddv_f32(svptrue_b32(), b2_vec);
+
+    // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
+    simsimd_f32_t a2_b2_arr[2] = {a2, b2};
+    vst1_f32(a2_b2_arr, simsimd_neon_rsqrt_f32x2(vld1_f32(a2_b2_arr)));
+    return ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
+}
+
+/*
+ *  @file   arm_sve_f32_batch.h
+ *  @brief  Arm SVE implementation of one-to-many similarity metrics for 32-bit floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity.
+ *  - Compares the query against 4 rows at a time, loading every query chunk into a register just once.
+ *  - Uses merging `_m` intrinsics, so the predicated tails don't clobber the accumulators.
+ *  - Requires compiler capabilities: +sve.
+ */
+
+__attribute__((target("+sve"))) //
+inline static void
+simsimd_sve_f32_l2sq_batch(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t count,
+                           simsimd_size_t stride, simsimd_size_t n, simsimd_f32_t* results) {
+    simsimd_size_t j = 0;
+    for (; j + 4 <= count; j += 4) {
+        simsimd_f32_t const* b_0 = (simsimd_f32_t const*)((char const*)b + (j + 0) * stride);
+        simsimd_f32_t const* b_1 = (simsimd_f32_t const*)((char const*)b + (j + 1) * stride);
+        simsimd_f32_t const* b_2 = (simsimd_f32_t const*)((char const*)b + (j + 2) * stride);
+        simsimd_f32_t const* b_3 = (simsimd_f32_t const*)((char const*)b + (j + 3) * stride);
+        svfloat32_t d2_0_vec = svdup_n_f32(0.f), d2_1_vec = svdup_n_f32(0.f);
+        svfloat32_t d2_2_vec = svdup_n_f32(0.f), d2_3_vec = svdup_n_f32(0.f);
+        simsimd_size_t i = 0;
+        do {
+            svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
+            svfloat32_t a_vec = svld1_f32(pg_vec, a + i);
+            svfloat32_t d_0_vec = svsub_f32_x(pg_vec, a_vec, svld1_f32(pg_vec, b_0 + i));
+            svfloat32_t d_1_vec = svsub_f32_x(pg_vec, a_vec, svld1_f32(pg_vec, b_1 + i));
+            svfloat32_t d_2_vec = svsub_f32_x(pg_vec, a_vec, svld1_f32(pg_vec, b_2 + i));
+            svfloat32_t d_3_vec = svsub_f32_x(pg_vec, a_vec, svld1_f32(pg_vec, b_3 + i));
+            d2_0_vec = svmla_f32_m(pg_vec, d2_0_vec, d_0_vec, d_0_vec);
+            d2_1_vec = svmla_f32_m(pg_vec, d2_1_vec, d_1_vec, d_1_vec);
+            d2_2_vec = svmla_f32_m(pg_vec, d2_2_vec, d_2_vec, d_2_vec);
+            d2_3_vec = svmla_f32_m(pg_vec, d2_3_vec, d_3_vec, d_3_vec);
+            i += svcntw();
+        } while (i < n);
+        results[j + 0] = svaddv_f32(svptrue_b32(), d2_0_vec);
+        results[j + 1] = svaddv_f32(svptrue_b32(), d2_1_vec);
+        results[j + 2] = svaddv_f32(svptrue_b32(), d2_2_vec);
+        results[j + 3] = svaddv_f32(svptrue_b32(), d2_3_vec);
+    }
+    for (; j < count; ++j)
+        results[j] = simsimd_sve_f32_l2sq(a, (simsimd_f32_t const*)((char const*)b + j * stride), n);
+}
+
+__attribute__((target("+sve"))) //
+inline static void
+simsimd_sve_f32_ip_batch(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t count,
+                         simsimd_size_t stride, simsimd_size_t n, simsimd_f32_t* results) {
+    simsimd_size_t j = 0;
+    for (; j + 4 <= count; j += 4) {
+        simsimd_f32_t const* b_0 = (simsimd_f32_t const*)((char const*)b + (j + 0) * stride);
+        simsimd_f32_t const* b_1 = (simsimd_f32_t const*)((char const*)b + (j + 1) * stride);
+        simsimd_f32_t const* b_2 = (simsimd_f32_t const*)((char const*)b + (j + 2) * stride);
+        simsimd_f32_t const* b_3 = (simsimd_f32_t const*)((char const*)b + (j + 3) * stride);
+        svfloat32_t ab_0_vec = svdup_n_f32(0.f), ab_1_vec = svdup_n_f32(0.f);
+        svfloat32_t ab_2_vec = svdup_n_f32(0.f), ab_3_vec = svdup_n_f32(0.f);
+        simsimd_size_t i = 0;
+        do {
+            svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
+            svfloat32_t a_vec = svld1_f32(pg_vec, a + i);
+            ab_0_vec = svmla_f32_m(pg_vec, ab_0_vec, a_vec, svld1_f32(pg_vec, b_0 + i));
+            ab_1_vec = svmla_f32_m(pg_vec, ab_1_vec, a_vec, svld1_f32(pg_vec, b_1 + i));
+            ab_2_vec = svmla_f32_m(pg_vec, ab_2_vec, a_vec, svld1_f32(pg_vec, b_2 + i));
+            ab_3_vec = svmla_f32_m(pg_vec, ab_3_vec, a_vec, svld1_f32(pg_vec, b_3 + i));
+            i += svcntw();
+        } while (i < n);
+        results[j + 0] = 1 - svaddv_f32(svptrue_b32(), ab_0_vec);
+        results[j + 1] = 1 - svaddv_f32(svptrue_b32(), ab_1_vec);
+        results[j + 2] = 1 - svaddv_f32(svptrue_b32(), ab_2_vec);
+        results[j + 3] = 1 - svaddv_f32(svptrue_b32(), ab_3_vec);
+    }
+    for (; j < count; ++j)
+        results[j] = simsimd_sve_f32_ip(a, (simsimd_f32_t const*)((char const*)b + j * stride), n);
+}
+
+__attribute__((target("+sve"))) //
+inline static void
+simsimd_sve_f32_cos_batch(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t count,
+                          simsimd_size_t stride, simsimd_size_t n, simsimd_f32_t* results) {
+
+    // The norm of the query is computed just once for all the rows
+    svfloat32_t a2_vec = svdup_n_f32(0.f);
+    simsimd_size_t i = 0;
+    do {
+        svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
+        svfloat32_t a_vec = svld1_f32(pg_vec, a + i);
+        a2_vec = svmla_f32_m(pg_vec, a2_vec, a_vec, a_vec);
+        i += svcntw();
+    } while (i < n);
+    simsimd_f32_t a2 = svaddv_f32(svptrue_b32(), a2_vec);
+    simsimd_f32_t a2_recip_sqrt = vget_lane_f32(simsimd_neon_rsqrt_f32x2(vdup_n_f32(a2)), 0);
+
+    simsimd_size_t j = 0;
+    for (; j + 4 <= count; j += 4) {
+        simsimd_f32_t const* b_0 = (simsimd_f32_t const*)((char const*)b + (j + 0) * stride);
+        simsimd_f32_t const* b_1 = (simsimd_f32_t const*)((char const*)b + (j + 1) * stride);
+        simsimd_f32_t const* b_2 = (simsimd_f32_t const*)((char const*)b + (j + 2) * stride);
+        simsimd_f32_t const* b_3 = (simsimd_f32_t const*)((char const*)b + (j + 3) * stride);
+        svfloat32_t ab_0_vec = svdup_n_f32(0.f), ab_1_vec = svdup_n_f32(0.f);
+        svfloat32_t ab_2_vec = svdup_n_f32(0.f), ab_3_vec = svdup_n_f32(0.f);
+        svfloat32_t b2_0_vec = svdup_n_f32(0.f), b2_1_vec = svdup_n_f32(0.f);
+        svfloat32_t b2_2_vec = svdup_n_f32(0.f), b2_3_vec = svdup_n_f32(0.f);
+        i = 0;
+        do {
+            svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
+            svfloat32_t a_vec = svld1_f32(pg_vec, a + i);
+            svfloat32_t b_0_vec = svld1_f32(pg_vec, b_0 + i), b_1_vec = svld1_f32(pg_vec, b_1 + i);
+            svfloat32_t b_2_vec = svld1_f32(pg_vec, b_2 + i), b_3_vec = svld1_f32(pg_vec, b_3 + i);
+            ab_0_vec = svmla_f32_m(pg_vec, ab_0_vec, a_vec, b_0_vec);
+            ab_1_vec = svmla_f32_m(pg_vec, ab_1_vec, a_vec, b_1_vec);
+            ab_2_vec = svmla_f32_m(pg_vec, ab_2_vec, a_vec, b_2_vec);
+            ab_3_vec = svmla_f32_m(pg_vec, ab_3_vec, a_vec, b_3_vec);
+            b2_0_vec = svmla_f32_m(pg_vec, b2_0_vec, b_0_vec, b_0_vec);
+            b2_1_vec = svmla_f32_m(pg_vec, b2_1_vec, b_1_vec, b_1_vec);
+            b2_2_vec = svmla_f32_m(pg_vec, b2_2_vec, b_2_vec, b_2_vec);
+            b2_3_vec = svmla_f32_m(pg_vec, b2_3_vec, b_3_vec, b_3_vec);
+            i += svcntw();
+        } while (i < n);
+        simsimd_f32_t ab_arr[4] = {svaddv_f32(svptrue_b32(), ab_0_vec), svaddv_f32(svptrue_b32(), ab_1_vec),
+                                   svaddv_f32(svptrue_b32(), ab_2_vec), svaddv_f32(svptrue_b32(), ab_3_vec)};
+        simsimd_f32_t b2_arr[4] = {svaddv_f32(svptrue_b32(), b2_0_vec), svaddv_f32(svptrue_b32(), b2_1_vec),
+                                   svaddv_f32(svptrue_b32(), b2_2_vec), svaddv_f32(svptrue_b32(), b2_3_vec)};
+
+        // Avoid `simsimd_approximate_inverse_square_root` on Arm, estimating 4 roots at once with NEON
+        float32x4_t b2_recip_sqrt_vec = simsimd_neon_rsqrt_f32x4(vld1q_f32(b2_arr));
+        float32x4_t ab_norm_vec = vmulq_n_f32(vmulq_f32(vld1q_f32(ab_arr), b2_recip_sqrt_vec), a2_recip_sqrt);
+        simsimd_f32_t result_arr[4];
+        vst1q_f32(result_arr, vsubq_f32(vdupq_n_f32(1), ab_norm_vec));
+        for (simsimd_size_t k = 0; k != 4; ++k)
+            results[j + k] = ab_arr[k] != 0 ? result_arr[k] : 1;
+    }
+    for (; j < count; ++j)
+        results[j] = simsimd_sve_f32_cos(a, (simsimd_f32_t const*)((char const*)b + j * stride), n);
+}
+
+/*
+ *  @file   arm_sve_i8.h
+ *  @brief  Arm SVE implementation of the most common similarity metrics for 8-bit signed integral numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, cosine similarity, inner product (same as cosine).
+ *  - Uses `i8` for storage and `i32` for accumulation, with `svdot` multiplying 4 pairs of bytes per lane.
+ *  - Squares the absolute differences, that fit into `u8`, with the unsigned `svdot` for L2.
+ *  - Requires compiler capabilities: +sve.
+ */
+
+__attribute__((target("+sve"))) //
+inline static simsimd_f32_t
+simsimd_sve_i8_l2sq(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svuint32_t d2_vec = svdup_n_u32(0);
+    do {
+        svbool_t pg_vec = svwhilelt_b8((unsigned int)i, (unsigned int)n);
+        svint8_t a_vec = svld1_s8(pg_vec, a + i);
+        svint8_t b_vec = svld1_s8(pg_vec, b + i);
+        svuint8_t d_vec = svreinterpret_u8_s8(svabd_s8_z(pg_vec, a_vec, b_vec));
+        d2_vec = svdot_u32(d2_vec, d_vec, d_vec);
+        i += svcntb();
+    } while (i < n);
+    return (simsimd_f32_t)svaddv_u32(svptrue_b32(), d2_vec);
+}
+
+__attribute__((target("+sve"))) //
+inline static simsimd_f32_t
+simsimd_sve_i8_cos(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n) {
+    simsimd_size_t i = 0;
+    svint32_t ab_vec = svdup_n_s32(0);
+    svint32_t a2_vec = svdup_n_s32(0);
+    svint32_t b2_vec = svdup_n_s32(0);
+    do {
+        svbool_t pg_vec = svwhilelt_b8((unsigned int)i, (unsigned int)n);
+        svint8_t a_vec = svld1_s8(pg_vec, a + i);
+        svint8_t b_vec = svld1_s8(pg_vec, b + i);
+        ab_vec = svdot_s32(ab_vec, a_vec, b_vec);
+        a2_vec = svdot_s32(a2_vec, a_vec, a_vec);
+        b2_vec = svdot_s32(b2_vec, b_vec, b_vec);
+        i += svcntb();
+    } while (i < n);
+
+    simsimd_f32_t ab = (simsimd_f32_t)svaddv_s32(svptrue_b32(), ab_vec);
+    simsimd_f32_t a2 = (simsimd_f32_t)svaddv_s32(svptrue_b32(), a2_vec);
+    simsimd_f32_t b2 = (simsimd_f32_t)svaddv_s32(svptrue_b32(), b2_vec);
+
+    // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
+    simsimd_f32_t a2_b2_arr[2] = {a2, b2};
+    vst1_f32(a2_b2_arr, simsimd_neon_rsqrt_f32x2(vld1_f32(a2_b2_arr)));
+    return ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
+}
+
+__attribute__((target("+sve"))) //
+inline static simsimd_f32_t
+simsimd_sve_i8_ip(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n) {
+    return simsimd_sve_i8_cos(a, b, n);
+}
+
+#endif // SIMSIMD_TARGET_ARM_SVE
+#endif // SIMSIMD_TARGET_ARM
+
+#if SIMSIMD_TARGET_X86
+#if SIMSIMD_TARGET_X86_AVX2
+
+/**
+ *  @brief  Computes the reciprocal square roots of four numbers with the precision set by `SIMSIMD_COS_PRECISION`.
+ *          The `rsqrtps` estimate has about 12 bits of precision, and one Newton-Raphson step doubles it.
+ */
+__attribute__((target("avx2"))) //
+inline static __m128
+simsimd_avx2_rsqrt_ps(__m128 x) {
+#if SIMSIMD_COS_PRECISION == SIMSIMD_COS_PRECISION_EXACT
+    return _mm_div_ps(_mm_set1_ps(1), _mm_sqrt_ps(x));
+#else
+    __m128 y = _mm_rsqrt_ps(x);
+#if SIMSIMD_COS_PRECISION == SIMSIMD_COS_PRECISION_NEWTON
+    __m128 x_y_y = _mm_mul_ps(_mm_mul_ps(x, y), y);
+    y = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), y), _mm_sub_ps(_mm_set1_ps(3), x_y_y));
+#endif
+    return y;
+#endif
+}
+
+/*
+ *  @file   x86_avx2_f32.h
+ *  @brief  x86 AVX2 implementation of the most common similarity metrics for 32-bit floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity.
+ *  - Uses two independent accumulators per quantity, to hide the latency of the FMA instructions.
+ *  - Uses `_mm256_maskload_ps` intrinsics to load the tails, as those are available for 32-bit words.
+ *  - Uses `f32` for storage and `f32` for accumulation.
+ *  - Requires compiler capabilities: avx2, fma.
+ */
+
+__attribute__((target("avx2,fma"))) //
+inline static simsimd_f32_t
+simsimd_avx2_f32_l2sq(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
+    __m256 d2_first_vec = _mm256_setzero_ps(), d2_second_vec = _mm256_setzero_ps();
+    simsimd_size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256 d_first_vec = _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+        __m256 d_second_vec = _mm256_sub_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8));
+        d2_first_vec = _mm256_fmadd_ps(d_first_vec, d_first_vec, d2_first_vec);
+        d2_second_vec = _mm256_fmadd_ps(d_second_vec, d_second_vec, d2_second_vec);
+    }
+    for (; i < n; i += 8) {
+        __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32((int)(n - i)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        __m256 d_vec = _mm256_sub_ps(_mm256_maskload_ps(a + i, mask), _mm256_maskload_ps(b + i, mask));
+        d2_first_vec = _mm256_fmadd_ps(d_vec, d_vec, d2_first_vec);
+    }
+
+    __m256 d2_vec = _mm256_add_ps(d2_first_vec, d2_second_vec);
+    d2_vec = _mm256_add_ps(_mm256_permute2f128_ps(d2_vec, d2_vec, 1), d2_vec);
+    d2_vec = _mm256_hadd_ps(d2_vec, d2_vec);
+    d2_vec = _mm256_hadd_ps(d2_vec, d2_vec);
+    return _mm256_cvtss_f32(d2_vec);
+}
+
+__attribute__((target("avx2,fma"))) //
+inline static simsimd_f32_t
+simsimd_avx2_f32_ip(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
+    __m256 ab_first_vec = _mm256_setzero_ps(), ab_second_vec = _mm256_setzero_ps();
+    simsimd_size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        ab_first_vec = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), ab_first_vec);
+        ab_second_vec = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), ab_second_vec);
+    }
+    for (; i < n; i += 8) {
+        __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32((int)(n - i)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        ab_first_vec = _mm256_fmadd_ps(_mm256_maskload_ps(a + i, mask), _mm256_maskload_ps(b + i, mask), ab_first_vec);
+    }
+
+    __m256 ab_vec = _mm256_add_ps(ab_first_vec, ab_second_vec);
+    ab_vec = _mm256_add_ps(_mm256_permute2f128_ps(ab_vec, ab_vec, 1), ab_vec);
+    ab_vec = _mm256_hadd_ps(ab_vec, ab_vec);
+    ab_vec = _mm256_hadd_ps(ab_vec, ab_vec);
+    return 1 - _mm256_cvtss_f32(ab_vec);
+}
+
+__attribute__((target("avx2,fma"))) //
 inline static simsimd_f32_t
-simsimd_sve_f16_ip(simsimd_f16_t const* a_enum, simsimd_f16_t const* b_enum, simsimd_size_t n) {
+simsimd_avx2_f32_cos(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n) {
+    __m256 ab_first_vec = _mm256_setzero_ps(), ab_second_vec = _mm256_setzero_ps();
+    __m256 a2_first_vec = _mm256_setzero_ps(), a2_second_vec = _mm256_setzero_ps();
+    __m256 b2_first_vec = _mm256_setzero_ps(), b2_second_vec = _mm256_setzero_ps();
     simsimd_size_t i = 0;
-    svfloat16_t ab_vec = svdupq_n_f16(0, 0, 0, 0, 0, 0, 0, 0);
-    simsimd_f16_t const* a = (simsimd_f16_t const*)(a_enum);
-    simsimd_f16_t const* b = (simsimd_f16_t const*)(b_enum);
-    do {
-        svbool_t pg_vec = svwhilelt_b16((unsigned int)i, (unsigned int)n);
-        svfloat16_t a_vec = svld1_f16(pg_vec, (float16_t const*)a + i);
-        svfloat16_t b_vec = svld1_f16(pg_vec, (float16_t const*)b + i);
-        ab_vec = svmla_f16_x(pg_vec, ab_vec, a_vec, b_vec);
-        i += svcnth();
-    } while (i < n);
-    simsimd_f16_t ab = svaddv_f16(svptrue_b16(), ab_vec);
-    return 1 - ab;
+    for (; i + 16 <= n; i += 16) {
+        __m256 a_first_vec = _mm256_loadu_ps(a + i), a_second_vec = _mm256_loadu_ps(a + i + 8);
+        __m256 b_first_vec = _mm256_loadu_ps(b + i), b_second_vec = _mm256_loadu_ps(b + i + 8);
+        ab_first_vec = _mm256_fmadd_ps(a_first_vec, b_first_vec, ab_first_vec);
+        a2_first_vec = _mm256_fmadd_ps(a_first_vec, a_first_vec, a2_first_vec);
+        b2_first_vec = _mm256_fmadd_ps(b_first_vec, b_first_vec, b2_first_vec);
+        ab_second_vec = _mm256_fmadd_ps(a_second_vec, b_second_vec, ab_second_vec);
+        a2_second_vec = _mm256_fmadd_ps(a_second_vec, a_second_vec, a2_second_vec);
+        b2_second_vec = _mm256_fmadd_ps(b_second_vec, b_second_vec, b2_second_vec);
+    }
+    for (; i < n; i += 8) {
+        __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32((int)(n - i)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        __m256 a_vec = _mm256_maskload_ps(a + i, mask);
+        __m256 b_vec = _mm256_maskload_ps(b + i, mask);
+        ab_first_vec = _mm256_fmadd_ps(a_vec, b_vec, ab_first_vec);
+        a2_first_vec = _mm256_fmadd_ps(a_vec, a_vec, a2_first_vec);
+        b2_first_vec = _mm256_fmadd_ps(b_vec, b_vec, b2_first_vec);
+    }
+
+    __m256 ab_vec = _mm256_add_ps(ab_first_vec, ab_second_vec);
+    ab_vec = _mm256_add_ps(_mm256_permute2f128_ps(ab_vec, ab_vec, 1), ab_vec);
+    ab_vec = _mm256_hadd_ps(ab_vec, ab_vec);
+    ab_vec = _mm256_hadd_ps(ab_vec, ab_vec);
+
+    __m256 a2_vec = _mm256_add_ps(a2_first_vec, a2_second_vec);
+    a2_vec = _mm256_add_ps(_mm256_permute2f128_ps(a2_vec, a2_vec, 1), a2_vec);
+    a2_vec = _mm256_hadd_ps(a2_vec, a2_vec);
+    a2_vec = _mm256_hadd_ps(a2_vec, a2_vec);
+
+    __m256 b2_vec = _mm256_add_ps(b2_first_vec, b2_second_vec);
+    b2_vec = _mm256_add_ps(_mm256_permute2f128_ps(b2_vec, b2_vec, 1), b2_vec);
+    b2_vec = _mm256_hadd_ps(b2_vec, b2_vec);
+    b2_vec = _mm256_hadd_ps(b2_vec, b2_vec);
+
+    simsimd_f32_t ab = _mm256_cvtss_f32(ab_vec), a2 = _mm256_cvtss_f32(a2_vec), b2 = _mm256_cvtss_f32(b2_vec);
+
+    // Replace `simsimd_approximate_inverse_square_root` with `rsqrtps`, refined to `SIMSIMD_COS_PRECISION`
+    __m128 a2_sqrt_recip = simsimd_avx2_rsqrt_ps(_mm_set_ss((float)a2));
+    __m128 b2_sqrt_recip = simsimd_avx2_rsqrt_ps(_mm_set_ss((float)b2));
+    __m128 result = _mm_mul_ss(a2_sqrt_recip, b2_sqrt_recip); // Multiply the reciprocal square roots
+    result = _mm_mul_ss(result, _mm_set_ss((float)ab));       // Multiply by ab
+    result = _mm_sub_ss(_mm_set_ss(1.0f), result);            // Subtract from 1
+    return ab != 0 ? _mm_cvtss_f32(result) : 1;               // Extract the final result
 }
 
-__attribute__((target("+sve+fp16"))) //
+/*
+ *  @file   x86_avx2_f64.h
+ *  @brief  x86 AVX2 implementation of the most common similarity metrics for 64-bit floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity.
+ *  - Uses two independent accumulators per quantity, to hide the latency of the FMA instructions.
+ *  - Uses `_mm256_maskload_pd` intrinsics to load the tails, as those are available for 64-bit words.
+ *  - Uses `f64` for storage and `f64` for accumulation.
+ *  - Requires compiler capabilities: avx2, fma.
+ */
+
+__attribute__((target("avx2,fma"))) //
 inline static simsimd_f32_t
-simsimd_sve_f16_cos(simsimd_f16_t const* a_enum, simsimd_f16_t const* b_enum, simsimd_size_t n) {
+simsimd_avx2_f64_l2sq(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    __m256d d2_first_vec = _mm256_setzero_pd(), d2_second_vec = _mm256_setzero_pd();
     simsimd_size_t i = 0;
-    svfloat16_t ab_vec = svdupq_n_f16(0, 0, 0, 0, 0, 0, 0, 0);
-    svfloat16_t a2_vec = svdupq_n_f16(0, 0, 0, 0, 0, 0, 0, 0);
-    svfloat16_t b2_vec = svdupq_n_f16(0, 0, 0, 0, 0, 0, 0, 0);
-    simsimd_f16_t const* a = (simsimd_f16_t const*)(a_enum);
-    simsimd_f16_t const* b = (simsimd_f16_t const*)(b_enum);
-    do {
-        svbool_t pg_vec = svwhilelt_b16((unsigned int)i, (unsigned int)n);
-        svfloat16_t a_vec = svld1_f16(pg_vec, (float16_t const*)a + i);
-        svfloat16_t b_vec = svld1_f16(pg_vec, (float16_t const*)b + i);
-        ab_vec = svmla_f16_x(pg_vec, ab_vec, a_vec, b_vec);
-        a2_vec = svmla_f16_x(pg_vec, a2_vec, a_vec, a_vec);
-        b2_vec = svmla_f16_x(pg_vec, b2_vec, b_vec, b_vec);
-        i += svcnth();
-    } while (i < n);
+    for (; i + 8 <= n; i += 8) {
+        __m256d d_first_vec = _mm256_sub_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i));
+        __m256d d_second_vec = _mm256_sub_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4));
+        d2_first_vec = _mm256_fmadd_pd(d_first_vec, d_first_vec, d2_first_vec);
+        d2_second_vec = _mm256_fmadd_pd(d_second_vec, d_second_vec, d2_second_vec);
+    }
+    for (; i < n; i += 4) {
+        __m256i mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long)(n - i)), _mm256_setr_epi64x(0, 1, 2, 3));
+        __m256d d_vec = _mm256_sub_pd(_mm256_maskload_pd(a + i, mask), _mm256_maskload_pd(b + i, mask));
+        d2_first_vec = _mm256_fmadd_pd(d_vec, d_vec, d2_first_vec);
+    }
 
-    simsimd_f16_t ab = svaddv_f16(svptrue_b16(), ab_vec);
-    simsimd_f16_t a2 = svaddv_f16(svptrue_b16(), a2_vec);
-    simsimd_f16_t b2 = svaddv_f16(svptrue_b16(), b2_vec);
+    __m256d d2_vec = _mm256_add_pd(d2_first_vec, d2_second_vec);
+    __m128d d2_half_vec = _mm_add_pd(_mm256_castpd256_pd128(d2_vec), _mm256_extractf128_pd(d2_vec, 1));
+    d2_half_vec = _mm_add_sd(d2_half_vec, _mm_unpackhi_pd(d2_half_vec, d2_half_vec));
+    return (simsimd_f32_t)_mm_cvtsd_f64(d2_half_vec);
+}
 
-    // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
-    simsimd_f32_t a2_b2_arr[2] = {a2, b2};
-    float32x2_t a2_b2 = vld1_f32(a2_b2_arr);
-    a2_b2 = vrsqrte_f32(a2_b2);
-    vst1_f32(a2_b2_arr, a2_b2);
-    return ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
+__attribute__((target("avx2,fma"))) //
+inline static simsimd_f32_t
+simsimd_avx2_f64_ip(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    __m256d ab_first_vec = _mm256_setzero_pd(), ab_second_vec = _mm256_setzero_pd();
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        ab_first_vec = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), ab_first_vec);
+        ab_second_vec = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4), ab_second_vec);
+    }
+    for (; i < n; i += 4) {
+        __m256i mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long)(n - i)), _mm256_setr_epi64x(0, 1, 2, 3));
+        ab_first_vec = _mm256_fmadd_pd(_mm256_maskload_pd(a + i, mask), _mm256_maskload_pd(b + i, mask), ab_first_vec);
+    }
+
+    __m256d ab_vec = _mm256_add_pd(ab_first_vec, ab_second_vec);
+    __m128d ab_half_vec = _mm_add_pd(_mm256_castpd256_pd128(ab_vec), _mm256_extractf128_pd(ab_vec, 1));
+    ab_half_vec = _mm_add_sd(ab_half_vec, _mm_unpackhi_pd(ab_half_vec, ab_half_vec));
+    return (simsimd_f32_t)(1 - _mm_cvtsd_f64(ab_half_vec));
 }
 
-#endif // SIMSIMD_TARGET_ARM_SVE
-#endif // SIMSIMD_TARGET_ARM
+__attribute__((target("avx2,fma"))) //
+inline static simsimd_f32_t
+simsimd_avx2_f64_cos(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    __m256d ab_first_vec = _mm256_setzero_pd(), ab_second_vec = _mm256_setzero_pd();
+    __m256d a2_first_vec = _mm256_setzero_pd(), a2_second_vec = _mm256_setzero_pd();
+    __m256d b2_first_vec = _mm256_setzero_pd(), b2_second_vec = _mm256_setzero_pd();
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256d a_first_vec = _mm256_loadu_pd(a + i), a_second_vec = _mm256_loadu_pd(a + i + 4);
+        __m256d b_first_vec = _mm256_loadu_pd(b + i), b_second_vec = _mm256_loadu_pd(b + i + 4);
+        ab_first_vec = _mm256_fmadd_pd(a_first_vec, b_first_vec, ab_first_vec);
+        a2_first_vec = _mm256_fmadd_pd(a_first_vec, a_first_vec, a2_first_vec);
+        b2_first_vec = _mm256_fmadd_pd(b_first_vec, b_first_vec, b2_first_vec);
+        ab_second_vec = _mm256_fmadd_pd(a_second_vec, b_second_vec, ab_second_vec);
+        a2_second_vec = _mm256_fmadd_pd(a_second_vec, a_second_vec, a2_second_vec);
+        b2_second_vec = _mm256_fmadd_pd(b_second_vec, b_second_vec, b2_second_vec);
+    }
+    for (; i < n; i += 4) {
+        __m256i mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long)(n - i)), _mm256_setr_epi64x(0, 1, 2, 3));
+        __m256d a_vec = _mm256_maskload_pd(a + i, mask);
+        __m256d b_vec = _mm256_maskload_pd(b + i, mask);
+        ab_first_vec = _mm256_fmadd_pd(a_vec, b_vec, ab_first_vec);
+        a2_first_vec = _mm256_fmadd_pd(a_vec, a_vec, a2_first_vec);
+        b2_first_vec = _mm256_fmadd_pd(b_vec, b_vec, b2_first_vec);
+    }
 
-#if SIMSIMD_TARGET_X86
-#if SIMSIMD_TARGET_X86_AVX2
+    __m256d ab_vec = _mm256_add_pd(ab_first_vec, ab_second_vec);
+    __m128d ab_half_vec = _mm_add_pd(_mm256_castpd256_pd128(ab_vec), _mm256_extractf128_pd(ab_vec, 1));
+    ab_half_vec = _mm_add_sd(ab_half_vec, _mm_unpackhi_pd(ab_half_vec, ab_half_vec));
+
+    __m256d a2_vec = _mm256_add_pd(a2_first_vec, a2_second_vec);
+    __m128d a2_half_vec = _mm_add_pd(_mm256_castpd256_pd128(a2_vec), _mm256_extractf128_pd(a2_vec, 1));
+    a2_half_vec = _mm_add_sd(a2_half_vec, _mm_unpackhi_pd(a2_half_vec, a2_half_vec));
+
+    __m256d b2_vec = _mm256_add_pd(b2_first_vec, b2_second_vec);
+    __m128d b2_half_vec = _mm_add_pd(_mm256_castpd256_pd128(b2_vec), _mm256_extractf128_pd(b2_vec, 1));
+    b2_half_vec = _mm_add_sd(b2_half_vec, _mm_unpackhi_pd(b2_half_vec, b2_half_vec));
+
+    // Prefer the exact `sqrtpd` to the estimates, as the precision is the reason to use `f64`
+    simsimd_f64_t ab = _mm_cvtsd_f64(ab_half_vec);
+    __m128d a2_b2_sqrt = _mm_sqrt_pd(_mm_unpacklo_pd(a2_half_vec, b2_half_vec));
+    simsimd_f64_t a2_b2 = _mm_cvtsd_f64(_mm_mul_sd(a2_b2_sqrt, _mm_unpackhi_pd(a2_b2_sqrt, a2_b2_sqrt)));
+    return ab != 0 ? (simsimd_f32_t)(1 - ab / a2_b2) : 1;
+}
 
 /*
  *  @file   x86_avx2_f16.h
@@ -582,9 +1929,9 @@ simsimd_avx2_f16_cos(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_siz
         ab += ai * bi, a2 += ai * ai, b2 += bi * bi;
     }
 
-    // Replace simsimd_approximate_inverse_square_root with `rsqrtss`
-    __m128 a2_sqrt_recip = _mm_rsqrt_ss(_mm_set_ss((float)a2));
-    __m128 b2_sqrt_recip = _mm_rsqrt_ss(_mm_set_ss((float)b2));
+    // Replace `simsimd_approximate_inverse_square_root` with `rsqrtps`, refined to `SIMSIMD_COS_PRECISION`
+    __m128 a2_sqrt_recip = simsimd_avx2_rsqrt_ps(_mm_set_ss((float)a2));
+    __m128 b2_sqrt_recip = simsimd_avx2_rsqrt_ps(_mm_set_ss((float)b2));
     __m128 result = _mm_mul_ss(a2_sqrt_recip, b2_sqrt_recip); // Multiply the reciprocal square roots
     result = _mm_mul_ss(result, _mm_set_ss((float)ab));       // Multiply by ab
     result = _mm_sub_ss(_mm_set_ss(1.0f), result);            // Subtract from 1
@@ -640,91 +1987,636 @@ simsimd_avx2_i8_l2sq(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_
 
     // Take care of the tail:
     for (; i < n; ++i) {
-        int n = a[i] - b[i];
-        d2 += n * n;
+        int n = a[i] - b[i];
+        d2 += n * n;
+    }
+
+    return (simsimd_f32_t)d2;
+}
+__attribute__((target("avx2"))) //
+inline static simsimd_f32_t
+simsimd_avx2_i8_cos(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n) {
+
+    __m256i ab_low_vec = _mm256_setzero_si256();
+    __m256i ab_high_vec = _mm256_setzero_si256();
+    __m256i a2_low_vec = _mm256_setzero_si256();
+    __m256i a2_high_vec = _mm256_setzero_si256();
+    __m256i b2_low_vec = _mm256_setzero_si256();
+    __m256i b2_high_vec = _mm256_setzero_si256();
+
+    simsimd_size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i a_vec = _mm256_loadu_si256((__m256i const*)(a + i));
+        __m256i b_vec = _mm256_loadu_si256((__m256i const*)(b + i));
+
+        // Unpack int8 to int16
+        __m256i a_low_16 = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(a_vec, 0));
+        __m256i a_high_16 = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(a_vec, 1));
+        __m256i b_low_16 = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(b_vec, 0));
+        __m256i b_high_16 = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(b_vec, 1));
+
+        // Multiply and accumulate at int16 level, accumulate at int32 level
+        ab_low_vec = _mm256_add_epi32(ab_low_vec, _mm256_madd_epi16(a_low_16, b_low_16));
+        ab_high_vec = _mm256_add_epi32(ab_high_vec, _mm256_madd_epi16(a_high_16, b_high_16));
+        a2_low_vec = _mm256_add_epi32(a2_low_vec, _mm256_madd_epi16(a_low_16, a_low_16));
+        a2_high_vec = _mm256_add_epi32(a2_high_vec, _mm256_madd_epi16(a_high_16, a_high_16));
+        b2_low_vec = _mm256_add_epi32(b2_low_vec, _mm256_madd_epi16(b_low_16, b_low_16));
+        b2_high_vec = _mm256_add_epi32(b2_high_vec, _mm256_madd_epi16(b_high_16, b_high_16));
+    }
+
+    // Horizontal sum across the 256-bit register
+    __m256i ab_vec = _mm256_add_epi32(ab_low_vec, ab_high_vec);
+    __m128i ab_sum = _mm_add_epi32(_mm256_extracti128_si256(ab_vec, 0), _mm256_extracti128_si256(ab_vec, 1));
+    ab_sum = _mm_hadd_epi32(ab_sum, ab_sum);
+    ab_sum = _mm_hadd_epi32(ab_sum, ab_sum);
+
+    __m256i a2_vec = _mm256_add_epi32(a2_low_vec, a2_high_vec);
+    __m128i a2_sum = _mm_add_epi32(_mm256_extracti128_si256(a2_vec, 0), _mm256_extracti128_si256(a2_vec, 1));
+    a2_sum = _mm_hadd_epi32(a2_sum, a2_sum);
+    a2_sum = _mm_hadd_epi32(a2_sum, a2_sum);
+
+    __m256i b2_vec = _mm256_add_epi32(b2_low_vec, b2_high_vec);
+    __m128i b2_sum = _mm_add_epi32(_mm256_extracti128_si256(b2_vec, 0), _mm256_extracti128_si256(b2_vec, 1));
+    b2_sum = _mm_hadd_epi32(b2_sum, b2_sum);
+    b2_sum = _mm_hadd_epi32(b2_sum, b2_sum);
+
+    // Further reduce to a single sum for each vector
+    int ab = _mm_extract_epi32(ab_sum, 0);
+    int a2 = _mm_extract_epi32(a2_sum, 0);
+    int b2 = _mm_extract_epi32(b2_sum, 0);
+
+    // Take care of the tail:
+    for (; i < n; ++i) {
+        int ai = a[i], bi = b[i];
+        ab += ai * bi, a2 += ai * ai, b2 += bi * bi;
+    }
+
+    // Compute the reciprocal of the square roots
+    __m128 a2_sqrt_recip = simsimd_avx2_rsqrt_ps(_mm_set_ss((float)a2));
+    __m128 b2_sqrt_recip = simsimd_avx2_rsqrt_ps(_mm_set_ss((float)b2));
+
+    // Compute cosine similarity: ab / sqrt(a2 * b2)
+    __m128 denom = _mm_mul_ss(a2_sqrt_recip, b2_sqrt_recip);  // Reciprocal of sqrt(a2 * b2)
+    __m128 result = _mm_mul_ss(_mm_set_ss((float)ab), denom); // ab * reciprocal of sqrt(a2 * b2)
+
+    return ab != 0 ? 1 - _mm_cvtss_f32(result) : 0; // Extract the final result
+}
+
+__attribute__((target("avx2"))) //
+inline static simsimd_f32_t
+simsimd_avx2_i8_ip(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n) {
+    return simsimd_avx2_i8_cos(a, b, n);
+}
+
+/*
+ *  @file   x86_avx2_u8.h
+ *  @brief  x86 AVX2 implementation of the most common similarity metrics for 8-bit unsigned integral numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, cosine similarity, inner product (same as cosine).
+ *  - Avoids `vpmaddubsw`, as the pairwise sums of `u8` products saturate `i16`, zero-extending to `i16` instead.
+ *  - Computes the absolute differences for L2 with a pair of saturating subtractions.
+ *  - Requires compiler capabilities: avx2.
+ */
+
+__attribute__((target("avx2"))) //
+inline static simsimd_i32_t
+simsimd_avx2_reduce_i32x8(__m256i vec) {
+    __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(vec), _mm256_extracti128_si256(vec, 1));
+    sum = _mm_hadd_epi32(sum, sum);
+    sum = _mm_hadd_epi32(sum, sum);
+    return _mm_cvtsi128_si32(sum);
+}
+
+__attribute__((target("avx2"))) //
+inline static simsimd_f32_t
+simsimd_avx2_u8_l2sq(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n) {
+
+    __m256i d2_low_vec = _mm256_setzero_si256();
+    __m256i d2_high_vec = _mm256_setzero_si256();
+    __m256i const zeros = _mm256_setzero_si256();
+
+    simsimd_size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i a_vec = _mm256_loadu_si256((__m256i const*)(a + i));
+        __m256i b_vec = _mm256_loadu_si256((__m256i const*)(b + i));
+        __m256i d_vec = _mm256_or_si256(_mm256_subs_epu8(a_vec, b_vec), _mm256_subs_epu8(b_vec, a_vec));
+
+        // Zero extend the absolute differences to int16, the lanes order doesn't matter for the sum
+        __m256i d_low = _mm256_unpacklo_epi8(d_vec, zeros);
+        __m256i d_high = _mm256_unpackhi_epi8(d_vec, zeros);
+        d2_low_vec = _mm256_add_epi32(d2_low_vec, _mm256_madd_epi16(d_low, d_low));
+        d2_high_vec = _mm256_add_epi32(d2_high_vec, _mm256_madd_epi16(d_high, d_high));
+    }
+
+    simsimd_i32_t d2 = simsimd_avx2_reduce_i32x8(_mm256_add_epi32(d2_low_vec, d2_high_vec));
+
+    // Take care of the tail:
+    for (; i < n; ++i) {
+        simsimd_i32_t d = (simsimd_i32_t)a[i] - (simsimd_i32_t)b[i];
+        d2 += d * d;
+    }
+
+    return (simsimd_f32_t)d2;
+}
+
+__attribute__((target("avx2"))) //
+inline static simsimd_f32_t
+simsimd_avx2_u8_cos(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n) {
+
+    __m256i ab_vec = _mm256_setzero_si256();
+    __m256i a2_vec = _mm256_setzero_si256();
+    __m256i b2_vec = _mm256_setzero_si256();
+    __m256i const zeros = _mm256_setzero_si256();
+
+    simsimd_size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i a_vec = _mm256_loadu_si256((__m256i const*)(a + i));
+        __m256i b_vec = _mm256_loadu_si256((__m256i const*)(b + i));
+
+        // Zero extend uint8 to int16, the lanes order doesn't matter, as long as it's the same for both
+        __m256i a_low = _mm256_unpacklo_epi8(a_vec, zeros);
+        __m256i a_high = _mm256_unpackhi_epi8(a_vec, zeros);
+        __m256i b_low = _mm256_unpacklo_epi8(b_vec, zeros);
+        __m256i b_high = _mm256_unpackhi_epi8(b_vec, zeros);
+
+        ab_vec = _mm256_add_epi32(ab_vec, _mm256_madd_epi16(a_low, b_low));
+        ab_vec = _mm256_add_epi32(ab_vec, _mm256_madd_epi16(a_high, b_high));
+        a2_vec = _mm256_add_epi32(a2_vec, _mm256_madd_epi16(a_low, a_low));
+        a2_vec = _mm256_add_epi32(a2_vec, _mm256_madd_epi16(a_high, a_high));
+        b2_vec = _mm256_add_epi32(b2_vec, _mm256_madd_epi16(b_low, b_low));
+        b2_vec = _mm256_add_epi32(b2_vec, _mm256_madd_epi16(b_high, b_high));
+    }
+
+    simsimd_i32_t ab = simsimd_avx2_reduce_i32x8(ab_vec);
+    simsimd_i32_t a2 = simsimd_avx2_reduce_i32x8(a2_vec);
+    simsimd_i32_t b2 = simsimd_avx2_reduce_i32x8(b2_vec);
+
+    // Take care of the tail:
+    for (; i < n; ++i) {
+        simsimd_i32_t ai = a[i], bi = b[i];
+        ab += ai * bi, a2 += ai * ai, b2 += bi * bi;
+    }
+
+    __m128 a2_sqrt_recip = simsimd_avx2_rsqrt_ps(_mm_set_ss((float)a2));
+    __m128 b2_sqrt_recip = simsimd_avx2_rsqrt_ps(_mm_set_ss((float)b2));
+    __m128 result = _mm_mul_ss(_mm_set_ss((float)ab), _mm_mul_ss(a2_sqrt_recip, b2_sqrt_recip));
+    return ab != 0 ? 1 - _mm_cvtss_f32(result) : 1;
+}
+
+__attribute__((target("avx2"))) //
+inline static simsimd_f32_t
+simsimd_avx2_u8_ip(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n) {
+    return simsimd_avx2_u8_cos(a, b, n);
+}
+
+/*
+ *  @file   x86_avx2_i4x2.h
+ *  @brief  x86 AVX2 implementation of the most common similarity metrics for 4-bit signed integral numbers,
+ *          packed in pairs into 8-bit words.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, cosine similarity, inner product (same as cosine).
+ *  - Unpacks the nibbles with shifts and masks, sign-extending them into `i8` with an `xor` and a subtraction.
+ *  - Multiplies with `vpmaddubsw`, passing the magnitudes of one side as unsigned bytes, and applying its signs
+ *    to the other side with `vpsignb`. Pairwise sums of 4-bit products never saturate `i16`.
+ *  - Requires compiler capabilities: avx2.
+ */
+
+__attribute__((target("avx2"))) //
+inline static void
+simsimd_avx2_i4x2_unpack(__m256i x, __m256i* low, __m256i* high) {
+    __m256i const nibble_mask = _mm256_set1_epi8(0x0F);
+    __m256i const sign_bit = _mm256_set1_epi8(0x08);
+    *low = _mm256_and_si256(x, nibble_mask);
+    *high = _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble_mask);
+    *low = _mm256_sub_epi8(_mm256_xor_si256(*low, sign_bit), sign_bit);
+    *high = _mm256_sub_epi8(_mm256_xor_si256(*high, sign_bit), sign_bit);
+}
+
+__attribute__((target("avx2"))) //
+inline static simsimd_f32_t
+simsimd_avx2_i4x2_l2sq(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n) {
+
+    __m256i d2_vec = _mm256_setzero_si256();
+    __m256i const ones = _mm256_set1_epi16(1);
+
+    simsimd_size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i a_low, a_high, b_low, b_high;
+        simsimd_avx2_i4x2_unpack(_mm256_loadu_si256((__m256i const*)(a + i)), &a_low, &a_high);
+        simsimd_avx2_i4x2_unpack(_mm256_loadu_si256((__m256i const*)(b + i)), &b_low, &b_high);
+        __m256i d_low = _mm256_abs_epi8(_mm256_sub_epi8(a_low, b_low));
+        __m256i d_high = _mm256_abs_epi8(_mm256_sub_epi8(a_high, b_high));
+        __m256i d2_i16s = _mm256_add_epi16(_mm256_maddubs_epi16(d_low, d_low), _mm256_maddubs_epi16(d_high, d_high));
+        d2_vec = _mm256_add_epi32(d2_vec, _mm256_madd_epi16(d2_i16s, ones));
+    }
+
+    simsimd_i32_t d2 = simsimd_avx2_reduce_i32x8(d2_vec);
+
+    // Take care of the tail:
+    for (; i < n; ++i) {
+        simsimd_i32_t d_low = SIMSIMD_I4X2_LOW(a[i]) - SIMSIMD_I4X2_LOW(b[i]);
+        simsimd_i32_t d_high = SIMSIMD_I4X2_HIGH(a[i]) - SIMSIMD_I4X2_HIGH(b[i]);
+        d2 += d_low * d_low + d_high * d_high;
+    }
+
+    return (simsimd_f32_t)d2;
+}
+
+__attribute__((target("avx2"))) //
+inline static simsimd_f32_t
+simsimd_avx2_i4x2_cos(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n) {
+
+    __m256i ab_vec = _mm256_setzero_si256();
+    __m256i a2_vec = _mm256_setzero_si256();
+    __m256i b2_vec = _mm256_setzero_si256();
+    __m256i const ones = _mm256_set1_epi16(1);
+
+    simsimd_size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i a_low, a_high, b_low, b_high;
+        simsimd_avx2_i4x2_unpack(_mm256_loadu_si256((__m256i const*)(a + i)), &a_low, &a_high);
+        simsimd_avx2_i4x2_unpack(_mm256_loadu_si256((__m256i const*)(b + i)), &b_low, &b_high);
+        __m256i a_low_abs = _mm256_abs_epi8(a_low), a_high_abs = _mm256_abs_epi8(a_high);
+        __m256i b_low_abs = _mm256_abs_epi8(b_low), b_high_abs = _mm256_abs_epi8(b_high);
+
+        __m256i ab_i16s = _mm256_add_epi16(_mm256_maddubs_epi16(a_low_abs, _mm256_sign_epi8(b_low, a_low)),
+                                           _mm256_maddubs_epi16(a_high_abs, _mm256_sign_epi8(b_high, a_high)));
+        __m256i a2_i16s = _mm256_add_epi16(_mm256_maddubs_epi16(a_low_abs, a_low_abs),
+                                           _mm256_maddubs_epi16(a_high_abs, a_high_abs));
+        __m256i b2_i16s = _mm256_add_epi16(_mm256_maddubs_epi16(b_low_abs, b_low_abs),
+                                           _mm256_maddubs_epi16(b_high_abs, b_high_abs));
+        ab_vec = _mm256_add_epi32(ab_vec, _mm256_madd_epi16(ab_i16s, ones));
+        a2_vec = _mm256_add_epi32(a2_vec, _mm256_madd_epi16(a2_i16s, ones));
+        b2_vec = _mm256_add_epi32(b2_vec, _mm256_madd_epi16(b2_i16s, ones));
+    }
+
+    simsimd_i32_t ab = simsimd_avx2_reduce_i32x8(ab_vec);
+    simsimd_i32_t a2 = simsimd_avx2_reduce_i32x8(a2_vec);
+    simsimd_i32_t b2 = simsimd_avx2_reduce_i32x8(b2_vec);
+
+    // Take care of the tail:
+    for (; i < n; ++i) {
+        simsimd_i32_t a_low = SIMSIMD_I4X2_LOW(a[i]), a_high = SIMSIMD_I4X2_HIGH(a[i]);
+        simsimd_i32_t b_low = SIMSIMD_I4X2_LOW(b[i]), b_high = SIMSIMD_I4X2_HIGH(b[i]);
+        ab += a_low * b_low + a_high * b_high;
+        a2 += a_low * a_low + a_high * a_high;
+        b2 += b_low * b_low + b_high * b_high;
     }
 
-    return (simsimd_f32_t)d2;
+    __m128 a2_sqrt_recip = simsimd_avx2_rsqrt_ps(_mm_set_ss((float)a2));
+    __m128 b2_sqrt_recip = simsimd_avx2_rsqrt_ps(_mm_set_ss((float)b2));
+    __m128 result = _mm_mul_ss(_mm_set_ss((float)ab), _mm_mul_ss(a2_sqrt_recip, b2_sqrt_recip));
+    return ab != 0 ? 1 - _mm_cvtss_f32(result) : 1;
 }
+
 __attribute__((target("avx2"))) //
 inline static simsimd_f32_t
-simsimd_avx2_i8_cos(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n) {
+simsimd_avx2_i4x2_ip(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n) {
+    return simsimd_avx2_i4x2_cos(a, b, n);
+}
 
-    __m256i ab_low_vec = _mm256_setzero_si256();
-    __m256i ab_high_vec = _mm256_setzero_si256();
-    __m256i a2_low_vec = _mm256_setzero_si256();
-    __m256i a2_high_vec = _mm256_setzero_si256();
-    __m256i b2_low_vec = _mm256_setzero_si256();
-    __m256i b2_high_vec = _mm256_setzero_si256();
+/*
+ *  @file   x86_avx2_mixed.h
+ *  @brief  x86 AVX2 implementation of the mixed-precision similarity metrics.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity, for `f32` and `f16`, `f32` and `i8`, `f16` and `i8`.
+ *  - Upcasts both sides to `f32` with `_mm256_cvtph_ps` and `_mm256_cvtepi8_epi32` on the fly.
+ *  - As AVX2 doesn't support masked loads of 8-bit and 16-bit words, the tails are handled by a separate `for`-loop.
+ *  - Requires compiler capabilities: avx2, f16c, fma.
+ */
 
-    simsimd_size_t i = 0;
-    for (; i + 32 <= n; i += 32) {
-        __m256i a_vec = _mm256_loadu_si256((__m256i const*)(a + i));
-        __m256i b_vec = _mm256_loadu_si256((__m256i const*)(b + i));
+__attribute__((target("avx2,f16c,fma"))) //
+inline static __m256
+simsimd_avx2_f32_load_f32(simsimd_f32_t const* x) {
+    return _mm256_loadu_ps(x);
+}
 
-        // Unpack int8 to int16
-        __m256i a_low_16 = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(a_vec, 0));
-        __m256i a_high_16 = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(a_vec, 1));
-        __m256i b_low_16 = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(b_vec, 0));
-        __m256i b_high_16 = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(b_vec, 1));
+__attribute__((target("avx2,f16c,fma"))) //
+inline static __m256
+simsimd_avx2_f16_load_f32(simsimd_f16_t const* x) {
+    return _mm256_cvtph_ps(_mm_loadu_si128((__m128i const*)x));
+}
 
-        // Multiply and accumulate at int16 level, accumulate at int32 level
-        ab_low_vec = _mm256_add_epi32(ab_low_vec, _mm256_madd_epi16(a_low_16, b_low_16));
-        ab_high_vec = _mm256_add_epi32(ab_high_vec, _mm256_madd_epi16(a_high_16, b_high_16));
-        a2_low_vec = _mm256_add_epi32(a2_low_vec, _mm256_madd_epi16(a_low_16, a_low_16));
-        a2_high_vec = _mm256_add_epi32(a2_high_vec, _mm256_madd_epi16(a_high_16, a_high_16));
-        b2_low_vec = _mm256_add_epi32(b2_low_vec, _mm256_madd_epi16(b_low_16, b_low_16));
-        b2_high_vec = _mm256_add_epi32(b2_high_vec, _mm256_madd_epi16(b_high_16, b_high_16));
+__attribute__((target("avx2,f16c,fma"))) //
+inline static __m256
+simsimd_avx2_i8_load_f32(simsimd_i8_t const* x) {
+    return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64((__m128i const*)x)));
+}
+
+__attribute__((target("avx2,f16c,fma"))) //
+inline static simsimd_f32_t
+simsimd_avx2_reduce_f32x8(__m256 x) {
+    __m128 sum_vec = _mm_add_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1));
+    sum_vec = _mm_hadd_ps(sum_vec, sum_vec);
+    sum_vec = _mm_hadd_ps(sum_vec, sum_vec);
+    return _mm_cvtss_f32(sum_vec);
+}
+
+#define SIMSIMD_AVX2_MAKE_MIXED(a_type, b_type, a_converter, b_converter)                                              \
+    __attribute__((target("avx2,f16c,fma")))                                                                           \
+    inline static simsimd_f32_t simsimd_avx2_##a_type##b_type##_l2sq_scaled(                                           \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n, simsimd_f32_t b_scale) {       \
+        __m256 const scale_vec = _mm256_set1_ps(b_scale);                                                              \
+        __m256 d2_vec = _mm256_setzero_ps();                                                                           \
+        simsimd_size_t i = 0;                                                                                          \
+        for (; i + 8 <= n; i += 8) {                                                                                   \
+            __m256 a_vec = simsimd_avx2_##a_type##_load_f32(a + i);                                                    \
+            __m256 b_vec = _mm256_mul_ps(simsimd_avx2_##b_type##_load_f32(b + i), scale_vec);                          \
+            __m256 d_vec = _mm256_sub_ps(a_vec, b_vec);                                                                \
+            d2_vec = _mm256_fmadd_ps(d_vec, d_vec, d2_vec);                                                            \
+        }                                                                                                              \
+        simsimd_f32_t d2 = simsimd_avx2_reduce_f32x8(d2_vec);                                                          \
+        for (; i < n; ++i) {                                                                                           \
+            simsimd_f32_t d = a_converter(a[i]) - b_scale * b_converter(b[i]);                                         \
+            d2 += d * d;                                                                                               \
+        }                                                                                                              \
+        return d2;                                                                                                     \
+    }                                                                                                                  \
+    __attribute__((target("avx2,f16c,fma")))                                                                           \
+    inline static simsimd_f32_t simsimd_avx2_##a_type##b_type##_ip_scaled(                                             \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n, simsimd_f32_t b_scale) {       \
+        __m256 ab_vec = _mm256_setzero_ps();                                                                           \
+        simsimd_size_t i = 0;                                                                                          \
+        for (; i + 8 <= n; i += 8) {                                                                                   \
+            __m256 a_vec = simsimd_avx2_##a_type##_load_f32(a + i);                                                    \
+            __m256 b_vec = simsimd_avx2_##b_type##_load_f32(b + i);                                                    \
+            ab_vec = _mm256_fmadd_ps(a_vec, b_vec, ab_vec);                                                            \
+        }                                                                                                              \
+        simsimd_f32_t ab = simsimd_avx2_reduce_f32x8(ab_vec);                                                          \
+        for (; i < n; ++i) {                                                                                           \
+            simsimd_f32_t ai = a_converter(a[i]), bi = b_converter(b[i]);                                              \
+            ab += ai * bi;                                                                                             \
+        }                                                                                                              \
+        return 1 - b_scale * ab;                                                                                       \
+    }                                                                                                                  \
+    __attribute__((target("avx2,f16c,fma")))                                                                           \
+    inline static simsimd_f32_t simsimd_avx2_##a_type##b_type##_cos_scaled(                                            \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n, simsimd_f32_t b_scale) {       \
+        __m256 ab_vec = _mm256_setzero_ps(), a2_vec = _mm256_setzero_ps(), b2_vec = _mm256_setzero_ps();               \
+        simsimd_size_t i = 0;                                                                                          \
+        for (; i + 8 <= n; i += 8) {                                                                                   \
+            __m256 a_vec = simsimd_avx2_##a_type##_load_f32(a + i);                                                    \
+            __m256 b_vec = simsimd_avx2_##b_type##_load_f32(b + i);                                                    \
+            ab_vec = _mm256_fmadd_ps(a_vec, b_vec, ab_vec);                                                            \
+            a2_vec = _mm256_fmadd_ps(a_vec, a_vec, a2_vec);                                                            \
+            b2_vec = _mm256_fmadd_ps(b_vec, b_vec, b2_vec);                                                            \
+        }                                                                                                              \
+        simsimd_f32_t ab = simsimd_avx2_reduce_f32x8(ab_vec);                                                          \
+        simsimd_f32_t a2 = simsimd_avx2_reduce_f32x8(a2_vec), b2 = simsimd_avx2_reduce_f32x8(b2_vec);                  \
+        for (; i < n; ++i) {                                                                                           \
+            simsimd_f32_t ai = a_converter(a[i]), bi = b_converter(b[i]);                                              \
+            ab += ai * bi, a2 += ai * ai, b2 += bi * bi;                                                               \
+        }                                                                                                              \
+        ab = b_scale < 0 ? -ab : ab;                                                                                   \
+        return ab != 0 ? (1 - ab * SIMSIMD_RSQRT(a2) * SIMSIMD_RSQRT(b2)) : 1;                                         \
+    }                                                                                                                  \
+    __attribute__((target("avx2,f16c,fma")))                                                                           \
+    inline static simsimd_f32_t simsimd_avx2_##a_type##b_type##_l2sq(                                                  \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n) {                              \
+        return simsimd_avx2_##a_type##b_type##_l2sq_scaled(a, b, n, 1);                                                \
+    }                                                                                                                  \
+    __attribute__((target("avx2,f16c,fma")))                                                                           \
+    inline static simsimd_f32_t simsimd_avx2_##a_type##b_type##_ip(                                                    \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n) {                              \
+        return simsimd_avx2_##a_type##b_type##_ip_scaled(a, b, n, 1);                                                  \
+    }                                                                                                                  \
+    __attribute__((target("avx2,f16c,fma")))                                                                           \
+    inline static simsimd_f32_t simsimd_avx2_##a_type##b_type##_cos(                                                   \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n) {                              \
+        return simsimd_avx2_##a_type##b_type##_cos_scaled(a, b, n, 1);                                                 \
     }
 
-    // Horizontal sum across the 256-bit register
-    __m256i ab_vec = _mm256_add_epi32(ab_low_vec, ab_high_vec);
-    __m128i ab_sum = _mm_add_epi32(_mm256_extracti128_si256(ab_vec, 0), _mm256_extracti128_si256(ab_vec, 1));
-    ab_sum = _mm_hadd_epi32(ab_sum, ab_sum);
-    ab_sum = _mm_hadd_epi32(ab_sum, ab_sum);
+SIMSIMD_AVX2_MAKE_MIXED(f32, f16, SIMSIMD_IDENTIFY, SIMSIMD_UNCOMPRESS_F16) // simsimd_avx2_f32f16_l2sq, ip, cos
+SIMSIMD_AVX2_MAKE_MIXED(f32, i8, SIMSIMD_IDENTIFY, SIMSIMD_IDENTIFY)        // simsimd_avx2_f32i8_l2sq, ip, cos
+SIMSIMD_AVX2_MAKE_MIXED(f16, i8, SIMSIMD_UNCOMPRESS_F16, SIMSIMD_IDENTIFY)  // simsimd_avx2_f16i8_l2sq, ip, cos
 
-    __m256i a2_vec = _mm256_add_epi32(a2_low_vec, a2_high_vec);
-    __m128i a2_sum = _mm_add_epi32(_mm256_extracti128_si256(a2_vec, 0), _mm256_extracti128_si256(a2_vec, 1));
-    a2_sum = _mm_hadd_epi32(a2_sum, a2_sum);
-    a2_sum = _mm_hadd_epi32(a2_sum, a2_sum);
+#undef SIMSIMD_AVX2_MAKE_MIXED
 
-    __m256i b2_vec = _mm256_add_epi32(b2_low_vec, b2_high_vec);
-    __m128i b2_sum = _mm_add_epi32(_mm256_extracti128_si256(b2_vec, 0), _mm256_extracti128_si256(b2_vec, 1));
-    b2_sum = _mm_hadd_epi32(b2_sum, b2_sum);
-    b2_sum = _mm_hadd_epi32(b2_sum, b2_sum);
+/*
+ *  @file   x86_avx2_bf16.h
+ *  @brief  x86 AVX2 implementation of the most common similarity metrics for 16-bit brain floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity.
+ *  - Serves as a fallback for CPUs without the `vdpbf16ps` instruction of AVX-512 BF16.
+ *  - Upcasts to `f32` by shifting the `bf16` bits into the upper halves of 32-bit words, accumulating with FMA.
+ *  - As AVX2 doesn't support masked loads of 16-bit words, the tails are handled by a separate `for`-loop.
+ *  - Requires compiler capabilities: avx2, f16c, fma.
+ */
 
-    // Further reduce to a single sum for each vector
-    int ab = _mm_extract_epi32(ab_sum, 0);
-    int a2 = _mm_extract_epi32(a2_sum, 0);
-    int b2 = _mm_extract_epi32(b2_sum, 0);
+__attribute__((target("avx2,f16c,fma"))) //
+inline static __m256
+simsimd_avx2_bf16_load_f32(simsimd_bf16_t const* x) {
+    __m256i words = _mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i const*)x));
+    return _mm256_castsi256_ps(_mm256_slli_epi32(words, 16));
+}
 
-    // Take care of the tail:
+__attribute__((target("avx2,f16c,fma"))) //
+inline static simsimd_f32_t
+simsimd_avx2_bf16_l2sq(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n) {
+    __m256 d2_vec = _mm256_setzero_ps();
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 d_vec = _mm256_sub_ps(simsimd_avx2_bf16_load_f32(a + i), simsimd_avx2_bf16_load_f32(b + i));
+        d2_vec = _mm256_fmadd_ps(d_vec, d_vec, d2_vec);
+    }
+    simsimd_f32_t d2 = simsimd_avx2_reduce_f32x8(d2_vec);
     for (; i < n; ++i) {
-        int ai = a[i], bi = b[i];
-        ab += ai * bi, a2 += ai * ai, b2 += bi * bi;
+        simsimd_f32_t d = SIMSIMD_UNCOMPRESS_BF16(a[i]) - SIMSIMD_UNCOMPRESS_BF16(b[i]);
+        d2 += d * d;
     }
+    return d2;
+}
 
-    // Compute the reciprocal of the square roots
-    __m128 a2_sqrt_recip = _mm_rsqrt_ss(_mm_set_ss((float)a2));
-    __m128 b2_sqrt_recip = _mm_rsqrt_ss(_mm_set_ss((float)b2));
-
-    // Compute cosine similarity: ab / sqrt(a2 * b2)
-    __m128 denom = _mm_mul_ss(a2_sqrt_recip, b2_sqrt_recip);  // Reciprocal of sqrt(a2 * b2)
-    __m128 result = _mm_mul_ss(_mm_set_ss((float)ab), denom); // ab * reciprocal of sqrt(a2 * b2)
-
-    return ab != 0 ? 1 - _mm_cvtss_f32(result) : 0; // Extract the final result
+__attribute__((target("avx2,f16c,fma"))) //
+inline static simsimd_f32_t
+simsimd_avx2_bf16_ip(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n) {
+    __m256 ab_vec = _mm256_setzero_ps();
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        ab_vec = _mm256_fmadd_ps(simsimd_avx2_bf16_load_f32(a + i), simsimd_avx2_bf16_load_f32(b + i), ab_vec);
+    simsimd_f32_t ab = simsimd_avx2_reduce_f32x8(ab_vec);
+    for (; i < n; ++i)
+        ab += SIMSIMD_UNCOMPRESS_BF16(a[i]) * SIMSIMD_UNCOMPRESS_BF16(b[i]);
+    return 1 - ab;
 }
 
-__attribute__((target("avx2"))) //
+__attribute__((target("avx2,f16c,fma"))) //
 inline static simsimd_f32_t
-simsimd_avx2_i8_ip(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n) {
-    return simsimd_avx2_i8_cos(a, b, n);
+simsimd_avx2_bf16_cos(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n) {
+    __m256 ab_vec = _mm256_setzero_ps(), a2_vec = _mm256_setzero_ps(), b2_vec = _mm256_setzero_ps();
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = simsimd_avx2_bf16_load_f32(a + i);
+        __m256 b_vec = simsimd_avx2_bf16_load_f32(b + i);
+        ab_vec = _mm256_fmadd_ps(a_vec, b_vec, ab_vec);
+        a2_vec = _mm256_fmadd_ps(a_vec, a_vec, a2_vec);
+        b2_vec = _mm256_fmadd_ps(b_vec, b_vec, b2_vec);
+    }
+    simsimd_f32_t ab = simsimd_avx2_reduce_f32x8(ab_vec);
+    simsimd_f32_t a2 = simsimd_avx2_reduce_f32x8(a2_vec);
+    simsimd_f32_t b2 = simsimd_avx2_reduce_f32x8(b2_vec);
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = SIMSIMD_UNCOMPRESS_BF16(a[i]), bi = SIMSIMD_UNCOMPRESS_BF16(b[i]);
+        ab += ai * bi, a2 += ai * ai, b2 += bi * bi;
+    }
+
+    __m128 a2_sqrt_recip = simsimd_avx2_rsqrt_ps(_mm_set_ss(a2));
+    __m128 b2_sqrt_recip = simsimd_avx2_rsqrt_ps(_mm_set_ss(b2));
+    __m128 result = _mm_mul_ss(_mm_set_ss(ab), _mm_mul_ss(a2_sqrt_recip, b2_sqrt_recip));
+    return ab != 0 ? 1 - _mm_cvtss_f32(result) : 1;
 }
 
+/*
+ *  @file   x86_avx2_fixed.h
+ *  @brief  x86 AVX2 implementation of the most common similarity metrics for fixed dimensions.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity, for `f32` and `f16` embeddings of 384, 768,
+ *    1024, and 1536 dimensions, exported as `simsimd_avx2_f32_cos_768` and alike.
+ *  - Has compile-time trip counts, that are multiples of 32, so there are no tails, and the loops are unrolled.
+ *  - Uses four independent accumulators per quantity, to hide the latency of the FMA instructions.
+ *  - Ignores the runtime `n` argument, but matches the `simsimd_metric_punned_t` signature.
+ *  - Requires compiler capabilities: avx2, f16c, fma.
+ */
+
+#define SIMSIMD_AVX2_MAKE_FIXED(input_type, dimensions)                                                                \
+    __attribute__((target("avx2,f16c,fma")))                                                                           \
+    inline static simsimd_f32_t simsimd_avx2_##input_type##_l2sq_##dimensions(                                         \
+        simsimd_##input_type##_t const* a, simsimd_##input_type##_t const* b, simsimd_size_t n) {                      \
+        (void)n;                                                                                                       \
+        __m256 d2_first_vec = _mm256_setzero_ps(), d2_second_vec = _mm256_setzero_ps();                                \
+        __m256 d2_third_vec = _mm256_setzero_ps(), d2_fourth_vec = _mm256_setzero_ps();                                \
+        for (simsimd_size_t i = 0; i != dimensions; i += 32) {                                                         \
+            __m256 a_first_vec = simsimd_avx2_##input_type##_load_f32(a + i);                                          \
+            __m256 a_second_vec = simsimd_avx2_##input_type##_load_f32(a + i + 8);                                     \
+            __m256 a_third_vec = simsimd_avx2_##input_type##_load_f32(a + i + 16);                                     \
+            __m256 a_fourth_vec = simsimd_avx2_##input_type##_load_f32(a + i + 24);                                    \
+            __m256 b_first_vec = simsimd_avx2_##input_type##_load_f32(b + i);                                          \
+            __m256 b_second_vec = simsimd_avx2_##input_type##_load_f32(b + i + 8);                                     \
+            __m256 b_third_vec = simsimd_avx2_##input_type##_load_f32(b + i + 16);                                     \
+            __m256 b_fourth_vec = simsimd_avx2_##input_type##_load_f32(b + i + 24);                                    \
+            __m256 d_first_vec = _mm256_sub_ps(a_first_vec, b_first_vec);                                              \
+            __m256 d_second_vec = _mm256_sub_ps(a_second_vec, b_second_vec);                                           \
+            __m256 d_third_vec = _mm256_sub_ps(a_third_vec, b_third_vec);                                              \
+            __m256 d_fourth_vec = _mm256_sub_ps(a_fourth_vec, b_fourth_vec);                                           \
+            d2_first_vec = _mm256_fmadd_ps(d_first_vec, d_first_vec, d2_first_vec);                                    \
+            d2_second_vec = _mm256_fmadd_ps(d_second_vec, d_second_vec, d2_second_vec);                                \
+            d2_third_vec = _mm256_fmadd_ps(d_third_vec, d_third_vec, d2_third_vec);                                    \
+            d2_fourth_vec = _mm256_fmadd_ps(d_fourth_vec, d_fourth_vec, d2_fourth_vec);                                \
+        }                                                                                                              \
+        d2_first_vec = _mm256_add_ps(d2_first_vec, d2_second_vec);                                                     \
+        d2_third_vec = _mm256_add_ps(d2_third_vec, d2_fourth_vec);                                                     \
+        return simsimd_avx2_reduce_f32x8(_mm256_add_ps(d2_first_vec, d2_third_vec));                                   \
+    }                                                                                                                  \
+    __attribute__((target("avx2,f16c,fma")))                                                                           \
+    inline static simsimd_f32_t simsimd_avx2_##input_type##_ip_##dimensions(                                           \
+        simsimd_##input_type##_t const* a, simsimd_##input_type##_t const* b, simsimd_size_t n) {                      \
+        (void)n;                                                                                                       \
+        __m256 ab_first_vec = _mm256_setzero_ps(), ab_second_vec = _mm256_setzero_ps();                                \
+        __m256 ab_third_vec = _mm256_setzero_ps(), ab_fourth_vec = _mm256_setzero_ps();                                \
+        for (simsimd_size_t i = 0; i != dimensions; i += 32) {                                                         \
+            __m256 a_first_vec = simsimd_avx2_##input_type##_load_f32(a + i);                                          \
+            __m256 a_second_vec = simsimd_avx2_##input_type##_load_f32(a + i + 8);                                     \
+            __m256 a_third_vec = simsimd_avx2_##input_type##_load_f32(a + i + 16);                                     \
+            __m256 a_fourth_vec = simsimd_avx2_##input_type##_load_f32(a + i + 24);                                    \
+            __m256 b_first_vec = simsimd_avx2_##input_type##_load_f32(b + i);                                          \
+            __m256 b_second_vec = simsimd_avx2_##input_type##_load_f32(b + i + 8);                                     \
+            __m256 b_third_vec = simsimd_avx2_##input_type##_load_f32(b + i + 16);                                     \
+            __m256 b_fourth_vec = simsimd_avx2_##input_type##_load_f32(b + i + 24);                                    \
+            ab_first_vec = _mm256_fmadd_ps(a_first_vec, b_first_vec, ab_first_vec);                                    \
+            ab_second_vec = _mm256_fmadd_ps(a_second_vec, b_second_vec, ab_second_vec);                                \
+            ab_third_vec = _mm256_fmadd_ps(a_third_vec, b_third_vec, ab_third_vec);                                    \
+            ab_fourth_vec = _mm256_fmadd_ps(a_fourth_vec, b_fourth_vec, ab_fourth_vec);                                \
+        }                                                                                                              \
+        ab_first_vec = _mm256_add_ps(ab_first_vec, ab_second_vec);                                                     \
+        ab_third_vec = _mm256_add_ps(ab_third_vec, ab_fourth_vec);                                                     \
+        return 1 - simsimd_avx2_reduce_f32x8(_mm256_add_ps(ab_first_vec, ab_third_vec));                               \
+    }                                                                                                                  \
+    __attribute__((target("avx2,f16c,fma")))                                                                           \
+    inline static simsimd_f32_t simsimd_avx2_##input_type##_cos_##dimensions(                                          \
+        simsimd_##input_type##_t const* a, simsimd_##input_type##_t const* b, simsimd_size_t n) {                      \
+        (void)n;                                                                                                       \
+        __m256 ab_first_vec = _mm256_setzero_ps(), ab_second_vec = _mm256_setzero_ps();                                \
+        __m256 ab_third_vec = _mm256_setzero_ps(), ab_fourth_vec = _mm256_setzero_ps();                                \
+        __m256 a2_first_vec = _mm256_setzero_ps(), a2_second_vec = _mm256_setzero_ps();                                \
+        __m256 a2_third_vec = _mm256_setzero_ps(), a2_fourth_vec = _mm256_setzero_ps();                                \
+        __m256 b2_first_vec = _mm256_setzero_ps(), b2_second_vec = _mm256_setzero_ps();                                \
+        __m256 b2_third_vec = _mm256_setzero_ps(), b2_fourth_vec = _mm256_setzero_ps();                                \
+        for (simsimd_size_t i = 0; i != dimensions; i += 32) {                                                         \
+            __m256 a_first_vec = simsimd_avx2_##input_type##_load_f32(a + i);                                          \
+            __m256 a_second_vec = simsimd_avx2_##input_type##_load_f32(a + i + 8);                                     \
+            __m256 a_third_vec = simsimd_avx2_##input_type##_load_f32(a + i + 16);                                     \
+            __m256 a_fourth_vec = simsimd_avx2_##input_type##_load_f32(a + i + 24);                                    \
+            __m256 b_first_vec = simsimd_avx2_##input_type##_load_f32(b + i);                                          \
+            __m256 b_second_vec = simsimd_avx2_##input_type##_load_f32(b + i + 8);                                     \
+            __m256 b_third_vec = simsimd_avx2_##input_type##_load_f32(b + i + 16);                                     \
+            __m256 b_fourth_vec = simsimd_avx2_##input_type##_load_f32(b + i + 24);                                    \
+            ab_first_vec = _mm256_fmadd_ps(a_first_vec, b_first_vec, ab_first_vec);                                    \
+            a2_first_vec = _mm256_fmadd_ps(a_first_vec, a_first_vec, a2_first_vec);                                    \
+            b2_first_vec = _mm256_fmadd_ps(b_first_vec, b_first_vec, b2_first_vec);                                    \
+            ab_second_vec = _mm256_fmadd_ps(a_second_vec, b_second_vec, ab_second_vec);                                \
+            a2_second_vec = _mm256_fmadd_ps(a_second_vec, a_second_vec, a2_second_vec);                                \
+            b2_second_vec = _mm256_fmadd_ps(b_second_vec, b_second_vec, b2_second_vec);                                \
+            ab_third_vec = _mm256_fmadd_ps(a_third_vec, b_third_vec, ab_third_vec);                                    \
+            a2_third_vec = _mm256_fmadd_ps(a_third_vec, a_third_vec, a2_third_vec);                                    \
+            b2_third_vec = _mm256_fmadd_ps(b_third_vec, b_third_vec, b2_third_vec);                                    \
+            ab_fourth_vec = _mm256_fmadd_ps(a_fourth_vec, b_fourth_vec, ab_fourth_vec);                                \
+            a2_fourth_vec = _mm256_fmadd_ps(a_fourth_vec, a_fourth_vec, a2_fourth_vec);                                \
+            b2_fourth_vec = _mm256_fmadd_ps(b_fourth_vec, b_fourth_vec, b2_fourth_vec);                                \
+        }                                                                                                              \
+        ab_first_vec = _mm256_add_ps(ab_first_vec, ab_second_vec);                                                     \
+        ab_third_vec = _mm256_add_ps(ab_third_vec, ab_fourth_vec);                                                     \
+        simsimd_f32_t ab = simsimd_avx2_reduce_f32x8(_mm256_add_ps(ab_first_vec, ab_third_vec));                       \
+        a2_first_vec = _mm256_add_ps(a2_first_vec, a2_second_vec);                                                     \
+        a2_third_vec = _mm256_add_ps(a2_third_vec, a2_fourth_vec);                                                     \
+        simsimd_f32_t a2 = simsimd_avx2_reduce_f32x8(_mm256_add_ps(a2_first_vec, a2_third_vec));                       \
+        b2_first_vec = _mm256_add_ps(b2_first_vec, b2_second_vec);                                                     \
+        b2_third_vec = _mm256_add_ps(b2_third_vec, b2_fourth_vec);                                                     \
+        simsimd_f32_t b2 = simsimd_avx2_reduce_f32x8(_mm256_add_ps(b2_first_vec, b2_third_vec));                       \
+        __m128 a2_sqrt_recip = simsimd_avx2_rsqrt_ps(_mm_set_ss(a2));                                                  \
+        __m128 b2_sqrt_recip = simsimd_avx2_rsqrt_ps(_mm_set_ss(b2));                                                  \
+        simsimd_f32_t result = ab * _mm_cvtss_f32(_mm_mul_ss(a2_sqrt_recip, b2_sqrt_recip));                           \
+        return ab != 0 ? 1 - result : 1;                                                                               \
+    }
+
+SIMSIMD_AVX2_MAKE_FIXED(f32, 384)  // simsimd_avx2_f32_l2sq_384, ..._ip_384, ..._cos_384
+SIMSIMD_AVX2_MAKE_FIXED(f32, 768)  // simsimd_avx2_f32_l2sq_768, ..._ip_768, ..._cos_768
+SIMSIMD_AVX2_MAKE_FIXED(f32, 1024) // simsimd_avx2_f32_l2sq_1024, ..._ip_1024, ..._cos_1024
+SIMSIMD_AVX2_MAKE_FIXED(f32, 1536) // simsimd_avx2_f32_l2sq_1536, ..._ip_1536, ..._cos_1536
+SIMSIMD_AVX2_MAKE_FIXED(f16, 384)  // simsimd_avx2_f16_l2sq_384, ..._ip_384, ..._cos_384
+SIMSIMD_AVX2_MAKE_FIXED(f16, 768)  // simsimd_avx2_f16_l2sq_768, ..._ip_768, ..._cos_768
+SIMSIMD_AVX2_MAKE_FIXED(f16, 1024) // simsimd_avx2_f16_l2sq_1024, ..._ip_1024, ..._cos_1024
+SIMSIMD_AVX2_MAKE_FIXED(f16, 1536) // simsimd_avx2_f16_l2sq_1536, ..._ip_1536, ..._cos_1536
+
+#undef SIMSIMD_AVX2_MAKE_FIXED
+
 #endif // SIMSIMD_TARGET_X86_AVX2
 
 #if SIMSIMD_TARGET_X86_AVX512
 
+/**
+ *  @brief  Computes the reciprocal square roots of four numbers with the precision set by `SIMSIMD_COS_PRECISION`.
+ *          The `vrsqrt14ps` estimate has 14 bits of precision, and one Newton-Raphson step doubles it.
+ */
+__attribute__((target("avx512f,avx512vl"))) //
+inline static __m128
+simsimd_avx512_rsqrt_ps(__m128 x) {
+#if SIMSIMD_COS_PRECISION == SIMSIMD_COS_PRECISION_EXACT
+    return _mm_div_ps(_mm_set1_ps(1), _mm_sqrt_ps(x));
+#else
+    __m128 y = _mm_rsqrt14_ps(x);
+#if SIMSIMD_COS_PRECISION == SIMSIMD_COS_PRECISION_NEWTON
+    __m128 x_y_y = _mm_mul_ps(_mm_mul_ps(x, y), y);
+    y = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), y), _mm_sub_ps(_mm_set1_ps(3), x_y_y));
+#endif
+    return y;
+#endif
+}
+
 /*
  *  @file   x86_avx512_f32.h
  *  @brief  x86 AVX-512 implementation of the most common similarity metrics for 32-bit floating point numbers.
@@ -814,12 +2706,106 @@ simsimd_avx512_f32_cos_cycle:
     simsimd_f32_t b2 = _mm512_reduce_add_ps(b2_vec);
 
     // Compute the reciprocal square roots of a2 and b2
-    __m128 rsqrts = _mm_rsqrt14_ps(_mm_set_ps(0.f, 0.f, a2 + 1.e-9f, b2 + 1.e-9f));
+    __m128 rsqrts = simsimd_avx512_rsqrt_ps(_mm_set_ps(0.f, 0.f, a2 + 1.e-9f, b2 + 1.e-9f));
     simsimd_f32_t rsqrt_a2 = _mm_cvtss_f32(rsqrts);
     simsimd_f32_t rsqrt_b2 = _mm_cvtss_f32(_mm_shuffle_ps(rsqrts, rsqrts, _MM_SHUFFLE(0, 0, 0, 1)));
     return 1 - ab * rsqrt_a2 * rsqrt_b2;
 }
 
+/*
+ *  @file   x86_avx512_f64.h
+ *  @brief  x86 AVX-512 implementation of the most common similarity metrics for 64-bit floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity.
+ *  - Uses `f64` for storage and `f64` for accumulation.
+ *  - Requires compiler capabilities: avx512f, avx512vl, bmi2.
+ */
+
+__attribute__((target("avx512f,avx512vl,bmi2"))) //
+inline static simsimd_f32_t
+simsimd_avx512_f64_l2sq(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    __m512d d2_vec = _mm512_set1_pd(0);
+    __m512d a_vec, b_vec;
+
+simsimd_avx512_f64_l2sq_cycle:
+    if (n < 8) {
+        __mmask8 mask = (__mmask8)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_pd(mask, a);
+        b_vec = _mm512_maskz_loadu_pd(mask, b);
+        n = 0;
+    } else {
+        a_vec = _mm512_loadu_pd(a);
+        b_vec = _mm512_loadu_pd(b);
+        a += 8, b += 8, n -= 8;
+    }
+    __m512d d_vec = _mm512_sub_pd(a_vec, b_vec);
+    d2_vec = _mm512_fmadd_pd(d_vec, d_vec, d2_vec);
+    if (n)
+        goto simsimd_avx512_f64_l2sq_cycle;
+
+    return (simsimd_f32_t)_mm512_reduce_add_pd(d2_vec);
+}
+
+__attribute__((target("avx512f,avx512vl,bmi2"))) //
+inline static simsimd_f32_t
+simsimd_avx512_f64_ip(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    __m512d ab_vec = _mm512_set1_pd(0);
+    __m512d a_vec, b_vec;
+
+simsimd_avx512_f64_ip_cycle:
+    if (n < 8) {
+        __mmask8 mask = (__mmask8)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_pd(mask, a);
+        b_vec = _mm512_maskz_loadu_pd(mask, b);
+        n = 0;
+    } else {
+        a_vec = _mm512_loadu_pd(a);
+        b_vec = _mm512_loadu_pd(b);
+        a += 8, b += 8, n -= 8;
+    }
+    ab_vec = _mm512_fmadd_pd(a_vec, b_vec, ab_vec);
+    if (n)
+        goto simsimd_avx512_f64_ip_cycle;
+
+    return (simsimd_f32_t)(1 - _mm512_reduce_add_pd(ab_vec));
+}
+
+__attribute__((target("avx512f,avx512vl,bmi2"))) //
+inline static simsimd_f32_t
+simsimd_avx512_f64_cos(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n) {
+    __m512d ab_vec = _mm512_set1_pd(0);
+    __m512d a2_vec = _mm512_set1_pd(0);
+    __m512d b2_vec = _mm512_set1_pd(0);
+    __m512d a_vec, b_vec;
+
+simsimd_avx512_f64_cos_cycle:
+    if (n < 8) {
+        __mmask8 mask = (__mmask8)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_pd(mask, a);
+        b_vec = _mm512_maskz_loadu_pd(mask, b);
+        n = 0;
+    } else {
+        a_vec = _mm512_loadu_pd(a);
+        b_vec = _mm512_loadu_pd(b);
+        a += 8, b += 8, n -= 8;
+    }
+    ab_vec = _mm512_fmadd_pd(a_vec, b_vec, ab_vec);
+    a2_vec = _mm512_fmadd_pd(a_vec, a_vec, a2_vec);
+    b2_vec = _mm512_fmadd_pd(b_vec, b_vec, b2_vec);
+    if (n)
+        goto simsimd_avx512_f64_cos_cycle;
+
+    simsimd_f64_t ab = _mm512_reduce_add_pd(ab_vec);
+    simsimd_f64_t a2 = _mm512_reduce_add_pd(a2_vec);
+    simsimd_f64_t b2 = _mm512_reduce_add_pd(b2_vec);
+
+    // Prefer the exact `sqrtpd` to the estimates, as the precision is the reason to use `f64`
+    __m128d a2_b2_sqrt = _mm_sqrt_pd(_mm_set_pd(b2, a2));
+    simsimd_f64_t a2_b2 = _mm_cvtsd_f64(_mm_mul_sd(a2_b2_sqrt, _mm_unpackhi_pd(a2_b2_sqrt, a2_b2_sqrt)));
+    return ab != 0 ? (simsimd_f32_t)(1 - ab / a2_b2) : 1;
+}
+
 /*
  *  @file   x86_avx512_f16.h
  *  @brief  x86 AVX-512 implementation of the most common similarity metrics for 16-bit floating point numbers.
@@ -848,72 +2834,169 @@ simsimd_avx512_f16_l2sq_cycle:
         b_i16_vec = _mm512_loadu_epi16(b);
         a += 32, b += 32, n -= 32;
     }
-    __m512h d_vec = _mm512_sub_ph(_mm512_castsi512_ph(a_i16_vec), _mm512_castsi512_ph(b_i16_vec));
-    d2_vec = _mm512_fmadd_ph(d_vec, d_vec, d2_vec);
+    __m512h d_vec = _mm512_sub_ph(_mm512_castsi512_ph(a_i16_vec), _mm512_castsi512_ph(b_i16_vec));
+    d2_vec = _mm512_fmadd_ph(d_vec, d_vec, d2_vec);
+    if (n)
+        goto simsimd_avx512_f16_l2sq_cycle;
+
+    return _mm512_reduce_add_ph(d2_vec);
+}
+
+__attribute__((target("avx512fp16,avx512vl,avx512f,bmi2"))) //
+inline static simsimd_f32_t
+simsimd_avx512_f16_ip(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n) {
+    __m512h ab_vec = _mm512_set1_ph(0);
+    __m512i a_i16_vec, b_i16_vec;
+
+simsimd_avx512_f16_ip_cycle:
+    if (n < 32) {
+        __mmask32 mask = _bzhi_u32(0xFFFFFFFF, n);
+        a_i16_vec = _mm512_maskz_loadu_epi16(mask, a);
+        b_i16_vec = _mm512_maskz_loadu_epi16(mask, b);
+        n = 0;
+    } else {
+        a_i16_vec = _mm512_loadu_epi16(a);
+        b_i16_vec = _mm512_loadu_epi16(b);
+        a += 32, b += 32, n -= 32;
+    }
+    ab_vec = _mm512_fmadd_ph(_mm512_castsi512_ph(a_i16_vec), _mm512_castsi512_ph(b_i16_vec), ab_vec);
+    if (n)
+        goto simsimd_avx512_f16_ip_cycle;
+
+    return 1 - _mm512_reduce_add_ph(ab_vec);
+}
+
+__attribute__((target("avx512fp16,avx512vl,avx512f,bmi2"))) //
+inline static simsimd_f32_t
+simsimd_avx512_f16_cos(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n) {
+    __m512h ab_vec = _mm512_set1_ph(0);
+    __m512h a2_vec = _mm512_set1_ph(0);
+    __m512h b2_vec = _mm512_set1_ph(0);
+    __m512i a_i16_vec, b_i16_vec;
+
+simsimd_avx512_f16_cos_cycle:
+    if (n < 32) {
+        __mmask32 mask = _bzhi_u32(0xFFFFFFFF, n);
+        a_i16_vec = _mm512_maskz_loadu_epi16(mask, a);
+        b_i16_vec = _mm512_maskz_loadu_epi16(mask, b);
+        n = 0;
+    } else {
+        a_i16_vec = _mm512_loadu_epi16(a);
+        b_i16_vec = _mm512_loadu_epi16(b);
+        a += 32, b += 32, n -= 32;
+    }
+    ab_vec = _mm512_fmadd_ph(_mm512_castsi512_ph(a_i16_vec), _mm512_castsi512_ph(b_i16_vec), ab_vec);
+    a2_vec = _mm512_fmadd_ph(_mm512_castsi512_ph(a_i16_vec), _mm512_castsi512_ph(a_i16_vec), a2_vec);
+    b2_vec = _mm512_fmadd_ph(_mm512_castsi512_ph(b_i16_vec), _mm512_castsi512_ph(b_i16_vec), b2_vec);
+    if (n)
+        goto simsimd_avx512_f16_cos_cycle;
+
+    simsimd_f32_t ab = _mm512_reduce_add_ph(ab_vec);
+    simsimd_f32_t a2 = _mm512_reduce_add_ph(a2_vec);
+    simsimd_f32_t b2 = _mm512_reduce_add_ph(b2_vec);
+
+    // Compute the reciprocal square roots of a2 and b2
+    __m128 rsqrts = simsimd_avx512_rsqrt_ps(_mm_set_ps(0.f, 0.f, a2 + 1.e-9f, b2 + 1.e-9f));
+    simsimd_f32_t rsqrt_a2 = _mm_cvtss_f32(rsqrts);
+    simsimd_f32_t rsqrt_b2 = _mm_cvtss_f32(_mm_shuffle_ps(rsqrts, rsqrts, _MM_SHUFFLE(0, 0, 0, 1)));
+    return 1 - ab * rsqrt_a2 * rsqrt_b2;
+}
+
+/*
+ *  @file   x86_avx512_bf16.h
+ *  @brief  x86 AVX-512 implementation of the most common similarity metrics for 16-bit brain floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity.
+ *  - Uses `vdpbf16ps` to multiply pairs of `bf16` words, accumulating in `f32`.
+ *  - Upcasts to `f32` for L2, as the differences of `bf16` numbers would lose precision.
+ *  - Requires compiler capabilities: avx512bf16, avx512f, avx512bw, avx512vl, bmi2.
+ */
+
+__attribute__((target("avx512bf16,avx512f,avx512bw,avx512vl,bmi2"))) //
+inline static simsimd_f32_t
+simsimd_avx512_bf16_l2sq(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n) {
+    __m512 d2_vec = _mm512_setzero_ps();
+    __m512 a_vec, b_vec;
+
+simsimd_avx512_bf16_l2sq_cycle:
+    // Shifting the `bf16` bits into the upper halves of 32-bit words produces valid `f32` numbers
+    if (n < 16) {
+        __mmask16 mask = _bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(mask, a)), 16));
+        b_vec = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(mask, b)), 16));
+        n = 0;
+    } else {
+        a_vec = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256((__m256i const*)a)), 16));
+        b_vec = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256((__m256i const*)b)), 16));
+        a += 16, b += 16, n -= 16;
+    }
+    __m512 d_vec = _mm512_sub_ps(a_vec, b_vec);
+    d2_vec = _mm512_fmadd_ps(d_vec, d_vec, d2_vec);
     if (n)
-        goto simsimd_avx512_f16_l2sq_cycle;
+        goto simsimd_avx512_bf16_l2sq_cycle;
 
-    return _mm512_reduce_add_ph(d2_vec);
+    return _mm512_reduce_add_ps(d2_vec);
 }
 
-__attribute__((target("avx512fp16,avx512vl,avx512f,bmi2"))) //
+__attribute__((target("avx512bf16,avx512f,avx512bw,avx512vl,bmi2"))) //
 inline static simsimd_f32_t
-simsimd_avx512_f16_ip(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n) {
-    __m512h ab_vec = _mm512_set1_ph(0);
-    __m512i a_i16_vec, b_i16_vec;
+simsimd_avx512_bf16_ip(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n) {
+    __m512 ab_vec = _mm512_setzero_ps();
+    __m512i a_vec, b_vec;
 
-simsimd_avx512_f16_ip_cycle:
+simsimd_avx512_bf16_ip_cycle:
     if (n < 32) {
         __mmask32 mask = _bzhi_u32(0xFFFFFFFF, n);
-        a_i16_vec = _mm512_maskz_loadu_epi16(mask, a);
-        b_i16_vec = _mm512_maskz_loadu_epi16(mask, b);
+        a_vec = _mm512_maskz_loadu_epi16(mask, a);
+        b_vec = _mm512_maskz_loadu_epi16(mask, b);
         n = 0;
     } else {
-        a_i16_vec = _mm512_loadu_epi16(a);
-        b_i16_vec = _mm512_loadu_epi16(b);
+        a_vec = _mm512_loadu_epi16(a);
+        b_vec = _mm512_loadu_epi16(b);
         a += 32, b += 32, n -= 32;
     }
-    ab_vec = _mm512_fmadd_ph(_mm512_castsi512_ph(a_i16_vec), _mm512_castsi512_ph(b_i16_vec), ab_vec);
+    ab_vec = _mm512_dpbf16_ps(ab_vec, (__m512bh)a_vec, (__m512bh)b_vec);
     if (n)
-        goto simsimd_avx512_f16_ip_cycle;
+        goto simsimd_avx512_bf16_ip_cycle;
 
-    return 1 - _mm512_reduce_add_ph(ab_vec);
+    return 1 - _mm512_reduce_add_ps(ab_vec);
 }
 
-__attribute__((target("avx512fp16,avx512vl,avx512f,bmi2"))) //
+__attribute__((target("avx512bf16,avx512f,avx512bw,avx512vl,bmi2"))) //
 inline static simsimd_f32_t
-simsimd_avx512_f16_cos(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n) {
-    __m512h ab_vec = _mm512_set1_ph(0);
-    __m512h a2_vec = _mm512_set1_ph(0);
-    __m512h b2_vec = _mm512_set1_ph(0);
-    __m512i a_i16_vec, b_i16_vec;
+simsimd_avx512_bf16_cos(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n) {
+    __m512 ab_vec = _mm512_setzero_ps();
+    __m512 a2_vec = _mm512_setzero_ps();
+    __m512 b2_vec = _mm512_setzero_ps();
+    __m512i a_vec, b_vec;
 
-simsimd_avx512_f16_cos_cycle:
+simsimd_avx512_bf16_cos_cycle:
     if (n < 32) {
         __mmask32 mask = _bzhi_u32(0xFFFFFFFF, n);
-        a_i16_vec = _mm512_maskz_loadu_epi16(mask, a);
-        b_i16_vec = _mm512_maskz_loadu_epi16(mask, b);
+        a_vec = _mm512_maskz_loadu_epi16(mask, a);
+        b_vec = _mm512_maskz_loadu_epi16(mask, b);
         n = 0;
     } else {
-        a_i16_vec = _mm512_loadu_epi16(a);
-        b_i16_vec = _mm512_loadu_epi16(b);
+        a_vec = _mm512_loadu_epi16(a);
+        b_vec = _mm512_loadu_epi16(b);
         a += 32, b += 32, n -= 32;
     }
-    ab_vec = _mm512_fmadd_ph(_mm512_castsi512_ph(a_i16_vec), _mm512_castsi512_ph(b_i16_vec), ab_vec);
-    a2_vec = _mm512_fmadd_ph(_mm512_castsi512_ph(a_i16_vec), _mm512_castsi512_ph(a_i16_vec), a2_vec);
-    b2_vec = _mm512_fmadd_ph(_mm512_castsi512_ph(b_i16_vec), _mm512_castsi512_ph(b_i16_vec), b2_vec);
+    ab_vec = _mm512_dpbf16_ps(ab_vec, (__m512bh)a_vec, (__m512bh)b_vec);
+    a2_vec = _mm512_dpbf16_ps(a2_vec, (__m512bh)a_vec, (__m512bh)a_vec);
+    b2_vec = _mm512_dpbf16_ps(b2_vec, (__m512bh)b_vec, (__m512bh)b_vec);
     if (n)
-        goto simsimd_avx512_f16_cos_cycle;
+        goto simsimd_avx512_bf16_cos_cycle;
 
-    simsimd_f32_t ab = _mm512_reduce_add_ph(ab_vec);
-    simsimd_f32_t a2 = _mm512_reduce_add_ph(a2_vec);
-    simsimd_f32_t b2 = _mm512_reduce_add_ph(b2_vec);
+    simsimd_f32_t ab = _mm512_reduce_add_ps(ab_vec);
+    simsimd_f32_t a2 = _mm512_reduce_add_ps(a2_vec);
+    simsimd_f32_t b2 = _mm512_reduce_add_ps(b2_vec);
 
     // Compute the reciprocal square roots of a2 and b2
-    __m128 rsqrts = _mm_rsqrt14_ps(_mm_set_ps(0.f, 0.f, a2 + 1.e-9f, b2 + 1.e-9f));
+    __m128 rsqrts = simsimd_avx512_rsqrt_ps(_mm_set_ps(0.f, 0.f, a2 + 1.e-9f, b2 + 1.e-9f));
     simsimd_f32_t rsqrt_a2 = _mm_cvtss_f32(rsqrts);
     simsimd_f32_t rsqrt_b2 = _mm_cvtss_f32(_mm_shuffle_ps(rsqrts, rsqrts, _MM_SHUFFLE(0, 0, 0, 1)));
-    return 1 - ab * rsqrt_a2 * rsqrt_b2;
+    return ab != 0 ? 1 - ab * rsqrt_a2 * rsqrt_b2 : 1;
 }
 
 /*
@@ -959,6 +3042,9 @@ simsimd_avx512_i8_cos(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size
     __m512i ab_i32s_vec = _mm512_setzero_si512();
     __m512i a2_i32s_vec = _mm512_setzero_si512();
     __m512i b2_i32s_vec = _mm512_setzero_si512();
+    __m512i a_surplus_vec = _mm512_setzero_si512();
+    __m512i b_surplus_vec = _mm512_setzero_si512();
+    __m512i const shift_vec = _mm512_set1_epi8((char)0x80);
     __m512i a_vec, b_vec;
 
 simsimd_avx512_i8_cos_cycle:
@@ -972,18 +3058,22 @@ simsimd_avx512_i8_cos_cycle:
         b_vec = _mm512_loadu_epi8(b);
         a += 64, b += 64, n -= 64;
     }
-    ab_i32s_vec = _mm512_dpbusd_epi32(ab_i32s_vec, a_vec, b_vec);
-    a2_i32s_vec = _mm512_dpbusd_epi32(a2_i32s_vec, a_vec, a_vec);
-    b2_i32s_vec = _mm512_dpbusd_epi32(b2_i32s_vec, b_vec, b_vec);
+    // The `vpdpbusd` multiplies unsigned bytes by signed ones, so the first argument is shifted by 128
+    // into the unsigned range, and the surplus of 128 times the sum of the second one is subtracted later
+    ab_i32s_vec = _mm512_dpbusd_epi32(ab_i32s_vec, _mm512_xor_si512(a_vec, shift_vec), b_vec);
+    a2_i32s_vec = _mm512_dpbusd_epi32(a2_i32s_vec, _mm512_xor_si512(a_vec, shift_vec), a_vec);
+    b2_i32s_vec = _mm512_dpbusd_epi32(b2_i32s_vec, _mm512_xor_si512(b_vec, shift_vec), b_vec);
+    a_surplus_vec = _mm512_dpbusd_epi32(a_surplus_vec, shift_vec, a_vec);
+    b_surplus_vec = _mm512_dpbusd_epi32(b_surplus_vec, shift_vec, b_vec);
     if (n)
         goto simsimd_avx512_i8_cos_cycle;
 
-    simsimd_f32_t ab = _mm512_reduce_add_epi32(ab_i32s_vec);
-    simsimd_f32_t a2 = _mm512_reduce_add_epi32(a2_i32s_vec);
-    simsimd_f32_t b2 = _mm512_reduce_add_epi32(b2_i32s_vec);
+    simsimd_f32_t ab = _mm512_reduce_add_epi32(_mm512_sub_epi32(ab_i32s_vec, b_surplus_vec));
+    simsimd_f32_t a2 = _mm512_reduce_add_epi32(_mm512_sub_epi32(a2_i32s_vec, a_surplus_vec));
+    simsimd_f32_t b2 = _mm512_reduce_add_epi32(_mm512_sub_epi32(b2_i32s_vec, b_surplus_vec));
 
     // Compute the reciprocal square roots of a2 and b2
-    __m128 rsqrts = _mm_rsqrt14_ps(_mm_set_ps(0.f, 0.f, a2 + 1.e-9f, b2 + 1.e-9f));
+    __m128 rsqrts = simsimd_avx512_rsqrt_ps(_mm_set_ps(0.f, 0.f, a2 + 1.e-9f, b2 + 1.e-9f));
     simsimd_f32_t rsqrt_a2 = _mm_cvtss_f32(rsqrts);
     simsimd_f32_t rsqrt_b2 = _mm_cvtss_f32(_mm_shuffle_ps(rsqrts, rsqrts, _MM_SHUFFLE(0, 0, 0, 1)));
     return 1 - ab * rsqrt_a2 * rsqrt_b2;
@@ -995,6 +3085,814 @@ simsimd_avx512_i8_ip(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_
     return simsimd_avx512_i8_cos(a, b, n);
 }
 
+/*
+ *  @file   x86_avx512_u8.h
+ *  @brief  x86 AVX-512 implementation of the most common similarity metrics for 8-bit unsigned integers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, cosine similarity, inner product (same as cosine).
+ *  - Uses `vpdpbusd`, that multiplies unsigned bytes by signed ones, flipping the top bit of the second argument
+ *    to shift it into the signed range, and adding back the sums of the first one, computed with `vpsadbw`.
+ *  - Squares the absolute differences, zero-extended to `i16`, with `vpdpwssd` for L2.
+ *  - Uses BMI2 `bzhi` instructions to build masks without branches or conditional moves.
+ *  - Requires compiler capabilities: avx512f, avx512vl, avx512bw, avx512vnni, bmi2.
+ */
+
+__attribute__((target("avx512vl,avx512f,avx512bw,avx512vnni,bmi2"))) //
+inline static simsimd_f32_t
+simsimd_avx512_u8_l2sq(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n) {
+    __m512i d2_i32s_vec = _mm512_setzero_si512();
+    __m512i const zeros = _mm512_setzero_si512();
+    __m512i a_vec, b_vec, d_vec, d_low_vec, d_high_vec;
+
+simsimd_avx512_u8_l2sq_cycle:
+    if (n < 64) {
+        __mmask64 mask = _bzhi_u64(0xFFFFFFFFFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_epi8(mask, a);
+        b_vec = _mm512_maskz_loadu_epi8(mask, b);
+        n = 0;
+    } else {
+        a_vec = _mm512_loadu_epi8(a);
+        b_vec = _mm512_loadu_epi8(b);
+        a += 64, b += 64, n -= 64;
+    }
+    d_vec = _mm512_or_si512(_mm512_subs_epu8(a_vec, b_vec), _mm512_subs_epu8(b_vec, a_vec));
+    d_low_vec = _mm512_unpacklo_epi8(d_vec, zeros);
+    d_high_vec = _mm512_unpackhi_epi8(d_vec, zeros);
+    d2_i32s_vec = _mm512_dpwssd_epi32(d2_i32s_vec, d_low_vec, d_low_vec);
+    d2_i32s_vec = _mm512_dpwssd_epi32(d2_i32s_vec, d_high_vec, d_high_vec);
+    if (n)
+        goto simsimd_avx512_u8_l2sq_cycle;
+
+    return _mm512_reduce_add_epi32(d2_i32s_vec);
+}
+
+__attribute__((target("avx512vl,avx512f,avx512bw,avx512vnni,bmi2"))) //
+inline static simsimd_f32_t
+simsimd_avx512_u8_cos(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n) {
+    __m512i ab_i32s_vec = _mm512_setzero_si512();
+    __m512i a2_i32s_vec = _mm512_setzero_si512();
+    __m512i b2_i32s_vec = _mm512_setzero_si512();
+    __m512i a_sums_vec = _mm512_setzero_si512();
+    __m512i b_sums_vec = _mm512_setzero_si512();
+    __m512i const shift_vec = _mm512_set1_epi8((char)0x80);
+    __m512i const zeros = _mm512_setzero_si512();
+    __m512i a_vec, b_vec, a_shifted_vec, b_shifted_vec;
+
+simsimd_avx512_u8_cos_cycle:
+    if (n < 64) {
+        __mmask64 mask = _bzhi_u64(0xFFFFFFFFFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_epi8(mask, a);
+        b_vec = _mm512_maskz_loadu_epi8(mask, b);
+        n = 0;
+    } else {
+        a_vec = _mm512_loadu_epi8(a);
+        b_vec = _mm512_loadu_epi8(b);
+        a += 64, b += 64, n -= 64;
+    }
+    // Flipping the top bit turns `x` into the signed byte `x - 128`, so every product is short by `128 * a`
+    a_shifted_vec = _mm512_xor_si512(a_vec, shift_vec);
+    b_shifted_vec = _mm512_xor_si512(b_vec, shift_vec);
+    ab_i32s_vec = _mm512_dpbusd_epi32(ab_i32s_vec, a_vec, b_shifted_vec);
+    a2_i32s_vec = _mm512_dpbusd_epi32(a2_i32s_vec, a_vec, a_shifted_vec);
+    b2_i32s_vec = _mm512_dpbusd_epi32(b2_i32s_vec, b_vec, b_shifted_vec);
+    a_sums_vec = _mm512_add_epi64(a_sums_vec, _mm512_sad_epu8(a_vec, zeros));
+    b_sums_vec = _mm512_add_epi64(b_sums_vec, _mm512_sad_epu8(b_vec, zeros));
+    if (n)
+        goto simsimd_avx512_u8_cos_cycle;
+
+    simsimd_f64_t a_sum = (simsimd_f64_t)_mm512_reduce_add_epi64(a_sums_vec);
+    simsimd_f64_t b_sum = (simsimd_f64_t)_mm512_reduce_add_epi64(b_sums_vec);
+    simsimd_f32_t ab = (simsimd_f32_t)(_mm512_reduce_add_epi32(ab_i32s_vec) + 128 * a_sum);
+    simsimd_f32_t a2 = (simsimd_f32_t)(_mm512_reduce_add_epi32(a2_i32s_vec) + 128 * a_sum);
+    simsimd_f32_t b2 = (simsimd_f32_t)(_mm512_reduce_add_epi32(b2_i32s_vec) + 128 * b_sum);
+
+    // Compute the reciprocal square roots of a2 and b2
+    __m128 rsqrts = simsimd_avx512_rsqrt_ps(_mm_set_ps(0.f, 0.f, a2 + 1.e-9f, b2 + 1.e-9f));
+    simsimd_f32_t rsqrt_a2 = _mm_cvtss_f32(rsqrts);
+    simsimd_f32_t rsqrt_b2 = _mm_cvtss_f32(_mm_shuffle_ps(rsqrts, rsqrts, _MM_SHUFFLE(0, 0, 0, 1)));
+    return ab != 0 ? 1 - ab * rsqrt_a2 * rsqrt_b2 : 1;
+}
+
+__attribute__((target("avx512vl,avx512f,avx512bw,avx512vnni,bmi2"))) //
+inline static simsimd_f32_t
+simsimd_avx512_u8_ip(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n) {
+    return simsimd_avx512_u8_cos(a, b, n);
+}
+
+/*
+ *  @file   x86_avx512_i4x2.h
+ *  @brief  x86 AVX-512 implementation of the most common similarity metrics for 4-bit signed integers,
+ *          packed in pairs into 8-bit words.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, cosine similarity, inner product (same as cosine).
+ *  - Unpacks the nibbles with shifts and masks, sign-extending them into `i8` with an `xor` and a subtraction.
+ *  - Uses `vpdpbusd`, passing the magnitudes of one side as unsigned bytes, and negating the other side
+ *    wherever the first one is negative, with a masked subtraction.
+ *  - Uses BMI2 `bzhi` instructions to build masks without branches or conditional moves.
+ *  - Requires compiler capabilities: avx512f, avx512vl, avx512bw, avx512vnni, bmi2.
+ */
+
+__attribute__((target("avx512vl,avx512f,avx512bw,avx512vnni,bmi2"))) //
+inline static void
+simsimd_avx512_i4x2_unpack(__m512i x, __m512i* low, __m512i* high) {
+    __m512i const nibble_mask = _mm512_set1_epi8(0x0F);
+    __m512i const sign_bit = _mm512_set1_epi8(0x08);
+    *low = _mm512_and_si512(x, nibble_mask);
+    *high = _mm512_and_si512(_mm512_srli_epi16(x, 4), nibble_mask);
+    *low = _mm512_sub_epi8(_mm512_xor_si512(*low, sign_bit), sign_bit);
+    *high = _mm512_sub_epi8(_mm512_xor_si512(*high, sign_bit), sign_bit);
+}
+
+__attribute__((target("avx512vl,avx512f,avx512bw,avx512vnni,bmi2"))) //
+inline static simsimd_f32_t
+simsimd_avx512_i4x2_l2sq(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n) {
+    __m512i d2_i32s_vec = _mm512_setzero_si512();
+    __m512i a_low, a_high, b_low, b_high, d_low, d_high;
+
+simsimd_avx512_i4x2_l2sq_cycle:
+    if (n < 64) {
+        __mmask64 mask = _bzhi_u64(0xFFFFFFFFFFFFFFFF, n);
+        simsimd_avx512_i4x2_unpack(_mm512_maskz_loadu_epi8(mask, a), &a_low, &a_high);
+        simsimd_avx512_i4x2_unpack(_mm512_maskz_loadu_epi8(mask, b), &b_low, &b_high);
+        n = 0;
+    } else {
+        simsimd_avx512_i4x2_unpack(_mm512_loadu_epi8(a), &a_low, &a_high);
+        simsimd_avx512_i4x2_unpack(_mm512_loadu_epi8(b), &b_low, &b_high);
+        a += 64, b += 64, n -= 64;
+    }
+    // The absolute differences don't exceed 15, so they are valid as both unsigned and signed bytes
+    d_low = _mm512_abs_epi8(_mm512_sub_epi8(a_low, b_low));
+    d_high = _mm512_abs_epi8(_mm512_sub_epi8(a_high, b_high));
+    d2_i32s_vec = _mm512_dpbusd_epi32(d2_i32s_vec, d_low, d_low);
+    d2_i32s_vec = _mm512_dpbusd_epi32(d2_i32s_vec, d_high, d_high);
+    if (n)
+        goto simsimd_avx512_i4x2_l2sq_cycle;
+
+    return _mm512_reduce_add_epi32(d2_i32s_vec);
+}
+
+__attribute__((target("avx512vl,avx512f,avx512bw,avx512vnni,bmi2"))) //
+inline static simsimd_f32_t
+simsimd_avx512_i4x2_cos(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n) {
+    __m512i ab_i32s_vec = _mm512_setzero_si512();
+    __m512i a2_i32s_vec = _mm512_setzero_si512();
+    __m512i b2_i32s_vec = _mm512_setzero_si512();
+    __m512i const zeros = _mm512_setzero_si512();
+    __m512i a_low, a_high, b_low, b_high;
+    __m512i a_low_abs, a_high_abs, b_low_abs, b_high_abs, b_low_signed, b_high_signed;
+
+simsimd_avx512_i4x2_cos_cycle:
+    if (n < 64) {
+        __mmask64 mask = _bzhi_u64(0xFFFFFFFFFFFFFFFF, n);
+        simsimd_avx512_i4x2_unpack(_mm512_maskz_loadu_epi8(mask, a), &a_low, &a_high);
+        simsimd_avx512_i4x2_unpack(_mm512_maskz_loadu_epi8(mask, b), &b_low, &b_high);
+        n = 0;
+    } else {
+        simsimd_avx512_i4x2_unpack(_mm512_loadu_epi8(a), &a_low, &a_high);
+        simsimd_avx512_i4x2_unpack(_mm512_loadu_epi8(b), &b_low, &b_high);
+        a += 64, b += 64, n -= 64;
+    }
+    a_low_abs = _mm512_abs_epi8(a_low), a_high_abs = _mm512_abs_epi8(a_high);
+    b_low_abs = _mm512_abs_epi8(b_low), b_high_abs = _mm512_abs_epi8(b_high);
+    b_low_signed = _mm512_mask_sub_epi8(b_low, _mm512_movepi8_mask(a_low), zeros, b_low);
+    b_high_signed = _mm512_mask_sub_epi8(b_high, _mm512_movepi8_mask(a_high), zeros, b_high);
+    ab_i32s_vec = _mm512_dpbusd_epi32(ab_i32s_vec, a_low_abs, b_low_signed);
+    ab_i32s_vec = _mm512_dpbusd_epi32(ab_i32s_vec, a_high_abs, b_high_signed);
+    a2_i32s_vec = _mm512_dpbusd_epi32(a2_i32s_vec, a_low_abs, a_low_abs);
+    a2_i32s_vec = _mm512_dpbusd_epi32(a2_i32s_vec, a_high_abs, a_high_abs);
+    b2_i32s_vec = _mm512_dpbusd_epi32(b2_i32s_vec, b_low_abs, b_low_abs);
+    b2_i32s_vec = _mm512_dpbusd_epi32(b2_i32s_vec, b_high_abs, b_high_abs);
+    if (n)
+        goto simsimd_avx512_i4x2_cos_cycle;
+
+    simsimd_f32_t ab = _mm512_reduce_add_epi32(ab_i32s_vec);
+    simsimd_f32_t a2 = _mm512_reduce_add_epi32(a2_i32s_vec);
+    simsimd_f32_t b2 = _mm512_reduce_add_epi32(b2_i32s_vec);
+
+    // Compute the reciprocal square roots of a2 and b2
+    __m128 rsqrts = simsimd_avx512_rsqrt_ps(_mm_set_ps(0.f, 0.f, a2 + 1.e-9f, b2 + 1.e-9f));
+    simsimd_f32_t rsqrt_a2 = _mm_cvtss_f32(rsqrts);
+    simsimd_f32_t rsqrt_b2 = _mm_cvtss_f32(_mm_shuffle_ps(rsqrts, rsqrts, _MM_SHUFFLE(0, 0, 0, 1)));
+    return ab != 0 ? 1 - ab * rsqrt_a2 * rsqrt_b2 : 1;
+}
+
+__attribute__((target("avx512vl,avx512f,avx512bw,avx512vnni,bmi2"))) //
+inline static simsimd_f32_t
+simsimd_avx512_i4x2_ip(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n) {
+    return simsimd_avx512_i4x2_cos(a, b, n);
+}
+
+
+/*
+ *  @file   x86_avx512_f32_batch.h
+ *  @brief  x86 AVX-512 implementation of one-to-many similarity metrics for 32-bit floating point numbers.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity.
+ *  - Compares the query against 4 rows at a time, loading every query chunk into a register just once.
+ *  - Uses masked loads for every chunk, the mask is only different from all-ones in the last one.
+ *  - Requires compiler capabilities: avx512f, avx512vl, bmi2.
+ */
+
+__attribute__((target("avx512f,avx512vl,bmi2"))) //
+inline static void
+simsimd_avx512_f32_l2sq_batch(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t count,
+                              simsimd_size_t stride, simsimd_size_t n, simsimd_f32_t* results) {
+    __mmask16 const tail_mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n % 16);
+    simsimd_size_t j = 0;
+    for (; j + 4 <= count; j += 4) {
+        simsimd_f32_t const* b_0 = (simsimd_f32_t const*)((char const*)b + (j + 0) * stride);
+        simsimd_f32_t const* b_1 = (simsimd_f32_t const*)((char const*)b + (j + 1) * stride);
+        simsimd_f32_t const* b_2 = (simsimd_f32_t const*)((char const*)b + (j + 2) * stride);
+        simsimd_f32_t const* b_3 = (simsimd_f32_t const*)((char const*)b + (j + 3) * stride);
+        __m512 d2_0_vec = _mm512_setzero_ps(), d2_1_vec = _mm512_setzero_ps();
+        __m512 d2_2_vec = _mm512_setzero_ps(), d2_3_vec = _mm512_setzero_ps();
+        for (simsimd_size_t i = 0; i < n; i += 16) {
+            __mmask16 mask = i + 16 <= n ? (__mmask16)0xFFFF : tail_mask;
+            __m512 a_vec = _mm512_maskz_loadu_ps(mask, a + i);
+            __m512 d_0_vec = _mm512_sub_ps(a_vec, _mm512_maskz_loadu_ps(mask, b_0 + i));
+            __m512 d_1_vec = _mm512_sub_ps(a_vec, _mm512_maskz_loadu_ps(mask, b_1 + i));
+            __m512 d_2_vec = _mm512_sub_ps(a_vec, _mm512_maskz_loadu_ps(mask, b_2 + i));
+            __m512 d_3_vec = _mm512_sub_ps(a_vec, _mm512_maskz_loadu_ps(mask, b_3 + i));
+            d2_0_vec = _mm512_fmadd_ps(d_0_vec, d_0_vec, d2_0_vec);
+            d2_1_vec = _mm512_fmadd_ps(d_1_vec, d_1_vec, d2_1_vec);
+            d2_2_vec = _mm512_fmadd_ps(d_2_vec, d_2_vec, d2_2_vec);
+            d2_3_vec = _mm512_fmadd_ps(d_3_vec, d_3_vec, d2_3_vec);
+        }
+        results[j + 0] = _mm512_reduce_add_ps(d2_0_vec);
+        results[j + 1] = _mm512_reduce_add_ps(d2_1_vec);
+        results[j + 2] = _mm512_reduce_add_ps(d2_2_vec);
+        results[j + 3] = _mm512_reduce_add_ps(d2_3_vec);
+    }
+    for (; j < count; ++j)
+        results[j] = simsimd_avx512_f32_l2sq(a, (simsimd_f32_t const*)((char const*)b + j * stride), n);
+}
+
+__attribute__((target("avx512f,avx512vl,bmi2"))) //
+inline static void
+simsimd_avx512_f32_ip_batch(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t count,
+                            simsimd_size_t stride, simsimd_size_t n, simsimd_f32_t* results) {
+    __mmask16 const tail_mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n % 16);
+    simsimd_size_t j = 0;
+    for (; j + 4 <= count; j += 4) {
+        simsimd_f32_t const* b_0 = (simsimd_f32_t const*)((char const*)b + (j + 0) * stride);
+        simsimd_f32_t const* b_1 = (simsimd_f32_t const*)((char const*)b + (j + 1) * stride);
+        simsimd_f32_t const* b_2 = (simsimd_f32_t const*)((char const*)b + (j + 2) * stride);
+        simsimd_f32_t const* b_3 = (simsimd_f32_t const*)((char const*)b + (j + 3) * stride);
+        __m512 ab_0_vec = _mm512_setzero_ps(), ab_1_vec = _mm512_setzero_ps();
+        __m512 ab_2_vec = _mm512_setzero_ps(), ab_3_vec = _mm512_setzero_ps();
+        for (simsimd_size_t i = 0; i < n; i += 16) {
+            __mmask16 mask = i + 16 <= n ? (__mmask16)0xFFFF : tail_mask;
+            __m512 a_vec = _mm512_maskz_loadu_ps(mask, a + i);
+            ab_0_vec = _mm512_fmadd_ps(a_vec, _mm512_maskz_loadu_ps(mask, b_0 + i), ab_0_vec);
+            ab_1_vec = _mm512_fmadd_ps(a_vec, _mm512_maskz_loadu_ps(mask, b_1 + i), ab_1_vec);
+            ab_2_vec = _mm512_fmadd_ps(a_vec, _mm512_maskz_loadu_ps(mask, b_2 + i), ab_2_vec);
+            ab_3_vec = _mm512_fmadd_ps(a_vec, _mm512_maskz_loadu_ps(mask, b_3 + i), ab_3_vec);
+        }
+        results[j + 0] = 1 - _mm512_reduce_add_ps(ab_0_vec);
+        results[j + 1] = 1 - _mm512_reduce_add_ps(ab_1_vec);
+        results[j + 2] = 1 - _mm512_reduce_add_ps(ab_2_vec);
+        results[j + 3] = 1 - _mm512_reduce_add_ps(ab_3_vec);
+    }
+    for (; j < count; ++j)
+        results[j] = simsimd_avx512_f32_ip(a, (simsimd_f32_t const*)((char const*)b + j * stride), n);
+}
+
+__attribute__((target("avx512f,avx512vl,bmi2"))) //
+inline static void
+simsimd_avx512_f32_cos_batch(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t count,
+                             simsimd_size_t stride, simsimd_size_t n, simsimd_f32_t* results) {
+    __mmask16 const tail_mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n % 16);
+
+    // The norm of the query is computed just once for all the rows
+    __m512 a2_vec = _mm512_setzero_ps();
+    for (simsimd_size_t i = 0; i < n; i += 16) {
+        __mmask16 mask = i + 16 <= n ? (__mmask16)0xFFFF : tail_mask;
+        __m512 a_vec = _mm512_maskz_loadu_ps(mask, a + i);
+        a2_vec = _mm512_fmadd_ps(a_vec, a_vec, a2_vec);
+    }
+    simsimd_f32_t a2 = _mm512_reduce_add_ps(a2_vec);
+
+    simsimd_size_t j = 0;
+    for (; j + 4 <= count; j += 4) {
+        simsimd_f32_t const* b_0 = (simsimd_f32_t const*)((char const*)b + (j + 0) * stride);
+        simsimd_f32_t const* b_1 = (simsimd_f32_t const*)((char const*)b + (j + 1) * stride);
+        simsimd_f32_t const* b_2 = (simsimd_f32_t const*)((char const*)b + (j + 2) * stride);
+        simsimd_f32_t const* b_3 = (simsimd_f32_t const*)((char const*)b + (j + 3) * stride);
+        __m512 ab_0_vec = _mm512_setzero_ps(), ab_1_vec = _mm512_setzero_ps();
+        __m512 ab_2_vec = _mm512_setzero_ps(), ab_3_vec = _mm512_setzero_ps();
+        __m512 b2_0_vec = _mm512_setzero_ps(), b2_1_vec = _mm512_setzero_ps();
+        __m512 b2_2_vec = _mm512_setzero_ps(), b2_3_vec = _mm512_setzero_ps();
+        for (simsimd_size_t i = 0; i < n; i += 16) {
+            __mmask16 mask = i + 16 <= n ? (__mmask16)0xFFFF : tail_mask;
+            __m512 a_vec = _mm512_maskz_loadu_ps(mask, a + i);
+            __m512 b_0_vec = _mm512_maskz_loadu_ps(mask, b_0 + i);
+            __m512 b_1_vec = _mm512_maskz_loadu_ps(mask, b_1 + i);
+            __m512 b_2_vec = _mm512_maskz_loadu_ps(mask, b_2 + i);
+            __m512 b_3_vec = _mm512_maskz_loadu_ps(mask, b_3 + i);
+            ab_0_vec = _mm512_fmadd_ps(a_vec, b_0_vec, ab_0_vec), b2_0_vec = _mm512_fmadd_ps(b_0_vec, b_0_vec, b2_0_vec);
+            ab_1_vec = _mm512_fmadd_ps(a_vec, b_1_vec, ab_1_vec), b2_1_vec = _mm512_fmadd_ps(b_1_vec, b_1_vec, b2_1_vec);
+            ab_2_vec = _mm512_fmadd_ps(a_vec, b_2_vec, ab_2_vec), b2_2_vec = _mm512_fmadd_ps(b_2_vec, b_2_vec, b2_2_vec);
+            ab_3_vec = _mm512_fmadd_ps(a_vec, b_3_vec, ab_3_vec), b2_3_vec = _mm512_fmadd_ps(b_3_vec, b_3_vec, b2_3_vec);
+        }
+
+        // Compute the reciprocal square roots of the query norm and 4 row norms at once
+        __m128 ab_vec = _mm_set_ps(_mm512_reduce_add_ps(ab_3_vec), _mm512_reduce_add_ps(ab_2_vec),
+                                   _mm512_reduce_add_ps(ab_1_vec), _mm512_reduce_add_ps(ab_0_vec));
+        __m128 b2_vec = _mm_set_ps(_mm512_reduce_add_ps(b2_3_vec), _mm512_reduce_add_ps(b2_2_vec),
+                                   _mm512_reduce_add_ps(b2_1_vec), _mm512_reduce_add_ps(b2_0_vec));
+        __m128 rsqrt_a2_vec = simsimd_avx512_rsqrt_ps(_mm_set1_ps(a2 + 1.e-9f));
+        __m128 rsqrt_b2_vec = simsimd_avx512_rsqrt_ps(_mm_add_ps(b2_vec, _mm_set1_ps(1.e-9f)));
+        __m128 result_vec = _mm_sub_ps(_mm_set1_ps(1), _mm_mul_ps(ab_vec, _mm_mul_ps(rsqrt_a2_vec, rsqrt_b2_vec)));
+        _mm_storeu_ps(results + j, result_vec);
+    }
+    for (; j < count; ++j)
+        results[j] = simsimd_avx512_f32_cos(a, (simsimd_f32_t const*)((char const*)b + j * stride), n);
+}
+
+/*
+ *  @file   x86_avx512_mixed.h
+ *  @brief  x86 AVX-512 implementation of the mixed-precision similarity metrics.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity, for `f32` and `f16`, `f32` and `i8`, `f16` and `i8`.
+ *  - Upcasts both sides to `f32` with `_mm512_cvtph_ps` and `_mm512_cvtepi8_epi32` on the fly, after masked loads.
+ *  - Uses `f32` for accumulation, applying the scale of the second vector before the FMA for L2 squared.
+ *  - Requires compiler capabilities: avx512f, avx512vl, avx512bw, bmi2.
+ */
+
+__attribute__((target("avx512f,avx512vl,avx512bw,bmi2"))) //
+inline static __m512
+simsimd_avx512_f32_load_f32(__mmask16 mask, simsimd_f32_t const* x) {
+    return _mm512_maskz_loadu_ps(mask, x);
+}
+
+__attribute__((target("avx512f,avx512vl,avx512bw,bmi2"))) //
+inline static __m512
+simsimd_avx512_f16_load_f32(__mmask16 mask, simsimd_f16_t const* x) {
+    return _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, x));
+}
+
+__attribute__((target("avx512f,avx512vl,avx512bw,bmi2"))) //
+inline static __m512
+simsimd_avx512_i8_load_f32(__mmask16 mask, simsimd_i8_t const* x) {
+    return _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_maskz_loadu_epi8(mask, x)));
+}
+
+#define SIMSIMD_AVX512_MAKE_MIXED(a_type, b_type)                                                                      \
+    __attribute__((target("avx512f,avx512vl,avx512bw,bmi2")))                                                          \
+    inline static simsimd_f32_t simsimd_avx512_##a_type##b_type##_l2sq_scaled(                                         \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n, simsimd_f32_t b_scale) {       \
+        __m512 const scale_vec = _mm512_set1_ps(b_scale);                                                              \
+        __m512 d2_vec = _mm512_setzero_ps();                                                                           \
+        for (simsimd_size_t i = 0; i < n; i += 16) {                                                                   \
+            __mmask16 mask = i + 16 <= n ? (__mmask16)0xFFFF : (__mmask16)_bzhi_u32(0xFFFF, (unsigned)(n - i));        \
+            __m512 a_vec = simsimd_avx512_##a_type##_load_f32(mask, a + i);                                            \
+            __m512 b_vec = _mm512_mul_ps(simsimd_avx512_##b_type##_load_f32(mask, b + i), scale_vec);                  \
+            __m512 d_vec = _mm512_sub_ps(a_vec, b_vec);                                                                \
+            d2_vec = _mm512_fmadd_ps(d_vec, d_vec, d2_vec);                                                            \
+        }                                                                                                              \
+        return _mm512_reduce_add_ps(d2_vec);                                                                           \
+    }                                                                                                                  \
+    __attribute__((target("avx512f,avx512vl,avx512bw,bmi2")))                                                          \
+    inline static simsimd_f32_t simsimd_avx512_##a_type##b_type##_ip_scaled(                                           \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n, simsimd_f32_t b_scale) {       \
+        __m512 ab_vec = _mm512_setzero_ps();                                                                           \
+        for (simsimd_size_t i = 0; i < n; i += 16) {                                                                   \
+            __mmask16 mask = i + 16 <= n ? (__mmask16)0xFFFF : (__mmask16)_bzhi_u32(0xFFFF, (unsigned)(n - i));        \
+            __m512 a_vec = simsimd_avx512_##a_type##_load_f32(mask, a + i);                                            \
+            __m512 b_vec = simsimd_avx512_##b_type##_load_f32(mask, b + i);                                            \
+            ab_vec = _mm512_fmadd_ps(a_vec, b_vec, ab_vec);                                                            \
+        }                                                                                                              \
+        return 1 - b_scale * _mm512_reduce_add_ps(ab_vec);                                                             \
+    }                                                                                                                  \
+    __attribute__((target("avx512f,avx512vl,avx512bw,bmi2")))                                                          \
+    inline static simsimd_f32_t simsimd_avx512_##a_type##b_type##_cos_scaled(                                          \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n, simsimd_f32_t b_scale) {       \
+        __m512 ab_vec = _mm512_setzero_ps(), a2_vec = _mm512_setzero_ps(), b2_vec = _mm512_setzero_ps();               \
+        for (simsimd_size_t i = 0; i < n; i += 16) {                                                                   \
+            __mmask16 mask = i + 16 <= n ? (__mmask16)0xFFFF : (__mmask16)_bzhi_u32(0xFFFF, (unsigned)(n - i));        \
+            __m512 a_vec = simsimd_avx512_##a_type##_load_f32(mask, a + i);                                            \
+            __m512 b_vec = simsimd_avx512_##b_type##_load_f32(mask, b + i);                                            \
+            ab_vec = _mm512_fmadd_ps(a_vec, b_vec, ab_vec);                                                            \
+            a2_vec = _mm512_fmadd_ps(a_vec, a_vec, a2_vec);                                                            \
+            b2_vec = _mm512_fmadd_ps(b_vec, b_vec, b2_vec);                                                            \
+        }                                                                                                              \
+        simsimd_f32_t ab = _mm512_reduce_add_ps(ab_vec);                                                               \
+        simsimd_f32_t a2 = _mm512_reduce_add_ps(a2_vec), b2 = _mm512_reduce_add_ps(b2_vec);                            \
+        ab = b_scale < 0 ? -ab : ab;                                                                                   \
+        return ab != 0 ? (1 - ab * SIMSIMD_RSQRT(a2) * SIMSIMD_RSQRT(b2)) : 1;                                         \
+    }                                                                                                                  \
+    __attribute__((target("avx512f,avx512vl,avx512bw,bmi2")))                                                          \
+    inline static simsimd_f32_t simsimd_avx512_##a_type##b_type##_l2sq(                                                \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n) {                              \
+        return simsimd_avx512_##a_type##b_type##_l2sq_scaled(a, b, n, 1);                                              \
+    }                                                                                                                  \
+    __attribute__((target("avx512f,avx512vl,avx512bw,bmi2")))                                                          \
+    inline static simsimd_f32_t simsimd_avx512_##a_type##b_type##_ip(                                                  \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n) {                              \
+        return simsimd_avx512_##a_type##b_type##_ip_scaled(a, b, n, 1);                                                \
+    }                                                                                                                  \
+    __attribute__((target("avx512f,avx512vl,avx512bw,bmi2")))                                                          \
+    inline static simsimd_f32_t simsimd_avx512_##a_type##b_type##_cos(                                                 \
+        simsimd_##a_type##_t const* a, simsimd_##b_type##_t const* b, simsimd_size_t n) {                              \
+        return simsimd_avx512_##a_type##b_type##_cos_scaled(a, b, n, 1);                                               \
+    }
+
+SIMSIMD_AVX512_MAKE_MIXED(f32, f16) // simsimd_avx512_f32f16_l2sq, simsimd_avx512_f32f16_ip, simsimd_avx512_f32f16_cos
+SIMSIMD_AVX512_MAKE_MIXED(f32, i8)  // simsimd_avx512_f32i8_l2sq, simsimd_avx512_f32i8_ip, simsimd_avx512_f32i8_cos
+SIMSIMD_AVX512_MAKE_MIXED(f16, i8)  // simsimd_avx512_f16i8_l2sq, simsimd_avx512_f16i8_ip, simsimd_avx512_f16i8_cos
+
+#undef SIMSIMD_AVX512_MAKE_MIXED
+
+/*
+ *  @file   x86_avx512_fixed.h
+ *  @brief  x86 AVX-512 implementation of the most common similarity metrics for fixed dimensions.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity, for `f32` and `f16` embeddings of 384, 768,
+ *    1024, and 1536 dimensions, exported as `simsimd_avx512_f32_cos_768` and alike.
+ *  - Has compile-time trip counts, that are multiples of 64, so there are no masked tails, and the loops are unrolled.
+ *  - Uses four independent accumulators per quantity, and reduces them horizontally just once.
+ *  - Upcasts `f16` to `f32` with `_mm512_cvtph_ps`, so unlike `simsimd_avx512_f16_cos` it doesn't need AVX512-FP16.
+ *  - Ignores the runtime `n` argument, but matches the `simsimd_metric_punned_t` signature.
+ *  - Requires compiler capabilities: avx512f, avx512vl, avx512bw, bmi2.
+ */
+
+#define SIMSIMD_AVX512_MAKE_FIXED(input_type, dimensions)                                                              \
+    __attribute__((target("avx512f,avx512vl,avx512bw,bmi2")))                                                          \
+    inline static simsimd_f32_t simsimd_avx512_##input_type##_l2sq_##dimensions(                                       \
+        simsimd_##input_type##_t const* a, simsimd_##input_type##_t const* b, simsimd_size_t n) {                      \
+        (void)n;                                                                                                       \
+        __m512 d2_first_vec = _mm512_setzero_ps(), d2_second_vec = _mm512_setzero_ps();                                \
+        __m512 d2_third_vec = _mm512_setzero_ps(), d2_fourth_vec = _mm512_setzero_ps();                                \
+        for (simsimd_size_t i = 0; i != dimensions; i += 64) {                                                         \
+            __m512 a_first_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, a + i);                                \
+            __m512 a_second_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, a + i + 16);                          \
+            __m512 a_third_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, a + i + 32);                           \
+            __m512 a_fourth_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, a + i + 48);                          \
+            __m512 b_first_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, b + i);                                \
+            __m512 b_second_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, b + i + 16);                          \
+            __m512 b_third_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, b + i + 32);                           \
+            __m512 b_fourth_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, b + i + 48);                          \
+            __m512 d_first_vec = _mm512_sub_ps(a_first_vec, b_first_vec);                                              \
+            __m512 d_second_vec = _mm512_sub_ps(a_second_vec, b_second_vec);                                           \
+            __m512 d_third_vec = _mm512_sub_ps(a_third_vec, b_third_vec);                                              \
+            __m512 d_fourth_vec = _mm512_sub_ps(a_fourth_vec, b_fourth_vec);                                           \
+            d2_first_vec = _mm512_fmadd_ps(d_first_vec, d_first_vec, d2_first_vec);                                    \
+            d2_second_vec = _mm512_fmadd_ps(d_second_vec, d_second_vec, d2_second_vec);                                \
+            d2_third_vec = _mm512_fmadd_ps(d_third_vec, d_third_vec, d2_third_vec);                                    \
+            d2_fourth_vec = _mm512_fmadd_ps(d_fourth_vec, d_fourth_vec, d2_fourth_vec);                                \
+        }                                                                                                              \
+        d2_first_vec = _mm512_add_ps(d2_first_vec, d2_second_vec);                                                     \
+        d2_third_vec = _mm512_add_ps(d2_third_vec, d2_fourth_vec);                                                     \
+        return _mm512_reduce_add_ps(_mm512_add_ps(d2_first_vec, d2_third_vec));                                        \
+    }                                                                                                                  \
+    __attribute__((target("avx512f,avx512vl,avx512bw,bmi2")))                                                          \
+    inline static simsimd_f32_t simsimd_avx512_##input_type##_ip_##dimensions(                                         \
+        simsimd_##input_type##_t const* a, simsimd_##input_type##_t const* b, simsimd_size_t n) {                      \
+        (void)n;                                                                                                       \
+        __m512 ab_first_vec = _mm512_setzero_ps(), ab_second_vec = _mm512_setzero_ps();                                \
+        __m512 ab_third_vec = _mm512_setzero_ps(), ab_fourth_vec = _mm512_setzero_ps();                                \
+        for (simsimd_size_t i = 0; i != dimensions; i += 64) {                                                         \
+            __m512 a_first_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, a + i);                                \
+            __m512 a_second_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, a + i + 16);                          \
+            __m512 a_third_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, a + i + 32);                           \
+            __m512 a_fourth_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, a + i + 48);                          \
+            __m512 b_first_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, b + i);                                \
+            __m512 b_second_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, b + i + 16);                          \
+            __m512 b_third_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, b + i + 32);                           \
+            __m512 b_fourth_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, b + i + 48);                          \
+            ab_first_vec = _mm512_fmadd_ps(a_first_vec, b_first_vec, ab_first_vec);                                    \
+            ab_second_vec = _mm512_fmadd_ps(a_second_vec, b_second_vec, ab_second_vec);                                \
+            ab_third_vec = _mm512_fmadd_ps(a_third_vec, b_third_vec, ab_third_vec);                                    \
+            ab_fourth_vec = _mm512_fmadd_ps(a_fourth_vec, b_fourth_vec, ab_fourth_vec);                                \
+        }                                                                                                              \
+        ab_first_vec = _mm512_add_ps(ab_first_vec, ab_second_vec);                                                     \
+        ab_third_vec = _mm512_add_ps(ab_third_vec, ab_fourth_vec);                                                     \
+        return 1 - _mm512_reduce_add_ps(_mm512_add_ps(ab_first_vec, ab_third_vec));                                    \
+    }                                                                                                                  \
+    __attribute__((target("avx512f,avx512vl,avx512bw,bmi2")))                                                          \
+    inline static simsimd_f32_t simsimd_avx512_##input_type##_cos_##dimensions(                                        \
+        simsimd_##input_type##_t const* a, simsimd_##input_type##_t const* b, simsimd_size_t n) {                      \
+        (void)n;                                                                                                       \
+        __m512 ab_first_vec = _mm512_setzero_ps(), ab_second_vec = _mm512_setzero_ps();                                \
+        __m512 ab_third_vec = _mm512_setzero_ps(), ab_fourth_vec = _mm512_setzero_ps();                                \
+        __m512 a2_first_vec = _mm512_setzero_ps(), a2_second_vec = _mm512_setzero_ps();                                \
+        __m512 a2_third_vec = _mm512_setzero_ps(), a2_fourth_vec = _mm512_setzero_ps();                                \
+        __m512 b2_first_vec = _mm512_setzero_ps(), b2_second_vec = _mm512_setzero_ps();                                \
+        __m512 b2_third_vec = _mm512_setzero_ps(), b2_fourth_vec = _mm512_setzero_ps();                                \
+        for (simsimd_size_t i = 0; i != dimensions; i += 64) {                                                         \
+            __m512 a_first_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, a + i);                                \
+            __m512 a_second_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, a + i + 16);                          \
+            __m512 a_third_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, a + i + 32);                           \
+            __m512 a_fourth_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, a + i + 48);                          \
+            __m512 b_first_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, b + i);                                \
+            __m512 b_second_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, b + i + 16);                          \
+            __m512 b_third_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, b + i + 32);                           \
+            __m512 b_fourth_vec = simsimd_avx512_##input_type##_load_f32(0xFFFF, b + i + 48);                          \
+            ab_first_vec = _mm512_fmadd_ps(a_first_vec, b_first_vec, ab_first_vec);                                    \
+            a2_first_vec = _mm512_fmadd_ps(a_first_vec, a_first_vec, a2_first_vec);                                    \
+            b2_first_vec = _mm512_fmadd_ps(b_first_vec, b_first_vec, b2_first_vec);                                    \
+            ab_second_vec = _mm512_fmadd_ps(a_second_vec, b_second_vec, ab_second_vec);                                \
+            a2_second_vec = _mm512_fmadd_ps(a_second_vec, a_second_vec, a2_second_vec);                                \
+            b2_second_vec = _mm512_fmadd_ps(b_second_vec, b_second_vec, b2_second_vec);                                \
+            ab_third_vec = _mm512_fmadd_ps(a_third_vec, b_third_vec, ab_third_vec);                                    \
+            a2_third_vec = _mm512_fmadd_ps(a_third_vec, a_third_vec, a2_third_vec);                                    \
+            b2_third_vec = _mm512_fmadd_ps(b_third_vec, b_third_vec, b2_third_vec);                                    \
+            ab_fourth_vec = _mm512_fmadd_ps(a_fourth_vec, b_fourth_vec, ab_fourth_vec);                                \
+            a2_fourth_vec = _mm512_fmadd_ps(a_fourth_vec, a_fourth_vec, a2_fourth_vec);                                \
+            b2_fourth_vec = _mm512_fmadd_ps(b_fourth_vec, b_fourth_vec, b2_fourth_vec);                                \
+        }                                                                                                              \
+        ab_first_vec = _mm512_add_ps(ab_first_vec, ab_second_vec);                                                     \
+        ab_third_vec = _mm512_add_ps(ab_third_vec, ab_fourth_vec);                                                     \
+        simsimd_f32_t ab = _mm512_reduce_add_ps(_mm512_add_ps(ab_first_vec, ab_third_vec));                            \
+        a2_first_vec = _mm512_add_ps(a2_first_vec, a2_second_vec);                                                     \
+        a2_third_vec = _mm512_add_ps(a2_third_vec, a2_fourth_vec);                                                     \
+        simsimd_f32_t a2 = _mm512_reduce_add_ps(_mm512_add_ps(a2_first_vec, a2_third_vec));                            \
+        b2_first_vec = _mm512_add_ps(b2_first_vec, b2_second_vec);                                                     \
+        b2_third_vec = _mm512_add_ps(b2_third_vec, b2_fourth_vec);                                                     \
+        simsimd_f32_t b2 = _mm512_reduce_add_ps(_mm512_add_ps(b2_first_vec, b2_third_vec));                            \
+        __m128 rsqrts = simsimd_avx512_rsqrt_ps(_mm_set_ps(0.f, 0.f, a2 + 1.e-9f, b2 + 1.e-9f));                       \
+        simsimd_f32_t rsqrt_a2 = _mm_cvtss_f32(rsqrts);                                                                \
+        simsimd_f32_t rsqrt_b2 = _mm_cvtss_f32(_mm_shuffle_ps(rsqrts, rsqrts, _MM_SHUFFLE(0, 0, 0, 1)));               \
+        return 1 - ab * rsqrt_a2 * rsqrt_b2;                                                                           \
+    }
+
+SIMSIMD_AVX512_MAKE_FIXED(f32, 384)  // simsimd_avx512_f32_l2sq_384, ..._ip_384, ..._cos_384
+SIMSIMD_AVX512_MAKE_FIXED(f32, 768)  // simsimd_avx512_f32_l2sq_768, ..._ip_768, ..._cos_768
+SIMSIMD_AVX512_MAKE_FIXED(f32, 1024) // simsimd_avx512_f32_l2sq_1024, ..._ip_1024, ..._cos_1024
+SIMSIMD_AVX512_MAKE_FIXED(f32, 1536) // simsimd_avx512_f32_l2sq_1536, ..._ip_1536, ..._cos_1536
+SIMSIMD_AVX512_MAKE_FIXED(f16, 384)  // simsimd_avx512_f16_l2sq_384, ..._ip_384, ..._cos_384
+SIMSIMD_AVX512_MAKE_FIXED(f16, 768)  // simsimd_avx512_f16_l2sq_768, ..._ip_768, ..._cos_768
+SIMSIMD_AVX512_MAKE_FIXED(f16, 1024) // simsimd_avx512_f16_l2sq_1024, ..._ip_1024, ..._cos_1024
+SIMSIMD_AVX512_MAKE_FIXED(f16, 1536) // simsimd_avx512_f16_l2sq_1536, ..._ip_1536, ..._cos_1536
+
+#undef SIMSIMD_AVX512_MAKE_FIXED
+
+/*
+ *  @file   x86_amx_matrix.h
+ *  @brief  x86 AMX implementation of many-to-many similarity metrics for 8-bit integers and brain floats.
+ *  @author Ash Vardanian
+ *
+ *  - Implements: L2 squared, inner product, cosine similarity, for `i8` with `tdpbssd` and `bf16` with `tdpbf16ps`.
+ *  - Multiplies blocks of 32 rows of `a` by blocks of 32 rows of `b`, accumulating into four 16x16 tiles.
+ *  - Repacks every block of `b` once, interleaving 4-byte words of 16 different rows in every tile row,
+ *    and streams up to `SIMSIMD_AMX_ROWS` rows of `a` against it, loading their tiles in place.
+ *  - Derives L2 squared and cosine from the dot products and cached norms, using |a - b|^2 = |a|^2 + |b|^2 - 2ab,
+ *    which is exact for `i8`, but may lose precision for `bf16` vectors, that are very close to each other.
+ *  - Requires compiler capabilities: amx-tile, amx-int8, amx-bf16, avx512bf16, avx512f, avx512bw, avx512vl, bmi2.
+ */
+
+#ifndef SIMSIMD_AMX_DEPTH
+/**
+ *  @brief  Number of bytes of every vector, that the AMX kernels pack at once. Keeps a packed block of
+ *          32 rows of `b` within 32 KiB, or the L1 data cache of most AMX-capable cores. Must be a multiple of 64.
+ */
+#define SIMSIMD_AMX_DEPTH 1024
+#endif
+
+#ifndef SIMSIMD_AMX_ROWS
+/**
+ *  @brief  Number of rows of `a`, whose norms the AMX kernels cache, reusing every packed block of `b` for all of them.
+ */
+#define SIMSIMD_AMX_ROWS 1024
+#endif
+
+/**
+ *  @brief  Tile configuration for `ldtilecfg`, where all eight tiles are used with 16 rows of 64 bytes.
+ *          Tiles 0-3 accumulate the outputs, tiles 4-5 hold the rows of `a`, and tiles 6-7 - the rows of `b`.
+ */
+typedef struct simsimd_amx_config_t {
+    unsigned char palette;
+    unsigned char start_row;
+    unsigned char reserved[14];
+    unsigned short columns_bytes[16];
+    unsigned char rows[16];
+} simsimd_amx_config_t;
+
+__attribute__((target("amx-tile,amx-int8,amx-bf16,avx512bf16,avx512f,avx512bw,avx512vl,bmi2"))) //
+inline static void
+simsimd_amx_norms(int bf16, void const* a, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t row_bytes,
+                  simsimd_f32i32_t* norms, simsimd_f32_t* inverse_norms) {
+    for (simsimd_size_t j = 0; j != count; ++j) {
+        char const* row = (char const*)a + j * stride;
+        simsimd_f32_t norm;
+        if (bf16) {
+            __m512 a2_vec = _mm512_setzero_ps();
+            for (simsimd_size_t i = 0; i < row_bytes; i += 64) {
+                __mmask32 mask =
+                    i + 64 <= row_bytes ? 0xFFFFFFFF : _bzhi_u32(0xFFFFFFFF, (unsigned)(row_bytes - i) / 2);
+                __m512i a_vec = _mm512_maskz_loadu_epi16(mask, row + i);
+                a2_vec = _mm512_dpbf16_ps(a2_vec, (__m512bh)a_vec, (__m512bh)a_vec);
+            }
+            norms[j].f = norm = _mm512_reduce_add_ps(a2_vec);
+        } else {
+            __m512i a2_vec = _mm512_setzero_si512();
+            for (simsimd_size_t i = 0; i < row_bytes; i += 32) {
+                __mmask32 mask = i + 32 <= row_bytes ? 0xFFFFFFFF : _bzhi_u32(0xFFFFFFFF, (unsigned)(row_bytes - i));
+                __m512i a_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, row + i));
+                a2_vec = _mm512_add_epi32(a2_vec, _mm512_madd_epi16(a_vec, a_vec));
+            }
+            norms[j].i = (unsigned)_mm512_reduce_add_epi32(a2_vec);
+            norm = (simsimd_f32_t)(simsimd_i32_t)norms[j].i;
+        }
+        inverse_norms[j] = norm > 0 ? SIMSIMD_RSQRT(norm) : 0;
+    }
+}
+
+/**
+ *  @brief  Packs `length` bytes of up to 32 rows of `b` into `2 * tiles` tiles, so that the first 16 rows
+ *          land in the first `tiles` ones. Every tile row holds the same 4-byte word of 16 different rows,
+ *          which is the layout `tdpbssd` and `tdpbf16ps` expect for their second operand. Missing rows and
+ *          the bytes past `length` are zeroed, so they don't affect the dot products.
+ */
+__attribute__((target("amx-tile,amx-int8,amx-bf16,avx512bf16,avx512f,avx512bw,avx512vl,bmi2"))) //
+inline static void
+simsimd_amx_pack(void const* b, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t length,
+                 simsimd_size_t tiles, simsimd_i32_t* packed) {
+    __m512i const offsets = _mm512_setr_epi32(0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240);
+    for (simsimd_size_t j = 0; j != 32; ++j) {
+        char const* row = (char const*)b + j * stride;
+        simsimd_i32_t* column = packed + (j / 16) * tiles * 256 + j % 16;
+        for (simsimd_size_t t = 0; t != tiles; ++t) {
+            simsimd_size_t left = j < count ? length - t * 64 : 0;
+            __mmask64 mask = left >= 64 ? 0xFFFFFFFFFFFFFFFFull : _bzhi_u64(0xFFFFFFFFFFFFFFFFull, (unsigned)left);
+            _mm512_i32scatter_epi32(column + t * 256, offsets, _mm512_maskz_loadu_epi8(mask, row + t * 64), 4);
+        }
+    }
+}
+
+/**
+ *  @brief  Copies up to `length` bytes of up to 32 rows of `a` into a pair of zero-padded tiles,
+ *          for the blocks that don't have enough rows or bytes to be loaded in place.
+ */
+__attribute__((target("amx-tile,amx-int8,amx-bf16,avx512bf16,avx512f,avx512bw,avx512vl,bmi2"))) //
+inline static void
+simsimd_amx_pad(void const* a, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t length, char* padded) {
+    __mmask64 mask = length >= 64 ? 0xFFFFFFFFFFFFFFFFull : _bzhi_u64(0xFFFFFFFFFFFFFFFFull, (unsigned)length);
+    for (simsimd_size_t j = 0; j != 32; ++j) {
+        __m512i a_vec = _mm512_maskz_loadu_epi8(j < count ? mask : 0, (char const*)a + j * stride);
+        _mm512_storeu_si512(padded + j * 64, a_vec);
+    }
+}
+
+/**
+ *  @brief  Turns 16 dot products of a row of `a` with 16 rows of `b` into distances, given their norms.
+ */
+__attribute__((target("amx-tile,amx-int8,amx-bf16,avx512bf16,avx512f,avx512bw,avx512vl,bmi2"))) //
+inline static __m512
+simsimd_amx_distances(int bf16, char metric, __m512i ab_vec, simsimd_f32i32_t a2, simsimd_f32_t a_inverse_norm,
+                      __m512i b2_vec, __m512 b_inverse_norms_vec) {
+    __m512 const ones_vec = _mm512_set1_ps(1);
+    __m512 ab_f32_vec = bf16 ? _mm512_castsi512_ps(ab_vec) : _mm512_cvtepi32_ps(ab_vec);
+    if (metric == 'e' && bf16) {
+        __m512 d2_vec = _mm512_add_ps(_mm512_set1_ps(a2.f), _mm512_castsi512_ps(b2_vec));
+        d2_vec = _mm512_fnmadd_ps(_mm512_set1_ps(2), ab_f32_vec, d2_vec);
+        return _mm512_max_ps(d2_vec, _mm512_setzero_ps());
+    }
+    if (metric == 'e')
+        return _mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_add_epi32(_mm512_set1_epi32((int)a2.i), b2_vec),
+                                                   _mm512_slli_epi32(ab_vec, 1)));
+    if (metric == 'i' && bf16)
+        return _mm512_sub_ps(ones_vec, ab_f32_vec);
+
+    // Just like the other integer kernels, the inner product of `i8` vectors is the cosine distance
+    __mmask16 nonzero = _mm512_cmp_ps_mask(ab_f32_vec, _mm512_setzero_ps(), _CMP_NEQ_OQ);
+    __m512 scale_vec = _mm512_mul_ps(_mm512_set1_ps(a_inverse_norm), b_inverse_norms_vec);
+    return _mm512_mask3_fnmadd_ps(ab_f32_vec, scale_vec, ones_vec, nonzero);
+}
+
+/**
+ *  @brief  Computes all pairwise distances between two collections of `i8` or `bf16` rows into a matrix,
+ *          processing the rows in blocks of `SIMSIMD_AMX_DEPTH` bytes. The partial dot products of the
+ *          earlier passes are kept in the output matrix, until the last pass turns them into distances.
+ *
+ *  @param bf16 Non-zero for `bf16` inputs, zero for `i8` ones.
+ *  @param metric The kind of the metric: 'i' for the inner product, 'c' for cosine, and 'e' for L2 squared.
+ */
+__attribute__((target("amx-tile,amx-int8,amx-bf16,avx512bf16,avx512f,avx512bw,avx512vl,bmi2"))) //
+inline static void
+simsimd_amx_matrix(int bf16, char metric,                                          //
+                   void const* a, simsimd_size_t a_count, simsimd_size_t a_stride, //
+                   void const* b, simsimd_size_t b_count, simsimd_size_t b_stride, //
+                   simsimd_size_t dimensions, simsimd_f32_t* results, simsimd_size_t results_stride) {
+
+    simsimd_size_t const row_bytes = bf16 ? dimensions * 2 : dimensions;
+    simsimd_i32_t packed[SIMSIMD_AMX_DEPTH * 8];
+    simsimd_f32i32_t products[4][256];
+    char padded[2048];
+    simsimd_f32i32_t a_norms[SIMSIMD_AMX_ROWS], b_norms[32];
+    simsimd_f32_t a_inverse_norms[SIMSIMD_AMX_ROWS], b_inverse_norms[32];
+
+    // Spell out every field, as C++ compilers warn about the missing initializers of `{0}`
+    simsimd_amx_config_t config = {1, 0, {0}, {0}, {0}};
+    for (int t = 0; t != 8; ++t)
+        config.rows[t] = 16, config.columns_bytes[t] = 64;
+    _tile_loadconfig(&config);
+
+    for (simsimd_size_t a_first = 0; a_first < a_count; a_first += SIMSIMD_AMX_ROWS) {
+        simsimd_size_t a_rows = a_count - a_first < SIMSIMD_AMX_ROWS ? a_count - a_first : SIMSIMD_AMX_ROWS;
+        char const* a_rows_start = (char const*)a + a_first * a_stride;
+        simsimd_amx_norms(bf16, a_rows_start, a_rows, a_stride, row_bytes, a_norms, a_inverse_norms);
+
+        for (simsimd_size_t b_first = 0; b_first < b_count; b_first += 32) {
+            simsimd_size_t b_rows = b_count - b_first < 32 ? b_count - b_first : 32;
+            char const* b_block = (char const*)b + b_first * b_stride;
+            simsimd_amx_norms(bf16, b_block, b_rows, b_stride, row_bytes, b_norms, b_inverse_norms);
+
+            for (simsimd_size_t offset = 0; offset < row_bytes; offset += SIMSIMD_AMX_DEPTH) {
+                simsimd_size_t length = row_bytes - offset < SIMSIMD_AMX_DEPTH ? row_bytes - offset : SIMSIMD_AMX_DEPTH;
+                simsimd_size_t tiles = (length + 63) / 64;
+                int const first_pass = offset == 0, last_pass = offset + length == row_bytes;
+                simsimd_amx_pack(b_block + offset, b_rows, b_stride, length, tiles, packed);
+
+                for (simsimd_size_t i = 0; i < a_rows; i += 32) {
+                    simsimd_size_t rows = a_rows - i < 32 ? a_rows - i : 32;
+                    char const* a_block = a_rows_start + i * a_stride + offset;
+                    _tile_zero(0);
+                    _tile_zero(1);
+                    _tile_zero(2);
+                    _tile_zero(3);
+                    for (simsimd_size_t t = 0; t != tiles; ++t) {
+                        if (rows == 32 && (t + 1) * 64 <= length) {
+                            _tile_loadd(4, a_block + t * 64, a_stride);
+                            _tile_loadd(5, a_block + 16 * a_stride + t * 64, a_stride);
+                        } else {
+                            simsimd_amx_pad(a_block + t * 64, rows, a_stride, length - t * 64, padded);
+                            _tile_loadd(4, padded, 64);
+                            _tile_loadd(5, padded + 1024, 64);
+                        }
+                        _tile_loadd(6, packed + t * 256, 64);
+                        _tile_loadd(7, packed + (tiles + t) * 256, 64);
+                        if (bf16) {
+                            _tile_dpbf16ps(0, 4, 6);
+                            _tile_dpbf16ps(1, 4, 7);
+                            _tile_dpbf16ps(2, 5, 6);
+                            _tile_dpbf16ps(3, 5, 7);
+                        } else {
+                            _tile_dpbssd(0, 4, 6);
+                            _tile_dpbssd(1, 4, 7);
+                            _tile_dpbssd(2, 5, 6);
+                            _tile_dpbssd(3, 5, 7);
+                        }
+                    }
+                    _tile_stored(0, products[0], 64);
+                    _tile_stored(1, products[1], 64);
+                    _tile_stored(2, products[2], 64);
+                    _tile_stored(3, products[3], 64);
+
+                    // Accumulate the partial products in the outputs, or turn them into distances on the last pass
+                    for (simsimd_size_t r = 0; r != rows; ++r) {
+                        simsimd_size_t row = i + r;
+                        char* cells = (char*)results + (a_first + row) * results_stride + b_first * 4;
+                        for (simsimd_size_t half = 0; half * 16 < b_rows; ++half) {
+                            __mmask16 mask = _bzhi_u32(0xFFFF, (unsigned)(b_rows - half * 16));
+                            __m512i ab_vec = _mm512_loadu_si512(products[(r / 16) * 2 + half] + (r % 16) * 16);
+                            if (!first_pass) {
+                                __m512i partial_vec = _mm512_maskz_loadu_epi32(mask, cells + half * 64);
+                                ab_vec = bf16 ? _mm512_castps_si512(_mm512_add_ps(_mm512_castsi512_ps(ab_vec),
+                                                                                  _mm512_castsi512_ps(partial_vec)))
+                                              : _mm512_add_epi32(ab_vec, partial_vec);
+                            }
+                            if (!last_pass) {
+                                _mm512_mask_storeu_epi32(cells + half * 64, mask, ab_vec);
+                                continue;
+                            }
+                            __m512 distances_vec = simsimd_amx_distances(
+                                bf16, metric, ab_vec, a_norms[row], a_inverse_norms[row],
+                                _mm512_loadu_si512(b_norms + half * 16), _mm512_loadu_ps(b_inverse_norms + half * 16));
+                            _mm512_mask_storeu_ps(cells + half * 64, mask, distances_vec);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    _tile_release();
+}
+
+#define SIMSIMD_AMX_MAKE_MATRIX(type, bf16, name, metric)                                                              \
+    __attribute__((target("amx-tile,amx-int8,amx-bf16,avx512bf16,avx512f,avx512bw,avx512vl,bmi2")))                   \
+    inline static void simsimd_amx_##type##_##name##_matrix(                                                           \
+        simsimd_##type##_t const* a, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_##type##_t const* b,     \
+        simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t dimensions, simsimd_f32_t* results,            \
+        simsimd_size_t results_stride) {                                                                               \
+        simsimd_amx_matrix(bf16, metric, a, a_count, a_stride, b, b_count, b_stride, dimensions, results,              \
+                           results_stride);                                                                            \
+    }
+
+SIMSIMD_AMX_MAKE_MATRIX(i8, 0, ip, 'i')     // simsimd_amx_i8_ip_matrix
+SIMSIMD_AMX_MAKE_MATRIX(i8, 0, cos, 'c')    // simsimd_amx_i8_cos_matrix
+SIMSIMD_AMX_MAKE_MATRIX(i8, 0, l2sq, 'e')   // simsimd_amx_i8_l2sq_matrix
+SIMSIMD_AMX_MAKE_MATRIX(bf16, 1, ip, 'i')   // simsimd_amx_bf16_ip_matrix
+SIMSIMD_AMX_MAKE_MATRIX(bf16, 1, cos, 'c')  // simsimd_amx_bf16_cos_matrix
+SIMSIMD_AMX_MAKE_MATRIX(bf16, 1, l2sq, 'e') // simsimd_amx_bf16_l2sq_matrix
+
+#undef SIMSIMD_AMX_MAKE_MATRIX
+
 #endif // SIMSIMD_TARGET_X86_AVX512
 #endif // SIMSIMD_TARGET_X86
 
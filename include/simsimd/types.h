@@ -81,14 +81,53 @@
 
 #endif
 
+/**
+ *  @brief  Precision of the reciprocal square roots, that normalize the cosine distances:
+ *          - `SIMSIMD_COS_PRECISION_FAST` uses the hardware estimates as is, like `rsqrtss` with
+ *            12 bits of precision, `vrsqrte` with 8 bits, and `vrsqrt14ps` with 14 bits.
+ *          - `SIMSIMD_COS_PRECISION_NEWTON` refines the estimates with Newton-Raphson iterations,
+ *            until they get close to the 24 bits of the `f32` mantissa.
+ *          - `SIMSIMD_COS_PRECISION_EXACT` computes the square roots and divides by them.
+ *          The dot products dominate the cost for any non-trivial number of dimensions, so the
+ *          refinement is enabled by default.
+ */
+#define SIMSIMD_COS_PRECISION_FAST 0
+#define SIMSIMD_COS_PRECISION_NEWTON 1
+#define SIMSIMD_COS_PRECISION_EXACT 2
+
+#ifndef SIMSIMD_COS_PRECISION
+#define SIMSIMD_COS_PRECISION SIMSIMD_COS_PRECISION_NEWTON
+#endif
+
+#if !defined(SIMSIMD_RSQRT) || SIMSIMD_COS_PRECISION == SIMSIMD_COS_PRECISION_EXACT
+#include <math.h> // `sqrtf`
+#endif
+
 #ifndef SIMSIMD_RSQRT
-#include <math.h>
 #define SIMSIMD_RSQRT(x) (1 / sqrtf(x))
 #endif
 
-#ifndef SIMSIMD_LOG
-#include <math.h>
-#define SIMSIMD_LOG(x) (logf(x))
+/**
+ *  @brief  Precision of the `log2` approximations in the Kullback-Leibler and Jensen-Shannon kernels:
+ *          - `SIMSIMD_LOG_PRECISION_FAST` evaluates a 5th degree polynomial with a relative error of 1e-5.
+ *          - `SIMSIMD_LOG_PRECISION_ACCURATE` evaluates an 8th degree polynomial with a relative error of 3e-8,
+ *            which is below the resolution of `f32`.
+ *          Every backend, including the serial one, reduces the arguments and evaluates the polynomial in the
+ *          same way, so the divergences don't change when the same job lands on a different CPU.
+ */
+#define SIMSIMD_LOG_PRECISION_FAST 0
+#define SIMSIMD_LOG_PRECISION_ACCURATE 1
+
+#ifndef SIMSIMD_LOG_PRECISION
+#define SIMSIMD_LOG_PRECISION SIMSIMD_LOG_PRECISION_ACCURATE
+#endif
+
+/**
+ *  @brief  Smoothing term added to both probabilities before taking their ratio in the Kullback-Leibler
+ *          and Jensen-Shannon kernels, shared by all datatypes and backends.
+ */
+#ifndef SIMSIMD_PROBABILITY_EPSILON
+#define SIMSIMD_PROBABILITY_EPSILON 1e-6
 #endif
 
 #ifdef __cplusplus
@@ -96,10 +135,13 @@ extern "C" {
 #endif
 
 typedef int simsimd_i32_t;
+typedef unsigned int simsimd_u32_t;
 typedef float simsimd_f32_t;
 typedef double simsimd_f64_t;
 typedef signed char simsimd_i8_t;
 typedef unsigned char simsimd_b8_t;
+typedef unsigned char simsimd_u8_t;
+typedef unsigned char simsimd_i4x2_t;
 typedef unsigned long long simsimd_size_t;
 
 #if !defined(SIMSIMD_NATIVE_F16)
@@ -127,8 +169,21 @@ typedef _Float16 simsimd_f16_t;
 typedef unsigned short simsimd_f16_t;
 #endif
 
+/**
+ *  @brief  Brain floating-point type, the upper half of an IEEE 754 single-precision number,
+ *          stored as raw bits, as few compilers expose a native type for it.
+ */
+typedef unsigned short simsimd_bf16_t;
+
 #define SIMSIMD_IDENTIFY(x) (x)
 
+/**
+ *  @brief  Returns the signed 4-bit number from the low or the high nibble of an `i4x2` word.
+ *          The low nibble holds the even dimension, and the high nibble the following odd one.
+ */
+#define SIMSIMD_I4X2_LOW(x) ((simsimd_i32_t)(((x) & 0x0F) ^ 0x08) - 0x08)
+#define SIMSIMD_I4X2_HIGH(x) ((simsimd_i32_t)((((x) >> 4) & 0x0F) ^ 0x08) - 0x08)
+
 /**
  *  @brief  Returns the value of the half-precision floating-point number,
  *          potentially decompressed into single-precision.
@@ -141,21 +196,61 @@ typedef unsigned short simsimd_f16_t;
 #endif
 #endif
 
+/**
+ *  @brief  Returns the half-precision floating-point number, closest to the given single-precision one.
+ */
+#ifndef SIMSIMD_COMPRESS_F16
+#if SIMSIMD_NATIVE_F16
+#define SIMSIMD_COMPRESS_F16(x) ((simsimd_f16_t)(x))
+#else
+#define SIMSIMD_COMPRESS_F16(x) simsimd_compress_f16(x)
+#endif
+#endif
+
+/**
+ *  @brief  Returns the value of the brain floating-point number, decompressed into single-precision.
+ */
+#ifndef SIMSIMD_UNCOMPRESS_BF16
+#define SIMSIMD_UNCOMPRESS_BF16(x) simsimd_uncompress_bf16(x)
+#endif
+
+/**
+ *  @brief  Returns the brain floating-point number, closest to the given single-precision one.
+ */
+#ifndef SIMSIMD_COMPRESS_BF16
+#define SIMSIMD_COMPRESS_BF16(x) simsimd_compress_bf16(x)
+#endif
+
 typedef union {
     unsigned i;
     float f;
 } simsimd_f32i32_t;
 
+typedef union {
+    unsigned long long i;
+    double f;
+} simsimd_f64i64_t;
+
 /**
  *  @brief  Computes `1/sqrt(x)` using the trick from Quake 3, replacing
- *          magic numbers with the ones suggested by Jan Kadlec.
+ *          magic numbers with the ones suggested by Jan Kadlec. The estimate has
+ *          about 11 bits of precision, and is refined with a Newton-Raphson iteration,
+ *          if `SIMSIMD_COS_PRECISION` is `SIMSIMD_COS_PRECISION_NEWTON`, or replaced with
+ *          the exact `1 / sqrtf(x)`, if it is `SIMSIMD_COS_PRECISION_EXACT`.
  */
 inline static simsimd_f32_t simsimd_approximate_inverse_square_root(simsimd_f32_t number) {
+#if SIMSIMD_COS_PRECISION == SIMSIMD_COS_PRECISION_EXACT
+    return 1 / sqrtf(number);
+#else
     simsimd_f32i32_t conv;
     conv.f = number;
     conv.i = 0x5F1FFFF9 - (conv.i >> 1);
     conv.f *= 0.703952253f * (2.38924456f - number * conv.f * conv.f);
+#if SIMSIMD_COS_PRECISION == SIMSIMD_COS_PRECISION_NEWTON
+    conv.f *= 1.5f - 0.5f * number * conv.f * conv.f;
+#endif
     return conv.f;
+#endif
 }
 
 /**
@@ -196,6 +291,52 @@ inline static float simsimd_uncompress_f16(unsigned short x) {
     return result_union.f;
 }
 
+/**
+ *  @brief  For compilers that don't natively support the `_Float16` type, downcasts a `float`,
+ *          rounding to the nearest even, saturating to infinity, and keeping the subnormals.
+ *
+ *  https://gist.github.com/rygorous/2156668
+ */
+inline static unsigned short simsimd_compress_f16(float x) {
+    simsimd_f32i32_t conv, denormal;
+    conv.f = x;
+    unsigned sign = (conv.i >> 16) & 0x8000u;
+    conv.i &= 0x7FFFFFFFu;
+    if (conv.i >= 0x47800000u) // Too large, infinite, or NaN
+        return (unsigned short)(sign | (conv.i > 0x7F800000u ? 0x7E00u : 0x7C00u));
+    if (conv.i < 0x38800000u) { // Subnormal or zero, rounded by the floating-point addition
+        denormal.i = 0x3F000000u;
+        conv.f += denormal.f;
+        return (unsigned short)(sign | (conv.i - denormal.i));
+    }
+    unsigned odd_mantissa = (conv.i >> 13) & 1u;
+    conv.i += 0xC8000FFFu + odd_mantissa; // Rebiasing the exponent and rounding
+    return (unsigned short)(sign | (conv.i >> 13));
+}
+
+/**
+ *  @brief  Upcasts a brain floating-point number into a conventional `float`,
+ *          by placing its bits into the upper half of the single-precision word.
+ */
+inline static float simsimd_uncompress_bf16(unsigned short x) {
+    simsimd_f32i32_t conv;
+    conv.i = (unsigned)x << 16;
+    return conv.f;
+}
+
+/**
+ *  @brief  Downcasts a `float` into a brain floating-point number, by keeping the upper half of its bits,
+ *          rounded to the nearest even. NaNs stay NaNs, instead of carrying the rounding into the exponent.
+ */
+inline static unsigned short simsimd_compress_bf16(float x) {
+    simsimd_f32i32_t conv;
+    conv.f = x;
+    if ((conv.i & 0x7FFFFFFFu) > 0x7F800000u)
+        return (unsigned short)((conv.i >> 16) | 0x0040u);
+    conv.i += 0x7FFFu + ((conv.i >> 16) & 1u);
+    return (unsigned short)(conv.i >> 16);
+}
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
\ No newline at end of file
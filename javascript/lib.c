@@ -10,10 +10,40 @@
 
 #include <node_api.h>        // `napi_*` functions
 #include <simsimd/simsimd.h> // `simsimd_*` functions
+#include <stdlib.h>          // `malloc`, `free`
+#include <string.h>          // `strcmp`
 
 /// @brief  Global variable that caches the CPU capabilities, and is computed just onc, when the module is loaded.
 simsimd_capability_t static_capabilities = simsimd_cap_serial_k;
 
+simsimd_datatype_t typedarray_to_datatype(napi_typedarray_type type) {
+    switch (type) {
+    case napi_float32_array: return simsimd_datatype_f32_k;
+    case napi_int8_array: return simsimd_datatype_i8_k;
+    case napi_uint8_array: return simsimd_datatype_b8_k;
+    default: return simsimd_datatype_unknown_k;
+    }
+}
+
+simsimd_metric_kind_t string_to_metric_kind(char const* name) {
+    if (strcmp(name, "sqeuclidean") == 0)
+        return simsimd_metric_sqeuclidean_k;
+    else if (strcmp(name, "inner") == 0)
+        return simsimd_metric_inner_k;
+    else if (strcmp(name, "cosine") == 0)
+        return simsimd_metric_cosine_k;
+    else if (strcmp(name, "hamming") == 0)
+        return simsimd_metric_hamming_k;
+    else if (strcmp(name, "jaccard") == 0)
+        return simsimd_metric_jaccard_k;
+    else if (strcmp(name, "kullbackleibler") == 0)
+        return simsimd_metric_kl_k;
+    else if (strcmp(name, "jensenshannon") == 0)
+        return simsimd_metric_js_k;
+    else
+        return simsimd_metric_unknown_k;
+}
+
 napi_value runAPI(napi_env env, napi_callback_info info, simsimd_metric_kind_t metric_kind) {
     size_t argc = 2;
     napi_value args[2];
@@ -42,17 +72,9 @@ napi_value runAPI(napi_env env, napi_callback_info info, simsimd_metric_kind_t m
         return NULL;
     }
 
-    simsimd_datatype_t datatype = simsimd_datatype_unknown_k;
-    switch (type_a) {
-    case napi_float32_array: datatype = simsimd_datatype_f32_k; break;
-    case napi_int8_array: datatype = simsimd_datatype_i8_k; break;
-    case napi_uint8_array: datatype = simsimd_datatype_b8_k; break;
-    default: break;
-    }
+    simsimd_datatype_t datatype = typedarray_to_datatype(type_a);
 
-    simsimd_metric_punned_t metric = NULL;
-    simsimd_capability_t capability = simsimd_cap_serial_k;
-    simsimd_find_metric_punned(metric_kind, datatype, static_capabilities, simsimd_cap_any_k, &metric, &capability);
+    simsimd_metric_punned_t metric = simsimd_dispatch_metric_sized(metric_kind, datatype, length_a);
     if (metric == NULL) {
         napi_throw_error(env, NULL, "Unsupported datatype");
         return NULL;
@@ -69,6 +91,372 @@ napi_value runAPI(napi_env env, napi_callback_info info, simsimd_metric_kind_t m
     return js_result;
 }
 
+napi_value topkAPI(napi_env env, napi_callback_info info) {
+    size_t argc = 4;
+    napi_value args[4];
+    napi_status status;
+
+    // Get callback info and ensure the argument count is correct
+    status = napi_get_cb_info(env, info, &argc, args, NULL, NULL);
+    if (status != napi_ok || argc < 3) {
+        napi_throw_error(env, NULL, "Expects a query, a flat matrix, `k`, and an optional metric name");
+        return NULL;
+    }
+
+    // Obtain the typed arrays from the arguments
+    void *data_a, *data_b;
+    size_t length_a, length_b;
+    napi_typedarray_type type_a, type_b;
+    napi_status status_a, status_b;
+    status_a = napi_get_typedarray_info(env, args[0], &type_a, &length_a, &data_a, NULL, NULL);
+    status_b = napi_get_typedarray_info(env, args[1], &type_b, &length_b, &data_b, NULL, NULL);
+    if (status_a != napi_ok || status_b != napi_ok || type_a != type_b || length_a == 0 ||
+        length_b % length_a != 0) {
+        napi_throw_error(env, NULL, "The matrix must be a typed array of the query type, with a multiple of its length");
+        return NULL;
+    }
+    simsimd_datatype_t datatype = typedarray_to_datatype(type_a);
+    if (datatype == simsimd_datatype_unknown_k) {
+        napi_throw_error(env, NULL, "Only `float32`, `int8` and `uint8` arrays are supported in JavaScript bindings");
+        return NULL;
+    }
+
+    uint32_t k;
+    if (napi_get_value_uint32(env, args[2], &k) != napi_ok || k == 0) {
+        napi_throw_error(env, NULL, "The `k` must be a positive integer");
+        return NULL;
+    }
+
+    simsimd_metric_kind_t metric_kind = simsimd_metric_sqeuclidean_k;
+    if (argc > 3) {
+        char metric_name[32];
+        if (napi_get_value_string_utf8(env, args[3], metric_name, sizeof(metric_name), NULL) != napi_ok ||
+            (metric_kind = string_to_metric_kind(metric_name)) == simsimd_metric_unknown_k) {
+            napi_throw_error(env, NULL, "Unsupported metric name");
+            return NULL;
+        }
+    }
+
+    simsimd_metric_punned_t metric = simsimd_dispatch_metric_sized(metric_kind, datatype, length_a);
+    simsimd_batch_punned_t batch = simsimd_dispatch_batch(metric_kind, datatype);
+    if (metric == NULL) {
+        napi_throw_error(env, NULL, "Unsupported datatype");
+        return NULL;
+    }
+
+    // The element sizes of all supported typed arrays match the sizes of the SimSIMD scalars
+    size_t const scalar_size = datatype == simsimd_datatype_f32_k ? sizeof(simsimd_f32_t) : 1;
+    size_t const count = length_b / length_a;
+    size_t const found = k < count ? k : count;
+    simsimd_size_t* indices = found ? malloc(found * sizeof(simsimd_size_t)) : NULL; // Empty for an empty matrix
+    if (found && !indices) {
+        napi_throw_error(env, NULL, "Failed to allocate memory");
+        return NULL;
+    }
+
+    // Export the results into a pair of typed arrays, sorted by increasing distance
+    void *indices_data, *distances_data;
+    napi_value indices_buffer, distances_buffer, indices_array, distances_array, js_result;
+    if (napi_create_arraybuffer(env, found * sizeof(uint32_t), &indices_data, &indices_buffer) != napi_ok ||
+        napi_create_arraybuffer(env, found * sizeof(simsimd_f32_t), &distances_data, &distances_buffer) != napi_ok) {
+        free(indices);
+        return NULL;
+    }
+    simsimd_topk(metric, batch, data_a, data_b, count, length_a * scalar_size, length_a, found, indices,
+                 (simsimd_f32_t*)distances_data);
+    for (size_t i = 0; i != found; ++i)
+        ((uint32_t*)indices_data)[i] = (uint32_t)indices[i];
+    free(indices);
+
+    if (napi_create_typedarray(env, napi_uint32_array, found, indices_buffer, 0, &indices_array) != napi_ok ||
+        napi_create_typedarray(env, napi_float32_array, found, distances_buffer, 0, &distances_array) != napi_ok ||
+        napi_create_object(env, &js_result) != napi_ok ||
+        napi_set_named_property(env, js_result, "indices", indices_array) != napi_ok ||
+        napi_set_named_property(env, js_result, "distances", distances_array) != napi_ok)
+        return NULL;
+
+    return js_result;
+}
+
+/// @brief  State of an asynchronous batch request, shared between the main thread and a libuv worker.
+typedef struct async_batch_t {
+    napi_async_work work;
+    napi_deferred deferred;
+    napi_ref a_ref, b_ref, distances_ref, indices_ref;
+    void const* a;
+    void const* b;
+    size_t a_count, b_count, dimensions, stride;
+    simsimd_metric_punned_t metric;
+    simsimd_batch_punned_t batch;
+    size_t k; ///< Zero for `cdistAsync`, or the number of neighbors to find for `topkAsync`
+    simsimd_f32_t* distances;
+    uint32_t* indices;
+    size_t distances_count;
+    int failed;
+} async_batch_t;
+
+/// @brief  Runs on a libuv worker thread, so it must not call into N-API or touch JavaScript values.
+void async_batch_execute(napi_env env, void* data) {
+    (void)env;
+    async_batch_t* state = (async_batch_t*)data;
+    if (!state->k) {
+        simsimd_many_to_many(state->metric, state->batch, state->a, state->a_count, state->stride, state->b,
+                             state->b_count, state->stride, state->dimensions, state->distances,
+                             state->b_count * sizeof(simsimd_f32_t));
+        return;
+    }
+
+    simsimd_size_t* indices = malloc(state->k * sizeof(simsimd_size_t));
+    if (!indices) {
+        state->failed = 1;
+        return;
+    }
+    simsimd_topk(state->metric, state->batch, state->a, state->b, state->b_count, state->stride, state->dimensions,
+                 state->k, indices, state->distances);
+    for (size_t i = 0; i != state->k; ++i)
+        state->indices[i] = (uint32_t)indices[i];
+    free(indices);
+}
+
+/// @brief  Releases the references to the inputs and the outputs, the async work, and the state itself.
+void async_batch_free(napi_env env, async_batch_t* state) {
+    napi_ref refs[4] = {state->a_ref, state->b_ref, state->distances_ref, state->indices_ref};
+    for (size_t i = 0; i != 4; ++i)
+        if (refs[i])
+            napi_delete_reference(env, refs[i]);
+    if (state->work)
+        napi_delete_async_work(env, state->work);
+    free(state);
+}
+
+/// @brief  Runs back on the main thread, settling the Promise and releasing the inputs and the state.
+void async_batch_complete(napi_env env, napi_status status, void* data) {
+    async_batch_t* state = (async_batch_t*)data;
+    napi_value result = NULL, distances_buffer, distances_array, indices_buffer, indices_array;
+    if (status == napi_ok && !state->failed &&
+        napi_get_reference_value(env, state->distances_ref, &distances_buffer) == napi_ok &&
+        napi_create_typedarray(env, napi_float32_array, state->distances_count, distances_buffer, 0,
+                               &distances_array) == napi_ok) {
+        if (!state->k)
+            result = distances_array;
+        else if (napi_get_reference_value(env, state->indices_ref, &indices_buffer) != napi_ok ||
+                 napi_create_typedarray(env, napi_uint32_array, state->k, indices_buffer, 0, &indices_array) !=
+                     napi_ok ||
+                 napi_create_object(env, &result) != napi_ok ||
+                 napi_set_named_property(env, result, "indices", indices_array) != napi_ok ||
+                 napi_set_named_property(env, result, "distances", distances_array) != napi_ok)
+            result = NULL;
+    }
+
+    if (result)
+        napi_resolve_deferred(env, state->deferred, result);
+    else {
+        napi_value message, error;
+        napi_create_string_utf8(env, "Failed to compute the distances", NAPI_AUTO_LENGTH, &message);
+        napi_create_error(env, NULL, message, &error);
+        napi_reject_deferred(env, state->deferred, error);
+    }
+    async_batch_free(env, state);
+}
+
+/**
+ *  @brief  Validates the arguments shared by `cdistAsync` and `topkAsync`, and queues the work on the
+ *          libuv thread pool. The third argument is the number of dimensions for `cdistAsync`,
+ *          or the number of neighbors for `topkAsync`, where the query defines the dimensions.
+ */
+napi_value queueBatchAPI(napi_env env, napi_callback_info info, int is_topk) {
+    size_t argc = 4;
+    napi_value args[4];
+    napi_status status;
+
+    // Get callback info and ensure the argument count is correct
+    status = napi_get_cb_info(env, info, &argc, args, NULL, NULL);
+    if (status != napi_ok || argc < 3) {
+        napi_throw_error(env, NULL,
+                         is_topk ? "Expects a query, a flat matrix, `k`, and an optional metric name"
+                                 : "Expects two flat matrices, the number of dimensions, and an optional metric name");
+        return NULL;
+    }
+
+    // Obtain the typed arrays from the arguments
+    void *data_a, *data_b;
+    size_t length_a, length_b;
+    napi_typedarray_type type_a, type_b;
+    napi_status status_a, status_b;
+    status_a = napi_get_typedarray_info(env, args[0], &type_a, &length_a, &data_a, NULL, NULL);
+    status_b = napi_get_typedarray_info(env, args[1], &type_b, &length_b, &data_b, NULL, NULL);
+    if (status_a != napi_ok || status_b != napi_ok || type_a != type_b) {
+        napi_throw_error(env, NULL, "Both arguments must be typed arrays of matching types");
+        return NULL;
+    }
+    simsimd_datatype_t datatype = typedarray_to_datatype(type_a);
+    if (datatype == simsimd_datatype_unknown_k) {
+        napi_throw_error(env, NULL, "Only `float32`, `int8` and `uint8` arrays are supported in JavaScript bindings");
+        return NULL;
+    }
+
+    uint32_t count_or_dimensions;
+    if (napi_get_value_uint32(env, args[2], &count_or_dimensions) != napi_ok || count_or_dimensions == 0) {
+        napi_throw_error(env, NULL, is_topk ? "The `k` must be a positive integer"
+                                            : "The number of dimensions must be a positive integer");
+        return NULL;
+    }
+    size_t const dimensions = is_topk ? length_a : count_or_dimensions;
+    if (dimensions == 0 || length_a % dimensions != 0 || length_b % dimensions != 0 || length_b == 0 ||
+        (is_topk && length_a != dimensions)) {
+        napi_throw_error(env, NULL, "The lengths of the arrays must be multiples of the number of dimensions");
+        return NULL;
+    }
+
+    simsimd_metric_kind_t metric_kind = simsimd_metric_sqeuclidean_k;
+    if (argc > 3) {
+        char metric_name[32];
+        if (napi_get_value_string_utf8(env, args[3], metric_name, sizeof(metric_name), NULL) != napi_ok ||
+            (metric_kind = string_to_metric_kind(metric_name)) == simsimd_metric_unknown_k) {
+            napi_throw_error(env, NULL, "Unsupported metric name");
+            return NULL;
+        }
+    }
+
+    simsimd_metric_punned_t metric = simsimd_dispatch_metric_sized(metric_kind, datatype, dimensions);
+    simsimd_batch_punned_t batch = simsimd_dispatch_batch(metric_kind, datatype);
+    if (metric == NULL) {
+        napi_throw_error(env, NULL, "Unsupported datatype");
+        return NULL;
+    }
+
+    async_batch_t* state = calloc(1, sizeof(async_batch_t));
+    if (!state) {
+        napi_throw_error(env, NULL, "Failed to allocate memory");
+        return NULL;
+    }
+
+    // The element sizes of all supported typed arrays match the sizes of the SimSIMD scalars
+    size_t const scalar_size = datatype == simsimd_datatype_f32_k ? sizeof(simsimd_f32_t) : 1;
+    state->a = data_a, state->b = data_b;
+    state->a_count = length_a / dimensions, state->b_count = length_b / dimensions;
+    state->dimensions = dimensions, state->stride = dimensions * scalar_size;
+    state->metric = metric, state->batch = batch;
+    state->k = is_topk ? (count_or_dimensions < state->b_count ? count_or_dimensions : state->b_count) : 0;
+    state->distances_count = is_topk ? state->k : state->a_count * state->b_count;
+
+    // Allocate the outputs on the main thread, so that the worker only fills them, and keep the
+    // inputs referenced, so that the garbage collector doesn't reclaim them until the work is done.
+    // The Promise is created last, so that no failure can leave its deferred unsettled.
+    napi_value promise, resource_name, distances_buffer, indices_buffer;
+    if (napi_create_arraybuffer(env, state->distances_count * sizeof(simsimd_f32_t), (void**)&state->distances,
+                                &distances_buffer) != napi_ok ||
+        (is_topk && napi_create_arraybuffer(env, state->k * sizeof(uint32_t), (void**)&state->indices,
+                                            &indices_buffer) != napi_ok) ||
+        napi_create_reference(env, args[0], 1, &state->a_ref) != napi_ok ||
+        napi_create_reference(env, args[1], 1, &state->b_ref) != napi_ok ||
+        napi_create_reference(env, distances_buffer, 1, &state->distances_ref) != napi_ok ||
+        (is_topk && napi_create_reference(env, indices_buffer, 1, &state->indices_ref) != napi_ok) ||
+        napi_create_string_utf8(env, is_topk ? "simsimd.topkAsync" : "simsimd.cdistAsync", NAPI_AUTO_LENGTH,
+                                &resource_name) != napi_ok ||
+        napi_create_async_work(env, NULL, resource_name, async_batch_execute, async_batch_complete, state,
+                               &state->work) != napi_ok ||
+        napi_create_promise(env, &state->deferred, &promise) != napi_ok) {
+        napi_throw_error(env, NULL, "Failed to schedule the asynchronous work");
+        async_batch_free(env, state);
+        return NULL;
+    }
+
+    // Past this point the Promise has already been created, so failures reject it instead of throwing
+    if (napi_queue_async_work(env, state->work) != napi_ok) {
+        napi_value message, error;
+        napi_create_string_utf8(env, "Failed to schedule the asynchronous work", NAPI_AUTO_LENGTH, &message);
+        napi_create_error(env, NULL, message, &error);
+        napi_reject_deferred(env, state->deferred, error);
+        async_batch_free(env, state);
+    }
+    return promise;
+}
+
+/// @brief  Parses the name of a single capability, like "x86_avx512", or returns zero for unknown ones.
+simsimd_capability_t string_to_capability(char const* name) {
+    for (int bit = 0; bit != 32; ++bit) {
+        char const* candidate = simsimd_capability_name((simsimd_capability_t)(1u << bit));
+        if (candidate && strcmp(candidate, name) == 0)
+            return (simsimd_capability_t)(1u << bit);
+    }
+    return (simsimd_capability_t)0;
+}
+
+napi_value getKernelAPI(napi_env env, napi_callback_info info) {
+    size_t argc = 3;
+    napi_value args[3];
+    if (napi_get_cb_info(env, info, &argc, args, NULL, NULL) != napi_ok || argc < 2) {
+        napi_throw_error(env, NULL, "Expects a metric name, a datatype name, and optional dimensions");
+        return NULL;
+    }
+
+    char metric_name[32], datatype_name[8];
+    simsimd_metric_kind_t metric_kind = simsimd_metric_unknown_k;
+    if (napi_get_value_string_utf8(env, args[0], metric_name, sizeof(metric_name), NULL) != napi_ok ||
+        (metric_kind = string_to_metric_kind(metric_name)) == simsimd_metric_unknown_k) {
+        napi_throw_error(env, NULL, "Unsupported metric name");
+        return NULL;
+    }
+    simsimd_datatype_t datatype = simsimd_datatype_unknown_k;
+    if (napi_get_value_string_utf8(env, args[1], datatype_name, sizeof(datatype_name), NULL) == napi_ok)
+        datatype = strcmp(datatype_name, "f32") == 0  ? simsimd_datatype_f32_k
+                   : strcmp(datatype_name, "i8") == 0 ? simsimd_datatype_i8_k
+                   : strcmp(datatype_name, "b8") == 0 ? simsimd_datatype_b8_k
+                                                      : simsimd_datatype_unknown_k;
+    if (datatype == simsimd_datatype_unknown_k) {
+        napi_throw_error(env, NULL, "Only 'f32', 'i8', and 'b8' datatypes are supported in JavaScript bindings");
+        return NULL;
+    }
+    uint32_t dimensions = 0;
+    if (argc > 2 && napi_get_value_uint32(env, args[2], &dimensions) != napi_ok) {
+        napi_throw_error(env, NULL, "The dimensions must be a positive integer");
+        return NULL;
+    }
+
+    // Report the capability of the kernel, that `runAPI` would use, or `null` for unsupported combinations
+    napi_value js_result;
+    char const* name = simsimd_capability_name(simsimd_dispatch_capability_sized(metric_kind, datatype, dimensions));
+    if ((name ? napi_create_string_utf8(env, name, NAPI_AUTO_LENGTH, &js_result) : napi_get_null(env, &js_result)) !=
+        napi_ok)
+        return NULL;
+    return js_result;
+}
+
+napi_value toggleCapability(napi_env env, napi_callback_info info, int enable) {
+    size_t argc = 1;
+    napi_value args[1];
+    char name[32];
+    simsimd_capability_t capability = 0;
+    if (napi_get_cb_info(env, info, &argc, args, NULL, NULL) != napi_ok || argc != 1 ||
+        napi_get_value_string_utf8(env, args[0], name, sizeof(name), NULL) != napi_ok ||
+        (capability = string_to_capability(name)) == 0) {
+        napi_throw_error(env, NULL, "Expects the name of a capability, like 'x86_avx512'");
+        return NULL;
+    }
+    if (enable && !(simsimd_capabilities() & capability)) {
+        napi_throw_error(env, NULL, "The capability isn't supported by this machine");
+        return NULL;
+    }
+    if (!enable && capability == simsimd_cap_serial_k) {
+        napi_throw_error(env, NULL, "The serial kernels can't be disabled");
+        return NULL;
+    }
+
+    // All the lookups go through the shared dispatch table, so replacing it affects every following call,
+    // while the asynchronous work already running on the worker threads finishes with the old kernels
+    simsimd_capability_t const capabilities = simsimd_dispatch_restrict(
+        (simsimd_capability_t)(enable ? static_capabilities | capability : static_capabilities & ~capability));
+    if (!capabilities) {
+        napi_throw_error(env, NULL, "Too many distinct capability sets were requested");
+        return NULL;
+    }
+    static_capabilities = capabilities;
+    napi_value js_result;
+    napi_get_undefined(env, &js_result);
+    return js_result;
+}
+
 napi_value l2sqAPI(napi_env env, napi_callback_info info) { return runAPI(env, info, simsimd_metric_sqeuclidean_k); }
 napi_value cosAPI(napi_env env, napi_callback_info info) { return runAPI(env, info, simsimd_metric_cosine_k); }
 napi_value ipAPI(napi_env env, napi_callback_info info) { return runAPI(env, info, simsimd_metric_ip_k); }
@@ -76,6 +464,10 @@ napi_value klAPI(napi_env env, napi_callback_info info) { return runAPI(env, inf
 napi_value jsAPI(napi_env env, napi_callback_info info) { return runAPI(env, info, simsimd_metric_js_k); }
 napi_value hammingAPI(napi_env env, napi_callback_info info) { return runAPI(env, info, simsimd_metric_hamming_k); }
 napi_value jaccardAPI(napi_env env, napi_callback_info info) { return runAPI(env, info, simsimd_metric_jaccard_k); }
+napi_value cdistAsyncAPI(napi_env env, napi_callback_info info) { return queueBatchAPI(env, info, 0); }
+napi_value topkAsyncAPI(napi_env env, napi_callback_info info) { return queueBatchAPI(env, info, 1); }
+napi_value enableCapabilityAPI(napi_env env, napi_callback_info info) { return toggleCapability(env, info, 1); }
+napi_value disableCapabilityAPI(napi_env env, napi_callback_info info) { return toggleCapability(env, info, 0); }
 
 napi_value Init(napi_env env, napi_value exports) {
 
@@ -87,15 +479,25 @@ napi_value Init(napi_env env, napi_value exports) {
     napi_property_descriptor jaccardDesc = {"jaccard", 0, jaccardAPI, 0, 0, 0, napi_default, 0};
     napi_property_descriptor klDesc = {"kullbackleibler", 0, klAPI, 0, 0, 0, napi_default, 0};
     napi_property_descriptor jsDesc = {"jensenshannon", 0, jsAPI, 0, 0, 0, napi_default, 0};
+    napi_property_descriptor topkDesc = {"topk", 0, topkAPI, 0, 0, 0, napi_default, 0};
+    napi_property_descriptor cdistAsyncDesc = {"cdistAsync", 0, cdistAsyncAPI, 0, 0, 0, napi_default, 0};
+    napi_property_descriptor topkAsyncDesc = {"topkAsync", 0, topkAsyncAPI, 0, 0, 0, napi_default, 0};
+    napi_property_descriptor getKernelDesc = {"getKernel", 0, getKernelAPI, 0, 0, 0, napi_default, 0};
+    napi_property_descriptor enableDesc = {"enableCapability", 0, enableCapabilityAPI, 0, 0, 0, napi_default, 0};
+    napi_property_descriptor disableDesc = {"disableCapability", 0, disableCapabilityAPI, 0, 0, 0, napi_default, 0};
     napi_property_descriptor properties[] = {
-        sqeuclideanDesc, innerDesc, cosineDesc, hammingDesc, jaccardDesc, klDesc, jsDesc,
+        sqeuclideanDesc, innerDesc,  cosineDesc,  hammingDesc,    jaccardDesc,
+        klDesc,          jsDesc,     topkDesc,    cdistAsyncDesc, topkAsyncDesc,
+        getKernelDesc,   enableDesc, disableDesc,
     };
 
     // Define the properties on the `exports` object
     size_t propertyCount = sizeof(properties) / sizeof(properties[0]);
     napi_define_properties(env, exports, propertyCount, properties);
 
+    // The shared dispatch table fills itself on first use, so just touch it here to pay for that upfront
     static_capabilities = simsimd_capabilities();
+    simsimd_dispatch_table();
     return exports;
 }
 
@@ -42,4 +42,57 @@ module.exports = {
      */
     jaccard: compiled.jaccard,
 
+    /**
+     * @brief Finds the `k` rows of a flat row-major matrix closest to the query vector.
+     * @param {Float32Array|Int8Array|Uint8Array} query - The query vector.
+     * @param {Float32Array|Int8Array|Uint8Array} matrix - The rows to search through, concatenated.
+     * @param {number} k - The maximum number of neighbors to return.
+     * @param {string} [metric='sqeuclidean'] - The name of the metric, like 'cosine' or 'inner'.
+     * @returns {{indices: Uint32Array, distances: Float32Array}} Row indices and distances, closest first.
+     */
+    topk: compiled.topk,
+
+    /**
+     * @brief Computes all pairwise distances between the rows of two flat row-major matrices on the libuv thread pool.
+     *        The input arrays must not be modified until the returned Promise settles.
+     * @param {Float32Array|Int8Array|Uint8Array} a - The rows of the first matrix, concatenated.
+     * @param {Float32Array|Int8Array|Uint8Array} b - The rows of the second matrix, concatenated.
+     * @param {number} dimensions - The number of scalars in every row.
+     * @param {string} [metric='sqeuclidean'] - The name of the metric, like 'cosine' or 'inner'.
+     * @returns {Promise<Float32Array>} Row-major matrix of distances, with a row for every row of `a`.
+     */
+    cdistAsync: compiled.cdistAsync,
+
+    /**
+     * @brief Finds the `k` rows closest to the query like `topk`, but on the libuv thread pool.
+     *        The input arrays must not be modified until the returned Promise settles.
+     * @param {Float32Array|Int8Array|Uint8Array} query - The query vector.
+     * @param {Float32Array|Int8Array|Uint8Array} matrix - The rows to search through, concatenated.
+     * @param {number} k - The maximum number of neighbors to return.
+     * @param {string} [metric='sqeuclidean'] - The name of the metric, like 'cosine' or 'inner'.
+     * @returns {Promise<{indices: Uint32Array, distances: Float32Array}>} Row indices and distances, closest first.
+     */
+    topkAsync: compiled.topkAsync,
+
+    /**
+     * @brief Names the hardware capability of the kernel, that the distance functions use for the given inputs.
+     * @param {string} metric - The name of the metric, like 'cosine' or 'inner'.
+     * @param {string} datatype - The scalar type, 'f32', 'i8', or 'b8'.
+     * @param {number} [dimensions=0] - The number of scalars, as some sizes have dedicated kernels.
+     * @returns {string|null} The capability, like 'x86_avx512' or 'serial', or null if unsupported.
+     */
+    getKernel: compiled.getKernel,
+
+    /**
+     * @brief Allows the kernels relying on a hardware capability again, after `disableCapability`.
+     * @param {string} capability - The name of the capability, like 'x86_avx512'.
+     */
+    enableCapability: compiled.enableCapability,
+
+    /**
+     * @brief Forbids the kernels relying on a hardware capability, to compare the backends.
+     * @param {string} capability - The name of the capability, like 'x86_avx512'.
+     */
+    disableCapability: compiled.disableCapability,
+
 };
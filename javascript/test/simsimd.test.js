@@ -45,3 +45,55 @@ test('Cosine Similarity', () => {
     const result = simsimd.cosine(f32Array1, f32Array2);
     assertAlmostEqual(result, 0.029, 0.01);
 });
+
+test('Top-K Search', () => {
+    const dimensions = 3;
+    const matrix = new Float32Array([...f32Array2, ...f32Array1, 7.0, 8.0, 9.0, 1.0, 2.0, 4.0]);
+    const { indices, distances } = simsimd.topk(f32Array1, matrix, 2);
+    assert.deepEqual(Array.from(indices), [1, 3]);
+    assertAlmostEqual(distances[0], 0.0, 0.01);
+    assertAlmostEqual(distances[1], 1.0, 0.01);
+
+    const all = simsimd.topk(f32Array1, matrix, 10, 'cosine');
+    assert.equal(all.indices.length, matrix.length / dimensions);
+    for (let i = 1; i < all.distances.length; ++i)
+        assert(all.distances[i - 1] <= all.distances[i]);
+
+    const empty = simsimd.topk(f32Array1, new Float32Array(0), 2);
+    assert(empty.indices instanceof Uint32Array && empty.distances instanceof Float32Array);
+    assert.equal(empty.indices.length, 0);
+    assert.equal(empty.distances.length, 0);
+    assert.throws(() => simsimd.topk(f32Array1, matrix, 0));
+});
+
+test('Asynchronous Batch API', async () => {
+    const matrix = new Float32Array([...f32Array2, ...f32Array1, 7.0, 8.0, 9.0, 1.0, 2.0, 4.0]);
+    const distances = await simsimd.cdistAsync(f32Array1, matrix, 3);
+    assert.equal(distances.length, 4);
+    for (let i = 0; i < distances.length; ++i)
+        assertAlmostEqual(distances[i], simsimd.sqeuclidean(f32Array1, matrix.subarray(i * 3, i * 3 + 3)), 0.01);
+
+    const pairwise = await simsimd.cdistAsync(matrix, matrix, 3, 'cosine');
+    assert.equal(pairwise.length, 16);
+    assertAlmostEqual(pairwise[1], simsimd.cosine(f32Array2, f32Array1), 0.01);
+
+    const { indices } = await simsimd.topkAsync(f32Array1, matrix, 2);
+    assert.deepEqual(Array.from(indices), [1, 3]);
+    await assert.rejects(async () => simsimd.cdistAsync(f32Array1, matrix, 2));
+});
+
+test('Kernel Introspection', () => {
+    const best = simsimd.getKernel('cosine', 'f32');
+    assert.equal(typeof best, 'string');
+    assert.equal(simsimd.getKernel('kullbackleibler', 'b8'), null);
+
+    const expected = simsimd.cosine(f32Array1, f32Array2);
+    if (best !== 'serial') {
+        simsimd.disableCapability(best);
+        assert.notEqual(simsimd.getKernel('cosine', 'f32', 768), best);
+        assertAlmostEqual(simsimd.cosine(f32Array1, f32Array2), expected, 0.01);
+        simsimd.enableCapability(best);
+    }
+    assert.equal(simsimd.getKernel('cosine', 'f32'), best);
+    assert.throws(() => simsimd.disableCapability('serial'));
+});
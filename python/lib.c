@@ -24,7 +24,6 @@
 #endif
 
 #define SIMSIMD_RSQRT simsimd_approximate_inverse_square_root
-#define SIMSIMD_LOG simsimd_approximate_log
 #include "simsimd/simsimd.h"
 
 #define PY_SSIZE_T_CLEAN
@@ -36,6 +35,8 @@ typedef struct parsed_vector_or_matrix_t {
     size_t dimensions;
     size_t count;
     size_t stride;
+    Py_ssize_t dimension_stride;
+    size_t scalar_size;
     int is_flat;
     simsimd_datatype_t datatype;
 } parsed_vector_or_matrix_t;
@@ -43,6 +44,47 @@ typedef struct parsed_vector_or_matrix_t {
 /// @brief  Global variable that caches the CPU capabilities, and is computed just onc, when the module is loaded.
 simsimd_capability_t static_capabilities = simsimd_cap_serial_k;
 
+#if defined(__linux__) && defined(_OPENMP)
+/// @brief  Executor for the `simsimd_*_parallel` helpers, that runs the tasks on the OpenMP threads.
+static void executor_openmp(void* executor, simsimd_size_t count, simsimd_task_t task, void* context) {
+    (void)executor;
+#pragma omp parallel for schedule(dynamic)
+    for (simsimd_size_t i = 0; i < count; ++i)
+        task(context, i);
+}
+#elif SIMSIMD_THREAD_POOL
+/// @brief  Pool of all the online cores, spawned on first use and reused by every following call.
+static simsimd_thread_pool_t shared_pool;
+/// @brief  Zero until the `shared_pool` is spawned, one if it's ready, and -1 if it couldn't be spawned.
+static int shared_pool_state = 0;
+
+/// @brief  The workers of the parent aren't copied into a forked child, so it spawns a pool of its own.
+static void forget_shared_pool(void) { shared_pool_state = 0; }
+
+/// @brief  Returns the `shared_pool`, spawning it on first use, or NULL if it can't be spawned.
+///         Must be called with the GIL held, which serializes the first calls.
+static simsimd_thread_pool_t* get_shared_pool(void) {
+    static int fork_handler_registered = 0;
+    if (!fork_handler_registered)
+        fork_handler_registered = pthread_atfork(NULL, NULL, &forget_shared_pool) == 0;
+    if (shared_pool_state == 0)
+        shared_pool_state = simsimd_thread_pool_init(&shared_pool, 0) == 0 ? 1 : -1;
+    return shared_pool_state == 1 ? &shared_pool : NULL;
+}
+
+/// @brief  The `shared_pool` and the number of threads, that a single call may use from it.
+typedef struct capped_pool_t {
+    simsimd_thread_pool_t* pool;
+    size_t threads;
+} capped_pool_t;
+
+/// @brief  Executor for the `simsimd_*_parallel` helpers, that runs the tasks on a part of the `shared_pool`.
+static void executor_capped_pool(void* executor, simsimd_size_t count, simsimd_task_t task, void* context) {
+    capped_pool_t const* capped = (capped_pool_t const*)executor;
+    simsimd_thread_pool_run(capped->pool, capped->threads, count, task, context);
+}
+#endif
+
 int same_string(char const* a, char const* b) { return strcmp(a, b) == 0; }
 
 simsimd_datatype_t numpy_string_to_datatype(char const* name) {
@@ -54,24 +96,32 @@ simsimd_datatype_t numpy_string_to_datatype(char const* name) {
     else if (same_string(name, "b") || same_string(name, "<b") || same_string(name, "i1") || same_string(name, "|i1"))
         return simsimd_datatype_i8_k;
     else if (same_string(name, "B") || same_string(name, "<B") || same_string(name, "u1") || same_string(name, "|u1"))
-        return simsimd_datatype_b8_k;
-    else if (same_string(name, "d") || same_string(name, "<d") || same_string(name, "i8") || same_string(name, "<i8"))
+        return simsimd_datatype_u8_k;
+    else if (same_string(name, "d") || same_string(name, "<d") || same_string(name, "f8") || same_string(name, "<f8"))
         return simsimd_datatype_f64_k;
     else
         return simsimd_datatype_unknown_k;
 }
 
 simsimd_datatype_t python_string_to_datatype(char const* name) {
-    if (same_string(name, "f") || same_string(name, "f32"))
+    if (same_string(name, "f") || same_string(name, "f32") || same_string(name, "float32"))
         return simsimd_datatype_f32_k;
-    else if (same_string(name, "h") || same_string(name, "f16"))
+    else if (same_string(name, "h") || same_string(name, "f16") || same_string(name, "float16"))
         return simsimd_datatype_f16_k;
     else if (same_string(name, "c") || same_string(name, "i8"))
         return simsimd_datatype_i8_k;
     else if (same_string(name, "b") || same_string(name, "b8"))
         return simsimd_datatype_b8_k;
-    else if (same_string(name, "d") || same_string(name, "f64"))
+    else if (same_string(name, "B") || same_string(name, "u8"))
+        return simsimd_datatype_u8_k;
+    else if (same_string(name, "i4x2"))
+        return simsimd_datatype_i4x2_k;
+    else if (same_string(name, "pq8"))
+        return simsimd_datatype_pq8_k;
+    else if (same_string(name, "d") || same_string(name, "f64") || same_string(name, "float64"))
         return simsimd_datatype_f64_k;
+    else if (same_string(name, "bf16"))
+        return simsimd_datatype_bf16_k;
     else
         return simsimd_datatype_unknown_k;
 }
@@ -109,18 +159,168 @@ static PyObject* api_get_capabilities(PyObject* self) {
     ADD_CAP(arm_neon);
     ADD_CAP(arm_sve);
     ADD_CAP(arm_sve2);
+    ADD_CAP(arm_bf16);
+    ADD_CAP(arm_sve_bf16);
+    ADD_CAP(arm_dotprod);
+    ADD_CAP(arm_i8mm);
     ADD_CAP(x86_avx2);
     ADD_CAP(x86_avx512);
     ADD_CAP(x86_avx2fp16);
     ADD_CAP(x86_avx512fp16);
     ADD_CAP(x86_avx512vpopcntdq);
     ADD_CAP(x86_avx512vnni);
+    ADD_CAP(x86_avx512bf16);
+    ADD_CAP(x86_amx_int8);
+    ADD_CAP(x86_amx_bf16);
 
 #undef ADD_CAP
 
     return cap_dict;
 }
 
+/// @brief  Metrics and datatypes reported by the introspection functions, named like the arguments of the others.
+static struct {
+    char const* name;
+    simsimd_metric_kind_t kind;
+} const introspected_metrics[] = {
+    {"inner", simsimd_metric_inner_k},
+    {"cosine", simsimd_metric_cosine_k},
+    {"sqeuclidean", simsimd_metric_sqeuclidean_k},
+    {"hamming", simsimd_metric_hamming_k},
+    {"jaccard", simsimd_metric_jaccard_k},
+    {"kullbackleibler", simsimd_metric_kl_k},
+    {"jensenshannon", simsimd_metric_js_k},
+    {"adc", simsimd_metric_adc_k},
+};
+static struct {
+    char const* name;
+    simsimd_datatype_t datatype;
+} const introspected_datatypes[] = {
+    {"f64", simsimd_datatype_f64_k},   {"f32", simsimd_datatype_f32_k},   {"f16", simsimd_datatype_f16_k},
+    {"bf16", simsimd_datatype_bf16_k}, {"i8", simsimd_datatype_i8_k},     {"b8", simsimd_datatype_b8_k},
+    {"u8", simsimd_datatype_u8_k},     {"i4x2", simsimd_datatype_i4x2_k}, {"pq8", simsimd_datatype_pq8_k},
+};
+
+/// @brief  Builds a dictionary of dictionaries, mapping every metric and datatype to the value, that the
+///         `entry` callback produces, skipping the pairs, for which it returns NULL without an error.
+static PyObject* build_introspection(PyObject* (*entry)(simsimd_metric_kind_t, simsimd_datatype_t, void*),
+                                     void* context) {
+    PyObject* metrics_dict = PyDict_New();
+    if (!metrics_dict)
+        return NULL;
+    size_t const metrics_count = sizeof(introspected_metrics) / sizeof(introspected_metrics[0]);
+    size_t const datatypes_count = sizeof(introspected_datatypes) / sizeof(introspected_datatypes[0]);
+    for (size_t i = 0; i != metrics_count; ++i) {
+        PyObject* datatypes_dict = PyDict_New();
+        if (!datatypes_dict)
+            goto failed;
+        for (size_t j = 0; j != datatypes_count; ++j) {
+            PyObject* value = entry(introspected_metrics[i].kind, introspected_datatypes[j].datatype, context);
+            if (!value && PyErr_Occurred()) {
+                Py_DECREF(datatypes_dict);
+                goto failed;
+            }
+            if (value) {
+                PyDict_SetItemString(datatypes_dict, introspected_datatypes[j].name, value);
+                Py_DECREF(value);
+            }
+        }
+        if (PyDict_Size(datatypes_dict))
+            PyDict_SetItemString(metrics_dict, introspected_metrics[i].name, datatypes_dict);
+        Py_DECREF(datatypes_dict);
+    }
+    return metrics_dict;
+
+failed:
+    Py_DECREF(metrics_dict);
+    return NULL;
+}
+
+static PyObject* kernel_entry(simsimd_metric_kind_t kind, simsimd_datatype_t datatype, void* context) {
+    simsimd_size_t const dimensions = *(simsimd_size_t const*)context;
+    char const* name = simsimd_capability_name(simsimd_dispatch_capability_sized(kind, datatype, dimensions));
+    return name ? PyUnicode_FromString(name) : NULL;
+}
+
+static PyObject* api_get_kernels(PyObject* self, PyObject* args, PyObject* kwargs) {
+    static char* keywords[] = {"dimensions", NULL};
+    Py_ssize_t dimensions = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|n", keywords, &dimensions))
+        return NULL;
+    simsimd_size_t context = dimensions > 0 ? (simsimd_size_t)dimensions : 0;
+    return build_introspection(&kernel_entry, &context);
+}
+
+/// @brief  Parses the name of a single capability, as reported by `get_capabilities`, or sets an exception.
+static simsimd_capability_t parse_capability(PyObject* args) {
+    char const* name;
+    if (!PyArg_ParseTuple(args, "s", &name))
+        return (simsimd_capability_t)0;
+    for (int bit = 0; bit != 32; ++bit) {
+        char const* candidate = simsimd_capability_name((simsimd_capability_t)(1u << bit));
+        if (candidate && same_string(candidate, name))
+            return (simsimd_capability_t)(1u << bit);
+    }
+    PyErr_Format(PyExc_ValueError, "unknown capability '%s'", name);
+    return (simsimd_capability_t)0;
+}
+
+static PyObject* api_enable_capability(PyObject* self, PyObject* args) {
+    simsimd_capability_t capability = parse_capability(args);
+    if (!capability)
+        return NULL;
+    if (!(simsimd_capabilities() & capability)) {
+        PyErr_SetString(PyExc_ValueError, "the capability isn't supported by this machine");
+        return NULL;
+    }
+    // A new table is published atomically, so kernels running with the GIL released finish with the old one
+    simsimd_capability_t const capabilities =
+        simsimd_dispatch_restrict((simsimd_capability_t)(static_capabilities | capability));
+    if (!capabilities) {
+        PyErr_SetString(PyExc_RuntimeError, "too many distinct capability sets were requested");
+        return NULL;
+    }
+    static_capabilities = capabilities;
+    Py_RETURN_NONE;
+}
+
+static PyObject* api_disable_capability(PyObject* self, PyObject* args) {
+    simsimd_capability_t capability = parse_capability(args);
+    if (!capability)
+        return NULL;
+    if (capability == simsimd_cap_serial_k) {
+        PyErr_SetString(PyExc_ValueError, "the serial kernels can't be disabled");
+        return NULL;
+    }
+    // A new table is published atomically, so kernels running with the GIL released finish with the old one
+    simsimd_capability_t const capabilities =
+        simsimd_dispatch_restrict((simsimd_capability_t)(static_capabilities & ~capability));
+    if (!capabilities) {
+        PyErr_SetString(PyExc_RuntimeError, "too many distinct capability sets were requested");
+        return NULL;
+    }
+    static_capabilities = capabilities;
+    Py_RETURN_NONE;
+}
+
+#if SIMSIMD_DISPATCH_COUNTERS
+static PyObject* counters_entry(simsimd_metric_kind_t kind, simsimd_datatype_t datatype, void* context) {
+    simsimd_kernel_counters_t counters = simsimd_dispatch_counters(kind, datatype, *(int const*)context);
+    if (!counters.calls)
+        return NULL;
+    return Py_BuildValue("{s:K,s:K,s:K}", "calls", (unsigned long long)counters.calls, "vectors",
+                         (unsigned long long)counters.vectors, "bytes", (unsigned long long)counters.bytes);
+}
+
+static PyObject* api_get_counters(PyObject* self, PyObject* args, PyObject* kwargs) {
+    static char* keywords[] = {"reset", NULL};
+    int reset = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|p", keywords, &reset))
+        return NULL;
+    return build_introspection(&counters_entry, &reset);
+}
+#endif // SIMSIMD_DISPATCH_COUNTERS
+
 int parse_tensor(PyObject* tensor, Py_buffer* buffer, parsed_vector_or_matrix_t* parsed) {
     if (PyObject_GetBuffer(tensor, buffer, PyBUF_STRIDES | PyBUF_FORMAT) != 0) {
         PyErr_SetString(PyExc_TypeError, "arguments must support buffer protocol");
@@ -128,26 +328,19 @@ int parse_tensor(PyObject* tensor, Py_buffer* buffer, parsed_vector_or_matrix_t*
     }
     parsed->start = buffer->buf;
     parsed->datatype = numpy_string_to_datatype(buffer->format);
+    parsed->scalar_size = buffer->itemsize;
     if (buffer->ndim == 1) {
-        if (buffer->strides[0] > buffer->itemsize) {
-            PyErr_SetString(PyExc_ValueError, "input vectors must be contiguous");
-            PyBuffer_Release(buffer);
-            return -1;
-        }
         parsed->is_flat = 1;
         parsed->dimensions = buffer->shape[0];
         parsed->count = 1;
         parsed->stride = 0;
+        parsed->dimension_stride = buffer->strides[0];
     } else if (buffer->ndim == 2) {
-        if (buffer->strides[1] > buffer->itemsize) {
-            PyErr_SetString(PyExc_ValueError, "input vectors must be contiguous");
-            PyBuffer_Release(buffer);
-            return -1;
-        }
         parsed->is_flat = 0;
         parsed->dimensions = buffer->shape[1];
         parsed->count = buffer->shape[0];
         parsed->stride = buffer->strides[0];
+        parsed->dimension_stride = buffer->strides[1];
     } else {
         PyErr_SetString(PyExc_ValueError, "input tensors must be 1D or 2D");
         PyBuffer_Release(buffer);
@@ -156,21 +349,248 @@ int parse_tensor(PyObject* tensor, Py_buffer* buffer, parsed_vector_or_matrix_t*
     return 0;
 }
 
-static PyObject* impl_metric(simsimd_metric_kind_t metric_kind, PyObject* const* args, Py_ssize_t nargs) {
+/// @brief  Checks if the scalars of every row are adjacent in memory, so the kernels can consume them directly.
+static int is_contiguous(parsed_vector_or_matrix_t const* parsed) {
+    return parsed->dimensions < 2 || parsed->dimension_stride == (Py_ssize_t)parsed->scalar_size;
+}
+
+/// @brief  Number of rows of a tensor, that are passed to the kernels at once. Strided rows, like column slices
+///         or transposed views, are gathered into contiguous blocks of about `SIMSIMD_BATCH_TILE_BYTES`, but at
+///         least `SIMSIMD_TOPK_CHUNK` rows, so that the packing is amortized over many pairs of rows.
+static size_t packing_block_rows(parsed_vector_or_matrix_t const* parsed) {
+    if (is_contiguous(parsed))
+        return parsed->count;
+    size_t const row_bytes = parsed->dimensions * parsed->scalar_size;
+    size_t rows = row_bytes ? SIMSIMD_BATCH_TILE_BYTES / row_bytes : parsed->count;
+    if (rows < SIMSIMD_TOPK_CHUNK)
+        rows = SIMSIMD_TOPK_CHUNK;
+    return rows < parsed->count ? rows : parsed->count;
+}
+
+/// @brief  Allocates the scratch space for gathering up to `rows` rows of a strided tensor,
+///         or leaves it NULL for contiguous tensors, that don't need any packing.
+static int allocate_scratch(parsed_vector_or_matrix_t const* parsed, size_t rows, char** scratch) {
+    *scratch = NULL;
+    if (is_contiguous(parsed))
+        return 0;
+    if (rows > parsed->count)
+        rows = parsed->count;
+    *scratch = malloc((rows ? rows : 1) * parsed->dimensions * parsed->scalar_size);
+    if (!*scratch) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+}
+
+/// @brief  Returns a view of `rows` consecutive rows starting from `first_row`. Strided rows are gathered into the
+///         contiguous `scratch` buffer, while for contiguous tensors the pointer is just shifted.
+static parsed_vector_or_matrix_t rows_view(parsed_vector_or_matrix_t const* parsed, size_t first_row, size_t rows,
+                                           char* scratch) {
+    parsed_vector_or_matrix_t view = *parsed;
+    view.count = rows;
+    view.start = parsed->start + first_row * parsed->stride;
+    if (!scratch)
+        return view;
+
+    // Broadcasted vectors have a zero stride, and are gathered just once
+    size_t const scalar_size = parsed->scalar_size;
+    size_t const row_bytes = parsed->dimensions * scalar_size;
+    size_t const gathered = parsed->stride ? rows : 1;
+    for (size_t i = 0; i != gathered; ++i) {
+        char const* source = view.start + i * parsed->stride;
+        char* target = scratch + i * row_bytes;
+        switch (scalar_size) {
+        case 1:
+            for (size_t j = 0; j != parsed->dimensions; ++j)
+                target[j] = source[(Py_ssize_t)j * parsed->dimension_stride];
+            break;
+        case 2:
+            for (size_t j = 0; j != parsed->dimensions; ++j)
+                memcpy(target + j * 2, source + (Py_ssize_t)j * parsed->dimension_stride, 2);
+            break;
+        case 4:
+            for (size_t j = 0; j != parsed->dimensions; ++j)
+                memcpy(target + j * 4, source + (Py_ssize_t)j * parsed->dimension_stride, 4);
+            break;
+        case 8:
+            for (size_t j = 0; j != parsed->dimensions; ++j)
+                memcpy(target + j * 8, source + (Py_ssize_t)j * parsed->dimension_stride, 8);
+            break;
+        default:
+            for (size_t j = 0; j != parsed->dimensions; ++j)
+                memcpy(target + j * scalar_size, source + (Py_ssize_t)j * parsed->dimension_stride, scalar_size);
+            break;
+        }
+    }
+    view.start = scratch;
+    view.stride = parsed->stride ? row_bytes : 0;
+    view.dimension_stride = (Py_ssize_t)scalar_size;
+    return view;
+}
+
+/// @brief  Finds the `k` closest of `rows` rows starting from `first_row`, like `simsimd_topk`, gathering strided
+///         rows into the `scratch` buffer of `SIMSIMD_TOPK_CHUNK` rows one chunk at a time.
+static size_t topk_rows(simsimd_metric_punned_t metric, simsimd_batch_punned_t batch, char const* query,
+                        parsed_vector_or_matrix_t const* parsed, size_t first_row, size_t rows, size_t k,
+                        simsimd_size_t* indices, float* distances, char* scratch) {
+    if (!scratch)
+        return simsimd_topk(metric, batch, query, parsed->start + first_row * parsed->stride, rows, parsed->stride,
+                            parsed->dimensions, k, indices, distances);
+
+    float chunk_distances[SIMSIMD_TOPK_CHUNK];
+    simsimd_size_t size = 0;
+    for (size_t chunk_start = 0; chunk_start < rows; chunk_start += SIMSIMD_TOPK_CHUNK) {
+        size_t const chunk_length = rows - chunk_start < SIMSIMD_TOPK_CHUNK ? rows - chunk_start : SIMSIMD_TOPK_CHUNK;
+        parsed_vector_or_matrix_t chunk = rows_view(parsed, first_row + chunk_start, chunk_length, scratch);
+        simsimd_one_to_many(metric, batch, query, chunk.start, chunk_length, chunk.stride, parsed->dimensions,
+                            chunk_distances);
+        for (size_t j = 0; j != chunk_length; ++j)
+            simsimd_topk_push(indices, distances, &size, k, chunk_start + j, chunk_distances[j]);
+    }
+    simsimd_topk_sort(indices, distances, size);
+    return size;
+}
+
+/// @brief  Index of the calling thread, to pick its own part of the scratch space inside of OpenMP loops.
+static size_t scratch_slot(void) {
+#if defined(__linux__) && defined(_OPENMP)
+    return (size_t)omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+/// @brief  Number of threads, that may run the OpenMP loops, each needing its own part of the scratch space.
+static size_t scratch_slots(size_t threads) {
+#if defined(__linux__) && defined(_OPENMP)
+    size_t const max_threads = (size_t)omp_get_max_threads();
+    return max_threads > threads ? max_threads : threads;
+#else
+    return threads;
+#endif
+}
+
+/// @brief  NumPy has no bit-packed type, so the `uint8` arrays, that are `u8` vectors for the spatial metrics,
+///         are reinterpreted as `b8` bitsets for the binary metrics, and as `pq8` codes for `adc`.
+static void reinterpret_bytes(simsimd_metric_kind_t metric_kind, parsed_vector_or_matrix_t* parsed) {
+    int const bitwise = metric_kind == simsimd_metric_hamming_k || metric_kind == simsimd_metric_jaccard_k;
+    if (parsed->datatype != simsimd_datatype_u8_k)
+        return;
+    if (bitwise)
+        parsed->datatype = simsimd_datatype_b8_k;
+    else if (metric_kind == simsimd_metric_adc_k)
+        parsed->datatype = simsimd_datatype_pq8_k;
+}
+
+/// @brief  Bumps the counters of the kernels, that compute `pairs` distances between the rows of the inputs.
+static void count_kernel_use(simsimd_metric_kind_t metric_kind, parsed_vector_or_matrix_t const* a,
+                             parsed_vector_or_matrix_t const* b, size_t pairs) {
+    size_t const rows = b ? a->count + b->count : a->count;
+    simsimd_dispatch_count(metric_kind, a->datatype, pairs, rows * a->dimensions * a->scalar_size);
+}
+
+/// @brief  Maps the datatype of the distances into the NumPy type number, or -1 if it can't hold them.
+static int datatype_to_numpy_type(simsimd_datatype_t datatype) {
+    switch (datatype) {
+    case simsimd_datatype_f64_k: return NPY_FLOAT64;
+    case simsimd_datatype_f32_k: return NPY_FLOAT32;
+    case simsimd_datatype_f16_k: return NPY_FLOAT16;
+    default: return -1;
+    }
+}
+
+/// @brief  Parses the optional `out=` and `dtype=` arguments of the distance functions. The `out` can be any
+///         writable object supporting the buffer protocol, and its format defines the datatype of the distances,
+///         unless `dtype` is also passed, in which case they must match. The datatype defaults to `f32`.
+int parse_output(PyObject* out_obj, PyObject* dtype_obj, Py_buffer* buffer, simsimd_datatype_t* datatype) {
+    *datatype = simsimd_datatype_f32_k;
+    buffer->obj = NULL;
+    if (dtype_obj) {
+        char const* dtype_str = PyUnicode_AsUTF8(dtype_obj);
+        if (!dtype_str) {
+            PyErr_SetString(PyExc_TypeError, "Expected 'dtype' to be a string");
+            return -1;
+        }
+        *datatype = python_string_to_datatype(dtype_str);
+        if (datatype_to_numpy_type(*datatype) < 0) {
+            PyErr_SetString(PyExc_ValueError, "Unsupported 'dtype', expected 'f16', 'f32', or 'f64'");
+            return -1;
+        }
+    }
+    if (!out_obj || out_obj == Py_None)
+        return 0;
+    if (PyObject_GetBuffer(out_obj, buffer, PyBUF_STRIDES | PyBUF_FORMAT | PyBUF_WRITABLE) != 0) {
+        PyErr_SetString(PyExc_TypeError, "'out' must be a writable buffer");
+        buffer->obj = NULL;
+        return -1;
+    }
+    simsimd_datatype_t out_datatype = numpy_string_to_datatype(buffer->format);
+    if (datatype_to_numpy_type(out_datatype) < 0 || (dtype_obj && out_datatype != *datatype)) {
+        PyErr_SetString(PyExc_ValueError, "'out' must be a buffer of 'f16', 'f32', or 'f64' matching the 'dtype'");
+        PyBuffer_Release(buffer);
+        buffer->obj = NULL;
+        return -1;
+    }
+    *datatype = out_datatype;
+    return 0;
+}
+
+/// @brief  Writes the `f32` distances into the output buffer of the requested datatype, transposing them,
+///         if the inputs were swapped to match the arguments order of a mixed-precision kernel.
+void export_distances(float const* distances, size_t rows, size_t columns, int transpose, char* target,
+                      Py_ssize_t row_stride, Py_ssize_t column_stride, simsimd_datatype_t datatype) {
+    for (size_t i = 0; i != rows; ++i)
+        for (size_t j = 0; j != columns; ++j) {
+            float distance = distances[i * columns + j];
+            char* slot = transpose ? target + (Py_ssize_t)j * row_stride + (Py_ssize_t)i * column_stride
+                                   : target + (Py_ssize_t)i * row_stride + (Py_ssize_t)j * column_stride;
+            switch (datatype) {
+            case simsimd_datatype_f64_k: *(double*)slot = distance; break;
+            case simsimd_datatype_f16_k: *(simsimd_f16_t*)slot = SIMSIMD_COMPRESS_F16(distance); break;
+            default: *(float*)slot = distance; break;
+            }
+        }
+}
+
+static PyObject* impl_metric(simsimd_metric_kind_t metric_kind, PyObject* const* args, Py_ssize_t nargs,
+                             PyObject* kwnames) {
     if (nargs != 2) {
-        PyErr_SetString(PyExc_TypeError, "function expects exactly 2 arguments");
+        PyErr_SetString(PyExc_TypeError, "function expects exactly 2 positional arguments");
         return NULL;
     }
 
+    // The keyword arguments of `METH_FASTCALL` functions follow the positional ones
+    PyObject* out_obj = NULL;
+    PyObject* dtype_obj = NULL;
+    Py_ssize_t const kwargs_count = kwnames ? PyTuple_Size(kwnames) : 0;
+    for (Py_ssize_t i = 0; i != kwargs_count; ++i) {
+        char const* name = PyUnicode_AsUTF8(PyTuple_GetItem(kwnames, i));
+        if (name && same_string(name, "out"))
+            out_obj = args[nargs + i];
+        else if (name && same_string(name, "dtype"))
+            dtype_obj = args[nargs + i];
+        else {
+            PyErr_SetString(PyExc_TypeError, "function only accepts 'out' and 'dtype' keyword arguments");
+            return NULL;
+        }
+    }
+
     PyObject* output = NULL;
     PyObject* input_tensor_a = args[0];
     PyObject* input_tensor_b = args[1];
-    Py_buffer buffer_a, buffer_b;
+    char *a_scratch = NULL, *b_scratch = NULL;
+    Py_buffer buffer_a, buffer_b, buffer_out;
     parsed_vector_or_matrix_t parsed_a, parsed_b;
     if (parse_tensor(input_tensor_a, &buffer_a, &parsed_a) != 0 ||
         parse_tensor(input_tensor_b, &buffer_b, &parsed_b) != 0) {
         return NULL; // Error already set by parse_tensor
     }
+    reinterpret_bytes(metric_kind, &parsed_a);
+    reinterpret_bytes(metric_kind, &parsed_b);
+    simsimd_datatype_t out_datatype;
+    if (parse_output(out_obj, dtype_obj, &buffer_out, &out_datatype) != 0)
+        goto cleanup;
 
     // Check dimensions
     if (parsed_a.dimensions != parsed_b.dimensions) {
@@ -193,69 +613,134 @@ static PyObject* impl_metric(simsimd_metric_kind_t metric_kind, PyObject* const*
         goto cleanup;
     }
 
-    simsimd_metric_punned_t metric = NULL;
-    simsimd_capability_t capability = simsimd_cap_serial_k;
     simsimd_datatype_t datatype = parsed_a.datatype;
-    simsimd_find_metric_punned(metric_kind, datatype, static_capabilities, simsimd_cap_any_k, &metric, &capability);
+    simsimd_metric_punned_t metric = simsimd_dispatch_metric_sized(metric_kind, datatype, parsed_a.dimensions);
     if (!metric) {
         PyErr_SetString(PyExc_ValueError, "unsupported metric and datatype combination");
         goto cleanup;
     }
 
+    // In some batch requests we may be computing the distance from multiple vectors to one,
+    // so the stride must be set to zero avoid illegal memory access
+    if (parsed_a.count == 1)
+        parsed_a.stride = 0;
+    if (parsed_b.count == 1)
+        parsed_b.stride = 0;
+
+    // Strided operands are gathered into contiguous blocks, shared by both of them
+    size_t const count_max = parsed_a.count > parsed_b.count ? parsed_a.count : parsed_b.count;
+    count_kernel_use(metric_kind, &parsed_a, &parsed_b, count_max);
+    size_t block_rows = count_max;
+    if (parsed_a.count > 1 && packing_block_rows(&parsed_a) < block_rows)
+        block_rows = packing_block_rows(&parsed_a);
+    if (parsed_b.count > 1 && packing_block_rows(&parsed_b) < block_rows)
+        block_rows = packing_block_rows(&parsed_b);
+    if (allocate_scratch(&parsed_a, block_rows, &a_scratch) != 0 ||
+        allocate_scratch(&parsed_b, block_rows, &b_scratch) != 0)
+        goto cleanup;
+
     // If the distance is computed between two vectors, rather than matrices, return a scalar
     if (parsed_a.is_flat && parsed_b.is_flat) {
-        output = PyFloat_FromDouble(metric(parsed_a.start, parsed_b.start, parsed_a.dimensions, parsed_b.dimensions));
+        if (buffer_out.obj) {
+            PyErr_SetString(PyExc_ValueError, "'out' is only supported for batches of vectors");
+            goto cleanup;
+        }
+        parsed_vector_or_matrix_t vector_a = rows_view(&parsed_a, 0, 1, a_scratch);
+        parsed_vector_or_matrix_t vector_b = rows_view(&parsed_b, 0, 1, b_scratch);
+        output = PyFloat_FromDouble(metric(vector_a.start, vector_b.start, parsed_a.dimensions, parsed_b.dimensions));
     } else {
 
-        // In some batch requests we may be computing the distance from multiple vectors to one,
-        // so the stride must be set to zero avoid illegal memory access
-        if (parsed_a.count == 1)
-            parsed_a.stride = 0;
-        if (parsed_b.count == 1)
-            parsed_b.stride = 0;
-
-        size_t count_max = parsed_a.count > parsed_b.count ? parsed_a.count : parsed_b.count;
-
-        // Compute the distances
-        float* distances = malloc(count_max * sizeof(float));
-        for (size_t i = 0; i < count_max; ++i)
-            distances[i] = metric(                    //
-                parsed_a.start + i * parsed_a.stride, //
-                parsed_b.start + i * parsed_b.stride, //
-                parsed_a.dimensions,                  //
-                parsed_b.dimensions);
-
-        // Create a new PyArray object for the output
-        npy_intp dims[1] = {count_max};
-        PyArray_Descr* descr = PyArray_DescrFromType(NPY_FLOAT32);
-        PyArrayObject* output_array = (PyArrayObject*)PyArray_NewFromDescr( //
-            &PyArray_Type, descr, 1, dims, NULL, distances, NPY_ARRAY_OWNDATA | NPY_ARRAY_C_CONTIGUOUS, NULL);
-
-        if (!output_array) {
-            free(distances);
+        // When one of the arguments is a single vector, it can be kept in registers by the batch kernels,
+        // but only for symmetric metrics, if it's the second argument
+        int broadcast_a = parsed_a.count == 1 && parsed_b.count > 1;
+        int broadcast_b = parsed_b.count == 1 && parsed_a.count > 1 && metric_kind != simsimd_metric_kl_k;
+        simsimd_batch_punned_t batch =
+            broadcast_a || broadcast_b ? simsimd_dispatch_batch(metric_kind, datatype) : NULL;
+
+        // Write straight into the output buffer, if it's a contiguous `f32` array, or convert afterwards
+        PyObject* output_array = NULL;
+        char* target;
+        Py_ssize_t target_stride;
+        if (buffer_out.obj) {
+            if (buffer_out.ndim != 1 || (size_t)buffer_out.shape[0] != count_max) {
+                PyErr_SetString(PyExc_ValueError, "'out' must be a vector with a slot for every pair");
+                goto cleanup;
+            }
+            target = buffer_out.buf, target_stride = buffer_out.strides[0];
+        } else {
+            npy_intp dims[1] = {count_max};
+            output_array = PyArray_SimpleNew(1, dims, datatype_to_numpy_type(out_datatype));
+            if (!output_array)
+                goto cleanup;
+            target = PyArray_DATA((PyArrayObject*)output_array);
+            target_stride = PyArray_ITEMSIZE((PyArrayObject*)output_array);
+        }
+        int const in_place = out_datatype == simsimd_datatype_f32_k && target_stride == sizeof(float);
+        float* distances = in_place ? (float*)target : malloc(count_max * sizeof(float));
+        if (!distances) {
+            Py_XDECREF(output_array);
+            PyErr_NoMemory();
             goto cleanup;
         }
 
+        // Compute the distances without holding the GIL, as the buffers are pinned until they are released
+        Py_BEGIN_ALLOW_THREADS;
+        for (size_t block_start = 0; block_start < count_max; block_start += block_rows) {
+            size_t const block_length = count_max - block_start < block_rows ? count_max - block_start : block_rows;
+            parsed_vector_or_matrix_t block_a = rows_view(&parsed_a, block_start, block_length, a_scratch);
+            parsed_vector_or_matrix_t block_b = rows_view(&parsed_b, block_start, block_length, b_scratch);
+            float* block_distances = distances + block_start;
+            if (batch && broadcast_a)
+                simsimd_one_to_many(metric, batch, block_a.start, block_b.start, block_length, block_b.stride,
+                                    parsed_a.dimensions, block_distances);
+            else if (batch && broadcast_b)
+                simsimd_one_to_many(metric, batch, block_b.start, block_a.start, block_length, block_a.stride,
+                                    parsed_a.dimensions, block_distances);
+            else
+                for (size_t i = 0; i < block_length; ++i)
+                    block_distances[i] = metric(            //
+                        block_a.start + i * block_a.stride, //
+                        block_b.start + i * block_b.stride, //
+                        parsed_a.dimensions,                //
+                        parsed_b.dimensions);
+        }
+
+        if (!in_place) {
+            export_distances(distances, count_max, 1, 0, target, target_stride, 0, out_datatype);
+            free(distances);
+        }
+        Py_END_ALLOW_THREADS;
+        if (!output_array)
+            Py_INCREF(out_obj), output_array = out_obj;
         output = output_array;
     }
 
 cleanup:
+    free(a_scratch), free(b_scratch);
     PyBuffer_Release(&buffer_a);
     PyBuffer_Release(&buffer_b);
+    if (buffer_out.obj)
+        PyBuffer_Release(&buffer_out);
     return output;
 }
 
 static PyObject* impl_cdist(                            //
     PyObject* input_tensor_a, PyObject* input_tensor_b, //
-    simsimd_metric_kind_t metric_kind, size_t threads) {
+    simsimd_metric_kind_t metric_kind, size_t threads, PyObject* out_obj, PyObject* dtype_obj) {
 
     PyObject* output = NULL;
-    Py_buffer buffer_a, buffer_b;
+    char *a_scratch = NULL, *b_scratch = NULL;
+    Py_buffer buffer_a, buffer_b, buffer_out;
     parsed_vector_or_matrix_t parsed_a, parsed_b;
     if (parse_tensor(input_tensor_a, &buffer_a, &parsed_a) != 0 ||
         parse_tensor(input_tensor_b, &buffer_b, &parsed_b) != 0) {
         return NULL; // Error already set by parse_tensor
     }
+    reinterpret_bytes(metric_kind, &parsed_a);
+    reinterpret_bytes(metric_kind, &parsed_b);
+    simsimd_datatype_t out_datatype;
+    if (parse_output(out_obj, dtype_obj, &buffer_out, &out_datatype) != 0)
+        goto cleanup;
 
     // Check dimensions
     if (parsed_a.dimensions != parsed_b.dimensions) {
@@ -267,126 +752,1323 @@ static PyObject* impl_cdist(                            //
         goto cleanup;
     }
 
-    // Check data types
-    if (parsed_a.datatype != parsed_b.datatype && parsed_a.datatype != simsimd_datatype_unknown_k &&
-        parsed_b.datatype != simsimd_datatype_unknown_k) {
-        PyErr_SetString(PyExc_ValueError, "input tensors must have matching and supported datatypes");
-        goto cleanup;
-    }
-
+    // Check data types, different ones are only supported by the mixed-precision kernels,
+    // which exist for just one order of arguments, so the inputs may have to be swapped
+    int const mixed = parsed_a.datatype != parsed_b.datatype && parsed_a.datatype != simsimd_datatype_unknown_k &&
+                      parsed_b.datatype != simsimd_datatype_unknown_k;
+    int swapped = 0;
     simsimd_metric_punned_t metric = NULL;
-    simsimd_capability_t capability = simsimd_cap_serial_k;
+    if (mixed) {
+        simsimd_capability_t capability;
+        simsimd_find_mixed_metric_punned(metric_kind, parsed_a.datatype, parsed_b.datatype, static_capabilities,
+                                         simsimd_cap_any_k, &metric, &capability);
+        if (!metric) {
+            simsimd_find_mixed_metric_punned(metric_kind, parsed_b.datatype, parsed_a.datatype,
+                                             static_capabilities, simsimd_cap_any_k, &metric, &capability);
+            swapped = metric != NULL;
+        }
+        if (!metric) {
+            PyErr_SetString(PyExc_ValueError, "unsupported metric for mismatched datatypes");
+            goto cleanup;
+        }
+        if (swapped) {
+            parsed_vector_or_matrix_t parsed_first = parsed_b;
+            parsed_b = parsed_a, parsed_a = parsed_first;
+        }
+    } else {
+        metric = simsimd_dispatch_metric_sized(metric_kind, parsed_a.datatype, parsed_a.dimensions);
+        if (!metric) {
+            PyErr_SetString(PyExc_ValueError, "unsupported metric and datatype combination");
+            goto cleanup;
+        }
+    }
     simsimd_datatype_t datatype = parsed_a.datatype;
-    simsimd_find_metric_punned(metric_kind, datatype, static_capabilities, simsimd_cap_any_k, &metric, &capability);
-    if (!metric) {
-        PyErr_SetString(PyExc_ValueError, "unsupported metric and datatype combination");
+    count_kernel_use(metric_kind, &parsed_a, &parsed_b, parsed_a.count * parsed_b.count);
+
+    // Strided operands are gathered into contiguous blocks of rows, that are compared pairwise
+    size_t const a_block_rows = packing_block_rows(&parsed_a);
+    size_t const b_block_rows = packing_block_rows(&parsed_b);
+    if (allocate_scratch(&parsed_a, a_block_rows, &a_scratch) != 0 ||
+        allocate_scratch(&parsed_b, b_block_rows, &b_scratch) != 0)
         goto cleanup;
-    }
 
     // If the distance is computed between two vectors, rather than matrices, return a scalar
     if (parsed_a.is_flat && parsed_b.is_flat) {
-        output = PyFloat_FromDouble(metric(parsed_a.start, parsed_b.start, parsed_a.dimensions, parsed_b.dimensions));
+        if (buffer_out.obj) {
+            PyErr_SetString(PyExc_ValueError, "'out' is only supported for matrices");
+            goto cleanup;
+        }
+        parsed_vector_or_matrix_t vector_a = rows_view(&parsed_a, 0, 1, a_scratch);
+        parsed_vector_or_matrix_t vector_b = rows_view(&parsed_b, 0, 1, b_scratch);
+        output = PyFloat_FromDouble(metric(vector_a.start, vector_b.start, parsed_a.dimensions, parsed_b.dimensions));
     } else {
 
-#ifdef __linux__
-#ifdef _OPENMP
+        // Write straight into the output matrix, if it has contiguous `f32` rows and the inputs weren't swapped,
+        // or convert afterwards. The output rows always match the rows of the first argument.
+        size_t const rows = swapped ? parsed_b.count : parsed_a.count;
+        size_t const columns = swapped ? parsed_a.count : parsed_b.count;
+        PyObject* output_array = NULL;
+        char* target;
+        Py_ssize_t target_row_stride, target_column_stride;
+        if (buffer_out.obj) {
+            if (buffer_out.ndim != 2 || (size_t)buffer_out.shape[0] != rows ||
+                (size_t)buffer_out.shape[1] != columns) {
+                PyErr_SetString(PyExc_ValueError, "'out' must be a matrix with a row per vector of the first argument");
+                goto cleanup;
+            }
+            target = buffer_out.buf;
+            target_row_stride = buffer_out.strides[0], target_column_stride = buffer_out.strides[1];
+        } else {
+            npy_intp dims[2] = {rows, columns};
+            output_array = PyArray_SimpleNew(2, dims, datatype_to_numpy_type(out_datatype));
+            if (!output_array)
+                goto cleanup;
+            target = PyArray_DATA((PyArrayObject*)output_array);
+            target_column_stride = PyArray_ITEMSIZE((PyArrayObject*)output_array);
+            target_row_stride = columns * target_column_stride;
+        }
+        int const in_place = !swapped && out_datatype == simsimd_datatype_f32_k &&
+                             target_column_stride == sizeof(float) && target_row_stride > 0;
+        float* distances = in_place ? (float*)target : malloc(parsed_a.count * parsed_b.count * sizeof(float));
+        size_t const distances_stride = in_place ? (size_t)target_row_stride : parsed_b.count * sizeof(float);
+        if (!distances) {
+            Py_XDECREF(output_array);
+            PyErr_NoMemory();
+            goto cleanup;
+        }
+
+#if !(defined(__linux__) && defined(_OPENMP)) && SIMSIMD_THREAD_POOL
+        capped_pool_t capped_pool = {threads != 1 ? get_shared_pool() : NULL, threads};
+#endif
+        // Nothing below touches Python objects, so other interpreter threads can run while the distances
+        // are computed. The rows are split into slices by the shared `simsimd_many_to_many_parallel` helpers,
+        // that run on OpenMP threads where it's available, or on the shared POSIX thread pool otherwise
+        Py_BEGIN_ALLOW_THREADS;
+        simsimd_executor_t executor = NULL;
+        void* executor_context = NULL;
+#if defined(__linux__) && defined(_OPENMP)
         if (threads == 0)
             threads = omp_get_num_procs();
         omp_set_num_threads(threads);
+        executor = &executor_openmp;
+#elif SIMSIMD_THREAD_POOL
+        if (capped_pool.pool)
+            executor = &executor_capped_pool, executor_context = &capped_pool;
 #endif
-#endif
-        // Compute the distances
-        float* distances = malloc(parsed_a.count * parsed_b.count * sizeof(float));
-#pragma omp parallel for collapse(2)
-        for (size_t i = 0; i < parsed_a.count; ++i)
-            for (size_t j = 0; j < parsed_b.count; ++j)
-                distances[i * parsed_b.count + j] = metric( //
-                    parsed_a.start + i * parsed_a.stride,   //
-                    parsed_b.start + j * parsed_b.stride,   //
-                    parsed_a.dimensions,                    //
-                    parsed_b.dimensions);
-
-        // Create a new PyArray object for the output
-        npy_intp dims[2] = {parsed_a.count, parsed_b.count};
-        PyArray_Descr* descr = PyArray_DescrFromType(NPY_FLOAT32);
-        PyArrayObject* output_array = (PyArrayObject*)PyArray_NewFromDescr( //
-            &PyArray_Type, descr, 2, dims, NULL, distances, NPY_ARRAY_OWNDATA | NPY_ARRAY_C_CONTIGUOUS, NULL);
-
-        if (!output_array) {
-            free(distances);
-            goto cleanup;
+
+        // Tile-based matrix kernels, like the AMX ones, compute whole blocks of the output at once, but waste
+        // most of the work on collections smaller than a tile, that are better served by the batch kernels
+        simsimd_matrix_punned_t const matrix = !mixed && parsed_a.count >= 16 && parsed_b.count >= 16
+                                                   ? simsimd_dispatch_matrix(metric_kind, datatype)
+                                                   : NULL;
+
+        // Cosine distances between two collections are cheaper with cached inverse norms, as every pair
+        // then needs just a dot product, but only the floating-point kernels have a separate inner product
+        int const normalize = !mixed && !matrix && metric_kind == simsimd_metric_cos_k && parsed_a.count > 1 &&
+                              parsed_b.count > 1 &&
+                              (datatype == simsimd_datatype_f64_k || datatype == simsimd_datatype_f32_k ||
+                               datatype == simsimd_datatype_f16_k || datatype == simsimd_datatype_bf16_k);
+        simsimd_metric_punned_t ip = normalize ? simsimd_dispatch_metric(simsimd_metric_ip_k, datatype) : NULL;
+        float* inverse_norms = ip ? malloc((a_block_rows + b_block_rows) * sizeof(float)) : NULL;
+        float* a_inverse_norms = inverse_norms;
+        float* b_inverse_norms = inverse_norms ? inverse_norms + a_block_rows : NULL;
+
+        // Divergences between two collections are cheaper with cached entropies and logarithms, as every
+        // pair then needs just a dot product for Kullback-Leibler, and one logarithm per dimension for Jensen–Shannon
+        int const cache_logs = !mixed && (metric_kind == simsimd_metric_kl_k || metric_kind == simsimd_metric_js_k) &&
+                               parsed_a.count > 1 && parsed_b.count > 1 &&
+                               (datatype == simsimd_datatype_f64_k || datatype == simsimd_datatype_f32_k ||
+                                datatype == simsimd_datatype_f16_k);
+        size_t const log_size = datatype == simsimd_datatype_f64_k ? sizeof(double) : sizeof(float);
+        size_t const logs_stride = metric_kind == simsimd_metric_kl_k ? parsed_b.dimensions * log_size : 0;
+        simsimd_divergence_term_punned_t log_kernel = NULL;
+        if (cache_logs)
+            log_kernel = metric_kind == simsimd_metric_js_k ? simsimd_dispatch_js_mixture(datatype)
+                                                            : simsimd_dispatch_cross_entropy(datatype);
+        double* entropies = log_kernel ? malloc((a_block_rows + b_block_rows) * sizeof(double)) : NULL;
+        void* b_logs = entropies && logs_stride ? malloc(b_block_rows * logs_stride) : NULL;
+        if (entropies && logs_stride && !b_logs)
+            free(entropies), entropies = NULL;
+        double* a_entropies = entropies;
+        double* b_entropies = entropies ? entropies + a_block_rows : NULL;
+
+        simsimd_batch_punned_t batch =
+            mixed ? NULL : simsimd_dispatch_batch(inverse_norms ? simsimd_metric_ip_k : metric_kind, datatype);
+
+        // Compute the distances between every pair of blocks, tiling every slice of rows against the second one.
+        // Without strided operands both collections fit into a single block, and the caches are only filled once.
+        size_t const dimensions = parsed_a.dimensions;
+        for (size_t a_start = 0; a_start < parsed_a.count; a_start += a_block_rows) {
+            size_t const a_length = parsed_a.count - a_start < a_block_rows ? parsed_a.count - a_start : a_block_rows;
+            parsed_vector_or_matrix_t block_a = rows_view(&parsed_a, a_start, a_length, a_scratch);
+            if (inverse_norms)
+                simsimd_inverse_norms(datatype, block_a.start, a_length, block_a.stride, dimensions, a_inverse_norms);
+            if (entropies)
+                simsimd_log_terms(datatype, block_a.start, a_length, block_a.stride, dimensions, NULL, a_entropies);
+
+            for (size_t b_start = 0; b_start < parsed_b.count; b_start += b_block_rows) {
+                size_t const b_length =
+                    parsed_b.count - b_start < b_block_rows ? parsed_b.count - b_start : b_block_rows;
+                parsed_vector_or_matrix_t block_b = rows_view(&parsed_b, b_start, b_length, b_scratch);
+                int const b_cached = a_start != 0 && b_length == parsed_b.count;
+                if (inverse_norms && !b_cached)
+                    simsimd_inverse_norms(datatype, block_b.start, b_length, block_b.stride, dimensions,
+                                          b_inverse_norms);
+                if (entropies && !b_cached)
+                    simsimd_log_terms(datatype, block_b.start, b_length, block_b.stride, dimensions, b_logs,
+                                      b_entropies);
+
+                simsimd_f32_t* block_distances =
+                    (simsimd_f32_t*)((char*)distances + a_start * distances_stride) + b_start;
+                if (matrix)
+                    simsimd_matrix_parallel(                           //
+                        executor, executor_context, matrix,            //
+                        block_a.start, a_length, block_a.stride,       //
+                        block_b.start, b_length, block_b.stride,       //
+                        dimensions, block_distances, distances_stride);
+                else if (b_logs)
+                    simsimd_many_to_many_kl_cached_parallel(                  //
+                        executor, executor_context, log_kernel,               //
+                        block_a.start, a_entropies, a_length, block_a.stride, //
+                        b_logs, b_length, logs_stride,                        //
+                        dimensions, block_distances, distances_stride);
+                else if (entropies)
+                    simsimd_many_to_many_js_cached_parallel(                  //
+                        executor, executor_context, log_kernel,               //
+                        block_a.start, a_entropies, a_length, block_a.stride, //
+                        block_b.start, b_entropies, b_length, block_b.stride, //
+                        dimensions, block_distances, distances_stride);
+                else if (inverse_norms)
+                    simsimd_many_to_many_normalized_parallel(                     //
+                        executor, executor_context, ip, batch,                    //
+                        block_a.start, a_inverse_norms, a_length, block_a.stride, //
+                        block_b.start, b_inverse_norms, b_length, block_b.stride, //
+                        dimensions, block_distances, distances_stride);
+                else
+                    simsimd_many_to_many_parallel(                 //
+                        executor, executor_context, metric, batch, //
+                        block_a.start, a_length, block_a.stride,   //
+                        block_b.start, b_length, block_b.stride,   //
+                        dimensions, block_distances, distances_stride);
+            }
         }
+        free(inverse_norms);
+        free(entropies);
+        free(b_logs);
 
+        // Convert the distances into the output datatype, transposing them back, if the inputs were swapped
+        if (!in_place) {
+            export_distances(distances, parsed_a.count, parsed_b.count, swapped, target, target_row_stride,
+                             target_column_stride, out_datatype);
+            free(distances);
+        }
+        Py_END_ALLOW_THREADS;
+        if (!output_array)
+            Py_INCREF(out_obj), output_array = out_obj;
         output = output_array;
     }
 
 cleanup:
+    free(a_scratch), free(b_scratch);
     PyBuffer_Release(&buffer_a);
     PyBuffer_Release(&buffer_b);
+    if (buffer_out.obj)
+        PyBuffer_Release(&buffer_out);
     return output;
 }
 
-static PyObject* impl_pointer(simsimd_metric_kind_t metric_kind, PyObject* args) {
-    char const* type_name = PyUnicode_AsUTF8(PyTuple_GetItem(args, 0));
-    if (!type_name) {
-        PyErr_SetString(PyExc_ValueError, "Invalid type name");
-        return NULL;
+static PyObject* impl_pdist(PyObject* input_tensor, simsimd_metric_kind_t metric_kind, size_t threads,
+                            PyObject* out_obj, PyObject* dtype_obj) {
+
+    PyObject* output = NULL;
+    char* scratch = NULL;
+    Py_buffer buffer, buffer_out;
+    parsed_vector_or_matrix_t parsed;
+    if (parse_tensor(input_tensor, &buffer, &parsed) != 0)
+        return NULL; // Error already set by parse_tensor
+    reinterpret_bytes(metric_kind, &parsed);
+    simsimd_datatype_t out_datatype;
+    if (parse_output(out_obj, dtype_obj, &buffer_out, &out_datatype) != 0)
+        goto cleanup;
+
+    // Only the upper triangle is computed, so the lower one must mirror it
+    if (parsed.is_flat) {
+        PyErr_SetString(PyExc_ValueError, "input must be a matrix with a row per vector");
+        goto cleanup;
+    }
+    if (metric_kind == simsimd_metric_kl_k) {
+        PyErr_SetString(PyExc_ValueError, "'pdist' requires a symmetric metric, use 'cdist' for divergences");
+        goto cleanup;
+    }
+    simsimd_datatype_t const datatype = parsed.datatype;
+    simsimd_metric_punned_t const metric = simsimd_dispatch_metric_sized(metric_kind, datatype, parsed.dimensions);
+    if (!metric) {
+        PyErr_SetString(PyExc_ValueError, "unsupported metric and datatype combination");
+        goto cleanup;
     }
 
-    simsimd_datatype_t datatype = python_string_to_datatype(type_name);
-    if (!type_name) {
-        PyErr_SetString(PyExc_ValueError, "Unsupported type");
-        return NULL;
+    // Every row is compared against all of the following ones, so strided rows are gathered all at once
+    if (allocate_scratch(&parsed, parsed.count, &scratch) != 0)
+        goto cleanup;
+    parsed_vector_or_matrix_t const rows = rows_view(&parsed, 0, parsed.count, scratch);
+
+    // Write straight into the condensed output, if it has contiguous `f32` entries, or convert afterwards
+    size_t const count = parsed.count;
+    size_t const pairs = count * (count ? count - 1 : 0) / 2;
+    count_kernel_use(metric_kind, &parsed, NULL, pairs);
+    PyObject* output_array = NULL;
+    char* target;
+    Py_ssize_t target_stride;
+    if (buffer_out.obj) {
+        if (buffer_out.ndim != 1 || (size_t)buffer_out.shape[0] != pairs) {
+            PyErr_SetString(PyExc_ValueError, "'out' must be a vector with a slot per pair of rows");
+            goto cleanup;
+        }
+        target = buffer_out.buf;
+        target_stride = buffer_out.strides[0];
+    } else {
+        npy_intp dims[1] = {pairs};
+        output_array = PyArray_SimpleNew(1, dims, datatype_to_numpy_type(out_datatype));
+        if (!output_array)
+            goto cleanup;
+        target = PyArray_DATA((PyArrayObject*)output_array);
+        target_stride = PyArray_ITEMSIZE((PyArrayObject*)output_array);
+    }
+    int const in_place = out_datatype == simsimd_datatype_f32_k && target_stride == sizeof(float);
+    float* distances = in_place ? (float*)target : malloc((pairs ? pairs : 1) * sizeof(float));
+    if (!distances) {
+        Py_XDECREF(output_array);
+        PyErr_NoMemory();
+        goto cleanup;
     }
 
-    simsimd_metric_punned_t metric = NULL;
-    simsimd_capability_t capability = simsimd_cap_serial_k;
-    simsimd_find_metric_punned(metric_kind, datatype, static_capabilities, simsimd_cap_any_k, &metric, &capability);
-    if (metric == NULL) {
-        PyErr_SetString(PyExc_ValueError, "No such metric");
-        return NULL;
+#if !(defined(__linux__) && defined(_OPENMP)) && SIMSIMD_THREAD_POOL
+    capped_pool_t capped_pool = {threads != 1 ? get_shared_pool() : NULL, threads};
+#endif
+    // Like in `cdist`, the GIL is released, and the triangle is split into balanced slices of rows
+    Py_BEGIN_ALLOW_THREADS;
+    simsimd_executor_t executor = NULL;
+    void* executor_context = NULL;
+#if defined(__linux__) && defined(_OPENMP)
+    if (threads == 0)
+        threads = omp_get_num_procs();
+    omp_set_num_threads(threads);
+    executor = &executor_openmp;
+#elif SIMSIMD_THREAD_POOL
+    if (capped_pool.pool)
+        executor = &executor_capped_pool, executor_context = &capped_pool;
+#endif
+    simsimd_batch_punned_t const batch = simsimd_dispatch_batch(metric_kind, datatype);
+    simsimd_pdist_parallel(executor, executor_context, metric, batch, rows.start, count, rows.stride,
+                           parsed.dimensions, distances);
+    if (!in_place) {
+        export_distances(distances, 1, pairs, 0, target, 0, target_stride, out_datatype);
+        free(distances);
     }
+    Py_END_ALLOW_THREADS;
+    if (!output_array)
+        Py_INCREF(out_obj), output_array = out_obj;
+    output = output_array;
 
-    return PyLong_FromUnsignedLongLong((unsigned long long)metric);
+cleanup:
+    free(scratch);
+    PyBuffer_Release(&buffer);
+    if (buffer_out.obj)
+        PyBuffer_Release(&buffer_out);
+    return output;
 }
 
-static PyObject* api_cdist(PyObject* self, PyObject* args, PyObject* kwargs) {
-    PyObject *input_tensor_a, *input_tensor_b;
-    PyObject* metric_obj = NULL;
-    PyObject* threads_obj = NULL;
+static PyObject* impl_topk(                             //
+    PyObject* input_tensor_a, PyObject* input_tensor_b, //
+    size_t k, simsimd_metric_kind_t metric_kind, size_t threads) {
 
-    if (!PyTuple_Check(args) || PyTuple_Size(args) < 2) {
-        PyErr_SetString(PyExc_TypeError, "function expects at least 2 positional arguments");
-        return NULL;
+    PyObject* output = NULL;
+    char* scratch = NULL;
+    Py_buffer buffer_a, buffer_b;
+    parsed_vector_or_matrix_t parsed_a, parsed_b;
+    if (parse_tensor(input_tensor_a, &buffer_a, &parsed_a) != 0 ||
+        parse_tensor(input_tensor_b, &buffer_b, &parsed_b) != 0) {
+        return NULL; // Error already set by parse_tensor
     }
+    reinterpret_bytes(metric_kind, &parsed_a);
+    reinterpret_bytes(metric_kind, &parsed_b);
 
-    input_tensor_a = PyTuple_GetItem(args, 0);
-    input_tensor_b = PyTuple_GetItem(args, 1);
-    if (PyTuple_Size(args) > 2)
-        metric_obj = PyTuple_GetItem(args, 2);
-    if (PyTuple_Size(args) > 3)
-        threads_obj = PyTuple_GetItem(args, 3);
+    // Check dimensions
+    if (parsed_a.dimensions != parsed_b.dimensions) {
+        PyErr_SetString(PyExc_ValueError, "vector dimensions don't match");
+        goto cleanup;
+    }
+    if (parsed_a.count == 0 || parsed_b.count == 0) {
+        PyErr_SetString(PyExc_ValueError, "collections can't be empty");
+        goto cleanup;
+    }
 
-    // Checking for named arguments in kwargs
-    if (kwargs) {
-        if (!metric_obj) {
-            metric_obj = PyDict_GetItemString(kwargs, "metric");
-        } else if (PyDict_GetItemString(kwargs, "metric")) {
-            PyErr_SetString(PyExc_TypeError, "Duplicate argument for 'metric'");
-            return NULL;
-        }
+    // Check data types
+    if (parsed_a.datatype != parsed_b.datatype && parsed_a.datatype != simsimd_datatype_unknown_k &&
+        parsed_b.datatype != simsimd_datatype_unknown_k) {
+        PyErr_SetString(PyExc_ValueError, "input tensors must have matching and supported datatypes");
+        goto cleanup;
+    }
 
-        if (!threads_obj) {
-            threads_obj = PyDict_GetItemString(kwargs, "threads");
-        } else if (PyDict_GetItemString(kwargs, "threads")) {
-            PyErr_SetString(PyExc_TypeError, "Duplicate argument for 'threads'");
-            return NULL;
-        }
+    simsimd_datatype_t datatype = parsed_a.datatype;
+    simsimd_metric_punned_t metric = simsimd_dispatch_metric_sized(metric_kind, datatype, parsed_a.dimensions);
+    if (!metric) {
+        PyErr_SetString(PyExc_ValueError, "unsupported metric and datatype combination");
+        goto cleanup;
     }
 
-    // Process the PyObject values
-    simsimd_metric_kind_t metric_kind = simsimd_metric_l2sq_k;
-    if (metric_obj) {
+    simsimd_batch_punned_t batch = simsimd_dispatch_batch(metric_kind, datatype);
+    count_kernel_use(metric_kind, &parsed_a, &parsed_b, parsed_a.count * parsed_b.count);
+
+#ifdef __linux__
+#ifdef _OPENMP
+    if (threads == 0)
+        threads = omp_get_num_procs();
+    omp_set_num_threads(threads);
+#endif
+#endif
+    if (threads == 0)
+        threads = 1;
+
+    size_t const found = k < parsed_b.count ? k : parsed_b.count;
+    simsimd_size_t* indices = malloc(parsed_a.count * found * sizeof(simsimd_size_t));
+    float* distances = malloc(parsed_a.count * found * sizeof(float));
+    if (!indices || !distances) {
+        free(indices), free(distances);
+        PyErr_NoMemory();
+        goto cleanup;
+    }
+
+    // Every thread gathers the strided query and chunks of strided rows into its own slot of the scratch space
+    size_t const a_slot_bytes = is_contiguous(&parsed_a) ? 0 : parsed_a.dimensions * parsed_a.scalar_size;
+    size_t const b_slot_bytes =
+        is_contiguous(&parsed_b) ? 0 : SIMSIMD_TOPK_CHUNK * parsed_b.dimensions * parsed_b.scalar_size;
+    size_t const slot_bytes = a_slot_bytes + b_slot_bytes;
+    if (slot_bytes && !(scratch = malloc(scratch_slots(threads) * slot_bytes))) {
+        free(indices), free(distances);
+        PyErr_NoMemory();
+        goto cleanup;
+    }
+
+    if (parsed_a.count > 1 || threads <= 1) {
+        // Every query gets its own heap, and independent queries are processed in parallel
+        Py_BEGIN_ALLOW_THREADS;
+#pragma omp parallel for schedule(dynamic)
+        for (size_t i = 0; i < parsed_a.count; ++i) {
+            char* slot = scratch ? scratch + scratch_slot() * slot_bytes : NULL;
+            char const* query = rows_view(&parsed_a, i, 1, a_slot_bytes ? slot : NULL).start;
+            topk_rows(metric, batch, query, &parsed_b, 0, parsed_b.count, found, indices + i * found,
+                      distances + i * found, b_slot_bytes ? slot + a_slot_bytes : NULL);
+        }
+        Py_END_ALLOW_THREADS;
+    } else {
+        // A single query is scanned by all threads, each keeping its own heap over a slice of rows,
+        // later merged into the final one
+        size_t const rows_per_slice = (parsed_b.count + threads - 1) / threads;
+        simsimd_size_t* slice_indices = malloc(threads * found * sizeof(simsimd_size_t));
+        float* slice_distances = malloc(threads * found * sizeof(float));
+        simsimd_size_t* slice_founds = malloc(threads * sizeof(simsimd_size_t));
+        if (!slice_indices || !slice_distances || !slice_founds) {
+            free(slice_indices), free(slice_distances), free(slice_founds);
+            free(indices), free(distances);
+            PyErr_NoMemory();
+            goto cleanup;
+        }
+        Py_BEGIN_ALLOW_THREADS;
+#pragma omp parallel for schedule(static)
+        for (size_t slice = 0; slice < threads; ++slice) {
+            size_t const first_row = slice * rows_per_slice;
+            size_t const slice_rows = first_row >= parsed_b.count ? 0
+                                      : parsed_b.count - first_row < rows_per_slice ? parsed_b.count - first_row
+                                                                                   : rows_per_slice;
+            char* slot = scratch ? scratch + scratch_slot() * slot_bytes : NULL;
+            char const* query = rows_view(&parsed_a, 0, 1, a_slot_bytes ? slot : NULL).start;
+            slice_founds[slice] = topk_rows(                                           //
+                metric, batch, query, &parsed_b, first_row, slice_rows,                //
+                found, slice_indices + slice * found, slice_distances + slice * found, //
+                b_slot_bytes ? slot + a_slot_bytes : NULL);
+            for (size_t j = 0; j != slice_founds[slice]; ++j)
+                slice_indices[slice * found + j] += first_row;
+        }
+        simsimd_size_t merged = 0;
+        for (size_t slice = 0; slice < threads; ++slice)
+            for (size_t j = 0; j != slice_founds[slice]; ++j)
+                simsimd_topk_push(indices, distances, &merged, found, slice_indices[slice * found + j],
+                                  slice_distances[slice * found + j]);
+        simsimd_topk_sort(indices, distances, merged);
+        Py_END_ALLOW_THREADS;
+        free(slice_indices), free(slice_distances), free(slice_founds);
+    }
+
+    // Create a pair of PyArray objects for the output, flat for a single query vector
+    npy_intp dims[2] = {parsed_a.count, found};
+    int const ndim = parsed_a.is_flat ? 1 : 2;
+    npy_intp* shape = parsed_a.is_flat ? dims + 1 : dims;
+    PyObject* indices_array = PyArray_NewFromDescr(                                  //
+        &PyArray_Type, PyArray_DescrFromType(NPY_UINT64), ndim, shape, NULL, indices, //
+        NPY_ARRAY_OWNDATA | NPY_ARRAY_C_CONTIGUOUS, NULL);
+    if (!indices_array) {
+        free(indices), free(distances);
+        goto cleanup;
+    }
+    PyObject* distances_array = PyArray_NewFromDescr(                                   //
+        &PyArray_Type, PyArray_DescrFromType(NPY_FLOAT32), ndim, shape, NULL, distances, //
+        NPY_ARRAY_OWNDATA | NPY_ARRAY_C_CONTIGUOUS, NULL);
+    if (!distances_array) {
+        free(distances);
+        Py_DECREF(indices_array);
+        goto cleanup;
+    }
+
+    output = PyTuple_Pack(2, indices_array, distances_array);
+    Py_DECREF(indices_array);
+    Py_DECREF(distances_array);
+
+cleanup:
+    free(scratch);
+    PyBuffer_Release(&buffer_a);
+    PyBuffer_Release(&buffer_b);
+    return output;
+}
+
+static PyObject* impl_radius(                           //
+    PyObject* input_tensor_a, PyObject* input_tensor_b, //
+    simsimd_f32_t max_distance, simsimd_metric_kind_t metric_kind) {
+
+    PyObject* output = NULL;
+    char *a_scratch = NULL, *b_scratch = NULL;
+    Py_buffer buffer_a, buffer_b;
+    parsed_vector_or_matrix_t parsed_a, parsed_b;
+    if (parse_tensor(input_tensor_a, &buffer_a, &parsed_a) != 0 ||
+        parse_tensor(input_tensor_b, &buffer_b, &parsed_b) != 0) {
+        return NULL; // Error already set by parse_tensor
+    }
+    reinterpret_bytes(metric_kind, &parsed_a);
+    reinterpret_bytes(metric_kind, &parsed_b);
+
+    // Check dimensions
+    if (parsed_a.dimensions != parsed_b.dimensions) {
+        PyErr_SetString(PyExc_ValueError, "vector dimensions don't match");
+        goto cleanup;
+    }
+    if (parsed_a.count != 1) {
+        PyErr_SetString(PyExc_ValueError, "expected a single query vector");
+        goto cleanup;
+    }
+
+    // Check data types
+    if (parsed_a.datatype != parsed_b.datatype && parsed_a.datatype != simsimd_datatype_unknown_k &&
+        parsed_b.datatype != simsimd_datatype_unknown_k) {
+        PyErr_SetString(PyExc_ValueError, "input tensors must have matching and supported datatypes");
+        goto cleanup;
+    }
+
+    simsimd_datatype_t datatype = parsed_a.datatype;
+    simsimd_metric_punned_t metric = simsimd_dispatch_metric_sized(metric_kind, datatype, parsed_a.dimensions);
+    if (!metric) {
+        PyErr_SetString(PyExc_ValueError, "unsupported metric and datatype combination");
+        goto cleanup;
+    }
+
+    simsimd_batch_punned_t batch = simsimd_dispatch_batch(metric_kind, datatype);
+    simsimd_bounded_batch_punned_t bounded = simsimd_dispatch_bounded_batch(metric_kind, datatype);
+    count_kernel_use(metric_kind, &parsed_a, &parsed_b, parsed_b.count);
+
+    // The number of matches is unknown in advance, so allocate for the worst case
+    size_t const capacity = parsed_b.count ? parsed_b.count : 1;
+    simsimd_size_t* indices = malloc(capacity * sizeof(simsimd_size_t));
+    float* distances = malloc(capacity * sizeof(float));
+    if (!indices || !distances) {
+        free(indices), free(distances);
+        PyErr_NoMemory();
+        goto cleanup;
+    }
+
+    // Strided rows are gathered into contiguous blocks, and the indices of the matches are shifted accordingly
+    size_t const block_rows = packing_block_rows(&parsed_b);
+    if (allocate_scratch(&parsed_a, 1, &a_scratch) != 0 || allocate_scratch(&parsed_b, block_rows, &b_scratch) != 0) {
+        free(indices), free(distances);
+        goto cleanup;
+    }
+
+    npy_intp found = 0;
+    Py_BEGIN_ALLOW_THREADS;
+    char const* query = rows_view(&parsed_a, 0, 1, a_scratch).start;
+    for (size_t block_start = 0; block_start < parsed_b.count; block_start += block_rows) {
+        size_t const block_length =
+            parsed_b.count - block_start < block_rows ? parsed_b.count - block_start : block_rows;
+        parsed_vector_or_matrix_t block = rows_view(&parsed_b, block_start, block_length, b_scratch);
+        size_t const block_found =
+            simsimd_range(metric, batch, bounded, query, block.start, block_length, block.stride, parsed_a.dimensions,
+                          max_distance, indices + found, distances + found);
+        for (size_t j = 0; j != block_found; ++j)
+            indices[found + j] += block_start;
+        found += (npy_intp)block_found;
+    }
+    Py_END_ALLOW_THREADS;
+
+    PyObject* indices_array = PyArray_SimpleNew(1, &found, NPY_UINT64);
+    PyObject* distances_array = PyArray_SimpleNew(1, &found, NPY_FLOAT32);
+    if (!indices_array || !distances_array) {
+        Py_XDECREF(indices_array);
+        Py_XDECREF(distances_array);
+        free(indices), free(distances);
+        goto cleanup;
+    }
+    memcpy(PyArray_DATA((PyArrayObject*)indices_array), indices, found * sizeof(simsimd_size_t));
+    memcpy(PyArray_DATA((PyArrayObject*)distances_array), distances, found * sizeof(float));
+    free(indices), free(distances);
+
+    output = PyTuple_Pack(2, indices_array, distances_array);
+    Py_DECREF(indices_array);
+    Py_DECREF(distances_array);
+
+cleanup:
+    free(a_scratch), free(b_scratch);
+    PyBuffer_Release(&buffer_a);
+    PyBuffer_Release(&buffer_b);
+    return output;
+}
+
+#if SIMSIMD_MMAP
+static PyObject* impl_scan(                                             //
+    char const* path, PyObject* input_tensor, size_t k,                 //
+    simsimd_metric_kind_t metric_kind, size_t threads, int with_headers) {
+
+    PyObject* output = NULL;
+    char* scratch = NULL;
+    Py_buffer buffer;
+    parsed_vector_or_matrix_t parsed;
+    if (parse_tensor(input_tensor, &buffer, &parsed) != 0)
+        return NULL; // Error already set by parse_tensor
+    reinterpret_bytes(metric_kind, &parsed);
+
+    // The rows of the file must have the same datatype and dimensions as the queries
+    simsimd_datatype_t const datatype = parsed.datatype;
+    simsimd_metric_punned_t const metric = simsimd_dispatch_metric_sized(metric_kind, datatype, parsed.dimensions);
+    if (!metric) {
+        PyErr_SetString(PyExc_ValueError, "unsupported metric and datatype combination");
+        goto cleanup;
+    }
+    if (parsed.count == 0) {
+        PyErr_SetString(PyExc_ValueError, "queries can't be empty");
+        goto cleanup;
+    }
+    simsimd_mmap_dataset_t dataset;
+    int const status = simsimd_mmap_dataset_open(&dataset, path, parsed.scalar_size, parsed.dimensions, with_headers);
+    if (status == -1) {
+        PyErr_SetFromErrnoWithFilename(PyExc_OSError, path);
+        goto cleanup;
+    }
+    if (status != 0) {
+        PyErr_SetString(PyExc_ValueError, "file size or row headers don't match the dimensions of the queries");
+        goto cleanup;
+    }
+
+    if (allocate_scratch(&parsed, parsed.count, &scratch) != 0) {
+        simsimd_mmap_dataset_close(&dataset);
+        goto cleanup;
+    }
+    parsed_vector_or_matrix_t const queries = rows_view(&parsed, 0, parsed.count, scratch);
+    size_t const found = k < dataset.count ? k : dataset.count;
+    simsimd_dispatch_count(metric_kind, datatype, parsed.count * dataset.count, dataset.bytes);
+    simsimd_size_t* indices = malloc(parsed.count * found * sizeof(simsimd_size_t));
+    float* distances = malloc(parsed.count * found * sizeof(float));
+    if (!indices || !distances) {
+        free(indices), free(distances);
+        simsimd_mmap_dataset_close(&dataset);
+        PyErr_NoMemory();
+        goto cleanup;
+    }
+
+#if !(defined(__linux__) && defined(_OPENMP)) && SIMSIMD_THREAD_POOL
+    capped_pool_t capped_pool = {threads != 1 ? get_shared_pool() : NULL, threads};
+#endif
+    // Like in `pdist`, the GIL is released, and the file is split into contiguous slices of chunks
+    simsimd_size_t scanned;
+    Py_BEGIN_ALLOW_THREADS;
+    simsimd_executor_t executor = NULL;
+    void* executor_context = NULL;
+#if defined(__linux__) && defined(_OPENMP)
+    if (threads == 0)
+        threads = omp_get_num_procs();
+    omp_set_num_threads(threads);
+    executor = &executor_openmp;
+#elif SIMSIMD_THREAD_POOL
+    if (capped_pool.pool)
+        executor = &executor_capped_pool, executor_context = &capped_pool;
+#endif
+    simsimd_batch_punned_t const batch = simsimd_dispatch_batch(metric_kind, datatype);
+    scanned = simsimd_mmap_topk(executor, executor_context, metric, batch, &dataset, queries.start, parsed.count,
+                                queries.stride, found, indices, distances);
+    simsimd_mmap_dataset_close(&dataset);
+    Py_END_ALLOW_THREADS;
+    if (scanned == (simsimd_size_t)-1) {
+        free(indices), free(distances);
+        PyErr_NoMemory();
+        goto cleanup;
+    }
+
+    // Create a pair of PyArray objects for the output, flat for a single query vector
+    npy_intp dims[2] = {parsed.count, found};
+    int const ndim = parsed.is_flat ? 1 : 2;
+    npy_intp* shape = parsed.is_flat ? dims + 1 : dims;
+    PyObject* indices_array = PyArray_NewFromDescr(                                  //
+        &PyArray_Type, PyArray_DescrFromType(NPY_UINT64), ndim, shape, NULL, indices, //
+        NPY_ARRAY_OWNDATA | NPY_ARRAY_C_CONTIGUOUS, NULL);
+    if (!indices_array) {
+        free(indices), free(distances);
+        goto cleanup;
+    }
+    PyObject* distances_array = PyArray_NewFromDescr(                                   //
+        &PyArray_Type, PyArray_DescrFromType(NPY_FLOAT32), ndim, shape, NULL, distances, //
+        NPY_ARRAY_OWNDATA | NPY_ARRAY_C_CONTIGUOUS, NULL);
+    if (!distances_array) {
+        free(distances);
+        Py_DECREF(indices_array);
+        goto cleanup;
+    }
+
+    output = PyTuple_Pack(2, indices_array, distances_array);
+    Py_DECREF(indices_array);
+    Py_DECREF(distances_array);
+
+cleanup:
+    free(scratch);
+    PyBuffer_Release(&buffer);
+    return output;
+}
+#endif // SIMSIMD_MMAP
+
+static PyObject* impl_adc(PyObject* const* args, Py_ssize_t nargs) {
+    if (nargs != 2) {
+        PyErr_SetString(PyExc_TypeError, "function expects exactly 2 arguments");
+        return NULL;
+    }
+
+    PyObject* output = NULL;
+    Py_buffer buffer_lut, buffer_codes;
+    parsed_vector_or_matrix_t parsed_lut, parsed_codes;
+    if (parse_tensor(args[0], &buffer_lut, &parsed_lut) != 0 ||
+        parse_tensor(args[1], &buffer_codes, &parsed_codes) != 0) {
+        return NULL; // Error already set by parse_tensor
+    }
+    reinterpret_bytes(simsimd_metric_adc_k, &parsed_codes);
+
+    // The lookup table has 256 columns for 8-bit codes and 16 columns for 4-bit codes, packed in pairs
+    size_t const subspaces = parsed_lut.count;
+    int const is_pq4 = parsed_lut.dimensions == 16;
+    if (parsed_lut.datatype != simsimd_datatype_f32_k || parsed_lut.is_flat || !is_contiguous(&parsed_lut) ||
+        (parsed_lut.dimensions != 256 && !is_pq4) || parsed_lut.stride != parsed_lut.dimensions * sizeof(float)) {
+        PyErr_SetString(PyExc_ValueError, "lookup table must be a contiguous `float32` matrix with 256 or 16 columns");
+        goto cleanup;
+    }
+    if (parsed_codes.datatype != simsimd_datatype_pq8_k || !is_contiguous(&parsed_codes)) {
+        PyErr_SetString(PyExc_ValueError, "codes must be `uint8` with contiguous rows");
+        goto cleanup;
+    }
+    if (parsed_codes.dimensions != (is_pq4 ? (subspaces + 1) / 2 : subspaces)) {
+        PyErr_SetString(PyExc_ValueError, "codes must have a byte per subspace, or per pair of 4-bit subspaces");
+        goto cleanup;
+    }
+
+    npy_intp dims[1] = {(npy_intp)parsed_codes.count};
+    PyObject* output_array = PyArray_SimpleNew(1, dims, NPY_FLOAT32);
+    if (!output_array)
+        goto cleanup;
+    float* distances = (float*)PyArray_DATA((PyArrayObject*)output_array);
+
+    count_kernel_use(simsimd_metric_adc_k, &parsed_codes, NULL, parsed_codes.count);
+    if (!is_pq4) {
+        simsimd_metric_punned_t metric = simsimd_dispatch_metric(simsimd_metric_adc_k, simsimd_datatype_pq8_k);
+        Py_BEGIN_ALLOW_THREADS;
+        simsimd_one_to_many(metric, NULL, parsed_lut.start, parsed_codes.start, parsed_codes.count,
+                            parsed_codes.stride, subspaces, distances);
+        Py_END_ALLOW_THREADS;
+    } else {
+        // Quantize the table and interleave the codes into blocks, that the fast-scan kernels expect
+        size_t const n_bytes = parsed_codes.dimensions;
+        size_t const blocks = (parsed_codes.count + SIMSIMD_PQ4_BLOCK - 1) / SIMSIMD_PQ4_BLOCK;
+        simsimd_b8_t* lut_u8 = malloc(n_bytes * 32);
+        simsimd_b8_t* packed = malloc(blocks * SIMSIMD_PQ4_BLOCK * n_bytes + 1);
+        if (!lut_u8 || !packed) {
+            free(lut_u8), free(packed);
+            Py_DECREF(output_array);
+            PyErr_NoMemory();
+            goto cleanup;
+        }
+        Py_BEGIN_ALLOW_THREADS;
+        simsimd_f32_t scale, bias;
+        simsimd_pq4_quantize_lut((simsimd_f32_t const*)parsed_lut.start, subspaces, lut_u8, &scale, &bias);
+        simsimd_pq4_pack((simsimd_b8_t const*)parsed_codes.start, parsed_codes.count, parsed_codes.stride, n_bytes,
+                         packed);
+        simsimd_dispatch_pq4_scan()(lut_u8, packed, parsed_codes.count, n_bytes, scale, bias, distances);
+        Py_END_ALLOW_THREADS;
+        free(lut_u8), free(packed);
+    }
+
+    if (parsed_codes.is_flat) {
+        output = PyFloat_FromDouble(distances[0]);
+        Py_DECREF(output_array);
+    } else {
+        output = output_array;
+    }
+
+cleanup:
+    PyBuffer_Release(&buffer_lut);
+    PyBuffer_Release(&buffer_codes);
+    return output;
+}
+
+/// @brief  Parses a vector of sorted sparse indices, that must be contiguous unsigned 32-bit integers.
+static int parse_indices(PyObject* tensor, Py_buffer* buffer, parsed_vector_or_matrix_t* parsed) {
+    if (parse_tensor(tensor, buffer, parsed) != 0)
+        return -1;
+    char const* format = buffer->format;
+    char const kind = format[0] && (format[0] == '<' || format[0] == '=' || format[0] == '@') ? format[1] : format[0];
+    if (!parsed->is_flat || buffer->itemsize != 4 || (kind != 'I' && kind != 'L') || !is_contiguous(parsed)) {
+        PyErr_SetString(PyExc_ValueError, "sparse indices must be contiguous `uint32` vectors");
+        PyBuffer_Release(buffer);
+        return -1;
+    }
+    return 0;
+}
+
+static PyObject* impl_intersect(PyObject* const* args, Py_ssize_t nargs) {
+    if (nargs != 2) {
+        PyErr_SetString(PyExc_TypeError, "function expects exactly 2 arguments");
+        return NULL;
+    }
+
+    Py_buffer buffer_a, buffer_b;
+    parsed_vector_or_matrix_t parsed_a, parsed_b;
+    if (parse_indices(args[0], &buffer_a, &parsed_a) != 0)
+        return NULL;
+    if (parse_indices(args[1], &buffer_b, &parsed_b) != 0) {
+        PyBuffer_Release(&buffer_a);
+        return NULL;
+    }
+
+    simsimd_size_t intersection = simsimd_dispatch_sparse_intersect()(
+        (simsimd_u32_t const*)parsed_a.start, (simsimd_u32_t const*)parsed_b.start, parsed_a.dimensions,
+        parsed_b.dimensions);
+    PyBuffer_Release(&buffer_a);
+    PyBuffer_Release(&buffer_b);
+    return PyLong_FromUnsignedLongLong((unsigned long long)intersection);
+}
+
+static PyObject* impl_sparse_dot(PyObject* const* args, Py_ssize_t nargs) {
+    if (nargs != 4) {
+        PyErr_SetString(PyExc_TypeError, "function expects exactly 4 arguments");
+        return NULL;
+    }
+
+    PyObject* output = NULL;
+    Py_buffer buffer_a, buffer_b, buffer_a_weights, buffer_b_weights;
+    parsed_vector_or_matrix_t parsed_a, parsed_b, parsed_a_weights, parsed_b_weights;
+    buffer_b.obj = buffer_a_weights.obj = buffer_b_weights.obj = NULL;
+    if (parse_indices(args[0], &buffer_a, &parsed_a) != 0)
+        return NULL;
+    if (parse_tensor(args[1], &buffer_a_weights, &parsed_a_weights) != 0 ||
+        parse_indices(args[2], &buffer_b, &parsed_b) != 0 ||
+        parse_tensor(args[3], &buffer_b_weights, &parsed_b_weights) != 0)
+        goto cleanup;
+
+    // Both vectors must have the same type of weights, matching their indices one to one
+    if (!parsed_a_weights.is_flat || !parsed_b_weights.is_flat || !is_contiguous(&parsed_a_weights) ||
+        !is_contiguous(&parsed_b_weights) || parsed_a_weights.dimensions != parsed_a.dimensions ||
+        parsed_b_weights.dimensions != parsed_b.dimensions) {
+        PyErr_SetString(PyExc_ValueError, "sparse weights must be contiguous vectors with a weight per index");
+        goto cleanup;
+    }
+    simsimd_sparse_dot_punned_t dot = parsed_a_weights.datatype == parsed_b_weights.datatype
+                                          ? simsimd_dispatch_sparse_dot(parsed_a_weights.datatype)
+                                          : NULL;
+    if (!dot) {
+        PyErr_SetString(PyExc_ValueError, "sparse weights must both be `float32` or `float16`");
+        goto cleanup;
+    }
+
+    simsimd_size_t intersection;
+    simsimd_f32_t product;
+    dot((simsimd_u32_t const*)parsed_a.start, (simsimd_u32_t const*)parsed_b.start, parsed_a_weights.start,
+        parsed_b_weights.start, parsed_a.dimensions, parsed_b.dimensions, &intersection, &product);
+    output = PyFloat_FromDouble(product);
+
+cleanup:
+    PyBuffer_Release(&buffer_a);
+    if (buffer_a_weights.obj)
+        PyBuffer_Release(&buffer_a_weights);
+    if (buffer_b.obj)
+        PyBuffer_Release(&buffer_b);
+    if (buffer_b_weights.obj)
+        PyBuffer_Release(&buffer_b_weights);
+    return output;
+}
+
+static PyObject* impl_quantize(PyObject* input_tensor, simsimd_datatype_t datatype, int per_vector) {
+    PyObject* output = NULL;
+    PyObject* codes_array = NULL;
+    PyObject* scales_array = NULL;
+    char* scratch = NULL;
+    Py_buffer buffer;
+    parsed_vector_or_matrix_t parsed;
+    if (parse_tensor(input_tensor, &buffer, &parsed) != 0)
+        return NULL; // Error already set by parse_tensor
+
+    simsimd_convert_punned_t convert = simsimd_dispatch_convert(datatype);
+    if (parsed.datatype != simsimd_datatype_f32_k) {
+        PyErr_SetString(PyExc_ValueError, "only `float32` inputs can be converted");
+        goto cleanup;
+    }
+    if (!convert) {
+        PyErr_SetString(PyExc_ValueError, "Unsupported 'dtype', expected 'f16', 'bf16', 'i8', or 'b8'");
+        goto cleanup;
+    }
+
+    // The `bf16` outputs are exported as raw `uint16` words, as NumPy has no such type
+    int numpy_type;
+    size_t row_bytes;
+    switch (datatype) {
+    case simsimd_datatype_f16_k: numpy_type = NPY_FLOAT16; break;
+    case simsimd_datatype_bf16_k: numpy_type = NPY_UINT16; break;
+    case simsimd_datatype_i8_k: numpy_type = NPY_INT8; break;
+    default: numpy_type = NPY_UINT8; break;
+    }
+    if (datatype == simsimd_datatype_b8_k)
+        row_bytes = (parsed.dimensions + 7) / 8;
+    else
+        row_bytes = parsed.dimensions * (datatype == simsimd_datatype_i8_k ? 1 : 2);
+    size_t const columns = datatype == simsimd_datatype_b8_k ? row_bytes : parsed.dimensions;
+    npy_intp dims[2] = {(npy_intp)parsed.count, (npy_intp)columns};
+    codes_array = parsed.is_flat ? PyArray_SimpleNew(1, dims + 1, numpy_type) : PyArray_SimpleNew(2, dims, numpy_type);
+    if (!codes_array)
+        goto cleanup;
+    int const quantized = datatype == simsimd_datatype_i8_k;
+    if (quantized && per_vector && !parsed.is_flat) {
+        scales_array = PyArray_SimpleNew(1, dims, NPY_FLOAT32);
+        if (!scales_array)
+            goto cleanup;
+    }
+
+    size_t const block_rows = packing_block_rows(&parsed);
+    if (allocate_scratch(&parsed, block_rows, &scratch) != 0)
+        goto cleanup;
+    char* codes = PyArray_DATA((PyArrayObject*)codes_array);
+    float* scales = scales_array ? (float*)PyArray_DATA((PyArrayObject*)scales_array) : NULL;
+    simsimd_absmax_punned_t absmax = simsimd_dispatch_absmax();
+    float shared_scale = 0;
+
+    Py_BEGIN_ALLOW_THREADS;
+    // Without per-vector scales, all the rows share the one derived from the largest magnitude of the tensor
+    if (quantized && !scales) {
+        for (size_t start = 0; start < parsed.count; start += block_rows) {
+            size_t const length = parsed.count - start < block_rows ? parsed.count - start : block_rows;
+            parsed_vector_or_matrix_t block = rows_view(&parsed, start, length, scratch);
+            for (size_t i = 0; i != length; ++i) {
+                float row_max = absmax((simsimd_f32_t const*)(block.start + i * block.stride), parsed.dimensions);
+                shared_scale = row_max > shared_scale ? row_max : shared_scale;
+            }
+        }
+        shared_scale /= 127;
+    }
+    for (size_t start = 0; start < parsed.count; start += block_rows) {
+        size_t const length = parsed.count - start < block_rows ? parsed.count - start : block_rows;
+        parsed_vector_or_matrix_t block = rows_view(&parsed, start, length, scratch);
+        if (scales)
+            simsimd_quantize_i8(absmax, convert, (simsimd_f32_t const*)block.start, length, block.stride,
+                                parsed.dimensions, (simsimd_i8_t*)(codes + start * row_bytes), scales + start);
+        else
+            for (size_t i = 0; i != length; ++i)
+                convert((simsimd_f32_t const*)(block.start + i * block.stride), parsed.dimensions, shared_scale,
+                        codes + (start + i) * row_bytes);
+    }
+    Py_END_ALLOW_THREADS;
+
+    // Quantized codes are returned together with their scales, to restore the values as `codes * scales`
+    if (!quantized)
+        output = codes_array, codes_array = NULL;
+    else if (scales_array)
+        output = PyTuple_Pack(2, codes_array, scales_array);
+    else {
+        PyObject* scale_obj = PyFloat_FromDouble(shared_scale);
+        output = scale_obj ? PyTuple_Pack(2, codes_array, scale_obj) : NULL;
+        Py_XDECREF(scale_obj);
+    }
+
+cleanup:
+    Py_XDECREF(codes_array);
+    Py_XDECREF(scales_array);
+    free(scratch);
+    PyBuffer_Release(&buffer);
+    return output;
+}
+
+static PyObject* impl_pointer(simsimd_metric_kind_t metric_kind, PyObject* args) {
+    char const* type_name = PyUnicode_AsUTF8(PyTuple_GetItem(args, 0));
+    if (!type_name) {
+        PyErr_SetString(PyExc_ValueError, "Invalid type name");
+        return NULL;
+    }
+
+    simsimd_datatype_t datatype = python_string_to_datatype(type_name);
+    if (!type_name) {
+        PyErr_SetString(PyExc_ValueError, "Unsupported type");
+        return NULL;
+    }
+
+    simsimd_metric_punned_t metric = simsimd_dispatch_metric(metric_kind, datatype);
+    if (metric == NULL) {
+        PyErr_SetString(PyExc_ValueError, "No such metric");
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong((unsigned long long)metric);
+}
+
+static PyObject* api_cdist(PyObject* self, PyObject* args, PyObject* kwargs) {
+    PyObject *input_tensor_a, *input_tensor_b;
+    PyObject* metric_obj = NULL;
+    PyObject* threads_obj = NULL;
+    PyObject* out_obj = NULL;
+    PyObject* dtype_obj = NULL;
+
+    if (!PyTuple_Check(args) || PyTuple_Size(args) < 2) {
+        PyErr_SetString(PyExc_TypeError, "function expects at least 2 positional arguments");
+        return NULL;
+    }
+
+    input_tensor_a = PyTuple_GetItem(args, 0);
+    input_tensor_b = PyTuple_GetItem(args, 1);
+    if (PyTuple_Size(args) > 2)
+        metric_obj = PyTuple_GetItem(args, 2);
+    if (PyTuple_Size(args) > 3)
+        threads_obj = PyTuple_GetItem(args, 3);
+
+    // Checking for named arguments in kwargs
+    if (kwargs) {
+        if (!metric_obj) {
+            metric_obj = PyDict_GetItemString(kwargs, "metric");
+        } else if (PyDict_GetItemString(kwargs, "metric")) {
+            PyErr_SetString(PyExc_TypeError, "Duplicate argument for 'metric'");
+            return NULL;
+        }
+
+        if (!threads_obj) {
+            threads_obj = PyDict_GetItemString(kwargs, "threads");
+        } else if (PyDict_GetItemString(kwargs, "threads")) {
+            PyErr_SetString(PyExc_TypeError, "Duplicate argument for 'threads'");
+            return NULL;
+        }
+
+        out_obj = PyDict_GetItemString(kwargs, "out");
+        dtype_obj = PyDict_GetItemString(kwargs, "dtype");
+    }
+
+    // Process the PyObject values
+    simsimd_metric_kind_t metric_kind = simsimd_metric_l2sq_k;
+    if (metric_obj) {
+        char const* metric_str = PyUnicode_AsUTF8(metric_obj);
+        if (!metric_str && PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError, "Expected 'metric' to be a string");
+            return NULL;
+        }
+        metric_kind = python_string_to_metric_kind(metric_str);
+        if (metric_kind == simsimd_metric_unknown_k) {
+            PyErr_SetString(PyExc_ValueError, "Unsupported metric");
+            return NULL;
+        }
+    }
+
+    size_t threads = 1;
+    if (threads_obj)
+        threads = PyLong_AsSize_t(threads_obj);
+    if (PyErr_Occurred()) {
+        PyErr_SetString(PyExc_TypeError, "Expected 'threads' to be an unsigned integer");
+        return NULL;
+    }
+
+    return impl_cdist(input_tensor_a, input_tensor_b, metric_kind, threads, out_obj, dtype_obj);
+}
+
+static PyObject* api_pdist(PyObject* self, PyObject* args, PyObject* kwargs) {
+    PyObject* input_tensor;
+    PyObject* metric_obj = NULL;
+    PyObject* threads_obj = NULL;
+    PyObject* out_obj = NULL;
+    PyObject* dtype_obj = NULL;
+
+    if (!PyTuple_Check(args) || PyTuple_Size(args) < 1) {
+        PyErr_SetString(PyExc_TypeError, "function expects at least 1 positional argument");
+        return NULL;
+    }
+
+    input_tensor = PyTuple_GetItem(args, 0);
+    if (PyTuple_Size(args) > 1)
+        metric_obj = PyTuple_GetItem(args, 1);
+    if (PyTuple_Size(args) > 2)
+        threads_obj = PyTuple_GetItem(args, 2);
+
+    // Checking for named arguments in kwargs
+    if (kwargs) {
+        if (!metric_obj) {
+            metric_obj = PyDict_GetItemString(kwargs, "metric");
+        } else if (PyDict_GetItemString(kwargs, "metric")) {
+            PyErr_SetString(PyExc_TypeError, "Duplicate argument for 'metric'");
+            return NULL;
+        }
+
+        if (!threads_obj) {
+            threads_obj = PyDict_GetItemString(kwargs, "threads");
+        } else if (PyDict_GetItemString(kwargs, "threads")) {
+            PyErr_SetString(PyExc_TypeError, "Duplicate argument for 'threads'");
+            return NULL;
+        }
+
+        out_obj = PyDict_GetItemString(kwargs, "out");
+        dtype_obj = PyDict_GetItemString(kwargs, "dtype");
+    }
+
+    // Process the PyObject values
+    simsimd_metric_kind_t metric_kind = simsimd_metric_l2sq_k;
+    if (metric_obj) {
+        char const* metric_str = PyUnicode_AsUTF8(metric_obj);
+        if (!metric_str && PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError, "Expected 'metric' to be a string");
+            return NULL;
+        }
+        metric_kind = python_string_to_metric_kind(metric_str);
+        if (metric_kind == simsimd_metric_unknown_k) {
+            PyErr_SetString(PyExc_ValueError, "Unsupported metric");
+            return NULL;
+        }
+    }
+
+    size_t threads = 1;
+    if (threads_obj)
+        threads = PyLong_AsSize_t(threads_obj);
+    if (PyErr_Occurred()) {
+        PyErr_SetString(PyExc_TypeError, "Expected 'threads' to be an unsigned integer");
+        return NULL;
+    }
+
+    return impl_pdist(input_tensor, metric_kind, threads, out_obj, dtype_obj);
+}
+
+static PyObject* api_quantize(PyObject* self, PyObject* args, PyObject* kwargs) {
+    PyObject* input_tensor;
+    PyObject* dtype_obj = NULL;
+    PyObject* per_vector_obj = NULL;
+
+    if (!PyTuple_Check(args) || PyTuple_Size(args) < 1) {
+        PyErr_SetString(PyExc_TypeError, "function expects at least 1 positional argument");
+        return NULL;
+    }
+
+    input_tensor = PyTuple_GetItem(args, 0);
+    if (PyTuple_Size(args) > 1)
+        dtype_obj = PyTuple_GetItem(args, 1);
+
+    // Checking for named arguments in kwargs
+    if (kwargs) {
+        if (!dtype_obj) {
+            dtype_obj = PyDict_GetItemString(kwargs, "dtype");
+        } else if (PyDict_GetItemString(kwargs, "dtype")) {
+            PyErr_SetString(PyExc_TypeError, "Duplicate argument for 'dtype'");
+            return NULL;
+        }
+        per_vector_obj = PyDict_GetItemString(kwargs, "per_vector");
+    }
+
+    // Process the PyObject values
+    if (!dtype_obj) {
+        PyErr_SetString(PyExc_TypeError, "Expected the target 'dtype'");
+        return NULL;
+    }
+    char const* dtype_str = PyUnicode_AsUTF8(dtype_obj);
+    if (!dtype_str) {
+        PyErr_SetString(PyExc_TypeError, "Expected 'dtype' to be a string");
+        return NULL;
+    }
+    int per_vector = 1;
+    if (per_vector_obj) {
+        per_vector = PyObject_IsTrue(per_vector_obj);
+        if (per_vector < 0)
+            return NULL;
+    }
+
+    return impl_quantize(input_tensor, python_string_to_datatype(dtype_str), per_vector);
+}
+
+static PyObject* api_topk(PyObject* self, PyObject* args, PyObject* kwargs) {
+    PyObject *input_tensor_a, *input_tensor_b, *k_obj;
+    PyObject* metric_obj = NULL;
+    PyObject* threads_obj = NULL;
+
+    if (!PyTuple_Check(args) || PyTuple_Size(args) < 3) {
+        PyErr_SetString(PyExc_TypeError, "function expects at least 3 positional arguments");
+        return NULL;
+    }
+
+    input_tensor_a = PyTuple_GetItem(args, 0);
+    input_tensor_b = PyTuple_GetItem(args, 1);
+    k_obj = PyTuple_GetItem(args, 2);
+    if (PyTuple_Size(args) > 3)
+        metric_obj = PyTuple_GetItem(args, 3);
+    if (PyTuple_Size(args) > 4)
+        threads_obj = PyTuple_GetItem(args, 4);
+
+    // Checking for named arguments in kwargs
+    if (kwargs) {
+        if (!metric_obj) {
+            metric_obj = PyDict_GetItemString(kwargs, "metric");
+        } else if (PyDict_GetItemString(kwargs, "metric")) {
+            PyErr_SetString(PyExc_TypeError, "Duplicate argument for 'metric'");
+            return NULL;
+        }
+
+        if (!threads_obj) {
+            threads_obj = PyDict_GetItemString(kwargs, "threads");
+        } else if (PyDict_GetItemString(kwargs, "threads")) {
+            PyErr_SetString(PyExc_TypeError, "Duplicate argument for 'threads'");
+            return NULL;
+        }
+    }
+
+    // Process the PyObject values
+    size_t k = PyLong_AsSize_t(k_obj);
+    if (PyErr_Occurred()) {
+        PyErr_SetString(PyExc_TypeError, "Expected 'k' to be an unsigned integer");
+        return NULL;
+    }
+    if (k == 0) {
+        PyErr_SetString(PyExc_ValueError, "Expected 'k' to be positive");
+        return NULL;
+    }
+
+    simsimd_metric_kind_t metric_kind = simsimd_metric_l2sq_k;
+    if (metric_obj) {
+        char const* metric_str = PyUnicode_AsUTF8(metric_obj);
+        if (!metric_str && PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError, "Expected 'metric' to be a string");
+            return NULL;
+        }
+        metric_kind = python_string_to_metric_kind(metric_str);
+        if (metric_kind == simsimd_metric_unknown_k) {
+            PyErr_SetString(PyExc_ValueError, "Unsupported metric");
+            return NULL;
+        }
+    }
+
+    size_t threads = 1;
+    if (threads_obj)
+        threads = PyLong_AsSize_t(threads_obj);
+    if (PyErr_Occurred()) {
+        PyErr_SetString(PyExc_TypeError, "Expected 'threads' to be an unsigned integer");
+        return NULL;
+    }
+
+    return impl_topk(input_tensor_a, input_tensor_b, k, metric_kind, threads);
+}
+
+static PyObject* api_radius(PyObject* self, PyObject* args, PyObject* kwargs) {
+    PyObject *input_tensor_a, *input_tensor_b, *max_distance_obj;
+    PyObject* metric_obj = NULL;
+
+    if (!PyTuple_Check(args) || PyTuple_Size(args) < 3) {
+        PyErr_SetString(PyExc_TypeError, "function expects at least 3 positional arguments");
+        return NULL;
+    }
+
+    input_tensor_a = PyTuple_GetItem(args, 0);
+    input_tensor_b = PyTuple_GetItem(args, 1);
+    max_distance_obj = PyTuple_GetItem(args, 2);
+    if (PyTuple_Size(args) > 3)
+        metric_obj = PyTuple_GetItem(args, 3);
+
+    // Checking for named arguments in kwargs
+    if (kwargs) {
+        if (!metric_obj) {
+            metric_obj = PyDict_GetItemString(kwargs, "metric");
+        } else if (PyDict_GetItemString(kwargs, "metric")) {
+            PyErr_SetString(PyExc_TypeError, "Duplicate argument for 'metric'");
+            return NULL;
+        }
+    }
+
+    // Process the PyObject values
+    double max_distance = PyFloat_AsDouble(max_distance_obj);
+    if (PyErr_Occurred()) {
+        PyErr_SetString(PyExc_TypeError, "Expected 'max_distance' to be a number");
+        return NULL;
+    }
+
+    simsimd_metric_kind_t metric_kind = simsimd_metric_hamming_k;
+    if (metric_obj) {
+        char const* metric_str = PyUnicode_AsUTF8(metric_obj);
+        if (!metric_str && PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError, "Expected 'metric' to be a string");
+            return NULL;
+        }
+        metric_kind = python_string_to_metric_kind(metric_str);
+        if (metric_kind == simsimd_metric_unknown_k) {
+            PyErr_SetString(PyExc_ValueError, "Unsupported metric");
+            return NULL;
+        }
+    }
+
+    return impl_radius(input_tensor_a, input_tensor_b, (simsimd_f32_t)max_distance, metric_kind);
+}
+
+#if SIMSIMD_MMAP
+static PyObject* api_scan(PyObject* self, PyObject* args, PyObject* kwargs) {
+    PyObject *path_obj, *input_tensor, *k_obj;
+    PyObject* metric_obj = NULL;
+    PyObject* threads_obj = NULL;
+
+    if (!PyTuple_Check(args) || PyTuple_Size(args) < 3) {
+        PyErr_SetString(PyExc_TypeError, "function expects at least 3 positional arguments");
+        return NULL;
+    }
+
+    path_obj = PyTuple_GetItem(args, 0);
+    input_tensor = PyTuple_GetItem(args, 1);
+    k_obj = PyTuple_GetItem(args, 2);
+    if (PyTuple_Size(args) > 3)
+        metric_obj = PyTuple_GetItem(args, 3);
+    if (PyTuple_Size(args) > 4)
+        threads_obj = PyTuple_GetItem(args, 4);
+
+    // Checking for named arguments in kwargs
+    if (kwargs) {
+        if (!metric_obj) {
+            metric_obj = PyDict_GetItemString(kwargs, "metric");
+        } else if (PyDict_GetItemString(kwargs, "metric")) {
+            PyErr_SetString(PyExc_TypeError, "Duplicate argument for 'metric'");
+            return NULL;
+        }
+
+        if (!threads_obj) {
+            threads_obj = PyDict_GetItemString(kwargs, "threads");
+        } else if (PyDict_GetItemString(kwargs, "threads")) {
+            PyErr_SetString(PyExc_TypeError, "Duplicate argument for 'threads'");
+            return NULL;
+        }
+    }
+
+    // Process the PyObject values
+    size_t k = PyLong_AsSize_t(k_obj);
+    if (PyErr_Occurred()) {
+        PyErr_SetString(PyExc_TypeError, "Expected 'k' to be an unsigned integer");
+        return NULL;
+    }
+    if (k == 0) {
+        PyErr_SetString(PyExc_ValueError, "Expected 'k' to be positive");
+        return NULL;
+    }
+
+    simsimd_metric_kind_t metric_kind = simsimd_metric_l2sq_k;
+    if (metric_obj) {
         char const* metric_str = PyUnicode_AsUTF8(metric_obj);
         if (!metric_str && PyErr_Occurred()) {
             PyErr_SetString(PyExc_TypeError, "Expected 'metric' to be a string");
@@ -407,8 +2089,19 @@ static PyObject* api_cdist(PyObject* self, PyObject* args, PyObject* kwargs) {
         return NULL;
     }
 
-    return impl_cdist(input_tensor_a, input_tensor_b, metric_kind, threads);
+    // Accept both strings and `pathlib` paths, and detect the `.fvecs`, `.bvecs`, `.ivecs` layouts by extension
+    PyObject* path_bytes = NULL;
+    if (!PyUnicode_FSConverter(path_obj, &path_bytes))
+        return NULL;
+    char const* path = PyBytes_AsString(path_bytes);
+    size_t const path_length = strlen(path);
+    int const with_headers = path_length > 5 && same_string(path + path_length - 4, "vecs") &&
+                             path[path_length - 6] == '.';
+    PyObject* output = impl_scan(path, input_tensor, k, metric_kind, threads, with_headers);
+    Py_DECREF(path_bytes);
+    return output;
 }
+#endif // SIMSIMD_MMAP
 
 static PyObject* api_l2sq_pointer(PyObject* self, PyObject* args) { return impl_pointer(simsimd_metric_l2sq_k, args); }
 static PyObject* api_cos_pointer(PyObject* self, PyObject* args) { return impl_pointer(simsimd_metric_cos_k, args); }
@@ -422,44 +2115,84 @@ static PyObject* api_jaccard_pointer(PyObject* self, PyObject* args) {
     return impl_pointer(simsimd_metric_jaccard_k, args);
 }
 
-static PyObject* api_l2sq(PyObject* self, PyObject* const* args, Py_ssize_t nargs) {
-    return impl_metric(simsimd_metric_l2sq_k, args, nargs);
+static PyObject* api_l2sq(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames) {
+    return impl_metric(simsimd_metric_l2sq_k, args, nargs, kwnames);
+}
+static PyObject* api_cos(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames) {
+    return impl_metric(simsimd_metric_cos_k, args, nargs, kwnames);
 }
-static PyObject* api_cos(PyObject* self, PyObject* const* args, Py_ssize_t nargs) {
-    return impl_metric(simsimd_metric_cos_k, args, nargs);
+static PyObject* api_ip(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames) {
+    return impl_metric(simsimd_metric_ip_k, args, nargs, kwnames);
 }
-static PyObject* api_ip(PyObject* self, PyObject* const* args, Py_ssize_t nargs) {
-    return impl_metric(simsimd_metric_ip_k, args, nargs);
+static PyObject* api_kl(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames) {
+    return impl_metric(simsimd_metric_kl_k, args, nargs, kwnames);
 }
-static PyObject* api_kl(PyObject* self, PyObject* const* args, Py_ssize_t nargs) {
-    return impl_metric(simsimd_metric_kl_k, args, nargs);
+static PyObject* api_js(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames) {
+    return impl_metric(simsimd_metric_js_k, args, nargs, kwnames);
 }
-static PyObject* api_js(PyObject* self, PyObject* const* args, Py_ssize_t nargs) {
-    return impl_metric(simsimd_metric_js_k, args, nargs);
+static PyObject* api_hamming(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames) {
+    return impl_metric(simsimd_metric_hamming_k, args, nargs, kwnames);
 }
-static PyObject* api_hamming(PyObject* self, PyObject* const* args, Py_ssize_t nargs) {
-    return impl_metric(simsimd_metric_hamming_k, args, nargs);
+static PyObject* api_jaccard(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames) {
+    return impl_metric(simsimd_metric_jaccard_k, args, nargs, kwnames);
 }
-static PyObject* api_jaccard(PyObject* self, PyObject* const* args, Py_ssize_t nargs) {
-    return impl_metric(simsimd_metric_jaccard_k, args, nargs);
+static PyObject* api_adc(PyObject* self, PyObject* const* args, Py_ssize_t nargs) { return impl_adc(args, nargs); }
+static PyObject* api_intersect(PyObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    return impl_intersect(args, nargs);
+}
+static PyObject* api_sparse_dot(PyObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    return impl_sparse_dot(args, nargs);
 }
 
 static PyMethodDef simsimd_methods[] = {
     // Introspecting library and hardware capabilities
     {"get_capabilities", api_get_capabilities, METH_NOARGS, "Get hardware capabilities"},
+    {"enable_capability", api_enable_capability, METH_VARARGS, "Allow the kernels relying on a hardware capability"},
+    {"disable_capability", api_disable_capability, METH_VARARGS, "Forbid the kernels relying on a hardware capability"},
+    {"get_kernels", api_get_kernels, METH_VARARGS | METH_KEYWORDS,
+     "Capability of the kernel used for every metric and datatype, optionally for the given `dimensions`"},
+#if SIMSIMD_DISPATCH_COUNTERS
+    {"get_counters", api_get_counters, METH_VARARGS | METH_KEYWORDS,
+     "Number of calls, compared vectors, and input bytes for every used metric and datatype"},
+#endif
 
-    // NumPy and SciPy compatible interfaces (two matrix or vector arguments)
-    {"sqeuclidean", api_l2sq, METH_FASTCALL, "L2sq (Sq. Euclidean) distances between a pair of matrices"},
-    {"cosine", api_cos, METH_FASTCALL, "Cosine (Angular) distances between a pair of matrices"},
-    {"inner", api_ip, METH_FASTCALL, "Inner (Dot) Product distances between a pair of matrices"},
-    {"hamming", api_hamming, METH_FASTCALL, "Hamming distances between a pair of matrices"},
-    {"jaccard", api_jaccard, METH_FASTCALL, "Jaccard (Bitwise Tanimoto) distances between a pair of matrices"},
-    {"kullbackleibler", api_kl, METH_FASTCALL, "Kullback-Leibler divergence between probability distributions"},
-    {"jensenshannon", api_js, METH_FASTCALL, "Jensen-Shannon divergence between probability distributions"},
+    // NumPy and SciPy compatible interfaces (two matrix or vector arguments), and optional `out` and `dtype` args
+    {"sqeuclidean", api_l2sq, METH_FASTCALL | METH_KEYWORDS,
+     "L2sq (Sq. Euclidean) distances between a pair of matrices"},
+    {"cosine", api_cos, METH_FASTCALL | METH_KEYWORDS, "Cosine (Angular) distances between a pair of matrices"},
+    {"inner", api_ip, METH_FASTCALL | METH_KEYWORDS, "Inner (Dot) Product distances between a pair of matrices"},
+    {"hamming", api_hamming, METH_FASTCALL | METH_KEYWORDS, "Hamming distances between a pair of matrices"},
+    {"jaccard", api_jaccard, METH_FASTCALL | METH_KEYWORDS,
+     "Jaccard (Bitwise Tanimoto) distances between a pair of matrices"},
+    {"kullbackleibler", api_kl, METH_FASTCALL | METH_KEYWORDS,
+     "Kullback-Leibler divergence between probability distributions"},
+    {"jensenshannon", api_js, METH_FASTCALL | METH_KEYWORDS,
+     "Jensen-Shannon divergence between probability distributions"},
 
-    // Conventional `cdist` and `pdist` insterfaces with third string argument, and optional `threads` arg
+    // Conventional `cdist` and `pdist` interfaces with third string argument, and optional `threads`, `out`, `dtype`
     {"cdist", api_cdist, METH_VARARGS | METH_KEYWORDS,
      "Compute distance between each pair of the two collections of inputs"},
+    {"pdist", api_pdist, METH_VARARGS | METH_KEYWORDS,
+     "Compute condensed distances between each unordered pair of rows of one collection"},
+    {"topk", api_topk, METH_VARARGS | METH_KEYWORDS,
+     "Find the `k` closest rows of the second collection for each vector of the first one"},
+    {"radius", api_radius, METH_VARARGS | METH_KEYWORDS,
+     "Find all rows of the second collection within `max_distance` from the query vector"},
+#if SIMSIMD_MMAP
+    {"scan", api_scan, METH_VARARGS | METH_KEYWORDS,
+     "Find the `k` closest rows of a memory-mapped raw matrix or `.fvecs` file for each of the query vectors"},
+#endif
+    {"adc", api_adc, METH_FASTCALL,
+     "Asymmetric distances from a query, given as a lookup table, to many product-quantized codes"},
+
+    // Sparse vectors, given as sorted `uint32` indices and optional `float32` or `float16` weights
+    {"intersect", api_intersect, METH_FASTCALL, "Number of common indices of two sorted sparse vectors"},
+    {"sparse_dot", api_sparse_dot, METH_FASTCALL,
+     "Dot product of two sparse vectors, given as sorted indices and weights: `(a, a_weights, b, b_weights)`"},
+
+    // Conversions of `float32` inputs into the compact datatypes, that the kernels above consume
+    {"quantize", api_quantize, METH_VARARGS | METH_KEYWORDS,
+     "Convert `float32` vectors into 'f16', 'bf16', 'i8' with scales, or 'b8' bitsets of their signs"},
 
     // Exposing underlying API for USearch
     {"pointer_to_sqeuclidean", api_l2sq_pointer, METH_VARARGS, "L2sq (Sq. Euclidean) function pointer as `int`"},
@@ -487,6 +2220,8 @@ PyMODINIT_FUNC PyInit_simsimd(void) {
     if (module)
         PyModule_AddStringConstant(module, "__version__", "2.1.1");
 
+    // The shared dispatch table fills itself on first use, so just touch it here to pay for that upfront
     static_capabilities = simsimd_capabilities();
+    simsimd_dispatch_table();
     return module;
 }
@@ -19,16 +19,62 @@ def test_pointers_availability():
     assert simd.pointer_to_cosine("f16") != 0
     assert simd.pointer_to_inner("f16") != 0
 
+    assert simd.pointer_to_sqeuclidean("bf16") != 0
+    assert simd.pointer_to_cosine("bf16") != 0
+    assert simd.pointer_to_inner("bf16") != 0
+
     assert simd.pointer_to_sqeuclidean("i8") != 0
     assert simd.pointer_to_cosine("i8") != 0
     assert simd.pointer_to_inner("i8") != 0
 
 
+def test_kernels_introspection():
+    """Checks that the reported kernels follow the enabled capabilities, and that they can be disabled."""
+    capabilities = simd.get_capabilities()
+    kernels = simd.get_kernels()
+    assert kernels["cosine"]["f32"] in capabilities
+    assert capabilities[kernels["cosine"]["f32"]]
+    assert simd.get_kernels(dimensions=768)["cosine"]["f32"] in capabilities
+
+    a = np.random.randn(97).astype(np.float32)
+    b = np.random.randn(97).astype(np.float32)
+    expected = simd.cosine(a, b)
+    best = kernels["cosine"]["f32"]
+    if best != "serial":
+        simd.disable_capability(best)
+        try:
+            assert simd.get_kernels()["cosine"]["f32"] != best
+            assert not simd.get_capabilities()[best]
+            np.testing.assert_allclose(simd.cosine(a, b), expected, atol=SIMSIMD_ATOL)
+        finally:
+            simd.enable_capability(best)
+    assert simd.get_kernels() == kernels
+
+    with pytest.raises(ValueError):
+        simd.disable_capability("serial")
+    with pytest.raises(ValueError):
+        simd.disable_capability("x86_avx1024")
+
+
+@pytest.mark.skipif(not hasattr(simd, "get_counters"), reason="SimSIMD was built without the kernel counters")
+def test_kernels_counters():
+    """Checks that the kernel counters account for every call, compared pair, and input byte."""
+    simd.get_counters(reset=True)
+    A = np.random.randn(10, 97).astype(np.float32)
+    B = np.random.randn(20, 97).astype(np.float32)
+    simd.cdist(A, B, metric="sqeuclidean")
+    simd.sqeuclidean(A[0], B[0])
+
+    counters = simd.get_counters(reset=True)
+    assert counters["sqeuclidean"]["f32"] == {"calls": 2, "vectors": 201, "bytes": (30 + 2) * 97 * 4}
+    assert simd.get_counters() == {}
+
+
 @pytest.mark.repeat(50)
-@pytest.mark.parametrize("ndim", [3, 97, 1536])
-@pytest.mark.parametrize("dtype", [np.float32, np.float16])
+@pytest.mark.parametrize("ndim", [3, 97, 768, 1536])
+@pytest.mark.parametrize("dtype", [np.float64, np.float32, np.float16])
 def test_dot(ndim, dtype):
-    """Compares the simd.dot() function with numpy.dot(), measuring the accuracy error for f16, and f32 types."""
+    """Compares the simd.dot() function with numpy.dot(), measuring the accuracy error for f16, f32, and f64 types."""
     a = np.random.randn(ndim).astype(dtype)
     b = np.random.randn(ndim).astype(dtype)
     a /= np.linalg.norm(a)
@@ -41,8 +87,8 @@ def test_dot(ndim, dtype):
 
 
 @pytest.mark.repeat(50)
-@pytest.mark.parametrize("ndim", [3, 97, 1536])
-@pytest.mark.parametrize("dtype", [np.float32, np.float16])
+@pytest.mark.parametrize("ndim", [3, 97, 768, 1536])
+@pytest.mark.parametrize("dtype", [np.float64, np.float32, np.float16])
 def test_sqeuclidean(ndim, dtype):
     """Compares the simd.sqeuclidean() function with scipy.spatial.distance.sqeuclidean(), measuring the accuracy error for f16, and f32 types."""
     a = np.random.randn(ndim).astype(dtype)
@@ -55,8 +101,8 @@ def test_sqeuclidean(ndim, dtype):
 
 
 @pytest.mark.repeat(50)
-@pytest.mark.parametrize("ndim", [3, 97, 1536])
-@pytest.mark.parametrize("dtype", [np.float32, np.float16])
+@pytest.mark.parametrize("ndim", [3, 97, 768, 1536])
+@pytest.mark.parametrize("dtype", [np.float64, np.float32, np.float16])
 def test_cosine(ndim, dtype):
     """Compares the simd.cosine() function with scipy.spatial.distance.cosine(), measuring the accuracy error for f16, and f32 types."""
     a = np.random.randn(ndim).astype(dtype)
@@ -91,6 +137,24 @@ def test_sqeuclidean_i8(ndim):
 
     np.testing.assert_allclose(expected, result, atol=0, rtol=SIMSIMD_RTOL)
 
+@pytest.mark.repeat(50)
+@pytest.mark.parametrize("ndim", [3, 97, 1536])
+@pytest.mark.parametrize("dtype", [np.int8, np.uint8])
+def test_full_range_integers(ndim, dtype):
+    """Compares simd.cosine() and simd.sqeuclidean() with SciPy on signed and unsigned bytes, including the extremes."""
+    limits = np.iinfo(dtype)
+    a = np.random.randint(limits.min, limits.max + 1, size=ndim, dtype=dtype)
+    b = np.random.randint(limits.min, limits.max + 1, size=ndim, dtype=dtype)
+
+    expected = spd.cosine(a.astype(np.float64), b.astype(np.float64))
+    np.testing.assert_allclose(expected, simd.cosine(a, b), atol=SIMSIMD_ATOL, rtol=0)
+    expected = spd.sqeuclidean(a.astype(np.float64), b.astype(np.float64))
+    np.testing.assert_allclose(expected, simd.sqeuclidean(a, b), atol=0, rtol=SIMSIMD_RTOL)
+
+    # The `uint8` arrays are still treated as bitsets by the binary metrics
+    if dtype == np.uint8:
+        assert simd.hamming(a, b) == np.unpackbits(a ^ b).sum()
+
 @pytest.mark.parametrize("ndim", [3, 97, 1536])
 @pytest.mark.parametrize("dtype", [np.float32, np.float16])
 def test_cosine_zero_vector(ndim, dtype):
@@ -109,7 +173,7 @@ def test_cosine_zero_vector(ndim, dtype):
 
 
 @pytest.mark.repeat(50)
-@pytest.mark.parametrize("ndim", [3, 97, 1536])
+@pytest.mark.parametrize("ndim", [3, 97, 1536, 8191])
 def test_hamming(ndim):
     """Compares the simd.hamming() function with scipy.spatial.distance.hamming."""
     a = np.random.randint(2, size=ndim).astype(np.uint8)
@@ -122,7 +186,7 @@ def test_hamming(ndim):
 
 
 @pytest.mark.repeat(50)
-@pytest.mark.parametrize("ndim", [3, 97, 1536])
+@pytest.mark.parametrize("ndim", [3, 97, 1536, 8191])
 def test_jaccard(ndim):
     """Compares the simd.jaccard() function with scipy.spatial.distance.jaccard."""
     a = np.random.randint(2, size=ndim).astype(np.uint8)
@@ -134,6 +198,25 @@ def test_jaccard(ndim):
     np.testing.assert_allclose(expected, result, atol=SIMSIMD_ATOL, rtol=0)
 
 
+@pytest.mark.repeat(50)
+@pytest.mark.parametrize("ndim", [3, 97, 1536])
+@pytest.mark.parametrize("dtype", [np.float64, np.float32, np.float16])
+def test_probability(ndim, dtype):
+    """Compares the simd.kullbackleibler() and simd.jensenshannon() functions with the NumPy definitions."""
+    a = np.random.rand(ndim) + 0.01
+    b = np.random.rand(ndim) + 0.01
+    a = (a / np.sum(a)).astype(dtype)
+    b = (b / np.sum(b)).astype(dtype)
+
+    a64, b64 = a.astype(np.float64), b.astype(np.float64)
+    m64 = (a64 + b64) / 2
+    expected_kl = np.sum(a64 * np.log(a64 / b64))
+    expected_js = (np.sum(a64 * np.log(a64 / m64)) + np.sum(b64 * np.log(b64 / m64))) / 2
+
+    np.testing.assert_allclose(expected_kl, simd.kullbackleibler(a, b), atol=1e-3, rtol=0)
+    np.testing.assert_allclose(expected_js, simd.jensenshannon(a, b), atol=1e-3, rtol=0)
+
+
 @pytest.mark.parametrize("ndim", [3, 97, 1536])
 @pytest.mark.parametrize("dtype", [np.float32, np.float16])
 def test_batch(ndim, dtype):
@@ -175,7 +258,7 @@ def test_batch(ndim, dtype):
 
 
 @pytest.mark.parametrize("ndim", [3, 97, 1536])
-@pytest.mark.parametrize("dtype", [np.float32, np.float16])
+@pytest.mark.parametrize("dtype", [np.float64, np.float32, np.float16])
 @pytest.mark.parametrize("metric", ["cosine"])
 def test_cdist(ndim, dtype, metric):
     """Compares the simd.cdist() function with scipy.spatial.distance.cdist(), measuring the accuracy error for f16, and f32 types using sqeuclidean and cosine metrics."""
@@ -193,3 +276,365 @@ def test_cdist(ndim, dtype, metric):
 
     # Assert they're close.
     np.testing.assert_allclose(expected, result, atol=SIMSIMD_ATOL, rtol=0)
+
+
+@pytest.mark.parametrize("ndim", [3, 97, 1536])
+@pytest.mark.parametrize("dtype", [np.float64, np.float32])
+@pytest.mark.parametrize("scale", [0.1, 1, 1e3])
+def test_cdist_cosine_unnormalized(ndim, dtype, scale):
+    """Compares the simd.cdist() cosine distances, that reuse the norms of every row, with the pairwise kernels
+    on unnormalized inputs. The cached norms come from the inner product kernels, returning `1 - ab` in `f32`,
+    so they are only precise for squared norms of about 0.01 and larger."""
+
+    M, N = 10, 15
+    A = (np.random.randn(M, ndim) * scale).astype(dtype)
+    B = (np.random.randn(N, ndim) * scale).astype(dtype)
+    expected = np.array([[simd.cosine(a, b) for b in B] for a in A])
+
+    np.testing.assert_allclose(expected, simd.cdist(A, B, metric="cosine"), atol=SIMSIMD_ATOL, rtol=0)
+
+
+@pytest.mark.parametrize("ndim", [3, 97, 1536])
+@pytest.mark.parametrize("dtype", [np.float64, np.float32, np.float16])
+@pytest.mark.parametrize("metric", ["kullbackleibler", "jensenshannon"])
+def test_cdist_probability(ndim, dtype, metric):
+    """Compares the simd.cdist() divergences, that reuse the log terms of every row, with the pairwise kernels."""
+
+    M, N = 10, 15
+    A = np.random.rand(M, ndim) + 0.01
+    B = np.random.rand(N, ndim) + 0.01
+    A = (A / np.sum(A, axis=1, keepdims=True)).astype(dtype)
+    B = (B / np.sum(B, axis=1, keepdims=True)).astype(dtype)
+    kernel = getattr(simd, metric)
+    expected = np.array([[kernel(a, b) for b in B] for a in A])
+
+    np.testing.assert_allclose(expected, simd.cdist(A, B, metric=metric), atol=1e-4, rtol=0)
+
+
+@pytest.mark.parametrize("ndim", [3, 97, 1536])
+@pytest.mark.parametrize("dtype", [np.float64, np.float32, np.float16])
+@pytest.mark.parametrize("metric", ["kullbackleibler", "jensenshannon"])
+def test_cdist_probability_self(ndim, dtype, metric):
+    """Checks that the simd.cdist() divergences with cached log terms are zero for identical rows and never negative."""
+
+    A = np.random.rand(10, ndim) + 0.01
+    A = (A / np.sum(A, axis=1, keepdims=True)).astype(dtype)
+    result = np.array(simd.cdist(A, A, metric=metric))
+
+    assert np.all(result >= 0)
+    np.testing.assert_allclose(np.diag(result), 0, atol=1e-7, rtol=0)
+
+
+@pytest.mark.parametrize("ndim", [3, 97, 1536])
+@pytest.mark.parametrize("dtypes", [(np.float32, np.float16), (np.float32, np.int8), (np.float16, np.int8)])
+@pytest.mark.parametrize("metric", ["sqeuclidean", "cosine"])
+def test_cdist_mixed(ndim, dtypes, metric):
+    """Compares the simd.cdist() function on matrices of different types with scipy.spatial.distance.cdist() in `f64`."""
+
+    M, N = 10, 15
+    A = (np.random.randn(M, ndim) * 10).astype(dtypes[0])
+    B = (np.random.randn(N, ndim) * 10).astype(dtypes[1])
+    expected = spd.cdist(A.astype(np.float64), B.astype(np.float64), metric)
+
+    np.testing.assert_allclose(expected, simd.cdist(A, B, metric=metric), atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+    np.testing.assert_allclose(expected.T, simd.cdist(B, A, metric=metric), atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+
+
+@pytest.mark.parametrize("ndim", [3, 7])
+@pytest.mark.parametrize("dtypes", [(np.float32, np.float16), (np.float32, np.int8), (np.float16, np.int8)])
+def test_cdist_mixed_tail(ndim, dtypes):
+    """Checks that the scalar tails of mixed-precision inner products accumulate in `f32`, and not in `f16`."""
+
+    M, N = 4, 5
+    # Products of these values have more significant bits, than a half-precision number can hold
+    A = (1 + np.random.randint(1, 1024, size=(M, ndim)) / 1024 * 31).astype(dtypes[0])
+    B = np.random.randint(-127, 128, size=(N, ndim)).astype(dtypes[1])
+    expected = 1 - A.astype(np.float64) @ B.astype(np.float64).T
+
+    np.testing.assert_allclose(expected, simd.cdist(A, B, metric="inner"), atol=0, rtol=1e-5)
+
+
+@pytest.mark.parametrize("threads", [0, 2, 4])
+def test_cdist_shared_pool(threads):
+    """Checks that multi-threaded simd.cdist() and simd.pdist() calls, that reuse the same worker threads, whether
+    repeated or issued from several Python threads at once, match the single-threaded ones."""
+    from concurrent.futures import ThreadPoolExecutor
+
+    A = np.random.randn(100, 97).astype(np.float32)
+    B = np.random.randn(200, 97).astype(np.float32)
+    expected_cdist = np.array(simd.cdist(A, B, metric="sqeuclidean", threads=1))
+    expected_pdist = np.array(simd.pdist(A, metric="sqeuclidean", threads=1))
+
+    for _ in range(16):
+        np.testing.assert_allclose(expected_cdist, simd.cdist(A, B, metric="sqeuclidean", threads=threads), rtol=1e-6)
+        np.testing.assert_allclose(expected_pdist, simd.pdist(A, metric="sqeuclidean", threads=threads), rtol=1e-6)
+
+    with ThreadPoolExecutor(max_workers=4) as pool:
+        results = list(pool.map(lambda _: simd.cdist(A, B, metric="sqeuclidean", threads=threads), range(16)))
+    for result in results:
+        np.testing.assert_allclose(expected_cdist, result, rtol=1e-6)
+
+
+@pytest.mark.parametrize("ndim", [3, 97, 1536])
+@pytest.mark.parametrize("metric", ["sqeuclidean", "cosine"])
+def test_cdist_i8(ndim, metric):
+    """Compares the simd.cdist() function on `i8` collections larger than a tile, that may run on AMX, with SciPy."""
+
+    M, N = 40, 70
+    A = np.random.randint(-128, 128, size=(M, ndim), dtype=np.int8)
+    B = np.random.randint(-128, 128, size=(N, ndim), dtype=np.int8)
+    expected = spd.cdist(A.astype(np.float64), B.astype(np.float64), metric)
+
+    np.testing.assert_allclose(expected, simd.cdist(A, B, metric=metric), atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+
+
+@pytest.mark.parametrize("ndim", [3, 97, 1536])
+@pytest.mark.parametrize("metric", ["sqeuclidean", "cosine"])
+def test_cdist_out(ndim, metric):
+    """Checks that simd.cdist() and batch metrics write into preallocated `out` buffers of any supported `dtype`."""
+
+    M, N = 10, 15
+    A = np.random.randn(M, ndim).astype(np.float32)
+    B = np.random.randn(N, ndim).astype(np.float32)
+    expected = simd.cdist(A, B, metric=metric)
+
+    out = np.zeros((M, N), dtype=np.float32)
+    assert simd.cdist(A, B, metric=metric, out=out) is out
+    np.testing.assert_allclose(expected, out, atol=0, rtol=0)
+
+    # Non-contiguous outputs, like transposed views, are filled through their strides.
+    out_t = np.zeros((N, M), dtype=np.float32)
+    simd.cdist(A, B, metric=metric, out=out_t.T)
+    np.testing.assert_allclose(expected, out_t.T, atol=0, rtol=0)
+
+    result_f64 = simd.cdist(A, B, metric=metric, dtype="f64")
+    assert result_f64.dtype == np.float64
+    np.testing.assert_allclose(expected, result_f64, atol=SIMSIMD_ATOL, rtol=0)
+    result_f16 = simd.cdist(A, B, metric=metric, dtype="f16")
+    assert result_f16.dtype == np.float16
+    np.testing.assert_allclose(expected, result_f16, atol=1e-2, rtol=1e-2)
+
+    batch_out = np.zeros(M, dtype=np.float64)
+    batch_metric = getattr(simd, metric)
+    assert batch_metric(A, B[:M], out=batch_out) is batch_out
+    np.testing.assert_allclose(np.diag(expected[:, :M]), batch_out, atol=SIMSIMD_ATOL, rtol=0)
+
+    with pytest.raises(ValueError):
+        simd.cdist(A, B, metric=metric, out=np.zeros((N, M), dtype=np.float32))
+    with pytest.raises(ValueError):
+        simd.cdist(A, B, metric=metric, out=np.zeros((M, N), dtype=np.float32), dtype="f64")
+
+
+@pytest.mark.parametrize("ndim", [3, 97, 1536])
+@pytest.mark.parametrize("dtype", [np.float32, np.float16])
+@pytest.mark.parametrize("metric", ["sqeuclidean", "cosine"])
+@pytest.mark.parametrize("threads", [1, 4])
+def test_pdist(ndim, dtype, metric, threads):
+    """Compares the condensed simd.pdist() output, computed in balanced slices of the upper triangle, with SciPy."""
+
+    N = 70
+    A = np.random.randn(N, ndim).astype(dtype)
+    expected = spd.pdist(A.astype(np.float64), metric)
+
+    result = simd.pdist(A, metric=metric, threads=threads)
+    assert result.shape == (N * (N - 1) // 2,)
+    np.testing.assert_allclose(expected, result, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+
+    out = np.zeros(N * (N - 1) // 2, dtype=np.float64)
+    assert simd.pdist(A, metric=metric, out=out) is out
+    np.testing.assert_allclose(expected, out, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+
+    with pytest.raises(ValueError):
+        simd.pdist(A, metric="kullbackleibler")
+
+
+@pytest.mark.parametrize("metric", ["sqeuclidean", "cosine"])
+def test_cdist_concurrent(metric):
+    """Checks that simd.cdist() calls from multiple Python threads, that run without the GIL, match serial ones."""
+    from concurrent.futures import ThreadPoolExecutor
+
+    A = np.random.randn(100, 1536).astype(np.float32)
+    B = np.random.randn(200, 1536).astype(np.float32)
+    expected = simd.cdist(A, B, metric=metric)
+
+    with ThreadPoolExecutor(max_workers=4) as pool:
+        results = list(pool.map(lambda _: simd.cdist(A, B, metric=metric, threads=1), range(8)))
+    for result in results:
+        np.testing.assert_allclose(expected, result, atol=SIMSIMD_ATOL, rtol=0)
+
+
+@pytest.mark.parametrize("ndim", [3, 97, 1536])
+@pytest.mark.parametrize("metric", ["sqeuclidean", "cosine"])
+@pytest.mark.parametrize("threads", [1, 4])
+def test_topk(ndim, metric, threads):
+    """Compares the simd.topk() function with the sorted rows of scipy.spatial.distance.cdist() output."""
+
+    M, N, K = 3, 1000, 10
+    A = np.random.randn(M, ndim).astype(np.float32)
+    B = np.random.randn(N, ndim).astype(np.float32)
+    expected = np.sort(spd.cdist(A, B, metric), axis=1)[:, :K]
+
+    indices, distances = simd.topk(A, B, K, metric=metric, threads=threads)
+    assert indices.shape == (M, K) and distances.shape == (M, K)
+    np.testing.assert_allclose(expected, distances, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+    for i in range(M):
+        np.testing.assert_allclose(simd.cdist(A[i], B[indices[i]], metric=metric), distances[i], atol=1e-5)
+
+    indices, distances = simd.topk(A[0], B, K, metric=metric, threads=threads)
+    assert indices.shape == (K,) and distances.shape == (K,)
+    np.testing.assert_allclose(expected[0], distances, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+
+
+@pytest.mark.parametrize("ndim", [97, 1536, 8191])
+def test_radius(ndim):
+    """Compares the simd.radius() function with a thresholded scipy.spatial.distance.cdist() output."""
+
+    N = 1000
+    a = np.random.randint(2, size=ndim).astype(np.uint8)
+    B = np.random.randint(2, size=(N, ndim)).astype(np.uint8)
+    B[::7] = a  # Some exact duplicates
+    B[1::7, : ndim // 10] ^= 1  # Some near duplicates
+    expected = spd.cdist(a[np.newaxis, :], B, "hamming")[0] * ndim
+    max_distance = ndim // 5
+
+    indices, distances = simd.radius(np.packbits(a), np.packbits(B, axis=1), max_distance)
+    np.testing.assert_array_equal(np.nonzero(expected <= max_distance)[0], indices)
+    np.testing.assert_allclose(expected[indices], distances, atol=0, rtol=SIMSIMD_RTOL)
+
+
+@pytest.mark.skipif(not hasattr(simd, "scan"), reason="SimSIMD was built without the memory-mapped scanner")
+@pytest.mark.parametrize("ndim", [97, 768])
+@pytest.mark.parametrize("dtype", [np.float32, np.float16])
+@pytest.mark.parametrize("threads", [1, 4])
+def test_scan(tmp_path, ndim, dtype, threads):
+    """Compares the simd.scan() function over raw and `.fvecs` files with simd.topk() over the same rows."""
+
+    M, N, K = 3, 5000, 10
+    A = np.random.randn(M, ndim).astype(dtype)
+    B = np.random.randn(N, ndim).astype(dtype)
+    expected_indices, expected_distances = simd.topk(A, B, K)
+
+    raw_path = tmp_path / "rows.bin"
+    B.tofile(raw_path)
+    indices, distances = simd.scan(raw_path, A, K, threads=threads)
+    np.testing.assert_array_equal(expected_indices, indices)
+    np.testing.assert_allclose(expected_distances, distances, rtol=1e-5)
+
+    if dtype == np.float32:
+        vecs_path = tmp_path / "rows.fvecs"
+        headers = np.full((N, 1), ndim, dtype=np.int32).view(np.float32)
+        np.hstack([headers, B]).tofile(vecs_path)
+        indices, distances = simd.scan(str(vecs_path), A[0], K, metric="sqeuclidean", threads=threads)
+        np.testing.assert_array_equal(expected_indices[0], indices)
+
+    with pytest.raises(ValueError):
+        simd.scan(raw_path, A[:, :-1], K)
+
+
+@pytest.mark.parametrize("ndim", [3, 97, 1536])
+@pytest.mark.parametrize("dtype", [np.float32, np.float16])
+@pytest.mark.parametrize("metric", ["sqeuclidean", "cosine"])
+def test_strided(ndim, dtype, metric):
+    """Checks that column slices, transposed views and Fortran-ordered arrays match their contiguous copies."""
+
+    M, N = 10, 1000
+    A = np.random.randn(M, ndim * 2).astype(dtype)[:, ::2]
+    B = np.asfortranarray(np.random.randn(N, ndim).astype(dtype))
+    C = np.random.randn(ndim, M).astype(dtype).T
+    A_copy, B_copy, C_copy = np.ascontiguousarray(A), np.ascontiguousarray(B), np.ascontiguousarray(C)
+
+    np.testing.assert_allclose(simd.cdist(A_copy, B_copy, metric=metric), simd.cdist(A, B, metric=metric), atol=1e-6)
+    np.testing.assert_allclose(simd.cdist(C_copy, A_copy, metric=metric), simd.cdist(C, A, metric=metric), atol=1e-6)
+    batch_metric = getattr(simd, metric)
+    np.testing.assert_allclose(batch_metric(A_copy, C_copy), batch_metric(A, C), atol=1e-6)
+    np.testing.assert_allclose(batch_metric(A_copy[0], B_copy), batch_metric(A[0], B), atol=1e-6)
+    np.testing.assert_allclose(batch_metric(A_copy[0], C_copy[0]), batch_metric(A[0], C[0]), atol=1e-6)
+
+    expected_indices, expected_distances = simd.topk(A_copy, B_copy, 10, metric=metric)
+    indices, distances = simd.topk(A, B, 10, metric=metric)
+    np.testing.assert_array_equal(expected_indices, indices)
+    np.testing.assert_allclose(expected_distances, distances, atol=1e-6)
+
+
+@pytest.mark.parametrize("subspaces", [1, 7, 64, 301])
+@pytest.mark.parametrize("centroids", [256, 16])
+def test_adc(subspaces, centroids):
+    """Compares the simd.adc() function with the sums of lookup table entries, gathered by NumPy."""
+
+    N = 100
+    lut = np.random.rand(subspaces, centroids).astype(np.float32)
+    codes = np.random.randint(centroids, size=(N, subspaces)).astype(np.uint8)
+    expected = lut[np.arange(subspaces), codes].sum(axis=1)
+
+    if centroids == 16:
+        # Two 4-bit codes per byte, with the even subspace in the lower nibble
+        padded = np.zeros((N, subspaces + subspaces % 2), dtype=np.uint8)
+        padded[:, :subspaces] = codes
+        packed = padded[:, 0::2] | (padded[:, 1::2] << 4)
+        step = np.ptp(lut, axis=1).max() / 255
+        result = simd.adc(lut, packed)
+        np.testing.assert_allclose(expected, result, atol=subspaces * step / 2 + SIMSIMD_ATOL, rtol=0)
+        np.testing.assert_allclose(expected[0], simd.adc(lut, packed[0]), atol=subspaces * step / 2 + SIMSIMD_ATOL)
+    else:
+        result = simd.adc(lut, codes)
+        np.testing.assert_allclose(expected, result, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+        np.testing.assert_allclose(expected[0], simd.adc(lut, codes[0]), atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+
+    # The 8-bit codes have a datatype of their own, rather than sharing the binary `b8` kernels
+    assert list(simd.get_kernels()["adc"]) == ["pq8"]
+
+
+@pytest.mark.parametrize("lengths", [(0, 10), (7, 13), (100, 300), (1000, 1000)])
+@pytest.mark.parametrize("dtype", [np.float32, np.float16])
+def test_sparse(lengths, dtype):
+    """Compares the simd.intersect() and simd.sparse_dot() functions on sorted indices with a NumPy intersection."""
+
+    a = np.sort(np.random.choice(2000, size=lengths[0], replace=False)).astype(np.uint32)
+    b = np.sort(np.random.choice(2000, size=lengths[1], replace=False)).astype(np.uint32)
+    a_weights = np.random.rand(lengths[0]).astype(dtype)
+    b_weights = np.random.rand(lengths[1]).astype(dtype)
+    common, a_positions, b_positions = np.intersect1d(a, b, assume_unique=True, return_indices=True)
+    expected = np.dot(a_weights[a_positions].astype(np.float64), b_weights[b_positions].astype(np.float64))
+
+    assert simd.intersect(a, b) == len(common)
+    assert simd.intersect(b, a) == len(common)
+    # Products of `f16` weights must be accumulated in `f32`, as half-precision products lose ~1e-4 of relative accuracy
+    np.testing.assert_allclose(expected, simd.sparse_dot(a, a_weights, b, b_weights), atol=1e-6, rtol=1e-5)
+
+    with pytest.raises(ValueError):
+        simd.intersect(a.astype(np.int64), b)
+    with pytest.raises(ValueError):
+        simd.sparse_dot(a, a_weights[:-1] if lengths[0] else np.ones(1, dtype=dtype), b, b_weights)
+
+
+@pytest.mark.parametrize("ndim", [3, 97, 1536])
+@pytest.mark.parametrize("per_vector", [True, False])
+def test_quantize(ndim, per_vector):
+    """Compares the simd.quantize() conversions of strided `float32` matrices with their NumPy equivalents."""
+
+    X = np.random.randn(20, ndim * 2).astype(np.float32)[:, ::2]
+
+    np.testing.assert_array_equal(simd.quantize(X, "f16"), X.astype(np.float16))
+    np.testing.assert_array_equal(simd.quantize(X, "b8"), np.packbits(X > 0, axis=-1))
+    np.testing.assert_array_equal(simd.quantize(X[0], "b8"), np.packbits(X[0] > 0))
+
+    # Rounding to `bfloat16` keeps the upper half of the `float32` bits, adjusted by at most one
+    bf16 = simd.quantize(X, "bf16")
+    assert bf16.dtype == np.uint16 and bf16.shape == X.shape
+    truncated = (X.view(np.uint32) >> 16).astype(np.int64)
+    assert np.all(np.abs(bf16.astype(np.int64) - truncated) <= 1)
+
+    codes, scales = simd.quantize(X, "i8", per_vector=per_vector)
+    assert codes.dtype == np.int8 and codes.shape == X.shape
+    expected_scales = np.abs(X).max(axis=1) / 127
+    if per_vector:
+        np.testing.assert_allclose(scales, expected_scales, rtol=1e-6)
+        scales = scales[:, np.newaxis]
+    else:
+        np.testing.assert_allclose(scales, expected_scales.max(), rtol=1e-6)
+    assert np.all(np.abs(codes.astype(np.float32) - np.round(X / scales)) <= 1)
+
+    with pytest.raises(ValueError):
+        simd.quantize(X.astype(np.float64), "f16")
+    with pytest.raises(ValueError):
+        simd.quantize(X, "f64")
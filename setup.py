@@ -27,6 +27,10 @@ if sys.platform == "linux":
     compile_args.append("-fopenmp")
     link_args.append("-lgomp")
 
+    # Enable the memory-mapped dataset scanner, which needs POSIX declarations hidden by `-std=c11`
+    macros_args.append(("SIMSIMD_MMAP", "1"))
+    macros_args.append(("_POSIX_C_SOURCE", "200809L"))
+
 if sys.platform == "darwin":
     compile_args.append("-std=c11")
     compile_args.append("-O3")
@@ -35,6 +39,13 @@ if sys.platform == "darwin":
     # Disable warnings
     compile_args.append("-w")
 
+    # Apple Clang ships without OpenMP, so use the POSIX thread pool from the headers
+    macros_args.append(("SIMSIMD_THREAD_POOL", "1"))
+
+    # Enable the memory-mapped dataset scanner, which needs POSIX declarations hidden by `-std=c11`
+    macros_args.append(("SIMSIMD_MMAP", "1"))
+    macros_args.append(("_POSIX_C_SOURCE", "200809L"))
+
 if sys.platform == "win32":
     compile_args.append("/std:c11")
     compile_args.append("/O2")
@@ -44,6 +55,11 @@ if sys.platform == "win32":
     # https://cibuildwheel.readthedocs.io/en/stable/faq/#windows-importerror-dll-load-failed-the-specific-module-could-not-be-found
     compile_args.append("/d2FH4-")
 
+# Count the calls, vectors, and bytes per kernel, that `simsimd.get_counters()` reports, if requested, as the
+# atomic increments on every call contend between threads
+if os.environ.get("SIMSIMD_DISPATCH_COUNTERS", "0") == "1":
+    macros_args.append(("SIMSIMD_DISPATCH_COUNTERS", "1"))
+
 ext_modules = [
     Extension(
         "simsimd",